@@ -43,3 +43,10 @@ Feature: Password Generation
     And the output should contain "5 numbers"
     And the output should contain "3 symbols"
     And the output should contain "max meow length 35"
+
+  Scenario: Stream passwords in bulk mode
+    When I run meowpass with "--count 3"
+    Then the exit code should be 0
+    And the output should contain "Generated 3 passwords"
+    And the output should contain "passwords/sec"
+    And the output should not contain "MOST SECURE PASSWORD MEOW SELECTED"
@@ -0,0 +1,410 @@
+/*
+ * audit.c - Password List Audit
+ * MeowPassword - Cat Name Based Secure Password Generator
+ *
+ * Scores every line of a password list in place: the file is mmap'd,
+ * cut into newline-aligned chunks, and chunks are spread over a
+ * work-stealing pool. Each worker owns a range of chunks, takes from its
+ * front, and when it runs dry steals the back half of another worker's
+ * range. Lines are scored straight out of the mapping, never copied.
+ * In summary mode each worker keeps its own ScoreSummary instead of
+ * writing lines, and the summaries are merged once all workers finish.
+ * With --cache, results are memoized in a sharded cache shared by all
+ * workers, so repeated lines are analyzed once; per-line output caches
+ * scores only, summaries cache the full analysis.
+ *
+ * Copyright (c) 2025 Jeffrey Kunzelman
+ * MIT License
+ */
+
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "meowpass.h"
+
+/* Room for a score column, a tab and a newline around each line */
+#define AUDIT_LINE_OVERHEAD 32
+
+/* State shared by all workers of one audit */
+typedef struct {
+    const char *data;
+    const size_t *bounds;       /* Chunk i is [bounds[i], bounds[i + 1]) */
+    double below;               /* Report threshold (0 = report everything) */
+    ScoreCache *cache;          /* NULL unless --cache */
+    FILE *out;
+    pthread_mutex_t out_lock;
+    bool failed;
+    struct AuditWorker *workers;
+    int nworkers;
+} AuditShared;
+
+/* Per-worker state, padded so neighbours never share a cache line */
+typedef struct AuditWorker {
+    _Alignas(CACHE_LINE_SIZE) pthread_mutex_t lock;
+    long head;                  /* Next chunk this worker will take */
+    long tail;                  /* End of this worker's range */
+    char *buffer;               /* AUDIT_BUFFER_SIZE bytes of pending output */
+    size_t used;
+    AuditStats stats;
+    ScoreSummary *summary;      /* NULL unless summarizing */
+    AuditShared *shared;
+    int index;
+    pthread_t thread;
+} AuditWorker;
+
+static double elapsed_seconds(const struct timespec *start) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)(now.tv_sec - start->tv_sec) +
+           (double)(now.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+/**
+ * Write pending output (and optionally one oversized line) under the
+ * output lock
+ */
+static void flush_output(AuditWorker *worker, const char *extra, size_t extra_len) {
+    AuditShared *shared = worker->shared;
+
+    pthread_mutex_lock(&shared->out_lock);
+    if (!shared->failed) {
+        if (fwrite(worker->buffer, 1, worker->used, shared->out) != worker->used ||
+            (extra_len > 0 && fwrite(extra, 1, extra_len, shared->out) != extra_len)) {
+            shared->failed = true;
+        }
+    }
+    pthread_mutex_unlock(&shared->out_lock);
+    worker->used = 0;
+}
+
+/**
+ * Queue "score<TAB>line" for output
+ */
+static void emit_line(AuditWorker *worker, double score, const char *line, size_t len) {
+    if (worker->used + len + AUDIT_LINE_OVERHEAD > AUDIT_BUFFER_SIZE) {
+        flush_output(worker, NULL, 0);
+    }
+
+    char *dst = &worker->buffer[worker->used];
+    int n = snprintf(dst, AUDIT_LINE_OVERHEAD, "%.2f\t", score);
+    worker->used += (size_t)n;
+
+    if (len + AUDIT_LINE_OVERHEAD > AUDIT_BUFFER_SIZE) {
+        /* Too long to buffer: write the prefix, then the line from the map */
+        flush_output(worker, line, len);
+        worker->buffer[worker->used++] = '\n';
+        return;
+    }
+    memcpy(&worker->buffer[worker->used], line, len);
+    worker->used += len;
+    worker->buffer[worker->used++] = '\n';
+}
+
+/**
+ * Score every line of one chunk
+ */
+static void audit_chunk(AuditWorker *worker, long chunk) {
+    AuditShared *shared = worker->shared;
+    const char *p = shared->data + shared->bounds[chunk];
+    const char *end = shared->data + shared->bounds[chunk + 1];
+
+    while (p < end) {
+        const char *nl = memchr(p, '\n', (size_t)(end - p));
+        const char *line_end = nl ? nl : end;
+        size_t len = (size_t)(line_end - p);
+        if (len > 0 && p[len - 1] == '\r') len--;
+
+        if (len > 0 && worker->summary) {
+            ComplexityResult result;
+            analyze_complexity_cached(shared->cache, p, len, &result);
+            summary_add(worker->summary, p, len, &result, classify_characters(p, len));
+            worker->stats.lines++;
+            if (shared->below <= 0.0 || result.score < shared->below) worker->stats.reported++;
+        } else if (len > 0) {
+            double score = complexity_score_cached(shared->cache, p, len);
+            worker->stats.lines++;
+            if (shared->below <= 0.0 || score < shared->below) {
+                worker->stats.reported++;
+                emit_line(worker, score, p, len);
+            }
+        }
+        p = nl ? nl + 1 : end;
+    }
+}
+
+/**
+ * Take the next chunk from the front of a worker's own range
+ */
+static long take_own(AuditWorker *worker) {
+    long chunk = -1;
+    pthread_mutex_lock(&worker->lock);
+    if (worker->head < worker->tail) chunk = worker->head++;
+    pthread_mutex_unlock(&worker->lock);
+    return chunk;
+}
+
+/**
+ * Move the back half of another worker's range to this worker
+ * @return true if anything was stolen
+ */
+static bool steal(AuditWorker *worker) {
+    AuditShared *shared = worker->shared;
+
+    for (int k = 1; k < shared->nworkers; k++) {
+        AuditWorker *victim = &shared->workers[(worker->index + k) % shared->nworkers];
+        long first = 0, last = 0;
+
+        pthread_mutex_lock(&victim->lock);
+        long remaining = victim->tail - victim->head;
+        if (remaining > 0) {
+            long take = (remaining + 1) / 2;
+            last = victim->tail;
+            first = last - take;
+            victim->tail = first;
+        }
+        pthread_mutex_unlock(&victim->lock);
+
+        if (last > first) {
+            pthread_mutex_lock(&worker->lock);
+            worker->head = first;
+            worker->tail = last;
+            pthread_mutex_unlock(&worker->lock);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Check whether a write has failed (written under the output lock)
+ */
+static bool output_failed(AuditShared *shared) {
+    pthread_mutex_lock(&shared->out_lock);
+    bool failed = shared->failed;
+    pthread_mutex_unlock(&shared->out_lock);
+    return failed;
+}
+
+static void *audit_worker(void *arg) {
+    AuditWorker *worker = arg;
+
+    for (;;) {
+        long chunk = take_own(worker);
+        if (chunk < 0) {
+            if (!steal(worker)) break;
+            continue;
+        }
+        if (output_failed(worker->shared)) break;
+        audit_chunk(worker, chunk);
+    }
+    if (worker->used > 0) flush_output(worker, NULL, 0);
+    return NULL;
+}
+
+/**
+ * Cut [0, size) into chunks of about AUDIT_CHUNK_SIZE ending after a newline
+ * @return Number of chunks (bounds has count + 1 entries), -1 on error
+ */
+static long split_chunks(const char *data, size_t size, size_t **bounds_out) {
+    size_t max_chunks = size / AUDIT_CHUNK_SIZE + 1;
+    size_t *bounds = malloc((max_chunks + 1) * sizeof(size_t));
+    if (!bounds) return -1;
+
+    long count = 0;
+    size_t pos = 0;
+    bounds[0] = 0;
+    while (pos < size) {
+        size_t cut = pos + AUDIT_CHUNK_SIZE;
+        if (cut >= size) {
+            cut = size;
+        } else {
+            const char *nl = memchr(data + cut, '\n', size - cut);
+            cut = nl ? (size_t)(nl - data) + 1 : size;
+        }
+        bounds[++count] = cut;
+        pos = cut;
+    }
+    *bounds_out = bounds;
+    return count;
+}
+
+int audit_file(const char *path, const PasswordConfig *config, FILE *out, AuditStats *stats,
+               ScoreSummary *summary) {
+    memset(stats, 0, sizeof(*stats));
+
+    /* Non-blocking, so a FIFO is rejected below instead of waiting for a writer */
+    int fd = open(path, O_RDONLY | O_NONBLOCK);
+    if (fd < 0) return -1;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+        /* Pipes and devices have no size to map */
+        close(fd);
+        return -1;
+    }
+    size_t size = (size_t)st.st_size;
+    if (size == 0) {
+        close(fd);
+        return 0;
+    }
+
+    const char *data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) return -1;
+    madvise((void *)data, size, MADV_SEQUENTIAL);
+
+    size_t *bounds = NULL;
+    long chunks = split_chunks(data, size, &bounds);
+    if (chunks < 0) {
+        munmap((void *)data, size);
+        return -1;
+    }
+
+    int nthreads = clamp_int(config->threads, MIN_THREADS, MAX_THREADS);
+    if (nthreads > chunks) nthreads = (int)chunks;
+
+    AuditShared shared;
+    shared.data = data;
+    shared.bounds = bounds;
+    shared.below = config->audit_below;
+    shared.cache = NULL;
+    if (config->cache_entries > 0) {
+        shared.cache = score_cache_create((size_t)config->cache_entries);
+        if (!shared.cache) {
+            free(bounds);
+            munmap((void *)data, size);
+            return -1;
+        }
+    }
+    shared.out = out;
+    shared.failed = false;
+    shared.nworkers = nthreads;
+    pthread_mutex_init(&shared.out_lock, NULL);
+
+    AuditWorker *workers = aligned_alloc(CACHE_LINE_SIZE, (size_t)nthreads * sizeof(AuditWorker));
+    shared.workers = workers;
+    int ready = 0;
+    if (workers) {
+        /* Initial even split; stealing evens out lines of uneven cost */
+        for (; ready < nthreads; ready++) {
+            AuditWorker *w = &workers[ready];
+            w->buffer = malloc(AUDIT_BUFFER_SIZE);
+            w->summary = summary ? malloc(sizeof(ScoreSummary)) : NULL;
+            if (!w->buffer || (summary && !w->summary)) {
+                free(w->buffer);
+                free(w->summary);
+                break;
+            }
+            if (summary) summary_init(w->summary);
+            pthread_mutex_init(&w->lock, NULL);
+            w->head = chunks * ready / nthreads;
+            w->tail = chunks * (ready + 1) / nthreads;
+            w->used = 0;
+            memset(&w->stats, 0, sizeof(w->stats));
+            w->shared = &shared;
+            w->index = ready;
+        }
+    }
+
+    stats->threads = nthreads;
+
+    int rc = 0;
+    if (ready < nthreads) {
+        rc = -1;
+    } else if (nthreads == 1) {
+        audit_worker(&workers[0]);
+    } else {
+        int spawned = 0;
+        for (; spawned < nthreads; spawned++) {
+            if (pthread_create(&workers[spawned].thread, NULL, audit_worker, &workers[spawned]) != 0) {
+                break;
+            }
+        }
+        /* Stealing lets this thread drain any share left unspawned */
+        if (spawned < nthreads) audit_worker(&workers[spawned]);
+        for (int i = 0; i < spawned; i++) {
+            pthread_join(workers[i].thread, NULL);
+        }
+    }
+
+    for (int i = 0; i < ready; i++) {
+        stats->lines += workers[i].stats.lines;
+        stats->reported += workers[i].stats.reported;
+        if (summary) {
+            summary_merge(summary, workers[i].summary);
+            /* The weakest entries are copies of input lines */
+            memset(workers[i].summary, 0, sizeof(ScoreSummary));
+            free(workers[i].summary);
+        }
+        pthread_mutex_destroy(&workers[i].lock);
+        /* Pending output holds copies of input lines too */
+        memset(workers[i].buffer, 0, AUDIT_BUFFER_SIZE);
+        free(workers[i].buffer);
+    }
+    free(workers);
+    if (shared.cache) {
+        score_cache_counters(shared.cache, &stats->cache_hits, &stats->cache_misses);
+        score_cache_destroy(shared.cache);
+    }
+    pthread_mutex_destroy(&shared.out_lock);
+    free(bounds);
+    munmap((void *)data, size);
+
+    if (rc == 0 && shared.failed) rc = -1;
+    return rc;
+}
+
+int run_audit(const PasswordConfig *config) {
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    ScoreSummary *summary = NULL;
+    if (config->summary) {
+        summary = malloc(sizeof(ScoreSummary));
+        if (!summary) {
+            fprintf(stderr, "ERROR: Out of memory for audit summary.\n");
+            return 1;
+        }
+        summary_init(summary);
+    }
+
+    AuditStats stats;
+    if (audit_file(config->audit_file, config, stdout, &stats, summary) != 0) {
+        fprintf(stderr, "ERROR: Failed to audit %s (must be a readable regular file).\n",
+                config->audit_file);
+        free(summary);
+        return 1;
+    }
+    if (summary) {
+        summary_print(summary, stdout);
+        memset(summary, 0, sizeof(*summary));
+        free(summary);
+    }
+    if (fflush(stdout) != 0) {
+        fprintf(stderr, "ERROR: Failed to audit %s.\n", config->audit_file);
+        return 1;
+    }
+
+    double seconds = elapsed_seconds(&start);
+    double rate = (seconds > 0.0) ? (double)stats.lines / seconds : 0.0;
+    fprintf(stderr, "Audited %ld lines in %.3f s (%.0f lines/sec, %d thread%s)",
+            stats.lines, seconds, rate, stats.threads, (stats.threads == 1) ? "" : "s");
+    if (config->audit_below > 0.0) {
+        fprintf(stderr, ", %ld below %.2f", stats.reported, config->audit_below);
+    }
+    if (config->cache_entries > 0) {
+        uint64_t lookups = stats.cache_hits + stats.cache_misses;
+        fprintf(stderr, ", cache %llu hits / %llu misses (%.1f%%)",
+                (unsigned long long)stats.cache_hits, (unsigned long long)stats.cache_misses,
+                (lookups > 0) ? 100.0 * (double)stats.cache_hits / (double)lookups : 0.0);
+    }
+    fprintf(stderr, "\n");
+
+    return 0;
+}
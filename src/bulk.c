@@ -0,0 +1,257 @@
+/*
+ * bulk.c - Bulk Streaming Password Generation
+ * MeowPassword - Cat Name Based Secure Password Generator
+ *
+ * Copyright (c) 2025 Jeffrey Kunzelman
+ * MIT License
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include "meowpass.h"
+
+/* A full chunk plus one in-progress password must fit in a slab */
+_Static_assert((size_t)BULK_CHUNK_PASSWORDS * (MAX_LENGTH + 1) + MAX_PASSWORD_LENGTH
+               <= BULK_BUFFER_SIZE, "bulk chunk does not fit in output slab");
+
+/* State shared by all workers of one run */
+typedef struct {
+    const PasswordConfig *config;
+    pthread_mutex_t lock;
+    pthread_cond_t turn;        /* Signalled when next_to_write advances */
+    long next_chunk;            /* Next chunk index to hand out */
+    long next_to_write;         /* Ordered mode: chunk allowed to write */
+    long total_chunks;
+    bool failed;
+} BulkShared;
+
+/* Per-worker state, padded so neighbours never share a cache line */
+typedef struct {
+    _Alignas(CACHE_LINE_SIZE) MeowRng rng;
+    GeneratorState generator;
+    char *slab;                 /* BULK_BUFFER_SIZE bytes, cache-line aligned */
+    ScoreSummary *summary;      /* NULL unless config->summary */
+    BulkShared *shared;
+    pthread_t thread;
+} BulkWorker;
+
+static double elapsed_seconds(const struct timespec *start) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)(now.tv_sec - start->tv_sec) +
+           (double)(now.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+/**
+ * Fill the worker slab with one chunk of passwords
+ * @return Number of bytes written to the slab
+ */
+static size_t fill_chunk(BulkWorker *worker, long chunk) {
+    const PasswordConfig *config = worker->shared->config;
+    long first = chunk * BULK_CHUNK_PASSWORDS;
+    long n = config->count - first;
+    if (n > BULK_CHUNK_PASSWORDS) n = BULK_CHUNK_PASSWORDS;
+
+    size_t used = 0;
+    for (long i = 0; i < n; i++) {
+        /* Generate straight into the slab, no intermediate copy */
+        char *slot = &worker->slab[used];
+        generate_password_r(config, &worker->generator, slot, MAX_PASSWORD_LENGTH);
+        size_t len = strlen(slot);
+        if (worker->summary) {
+            ComplexityResult result;
+            analyze_complexity_len(slot, len, &result);
+            summary_add(worker->summary, slot, len, &result, classify_characters(slot, len));
+        }
+        used += len;
+        worker->slab[used++] = '\n';
+    }
+    return used;
+}
+
+static void *bulk_worker(void *arg) {
+    BulkWorker *worker = arg;
+    BulkShared *shared = worker->shared;
+
+    for (;;) {
+        pthread_mutex_lock(&shared->lock);
+        long chunk = shared->next_chunk;
+        if (shared->failed || chunk >= shared->total_chunks) {
+            pthread_mutex_unlock(&shared->lock);
+            break;
+        }
+        shared->next_chunk++;
+        pthread_mutex_unlock(&shared->lock);
+
+        size_t used = fill_chunk(worker, chunk);
+
+        pthread_mutex_lock(&shared->lock);
+        if (!shared->config->unordered) {
+            while (shared->next_to_write != chunk && !shared->failed) {
+                pthread_cond_wait(&shared->turn, &shared->lock);
+            }
+        }
+        if (!shared->failed && fwrite(worker->slab, 1, used, stdout) != used) {
+            shared->failed = true;
+        }
+        shared->next_to_write++;
+        pthread_cond_broadcast(&shared->turn);
+        pthread_mutex_unlock(&shared->lock);
+    }
+
+    return NULL;
+}
+
+/**
+ * Wipe and free a worker slab; it holds generated passwords
+ */
+static void free_slab(char *slab) {
+    memset(slab, 0, BULK_BUFFER_SIZE);
+    free(slab);
+}
+
+/**
+ * Wipe a worker's generator: the ChaCha20 key and unused keystream, and
+ * the scoring state holding the last password
+ */
+static void wipe_generator(BulkWorker *worker) {
+    memset(&worker->rng, 0, sizeof(worker->rng));
+    memset(&worker->generator, 0, sizeof(worker->generator));
+}
+
+static int worker_init(BulkWorker *worker, BulkShared *shared) {
+    worker->shared = shared;
+    worker->summary = NULL;
+    if (rng_init(&worker->rng) != 0) return -1;
+    worker->slab = aligned_alloc(CACHE_LINE_SIZE, BULK_BUFFER_SIZE);
+    if (!worker->slab) {
+        wipe_generator(worker);
+        return -1;
+    }
+    if (shared->config->summary) {
+        worker->summary = malloc(sizeof(ScoreSummary));
+        if (!worker->summary) {
+            free_slab(worker->slab);
+            wipe_generator(worker);
+            return -1;
+        }
+        summary_init(worker->summary);
+    }
+    if (generator_init(&worker->generator, &worker->rng) != 0) {
+        free(worker->summary);
+        free_slab(worker->slab);
+        wipe_generator(worker);
+        return -1;
+    }
+    return 0;
+}
+
+static void worker_free(BulkWorker *worker) {
+    generator_free(&worker->generator);
+    if (worker->summary) {
+        /* The weakest entries are generated passwords */
+        memset(worker->summary, 0, sizeof(ScoreSummary));
+        free(worker->summary);
+    }
+    free_slab(worker->slab);
+    wipe_generator(worker);
+}
+
+int run_bulk(const PasswordConfig *config) {
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    BulkShared shared;
+    shared.config = config;
+    shared.next_chunk = 0;
+    shared.next_to_write = 0;
+    shared.total_chunks = (config->count + BULK_CHUNK_PASSWORDS - 1) / BULK_CHUNK_PASSWORDS;
+    shared.failed = false;
+    pthread_mutex_init(&shared.lock, NULL);
+    pthread_cond_init(&shared.turn, NULL);
+
+    int nthreads = clamp_int(config->threads, MIN_THREADS, MAX_THREADS);
+    if (nthreads > shared.total_chunks) nthreads = (int)shared.total_chunks;
+    if (nthreads < MIN_THREADS) nthreads = MIN_THREADS;
+
+    BulkWorker *workers = aligned_alloc(CACHE_LINE_SIZE, (size_t)nthreads * sizeof(BulkWorker));
+    if (!workers) {
+        fprintf(stderr, "ERROR: Out of memory for bulk workers.\n");
+        return 1;
+    }
+
+    /* Every worker gets its own independently seeded generator */
+    int started = 0;
+    for (; started < nthreads; started++) {
+        if (worker_init(&workers[started], &shared) != 0) break;
+    }
+
+    int rc = 0;
+    if (started < nthreads) {
+        fprintf(stderr, "ERROR: Unable to set up bulk workers.\n");
+        rc = 1;
+    } else if (nthreads == 1) {
+        bulk_worker(&workers[0]);
+    } else {
+        int spawned = 0;
+        for (; spawned < nthreads; spawned++) {
+            if (pthread_create(&workers[spawned].thread, NULL, bulk_worker, &workers[spawned]) != 0) {
+                break;
+            }
+        }
+        /* Run the remaining share on this thread if a spawn failed */
+        if (spawned < nthreads) bulk_worker(&workers[spawned]);
+        for (int i = 0; i < spawned; i++) {
+            pthread_join(workers[i].thread, NULL);
+        }
+    }
+
+    /* Per-worker summaries are merged once all workers are done */
+    ScoreSummary *summary = NULL;
+    if (rc == 0 && config->summary) {
+        summary = malloc(sizeof(ScoreSummary));
+        if (summary) {
+            summary_init(summary);
+            for (int i = 0; i < nthreads; i++) {
+                summary_merge(summary, workers[i].summary);
+            }
+        }
+    }
+
+    for (int i = 0; i < started; i++) {
+        worker_free(&workers[i]);
+    }
+    free(workers);
+    pthread_cond_destroy(&shared.turn);
+    pthread_mutex_destroy(&shared.lock);
+
+    if (rc != 0) return rc;
+
+    if (shared.failed || fflush(stdout) != 0) {
+        fprintf(stderr, "ERROR: Failed to write bulk output.\n");
+        free(summary);
+        return 1;
+    }
+
+    double seconds = elapsed_seconds(&start);
+    double rate = (seconds > 0.0) ? (double)config->count / seconds : 0.0;
+    fprintf(stderr, "Generated %ld passwords in %.3f s (%.0f passwords/sec, %d thread%s)\n",
+            config->count, seconds, rate, nthreads, (nthreads == 1) ? "" : "s");
+
+    /* Stdout carries the passwords, so the summary goes to stderr */
+    if (config->summary) {
+        if (!summary) {
+            fprintf(stderr, "ERROR: Out of memory for bulk summary.\n");
+            return 1;
+        }
+        summary_print(summary, stderr);
+        memset(summary, 0, sizeof(*summary));
+        free(summary);
+    }
+
+    return 0;
+}
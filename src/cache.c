@@ -0,0 +1,259 @@
+/*
+ * cache.c - Memoized Complexity Scoring
+ * MeowPassword - Cat Name Based Secure Password Generator
+ *
+ * A fixed-size cache of ComplexityResults for duplicate-heavy inputs such
+ * as leaked password lists. Entries are spread over CACHE_SHARDS shards,
+ * each with its own lock, by a 64-bit hash of the password; within a shard
+ * the hash picks a set of CACHE_WAYS entries, and a full set evicts its
+ * least recently used entry. Keys are stored in full and compared on every
+ * hit, so a hash collision can never return another password's result.
+ * Evicted and freed keys are wiped. Keys are capped at CACHE_KEY_MAX bytes
+ * to keep entries small; longer passwords are always analyzed afresh.
+ * Score-only lookups (the per-line audit) store just the score; a full
+ * lookup treats such an entry as a miss and replaces it with the full
+ * analysis, so callers that only rank never pay for the guess estimate.
+ *
+ * Copyright (c) 2025 Jeffrey Kunzelman
+ * MIT License
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+#include "meowpass.h"
+
+/* One cached password and its analysis, two cache lines */
+typedef struct {
+    uint64_t hash;
+    uint64_t stamp;             /* Shard clock at last use (0 = empty) */
+    ComplexityResult result;    /* Only score and length unless full */
+    unsigned char len;
+    bool full;
+    char text[CACHE_KEY_MAX];
+} CacheEntry;
+
+_Static_assert(sizeof(CacheEntry) == 2 * CACHE_LINE_SIZE, "cache entry should span two lines");
+
+/* Shards are padded so their locks and counters never share a line */
+typedef struct {
+    _Alignas(CACHE_LINE_SIZE) pthread_mutex_t lock;
+    CacheEntry *entries;        /* sets * CACHE_WAYS entries */
+    uint64_t clock;
+    uint64_t hits;
+    uint64_t misses;
+} CacheShard;
+
+struct ScoreCache {
+    CacheShard shards[CACHE_SHARDS];
+    size_t sets;                /* Sets per shard */
+};
+
+/**
+ * Fast 64-bit hash, eight bytes per step
+ */
+static uint64_t hash_password(const char *str, size_t len) {
+    uint64_t h = 0x9E3779B97F4A7C15ull ^ (uint64_t)len;
+    size_t i = 0;
+    for (; i + 8 <= len; i += 8) {
+        uint64_t w;
+        memcpy(&w, &str[i], 8);
+        h = (h ^ w) * 0xFF51AFD7ED558CCDull;
+        h ^= h >> 32;
+    }
+    uint64_t tail = 0;
+    memcpy(&tail, &str[i], len - i);
+    h = (h ^ tail) * 0xC4CEB9FE1A85EC53ull;
+    h ^= h >> 29;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 32;
+    return h;
+}
+
+ScoreCache *score_cache_create(size_t entries) {
+    ScoreCache *cache = aligned_alloc(CACHE_LINE_SIZE, sizeof(ScoreCache));
+    if (!cache) return NULL;
+
+    size_t sets = entries / ((size_t)CACHE_SHARDS * CACHE_WAYS);
+    cache->sets = (sets > 0) ? sets : 1;
+
+    for (int s = 0; s < CACHE_SHARDS; s++) {
+        CacheShard *shard = &cache->shards[s];
+        size_t bytes = cache->sets * CACHE_WAYS * sizeof(CacheEntry);
+        shard->entries = aligned_alloc(CACHE_LINE_SIZE, bytes);
+        if (!shard->entries) {
+            for (int k = 0; k < s; k++) {
+                free(cache->shards[k].entries);
+                pthread_mutex_destroy(&cache->shards[k].lock);
+            }
+            free(cache);
+            return NULL;
+        }
+        memset(shard->entries, 0, bytes);
+        pthread_mutex_init(&shard->lock, NULL);
+        shard->clock = 0;
+        shard->hits = 0;
+        shard->misses = 0;
+    }
+    return cache;
+}
+
+void score_cache_destroy(ScoreCache *cache) {
+    if (!cache) return;
+    for (int s = 0; s < CACHE_SHARDS; s++) {
+        CacheShard *shard = &cache->shards[s];
+        memset(shard->entries, 0, cache->sets * CACHE_WAYS * sizeof(CacheEntry));
+        free(shard->entries);
+        pthread_mutex_destroy(&shard->lock);
+    }
+    free(cache);
+}
+
+/**
+ * Shard and first entry of the set a hash maps to
+ */
+static CacheEntry *cache_set(ScoreCache *cache, uint64_t hash, CacheShard **shard) {
+    *shard = &cache->shards[hash & (CACHE_SHARDS - 1)];
+    /* High bits pick the set, independent of the shard bits */
+    size_t set = (size_t)(((hash >> 32) * (uint64_t)cache->sets) >> 32);
+    return &(*shard)->entries[set * CACHE_WAYS];
+}
+
+static bool cache_lookup_hashed(ScoreCache *cache, uint64_t hash, const char *str, size_t len,
+                                bool need_full, ComplexityResult *result) {
+    CacheShard *shard;
+    CacheEntry *set = cache_set(cache, hash, &shard);
+    bool found = false;
+
+    pthread_mutex_lock(&shard->lock);
+    for (int w = 0; w < CACHE_WAYS; w++) {
+        CacheEntry *e = &set[w];
+        if (e->stamp != 0 && e->hash == hash && e->len == len && memcmp(e->text, str, len) == 0) {
+            if (e->full || !need_full) {
+                e->stamp = ++shard->clock;
+                *result = e->result;
+                found = true;
+            }
+            break;
+        }
+    }
+    if (found) shard->hits++;
+    else shard->misses++;
+    pthread_mutex_unlock(&shard->lock);
+    return found;
+}
+
+static void cache_store_hashed(ScoreCache *cache, uint64_t hash, const char *str, size_t len,
+                               const ComplexityResult *result, bool full) {
+    CacheShard *shard;
+    CacheEntry *set = cache_set(cache, hash, &shard);
+
+    pthread_mutex_lock(&shard->lock);
+    CacheEntry *victim = &set[0];
+    for (int w = 0; w < CACHE_WAYS; w++) {
+        CacheEntry *e = &set[w];
+        /* Another thread may have stored it since our miss */
+        if (e->stamp != 0 && e->hash == hash && e->len == len && memcmp(e->text, str, len) == 0) {
+            victim = e;
+            break;
+        }
+        if (e->stamp < victim->stamp) victim = e;
+    }
+    if (victim->stamp != 0 && victim->full && !full && victim->hash == hash &&
+        victim->len == len && memcmp(victim->text, str, len) == 0) {
+        /* Never replace a full analysis with a bare score */
+        victim->stamp = ++shard->clock;
+        pthread_mutex_unlock(&shard->lock);
+        return;
+    }
+    memset(victim->text, 0, sizeof(victim->text));
+    memcpy(victim->text, str, len);
+    victim->len = (unsigned char)len;
+    victim->hash = hash;
+    victim->result = *result;
+    victim->full = full;
+    victim->stamp = ++shard->clock;
+    pthread_mutex_unlock(&shard->lock);
+}
+
+bool score_cache_lookup(ScoreCache *cache, const char *str, size_t len, ComplexityResult *result) {
+    if (len > CACHE_KEY_MAX) return false;
+    return cache_lookup_hashed(cache, hash_password(str, len), str, len, true, result);
+}
+
+void score_cache_store(ScoreCache *cache, const char *str, size_t len, const ComplexityResult *result) {
+    if (len > CACHE_KEY_MAX) return;
+    cache_store_hashed(cache, hash_password(str, len), str, len, result, true);
+}
+
+void score_cache_counters(ScoreCache *cache, uint64_t *hits, uint64_t *misses) {
+    uint64_t h = 0, m = 0;
+    for (int s = 0; s < CACHE_SHARDS; s++) {
+        CacheShard *shard = &cache->shards[s];
+        pthread_mutex_lock(&shard->lock);
+        h += shard->hits;
+        m += shard->misses;
+        pthread_mutex_unlock(&shard->lock);
+    }
+    if (hits) *hits = h;
+    if (misses) *misses = m;
+}
+
+void analyze_complexity_cached(ScoreCache *cache, const char *str, size_t len, ComplexityResult *result) {
+    if (!cache || len > CACHE_KEY_MAX) {
+        analyze_complexity_len(str, len, result);
+        return;
+    }
+    uint64_t hash = hash_password(str, len);
+    if (cache_lookup_hashed(cache, hash, str, len, true, result)) return;
+    analyze_complexity_len(str, len, result);
+    cache_store_hashed(cache, hash, str, len, result, true);
+}
+
+double complexity_score_cached(ScoreCache *cache, const char *str, size_t len) {
+    double score = 0.0;
+    if (!cache || len > CACHE_KEY_MAX) {
+        complexity_score_above(str, len, -INFINITY, &score);
+        return score;
+    }
+    uint64_t hash = hash_password(str, len);
+    ComplexityResult result;
+    if (cache_lookup_hashed(cache, hash, str, len, false, &result)) return result.score;
+    complexity_score_above(str, len, -INFINITY, &score);
+    memset(&result, 0, sizeof(result));
+    result.score = score;
+    result.length = (int)len;
+    cache_store_hashed(cache, hash, str, len, &result, false);
+    return score;
+}
+
+void analyze_complexity_batch_cached(ScoreCache *cache, const char *const *passwords,
+                                     const size_t *lengths, size_t count,
+                                     const ComplexityBatch *out) {
+    if (!cache) {
+        analyze_complexity_batch(passwords, lengths, count, out);
+        return;
+    }
+    /* Score and length alone never need the full analysis */
+    bool need_full = out->entropy || out->compression_ratio || out->pattern_complexity ||
+                     out->character_diversity || out->guesses_log2;
+    for (size_t i = 0; i < count; i++) {
+        const char *pw = passwords[i];
+        size_t len = pw ? (lengths ? lengths[i] : strlen(pw)) : 0;
+        if (!need_full) {
+            if (out->score) out->score[i] = complexity_score_cached(cache, pw ? pw : "", len);
+            if (out->length) out->length[i] = (int)len;
+            continue;
+        }
+        ComplexityResult result;
+        analyze_complexity_cached(cache, pw ? pw : "", len, &result);
+        if (out->score) out->score[i] = result.score;
+        if (out->entropy) out->entropy[i] = result.entropy;
+        if (out->compression_ratio) out->compression_ratio[i] = result.compression_ratio;
+        if (out->pattern_complexity) out->pattern_complexity[i] = result.pattern_complexity;
+        if (out->character_diversity) out->character_diversity[i] = result.character_diversity;
+        if (out->length) out->length[i] = result.length;
+        if (out->guesses_log2) out->guesses_log2[i] = result.guesses_log2;
+    }
+}
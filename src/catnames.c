@@ -1,16936 +1,40 @@
 /*
  * catnames.c - Embedded Cat Names Data
- * Generated from MeowPassword Swift source
+ * Tables are generated at build time from data/catnames.txt
  *
  * Copyright (c) 2025 Jeffrey Kunzelman
  * MIT License
  */
 
 #include "meowpass.h"
+#include "catnames_data.h"
 
-/* Array of embedded cat names */
-static const char *cat_names[] = {
-    "Aaargh",
-    "Aaliyah",
-    "Aaron",
-    "Ab",
-    "Ababa",
-    "Abba",
-    "Abba-daba",
-    "Abba-Goo",
-    "Abbey",
-    "Abbey Roads",
-    "Abbi-girl",
-    "Abbie",
-    "Abbot",
-    "Abbott",
-    "Abby",
-    "Abby-girl",
-    "Abby-normal",
-    "Abbykitty",
-    "Abcat",
-    "Abdul",
-    "Abe",
-    "Abednego",
-    "Abegale",
-    "Abel",
-    "Abelard",
-    "Abendigo",
-    "Abercrombie",
-    "Aberdeen",
-    "Abi",
-    "Abigail",
-    "Abigail Von Buttons",
-    "Abilene",
-    "Able",
-    "Abner",
-    "Abra",
-    "Abra (and Cadabra?)",
-    "Abracadabra",
-    "Abraham",
-    "Abraxas",
-    "Abrico",
-    "Abs",
-    "Absinthe",
-    "Absolon (from Chaucer's \\",
-    "Absolut (named after the Swedish vodka)",
-    "Abstraction",
-    "Abu",
-    "Abubu",
-    "Aby",
-    "Abyss",
-    "Acat",
-    "Ace",
-    "Ace Baby Toadflakes",
-    "Ace Of Spades",
-    "Acey",
-    "Achille",
-    "Achilles (Greek mythology: Champion of the Greeks in the Trojan War)",
-    "Acis",
-    "Ackerly",
-    "Acorn",
-    "Acrolina",
-    "Acroy",
-    "Action",
-    "Ada",
-    "Ada Jane",
-    "Adacat",
-    "Adagio",
-    "Adakin Skywalker",
-    "Adam",
-    "Adam And Eve",
-    "Adams",
-    "Adcom",
-    "Addie",
-    "Addis",
-    "Addison",
-    "Addy",
-    "Addy-Tood",
-    "Adelaida",
-    "Adelaide",
-    "Ademma",
-    "Adidas",
-    "Adirondak",
-    "Adiza",
-    "Adlai",
-    "Adler",
-    "Admetus",
-    "Admiral",
-    "Adobe",
-    "Adolph",
-    "Adom",
-    "Adonis",
-    "Adrian",
-    "Adriatic",
-    "Adrock",
-    "Advance Cat",
-    "Aegyptos",
-    "Aelgifa (The Elven Gift - Old English)",
-    "Aelurus (Egyptian mythology, sacred cat)",
-    "Aenias",
-    "Aeolus (Greek God of the Wind)",
-    "Aerope",
-    "Aeros",
-    "Aesop",
-    "Aethelwyn",
-    "Aethra",
-    "Affinity",
-    "Afikoman",
-    "Afonia",
-    "Africa",
-    "African Queen",
-    "African-Americat",
-    "Afrikan",
-    "Afrikat",
-    "Agadore",
-    "Agamemnon",
-    "Agape (from the New Testament meaning unconditional love)",
-    "Agassi",
-    "Agatha",
-    "Agatha Christie",
-    "Agatha Christy",
-    "Agent Z",
-    "Aggedor",
-    "Aggie",
-    "Agili-tree",
-    "Agility",
-    "Agima",
-    "Agitador (Spanish for \\",
-    "Agnes",
-    "Agrippina",
-    "Agustus",
-    "Ah Kinchil (Maya mythology: the sun god)",
-    "Ah Puch (Maya mythology: the god of death)",
-    "Ah-choo!",
-    "Ahab",
-    "Ahau Chamahez (Maya mythology: one of two gods of medicine)",
-    "Ahi",
-    "Ahlia",
-    "Ahmakiq (Maya mythology: god of agriculture)",
-    "Ahura Mazda",
-    "Aida",
-    "Aidan",
-    "Aiiy",
-    "Aikido",
-    "Aiko",
-    "Aimee",
-    "Air",
-    "Air Einstein",
-    "Air Raid",
-    "Airhead",
-    "AJ",
-    "Aja",
-    "Ajah (priesthood in fantasy games)",
-    "Ajax",
-    "Akaia",
-    "Akamai (Hawaiian for \\",
-    "Akasha",
-    "Akasha (character in Anne Rice's vampire chronicles)",
-    "Akasha (Queen Mother Vampire from Anne Rice's \\",
-    "Akbar",
-    "Akeel",
-    "Akeel The One Eyed",
-    "Akeela",
-    "Akeem",
-    "Akeisha",
-    "Aker (Egyptian mythology: the lion who guards the gates of dawn)",
-    "Akhen",
-    "Akhushtal (Maya mythology: goddess of childbirth)",
-    "Aki",
-    "Akim",
-    "Akira",
-    "Akita (Japanese breed of dog)",
-    "Aktil (after the mouse in \\",
-    "Aku",
-    "Akula",
-    "Akuna",
-    "Al",
-    "Al Bundy",
-    "Al Capone",
-    "Al Pacino (after the actor)",
-    "Alabama",
-    "Alabaster",
-    "Aladara",
-    "Aladdin",
-    "Alakazam!",
-    "Alan",
-    "Alani",
-    "Alanna",
-    "Alaska",
-    "Alastair",
-    "Albatross",
-    "Albee (after the playwright Edward Albee)",
-    "Albert",
-    "Albert Einstein",
-    "Albert Oscelish Loudpurr",
-    "Alberta",
-    "Alberto",
-    "Albie-Capone",
-    "Albrecht",
-    "Alcatraz",
-    "Alchemy",
-    "Alcuin",
-    "Aldebaran",
-    "Aldo",
-    "Aldo Scalicki",
-    "Aldous (after the British author, Aldous Huxley)",
-    "Alecia",
-    "Alegra",
-    "Alegria Noah",
-    "Aleister",
-    "Aleksandra",
-    "Aleksei",
-    "Aleta",
-    "Alex",
-    "Alex P. Kitten",
-    "Alexa",
-    "Alexander",
-    "Alexander Blitzen Cody",
-    "Alexander Blue",
-    "Alexander-The-Great",
-    "Alexandra",
-    "Alexandra The Great",
-    "Alexandra The Grey",
-    "Alexandria",
-    "Alexandroupolis",
-    "Alexia",
-    "Alexis",
-    "Alf",
-    "Alfa Skywalker",
-    "Alfalfa",
-    "Alfanzo",
-    "Alfie",
-    "Alfie Moon (after the character in the \\",
-    "Alfiepet",
-    "Alfonzo",
-    "Alfred",
-    "Alfred \\",
-    "Alfreda",
-    "Algebra",
-    "Alger",
-    "Algernon",
-    "Algy",
-    "Ali",
-    "Ali Baba",
-    "Ali Kat",
-    "Ali Khat",
-    "Alia",
-    "Alibi",
-    "Alice",
-    "Alice B. Toe-Claws",
-    "Alice B. Toklas",
-    "Alien",
-    "Alika",
-    "Aliki",
-    "Alimony",
-    "Alina",
-    "Alise",
-    "Alistair",
-    "Alistair Jones",
-    "Alix",
-    "Aliza",
-    "Alize",
-    "All This and Heaven Too",
-    "Alla",
-    "Alladin",
-    "Allan",
-    "Allball",
-    "Allegra",
-    "Allegro",
-    "Allergen",
-    "Alley",
-    "Alley McClaw",
-    "Allie",
-    "Allie Cat",
-    "Allie Marie",
-    "Allison",
-    "Allison Jo",
-    "Allred",
-    "Allspice",
-    "Allura",
-    "Ally",
-    "Alma (Spanish for soul)",
-    "Almanzo",
-    "Almond Roca",
-    "Almost Paradise (song \\",
-    "Aloha",
-    "Aloka",
-    "Alokee",
-    "Alomar",
-    "Alonzo",
-    "Alouiscious",
-    "Alowicious",
-    "Aloysius",
-    "Alpaca",
-    "Alpha",
-    "Alphie",
-    "Alpine",
-    "Alsatia",
-    "Althea",
-    "Alton",
-    "Aluminum",
-    "Alvin",
-    "Alwix",
-    "Alyssa",
-    "Alyx",
-    "Am-fats",
-    "Ama",
-    "Amable",
-    "Amadaeus",
-    "Amadala",
-    "Amadeus",
-    "Amadeus (after Mozart)",
-    "Amalthea",
-    "Amanda",
-    "Amandalina",
-    "Amanita",
-    "Amaretto",
-    "Amazing Grace",
-    "Amazon",
-    "Amba",
-    "Ambar",
-    "Ambassador",
-    "Amber",
-    "Amberwavesoffur",
-    "Ambidextrous",
-    "Ambiguity",
-    "Ambiguous Eunuch FarFromScrewin",
-    "Amble",
-    "Ambriel (Zodiac, guardian angel of Gemini)",
-    "Ambrose",
-    "Ambrose Ambrogo",
-    "Ambrose Bugger-Boo Pendragon",
-    "Ambrosia",
-    "Ambrosia Jean Marie",
-    "Ambrosious",
-    "Ambush",
-    "Amby",
-    "Amby (one of the feminine forms of Ambrose)",
-    "Amelia",
-    "Amelia Air-Cat",
-    "Amelia Earhart",
-    "Amelie (after the movie)",
-    "Amen-Ra",
-    "Amenhotep",
-    "America",
-    "American Pie",
-    "Americat",
-    "Amerito",
-    "Amethyst",
-    "Ami",
-    "Amida",
-    "Amidala",
-    "Amie",
-    "Amiga",
-    "Amigo",
-    "Amir",
-    "Amira (Female Arabian name, meaning \\",
-    "Ammie",
-    "Ammo",
-    "Amon",
-    "Amor (Spanish for \\",
-    "Amore",
-    "Amos",
-    "Amour (French for \\",
-    "Ampersand",
-    "Amphion",
-    "Amsterdam",
-    "Amtrak",
-    "Amulet",
-    "Amway",
-    "Amy",
-    "Amy Budd",
-    "Amydala",
-    "Ana",
-    "Ana-Hata",
-    "Anaakii (Japanese for \\",
-    "Anabel",
-    "Anabell",
-    "Anabelle",
-    "Anacharsis",
-    "Anaconda",
-    "Anais",
-    "Anakin",
-    "Anamokit (Indian for \\",
-    "Anastasia",
-    "Anastasia (after the Russian princess)",
-    "Anatevka",
-    "Anatole",
-    "Anatolius",
-    "Anatoly",
-    "Anchor",
-    "Anchors Away",
-    "Anchovey",
-    "Anchovy",
-    "Ancona",
-    "Andaconda",
-    "Andalusia",
-    "Anderson",
-    "Andi",
-    "Andie",
-    "Andilay, Andilay!",
-    "Andorra",
-    "Andouille (after the spicy Cajun sausage)",
-    "Andre",
-    "Andrea",
-    "Andrea Majorie",
-    "Andreas",
-    "Andrew",
-    "Andrew Elliott James David",
-    "Andrew Jackson",
-    "Android",
-    "Andromeda",
-    "Andy",
-    "Andy Rooney",
-    "Anfurnee",
-    "Angel",
-    "Angel Boy",
-    "Angel Cookie",
-    "Angel Eyes",
-    "Angel Marie",
-    "Angela",
-    "Angelee",
-    "Angelface",
-    "Angelica",
-    "Angelika",
-    "Angelika (after Angelika Foster-Gooding)",
-    "Angelina",
-    "Angeline",
-    "Angelo",
-    "Angelo Jo",
-    "Angie",
-    "Angstrom",
-    "Angus",
-    "Angus MacDoogal",
-    "Angus MacGuyver",
-    "Angus Pangus",
-    "Angus Suzy-Socks",
-    "Angy Poo",
-    "Ani",
-    "Ani Difranco",
-    "Anika",
-    "Anikki",
-    "Animal",
-    "Animophat",
-    "Anina",
-    "Anishka",
-    "Anita Blake (after the Laurel K. Hamilton novels)",
-    "Anitra",
-    "Ankelfraeseren",
-    "Ankle Biter",
-    "Ankle Dancer",
-    "Ann",
-    "Ann Jelly",
-    "Ann-Margaret",
-    "Anna",
-    "Anna-lynn",
-    "Annabel",
-    "Annabelle",
-    "Annakin (after Annakin Skywalker in the Star Wars movies)",
-    "Annapolis",
-    "Annapurna",
-    "Annelee",
-    "Annette",
-    "Annible",
-    "Annie",
-    "Annie Banannie",
-    "Annie Marie",
-    "Annie Pearl",
-    "Anniey",
-    "Anonka",
-    "Anonymous",
-    "Anouk (after Anouk Aimee)",
-    "Anouk Manouk",
-    "Anowa",
-    "Ansel",
-    "Ansel Adams",
-    "Ansel Catams",
-    "Antar (after a character in Arabic literature known for his bravery)",
-    "Antarctica",
-    "Antares",
-    "Antelope",
-    "Antha",
-    "Anthea",
-    "Anthem",
-    "Anthony",
-    "Anthrax P.H. (Poo Head) Zeppelin",
-    "Antic",
-    "Antigone",
-    "Anton",
-    "Anton B. Stanton",
-    "Antonia",
-    "Antonio",
-    "Antonio Banderas",
-    "Antony",
-    "Antony And Cleopatra",
-    "Antos",
-    "Antryg",
-    "Anubis",
-    "Anxiety",
-    "Anya",
-    "Apache",
-    "Aphrodisia",
-    "Aphrodite",
-    "Aphrodite, The Kitten Of Love",
-    "Apie",
-    "Apocalypse",
-    "Apocalypse Now",
-    "Apogee",
-    "Apollo",
-    "Apollo (the mythological god of light and truth)",
-    "Apollonia",
-    "Apothecary",
-    "Applaton",
-    "Apple",
-    "Apple Dog",
-    "Apple Pie",
-    "Applejack",
-    "Applesauce",
-    "Appleton",
-    "Appollinia",
-    "Apprentice",
-    "Appy",
-    "Apri",
-    "Apricot",
-    "April",
-    "Aptos",
-    "Apu",
-    "Aput",
-    "Apuu",
-    "Aqua",
-    "Aqua Girl",
-    "Aquarius",
-    "Ar-too",
-    "Arachne",
-    "Aragorn",
-    "Araine",
-    "Aramer",
-    "Aramis (one of the three muskateers)",
-    "Arapaho",
-    "Arbitration",
-    "Arbuckle (after the silent film comedian)",
-    "Arbutis",
-    "Arby",
-    "Archibald",
-    "Archie",
-    "Archie Bunker",
-    "Archima",
-    "Archimedes",
-    "Ardal",
-    "Area 51",
-    "Arejay Joseph (Arejay from the band Halestorm)",
-    "Arendal",
-    "Ares",
-    "Arf",
-    "Arfie",
-    "Arfur",
-    "Argent",
-    "Argo",
-    "Argon",
-    "Argos",
-    "Argus",
-    "Argyle",
-    "Ari",
-    "Aria",
-    "Ariadne (Greek mythology, daughter of King Minos of Crete)",
-    "Ariel",
-    "Ariel (from the movie \\",
-    "Ariela (Hebrew for \\",
-    "Arielle",
-    "Aries",
-    "Arietty",
-    "Arioch",
-    "Arista Kat",
-    "AristoCat",
-    "Aristophanes",
-    "Aristotle",
-    "Arizona",
-    "Arlene",
-    "Arlington",
-    "Arlo",
-    "Arly",
-    "Armageddon",
-    "Armani",
-    "Armie",
-    "Arms",
-    "Arms Von Hirshstein",
-    "Armstrong",
-    "Arnie",
-    "Arnold",
-    "Arnold Schwarzenegger",
-    "Arnold Shortzenlegger",
-    "Arpeggio",
-    "Arquette",
-    "Arriana",
-    "Arrow",
-    "Arsenic",
-    "Artemis",
-    "Artemis (Greek goddess of hunting and moon)",
-    "Artera",
-    "Artesian",
-    "Artful Dodger",
-    "Arthur",
-    "Arthur Ambrosius",
-    "Arti",
-    "Artie",
-    "Arty",
-    "Arvo",
-    "Arwen",
-    "Arwen Renaissance",
-    "Arzu (Turkish for \\",
-    "Asbury (after Asbury Park, NJ)",
-    "ASCII (computer term)",
-    "Ash",
-    "Ash-butt",
-    "Asha",
-    "Ashanti",
-    "Ashben",
-    "Asheema",
-    "Asher",
-    "Ashes",
-    "Ashes Too Ashes",
-    "Ashford",
-    "Ashika",
-    "Ashke",
-    "Ashleigh",
-    "Ashley",
-    "Ashley Cat",
-    "Ashley Olsen",
-    "Ashley Wilkes",
-    "Ashli",
-    "Ashlyn",
-    "Ashrei (Hebrew for \\",
-    "Ashton",
-    "Ashur",
-    "Asia",
-    "Asia Major",
-    "Asia Minor",
-    "Asimov",
-    "Asja",
-    "Aska",
-    "Asker",
-    "Askhim",
-    "Aslan",
-    "Asparagus",
-    "Aspen",
-    "Asphalt",
-    "Aspirin",
-    "Asscaught",
-    "Asset",
-    "Asta",
-    "Astarael",
-    "Astarte",
-    "Aster",
-    "Asterix",
-    "Asteroid",
-    "Asti",
-    "Asti Spumonte",
-    "Astor",
-    "Astra",
-    "Astro",
-    "Astroid",
-    "Astrology",
-    "Astroman",
-    "Astrophe",
-    "Asylum",
-    "Asymptote",
-    "Atair",
-    "Atari",
-    "Ateesha",
-    "Athalia",
-    "Athena (Goddess of War)",
-    "Athene",
-    "Athens",
-    "Athinai",
-    "Atilla",
-    "Atinna",
-    "Atlantic",
-    "Atlantis",
-    "Atlas",
-    "Atom",
-    "Atossa",
-    "Attacker",
-    "Atte",
-    "Atti (short for attitude)",
-    "Atticus",
-    "Attila",
-    "Attitude",
-    "Atude",
-    "Aubergine",
-    "Aubrey",
-    "Audacity",
-    "Audball",
-    "Auden (named after the poet W.H. Auden)",
-    "Audie",
-    "Audio",
-    "Auditor",
-    "Audrey",
-    "Audrey Hepburn",
-    "Audrey III",
-    "Audubon (after John James Audubon)",
-    "Augger-Dogger",
-    "Auggie",
-    "Auggie Doggie",
-    "Auggie or Augie",
-    "Augie",
-    "August",
-    "August Nights",
-    "Augusta",
-    "Auguste Eighth Month.",
-    "Augustiko",
-    "Augustin",
-    "Augustina",
-    "Augustine \\",
-    "Augustus",
-    "Aunt Esther",
-    "Aunt Jemima",
-    "Aunt Kat",
-    "Aunt Margaret",
-    "Auntie Stella",
-    "Aura",
-    "Aureim",
-    "Aureole",
-    "Aurey",
-    "Aurora",
-    "Aurora Borealis",
-    "Aussie",
-    "Austin",
-    "Austin Meowers",
-    "Austin Powers",
-    "Autobahn",
-    "Autumn",
-    "Ava",
-    "Avagadros (after the mathmetician)",
-    "Avail",
-    "Avalanche",
-    "Avalon",
-    "Avanti",
-    "Avatar",
-    "Avery",
-    "Avis",
-    "Avocado",
-    "Avril",
-    "Awesie",
-    "Awesome Kitty",
-    "Awestruck",
-    "Awk",
-    "Axel",
-    "Axl",
-    "Axl Rose",
-    "Axle",
-    "Axon",
-    "Ayame (Japanese for \\",
-    "Ayesha (3rd wife of Mohammed)",
-    "Ayisha",
-    "Ayla",
-    "Aylin",
-    "Aymaya (Japanese for \\",
-    "Ayra",
-    "Ayreh",
-    "Ayun (As Yet Un-named)",
-    "Azar",
-    "Azark",
-    "Azazel (means \\",
-    "Azil",
-    "Aziza (\\",
-    "Azmodius",
-    "Azour Mavreen",
-    "Azrael",
-    "Azreal",
-    "Aztec",
-    "Azure",
-    "Azzuki",
-    "Azzul",
-    "B-52",
-    "B-dee",
-    "B-Girl",
-    "B-Pal",
-    "B.A.",
-    "B.A. (Bad Attitude!)",
-    "B.A. Barrakus",
-    "B.B.",
-    "B.B. Kat",
-    "B.B. King",
-    "B.B. Kingcat",
-    "B.C.",
-    "B.C. (\\",
-    "B.C. (Big Cat)",
-    "B.D. (\\",
-    "B.D. (Bad Boy)",
-    "B.D. (Brain-Dead)",
-    "B.D.K. (\\",
-    "B.e.r.u. (Banana Emergency Recovery Unit, also Luke Skywalkers aunt and an island in the Pacific Ocean)",
-    "B.G.",
-    "B.I.F. (Butt In Face)",
-    "B.J.",
-    "B.J. (Tom Robbin's character Bonanza Jellybean)",
-    "B.K.",
-    "B.M.W. (Black, Mahogany & White)",
-    "B.O.T. (Big Old Tom)",
-    "B.u.d. (\\",
-    "B.W.",
-    "B.W. (Black White)",
-    "BA",
-    "Ba Shaleek Alshain",
-    "Ba' Boy",
-    "Baba",
-    "Babaganoush",
-    "Babalou (after the tv show)",
-    "Babar",
-    "Babbaboombanorsh",
-    "Babbit",
-    "Babbitt",
-    "Babe",
-    "Babee",
-    "Babers",
-    "Babester",
-    "Babette",
-    "Babirusa",
-    "Baboo",
-    "Baboon Butt",
-    "Babricus",
-    "Babs (after Barbra Streisand)",
-    "Babsy",
-    "Babuji Braveheart",
-    "Babur",
-    "Babushka",
-    "Baby",
-    "Baby Bear",
-    "Baby Beauty",
-    "Baby Boogens",
-    "Baby Boy",
-    "Baby Bug",
-    "Baby Butterscotch",
-    "Baby Cakes",
-    "Baby Cat",
-    "Baby Doe (sort of a Jane Doe thang)",
-    "Baby Dog",
-    "Baby Doll",
-    "Baby Doo II",
-    "Baby Dumpling",
-    "Baby Girl",
-    "Baby Grey.",
-    "Baby Guiness",
-    "Baby Head",
-    "Baby Jane",
-    "Baby Jesus",
-    "Baby Ki'n",
-    "Baby Kitten",
-    "Baby Kitty",
-    "Baby Kitty And Trouble",
-    "Baby Mimi",
-    "Baby Nesbit",
-    "Baby Ruth",
-    "Baby Seebs",
-    "Baby Spice",
-    "Baby Weeeeeeezel the little Frrrrrench Chat",
-    "Baby-Boogs",
-    "Baby-Doll",
-    "Baby-Doo",
-    "Baby-Face",
-    "Baby-Kitty",
-    "Baby-Roca (named after two favorite candies, Baby Ruth and Almond Roca)",
-    "Babycakes",
-    "Babycat",
-    "Babydoll",
-    "Babyface",
-    "Babygray",
-    "Babykins",
-    "Babyman",
-    "Babyshoes",
-    "Babytat",
-    "Bacabs (Maya mythology: the canopic gods)",
-    "Bacall",
-    "Bacardi",
-    "Baccarat",
-    "Bacchos",
-    "Bacchus",
-    "Bacci (pronounced: Baa-chie; Italian for \\",
-    "Bach",
-    "Baci",
-    "Back",
-    "Backstreet Blues",
-    "Backstreet Kitty",
-    "Bacon",
-    "Bad Bad Boy",
-    "Bad Bad Leroy Brown",
-    "Bad Bess",
-    "Bad Cat",
-    "Bad Kitty",
-    "Bad Luck",
-    "Bada",
-    "Badger",
-    "Badjun",
-    "Badlands",
-    "Badness",
-    "BadShad",
-    "Baeki",
-    "Bafftub",
-    "Bag",
-    "Bag Lady",
-    "Bag O'Cat",
-    "Bagel",
-    "Baggage",
-    "Baggi pants",
-    "Baggins",
-    "Baggy",
-    "Bagheera",
-    "Baghera (black panther in \\",
-    "Baghreeah",
-    "Bagira",
-    "Bagoas",
-    "Bagpuss",
-    "Baguette",
-    "Bahama Mama",
-    "Bailey",
-    "Bailey Emerald Isle",
-    "Bailey's Irish Cream (50% sweetness and 50% nuts)",
-    "Bain",
-    "Bainbridge",
-    "Baja",
-    "Bajan",
-    "Baka (Japanese insult, \\",
-    "Baka-Neko",
-    "Baker",
-    "Baker (after the mountain in North Carolina, USA)",
-    "Baksheesh (means \\",
-    "Balaena",
-    "Balbina",
-    "Balboa",
-    "Balder (Viking mythology: The God of light)",
-    "Balderdash",
-    "Baldric",
-    "Baldrick",
-    "Baldur",
-    "Baldur The Fairly Slow",
-    "Baldwin",
-    "Baldy",
-    "Bali",
-    "Balik",
-    "Balin",
-    "Balki",
-    "Ballbearing Mouse Trap",
-    "Ballerina",
-    "Ballou",
-    "Ballsy",
-    "Baloo",
-    "Balraj",
-    "Balthazar",
-    "Balzac",
-    "Bam",
-    "Bam-Bam",
-    "Bama",
-    "Bambalona",
-    "Bambam",
-    "Bambi",
-    "Bambina",
-    "Bambino",
-    "Bamboo",
-    "Bamboozler",
-    "Bams",
-    "Bamse",
-    "Banana Cabana",
-    "Banana Peel",
-    "Band-Aid",
-    "Bandanna",
-    "Bandit",
-    "Bandito",
-    "Bang (reference to the Unix ! symbol)",
-    "Bangladesh",
-    "Bangle",
-    "Bangui (capital of Central African Republic)",
-    "Banjer",
-    "Banjo",
-    "Banjo Blue",
-    "Bannana Fanna",
-    "Bannenay",
-    "Banner",
-    "Banquet",
-    "Banquo",
-    "Banshee",
-    "Banzai",
-    "Bar Room",
-    "Baracca",
-    "Barbara",
-    "Barbara Bush",
-    "Barbarella (after the Jane Fonda movie)",
-    "Barbarian",
-    "Barbarino",
-    "Barbeque",
-    "Barbi (after Barbara Streisand)",
-    "Barbossa",
-    "Barclay",
-    "Bardee",
-    "Barfly",
-    "Barfolemeow",
-    "Bariska",
-    "Barkley",
-    "Barky",
-    "Barley",
-    "Barley-Boo",
-    "Barn Cat",
-    "Barnabas (so named for Barnabas Collins of Dark Shadows)",
-    "Barnabus (after the vampire Barnabus Collins)",
-    "Barnaby",
-    "Barnaby Jones",
-    "Barnacle",
-    "Barnacle Bill (Barney)",
-    "Barney",
-    "Barney Cat",
-    "Barney Giggles",
-    "Barney Googles",
-    "Barney Munsch O'Malley",
-    "Baron",
-    "Baron Mungojerrie Chaia Reisinho von Rumplestiltzkin-Sylvester",
-    "Baroque",
-    "Barou",
-    "Barrett",
-    "Barretta",
-    "Barrin",
-    "Barrington",
-    "Barron",
-    "Barsik",
-    "Bart",
-    "Bart Maverick",
-    "Bartholimew",
-    "Bartholomew",
-    "Bartleby",
-    "Bartlee",
-    "Bartles",
-    "Bartles and James",
-    "Bartlett",
-    "Bartleyboo",
-    "Barton",
-    "Bas (Dutch name)",
-    "Base",
-    "Baseball",
-    "Basel",
-    "Bashan",
-    "Bashful",
-    "Bashfuly",
-    "Basia",
-    "Basic",
-    "Basil",
-    "Basil Ratbones",
-    "Basket O'Cat",
-    "Basket-case",
-    "Baskin-Robbins",
-    "Basque",
-    "Basquiat",
-    "Bass",
-    "Bast",
-    "Bastet",
-    "Bastet (Egyptian cat-goddess)",
-    "Bastion",
-    "Bastu",
-    "Bat Baby",
-    "Bat Cat",
-    "Bat Face",
-    "Bat Kitty",
-    "Batal (Female Arabian name, meaning \\",
-    "Batale (Female Arabian name, meaning \\",
-    "Batface",
-    "Bathilda Christine",
-    "Bathsheba",
-    "Bation",
-    "Batly",
-    "Batman",
-    "Batman And Robin",
-    "Battina",
-    "Battlecat",
-    "Battlescar Gallacticat",
-    "Batty",
-    "Batty Cat",
-    "Batwings",
-    "Baudelaire",
-    "Baur (after the inline skates)",
-    "Bauzeur",
-    "Bawdy",
-    "Baxter",
-    "Baxter (after Mount Katahdin Baxter State Park, Piscataquis county, Maine, USA)",
-    "Bay",
-    "Bayda (Female Arabian name, meaning \\",
-    "Bayley",
-    "Bayou",
-    "Baz (from the longest name in the Bible, Maher-shalal-hash-baz)",
-    "Bazoo (French for \\",
-    "Bazooka",
-    "BB",
-    "BB Baby",
-    "Be Be",
-    "Be'Be'",
-    "Bea",
-    "Beach",
-    "Beachbaby",
-    "Beachcomber",
-    "Beached Whale",
-    "Beachnut",
-    "Beachwood",
-    "Beacon",
-    "Beager",
-    "Beak",
-    "Beaker",
-    "Bealzebub",
-    "Beamer",
-    "Beamer (BMW)",
-    "Beamish",
-    "Bean",
-    "Bean Bag",
-    "Beaner Leener",
-    "Beanie",
-    "Beanie Baby",
-    "Beanor",
-    "Beans",
-    "Bear",
-    "Bear Bear",
-    "Bear Cat",
-    "Bear of Very Little Brain",
-    "Bear-Bear",
-    "Bear-we-got(ski)",
-    "Beard",
-    "Beardpuller",
-    "Beardums",
-    "Beardy",
-    "Bearlock Holmes",
-    "Bearly",
-    "Bearly-there",
-    "Bearton",
-    "Beashue",
-    "Beast",
-    "Beastcat",
-    "Beastie",
-    "Beastie Boy",
-    "Beatrice",
-    "Beattlejuice",
-    "Beau",
-    "Beau Cat",
-    "Beau-lander",
-    "Beau-man",
-    "Beaubo",
-    "BeauCat",
-    "Beaucoup",
-    "Beaudinkle",
-    "Beaudreaux",
-    "Beaufort",
-    "Beauragard",
-    "Beauregard",
-    "Beautiful",
-    "Beautiful Blue Eyes",
-    "Beautty",
-    "Beauty",
-    "Beauty School Drop-Out",
-    "Beauty the Cat",
-    "Beaux",
-    "Beauxcephus",
-    "Beaver (after the tv show \\",
-    "Beaver Sue",
-    "Beavis",
-    "Beavis And Butthead",
-    "Bebby",
-    "Bebe",
-    "Bebee",
-    "Bebeez",
-    "Bebert",
-    "Bebo",
-    "Bechamel",
-    "Becka",
-    "Beckett",
-    "Beckett's Lady Ruth",
-    "Beckham",
-    "Becky",
-    "Bedford",
-    "Bedivere",
-    "Bedouin",
-    "Bee-Bul",
-    "Beebee",
-    "Beebers",
-    "Beebop",
-    "Beebs",
-    "Beebus",
-    "Beecham",
-    "Beechnut",
-    "Beedo",
-    "Beefcake",
-    "Beefeater",
-    "Beefy",
-    "Beefy Mae",
-    "Beeju",
-    "Beelzebub",
-    "Beelzebub (Bee EL zah BUB)",
-    "Beenie",
-    "Beentsy",
-    "Beep You",
-    "Beep-Beep",
-    "Beeper",
-    "Beeps",
-    "Beer",
-    "Beertje (Dutch for \\",
-    "Bees",
-    "Beeswax",
-    "Beethoven",
-    "Beetle",
-    "Beetle E. Bailey",
-    "Beetlejuice",
-    "Beeyoootiful",
-    "Beez Louise",
-    "Beezer",
-    "Beezlebub",
-    "Beezo",
-    "Beggin' Earl Jackson",
-    "Begonia",
-    "Behemoth",
-    "Behr",
-    "Beija (Portugese for \\",
-    "Bel-Ami",
-    "Bela (named after Bela Lugosi and pronounced: BAY-la)",
-    "Bela Lugosi",
-    "Belabella",
-    "Belah",
-    "Belfry",
-    "Belgarath the Sorcerer",
-    "Belinda",
-    "Belka",
-    "Bell",
-    "Bella",
-    "Bella Mia",
-    "Bella-Bell",
-    "Belladonna",
-    "Bellatrix",
-    "Bellboy",
-    "Belle",
-    "Belle Poitrine (French for \\",
-    "Belle Watling",
-    "Belle-Belle",
-    "Bellina",
-    "Bellissima",
-    "Bellissimo",
-    "Bello (Spanisch for \\",
-    "Bells",
-    "Belly Boy",
-    "Belly Button",
-    "Belly Girl",
-    "Belly Lint",
-    "Belochka",
-    "Beloved",
-    "Beluga",
-    "Belvedere",
-    "Belvedere (after a freeway exit in Marin County, CA)",
-    "Belvy",
-    "Belzer",
-    "Bemol",
-    "Ben",
-    "Ben And Jerry",
-    "Ben Her",
-    "Ben Hur",
-    "Benazir",
-    "Benedick",
-    "Benedict",
-    "Benedict Arnold",
-    "Benet",
-    "Bengal",
-    "Bengali",
-    "Benito (after Benito Mussolini)",
-    "Benjamin",
-    "Benjamin Franklin Purrs",
-    "Benjamin Norman Bates",
-    "Benji (after the movie)",
-    "Benkelman (after the town in Nebraska, USA)",
-    "Bennett",
-    "Benni",
-    "Bennie",
-    "Bennington",
-    "Benny",
-    "Benny von Munchkin",
-    "Bensien",
-    "Benson",
-    "Bentley",
-    "Bently",
-    "Benz",
-    "Benz-a-licker",
-    "Benzo",
-    "Benzy",
-    "Beowoof",
-    "Beowulf",
-    "Beppie",
-    "Bequest",
-    "Beraal",
-    "Berber",
-    "Beret",
-    "Beretta (after the firearm)",
-    "Bergen",
-    "Berkeley",
-    "Berlin",
-    "Berlioz (after a kitten in the movie Aristocats)",
-    "Berma",
-    "Bern-stein",
-    "Bernadette",
-    "Bernard",
-    "Bernice",
-    "Bernie",
-    "Bernini",
-    "Berry",
-    "Berry Cute",
-    "Bert",
-    "Berta",
-    "Bertha",
-    "Bertie",
-    "Besmyertnik",
-    "Bess",
-    "Bessemer",
-    "Besseya",
-    "Besseya The Fearless",
-    "Bessie",
-    "Best",
-    "Bestling",
-    "Beta",
-    "Betelguece",
-    "Beth",
-    "Beth Anne",
-    "Beth Gatlin",
-    "Bethany",
-    "Bethina (seal point Himi)",
-    "Betsie",
-    "Betsy",
-    "Betsy Rose",
-    "Bette",
-    "Bette Davis",
-    "Bette Davis Eyes",
-    "Bettilla",
-    "Bettina",
-    "Betty",
-    "Betty Boop",
-    "Betty Kitty",
-    "Betty Poop",
-    "Beulah",
-    "Beverly",
-    "Bewitched",
-    "Beyonce",
-    "Bialy",
-    "Bianca",
-    "Bianco",
-    "Bibbers",
-    "Bibble",
-    "Bibby",
-    "Bibi",
-    "Bibibig",
-    "Bibs",
-    "Bicki",
-    "Biddy",
-    "Bierstadt",
-    "Bifakitty (short for Big Fat Kitty)",
-    "Biff",
-    "Big",
-    "Big Abe",
-    "Big Baby",
-    "Big Bad Baby Beau",
-    "Big Bad Baby Bentley Billy Joe Bob",
-    "Big Bag",
-    "Big Bear",
-    "Big Beau",
-    "Big Ben",
-    "Big Black",
-    "Big Boo",
-    "Big Boy",
-    "Big Cat",
-    "Big Dipper",
-    "Big Dog",
-    "Big Fat Monster Cat",
-    "Big Fat Yellow Cat aka Ringo",
-    "Big Foot",
-    "Big Galoot",
-    "Big Girl",
-    "Big Guy",
-    "Big Hairy Cat",
-    "Big Headed Galoot",
-    "Big Kitty",
-    "Big Kitty Pye",
-    "Big Lummox",
-    "Big Mac",
-    "Big Mama",
-    "Big Min",
-    "Big Mom",
-    "Big Momma Kitty",
-    "Big Precious",
-    "Big Puss",
-    "Big Red",
-    "Big Runt",
-    "Big Skinny Cat",
-    "Big Time",
-    "Big White Boy",
-    "Big White Boy Kitty",
-    "Big Yellow Cat",
-    "Big-Baby Blubber-Whimp",
-    "Bigboy",
-    "Bigface",
-    "Bigfoot",
-    "Bigfoot The Brain Dead Kitty",
-    "Bigga Boy",
-    "Bigger",
-    "Biggie Boy",
-    "Biggles",
-    "Bigglesworth",
-    "Bigguy",
-    "Bigkitty",
-    "Bigmac",
-    "BigMouth",
-    "Bijou (French for \\",
-    "Biker",
-    "Biker Coon",
-    "Biko",
-    "Bikuchi (\\",
-    "Bilbo",
-    "Bilbo Baggins",
-    "Bill",
-    "Bill (comic-strip Bill the Cat)",
-    "Bill Howard",
-    "Bill The Hell Cat",
-    "Bill Widders",
-    "Billabong",
-    "Billbull",
-    "Billie",
-    "Billie Jo",
-    "Billy",
-    "Billy Boy",
-    "Billy Button",
-    "Billy Jack",
-    "Billy the Kit",
-    "Billyboy",
-    "Bilqna",
-    "Bimbo",
-    "Bimini",
-    "Bina",
-    "Binbin",
-    "Bindi Sue (after the daughter of Steve \\",
-    "Bing",
-    "Bing and Bong",
-    "Bing Crosby",
-    "Bing-ben",
-    "Bingo",
-    "Bink",
-    "Binkers",
-    "Binki",
-    "Binkley",
-    "Binks (black cat in the movie Hocus Pocus)",
-    "Binky",
-    "Bintje",
-    "Binx",
-    "Binx (black cat in the movie Hocus Pocus)",
-    "Binxy (after Binx, black cat in the movie Hocus Pocus)",
-    "Bipsey",
-    "Bira (after Prince Birabongse Bhanutej Bhanubandh, member of Siam's royal family)",
-    "Bird",
-    "Birdy",
-    "Birgitte",
-    "Birka (after the ancient Viking trading center on the isle of Bjˆrkˆ)",
-    "Birthday",
-    "Bis",
-    "Biscotti",
-    "Biscuit",
-    "Biscuit The Neversick",
-    "Bishop",
-    "Bisket",
-    "Bismarck",
-    "Bisou",
-    "Bisou (French for \\",
-    "Bister",
-    "Bistro",
-    "Bit",
-    "Bitch",
-    "Bitch Ass",
-    "Bitchie-Vitchie",
-    "Bitey",
-    "Bitney",
-    "Bits",
-    "Bitsey",
-    "Bitsy",
-    "Bitsy Pookums",
-    "Bitter juice",
-    "Bitters",
-    "Bitty",
-    "Bitty-bit",
-    "Bitu",
-    "Bixbee Tortise Shell",
-    "Bizkit",
-    "Bizzy",
-    "Bj",
-    "Bjork",
-    "Bjte Noir",
-    "Black",
-    "Black A",
-    "Black Beauty",
-    "Black Bomber",
-    "Black Boy",
-    "Black Cat",
-    "Black Elk (named for the Lakota Holy Man)",
-    "Black Eyes",
-    "Black Foot",
-    "Black Imp",
-    "Black Jack",
-    "Black Kitten",
-    "Black Kitty",
-    "Black Kitty Cat",
-    "Black Label",
-    "Black Lady",
-    "Black Magic Secret",
-    "Black Magic Woman",
-    "Black Mamba (after the character in the Kill Bill movies)",
-    "Black Moustache",
-    "Black Nettik",
-    "Black Onyx",
-    "Black Pearl",
-    "Black Peter",
-    "Black Sambuca",
-    "Black Spot",
-    "Black Stuff",
-    "Black Tabby",
-    "Black Velvet",
-    "Blackberry",
-    "Blackbird",
-    "Blackey Blue Eyes",
-    "Blackie",
-    "Blackitty",
-    "Blackjack",
-    "Blackman",
-    "Blackone",
-    "Blackstein",
-    "Blacky",
-    "Blade",
-    "Blaise",
-    "Blake",
-    "Blanca",
-    "Blanche",
-    "Blanche the Cat",
-    "Blarney",
-    "Blaster",
-    "Blaxie",
-    "Blaze",
-    "Blaze Starr Bleach",
-    "Blea",
-    "Bleach",
-    "Blender Guts",
-    "Bleu",
-    "Bleu Cheez",
-    "Blight",
-    "Blimp",
-    "Blimpette",
-    "Blimpie",
-    "Blimpy",
-    "Blinken",
-    "Blinky",
-    "Blinx",
-    "Blip",
-    "Blitzen",
-    "Blizzard",
-    "Blob Cat",
-    "Blobcat",
-    "Blonde Bombshell",
-    "Blondie",
-    "Bloody Wanker",
-    "Blooper",
-    "Blosom",
-    "Blossom",
-    "Blot",
-    "Blotch",
-    "Blotto",
-    "Blu",
-    "Blubber",
-    "Blue",
-    "Blue Baby",
-    "Blue Bell",
-    "Blue Bijou",
-    "Blue Boy",
-    "Blue Comet",
-    "Blue Danube",
-    "Blue Emerald",
-    "Blue Eyes",
-    "Blue Fuzzy Tiger",
-    "Blue Light Special",
-    "Blue Monday",
-    "Blue Money",
-    "Blue Passion",
-    "Blue Rocket",
-    "Blue Sapphire",
-    "Blue's Baby",
-    "Blue's Baby Beatrice",
-    "Bluebeard",
-    "BlueBelle",
-    "Blueberry",
-    "Blueberry Muffin",
-    "Blueberry Peach Parfait",
-    "Bluella",
-    "Blueprint",
-    "Blues",
-    "Bluestar (cat from the \\",
-    "Bluey",
-    "Blunder",
-    "Blur",
-    "Blurry Cat",
-    "Blurry Kitty",
-    "Blurt",
-    "Bluster",
-    "Bluto",
-    "Blynken",
-    "Bo",
-    "Bo Bo",
-    "Bo Didley",
-    "Bo Peep",
-    "Bo-head",
-    "Boa",
-    "Boadecia",
-    "Boar Deaux",
-    "Boaz",
-    "Bob",
-    "Bob Dole",
-    "Bobbers",
-    "Bobbie",
-    "Bobbie Joe",
-    "Bobbin",
-    "Bobbobmicbobob",
-    "Bobbos",
-    "Bobby",
-    "Bobby Brown",
-    "Bobby Socks",
-    "Bobbysocks",
-    "Bobcat",
-    "Bobet",
-    "Bobfred",
-    "Bobin",
-    "Bobinski",
-    "Bobo",
-    "Boca",
-    "Boccaccio",
-    "Bocce",
-    "Bocelli",
-    "Bocephus",
-    "Bocephus Twilliger",
-    "Bodacious",
-    "Bodeer",
-    "Bodhi",
-    "Bodhi Or Bodhisattva",
-    "Bodi",
-    "Bodie",
-    "Body",
-    "Boffin",
-    "Bogart",
-    "Bogart Or Bogie",
-    "Bogey",
-    "Bogeyman",
-    "Boginator",
-    "Bogo",
-    "Bogus",
-    "Bogus Kitty",
-    "Bohboh",
-    "Bohemian",
-    "Bohumil",
-    "Boi",
-    "Boiler (after the Purdue Boilermakers football team)",
-    "Boingo",
-    "Boise",
-    "Bojangles",
-    "Bojo",
-    "Bolero",
-    "Boll Weevil",
-    "Bolla",
-    "Bollox",
-    "Bologna",
-    "Bomart",
-    "Bomba",
-    "Bombalurina (From \\",
-    "Bombastic",
-    "Bomber",
-    "Bombshell",
-    "Bommel (after Olivier B Bommel)",
-    "Bon Bon",
-    "Bonanza",
-    "Bonbon",
-    "Bond",
-    "Bond, James Bond",
-    "Bondi",
-    "Bondo",
-    "Bone",
-    "BoneCrusher",
-    "Bonehead",
-    "Boneless",
-    "Bones",
-    "Bones (after doctor in \\",
-    "Boneta",
-    "Boney Butt",
-    "Bonfire",
-    "Bong",
-    "Bongie",
-    "Bongo",
-    "Bonita",
-    "Bonkers",
-    "Bonkers Justice",
-    "Bonnie",
-    "Bonnie And Clyde",
-    "Bonnie Blue",
-    "Bonnie Mewman",
-    "Bonny/Bonnie",
-    "Bono",
-    "Bonquers",
-    "Bonsai",
-    "Bonstance",
-    "Bonstancia",
-    "Bony",
-    "Bonz",
-    "Bonza",
-    "Bonzai",
-    "Bonzo",
-    "Bonzo Jolson",
-    "Boo",
-    "Boo Bear",
-    "Boo Boo",
-    "Boo Boo Kitty",
-    "Boo Boo Magoo",
-    "Boo Boo Tannenbaum (after a J.D. Salinger character)",
-    "Boo Kitty",
-    "Boo-bear",
-    "Boo-Boo",
-    "Boo-Boo Kitty",
-    "Boo-ful (as in \\",
-    "Boo-kitty",
-    "Boo-pish",
-    "Boo-Who?",
-    "Boober",
-    "BooBoo",
-    "Boobool",
-    "Boochie",
-    "Boodle",
-    "Boodle-Loaf",
-    "Boodle-Ookins",
-    "Boodles",
-    "Boofer",
-    "Boog",
-    "Boog-Boogs",
-    "Booga",
-    "Boogaboo",
-    "Boogee",
-    "Booger",
-    "Booger Buddy",
-    "Booger Butt",
-    "Booger Nose",
-    "Boogety",
-    "Boogie",
-    "Boogie Boy",
-    "Boogie Cat",
-    "Boogie Oogie Oogie",
-    "Boogie the Woo",
-    "Boogie-Woogie",
-    "Boogster",
-    "Booh",
-    "Book'em Dano",
-    "Booker",
-    "Booker T (and the M-Gees)",
-    "Bookie",
-    "Books",
-    "Bookums",
-    "Boolee",
-    "Boom-Boom",
-    "Boom-Boom Bubbles",
-    "Boomer",
-    "Boomerang",
-    "Boomey-butt",
-    "Boomley",
-    "Booms",
-    "Boone",
-    "Boopsie",
-    "Booters",
-    "Bootes",
-    "Booties",
-    "Boots",
-    "Bootsie (Collins Pussycat)",
-    "Bootsy",
-    "Booty",
-    "Bootz",
-    "Booze",
-    "Boozer",
-    "Bopper",
-    "Bopper Stopper",
-    "Boppy",
-    "Bor",
-    "Bora",
-    "Borboleta (Portuguese for \\",
-    "Border",
-    "Borg",
-    "Boris",
-    "Boris And Natasha",
-    "Boris Baryshnakat",
-    "Borris",
-    "Borscht",
-    "Bosch",
-    "Bosco",
-    "Boscovich",
-    "Bosley",
-    "Boss",
-    "Bossman",
-    "Bossy",
-    "Boston",
-    "Botan",
-    "Bote",
-    "Botelli",
-    "Botham",
-    "Botitas",
-    "Botswana",
-    "Boubie Or Bouba",
-    "Bouboule",
-    "Boucane",
-    "Boudicca",
-    "Bouffant",
-    "Bougainvillea",
-    "Bouggie",
-    "Boulis (Greek for \\",
-    "Bounce",
-    "Bouncer",
-    "Bounty",
-    "Bounty Hunter",
-    "Bouquet",
-    "Bourbon",
-    "Bourbon Street Cat",
-    "Bovine",
-    "Bow Cat",
-    "Bowie",
-    "Bowie (after David Bowie)",
-    "Bowie David Liberace",
-    "Bowser",
-    "BowTie",
-    "Boxcar Willie",
-    "Boxer",
-    "Boy",
-    "Boy Cat",
-    "Boy Catte",
-    "Boy-Ing-Goh",
-    "Boyfriend",
-    "Boyka",
-    "Boykitty",
-    "Boynton (cartoon character by Sandra Boynton)",
-    "Boysie (after the character in sitcom 'Only Fools and Horses')",
-    "Boz",
-    "Bozo",
-    "Brad",
-    "Bradleigh",
-    "Bradley",
-    "Bradstreet",
-    "Brady",
-    "Brahms",
-    "Brain",
-    "Brainchild",
-    "Braindead",
-    "Brainiac",
-    "Brains",
-    "Braley",
-    "Bramble",
-    "Bramwell",
-    "Brandi",
-    "Brando",
-    "Brandy",
-    "Brandywine",
-    "Branford",
-    "Brassy",
-    "Brat",
-    "Bratcat",
-    "Bratchild",
-    "Bratikins",
-    "Bratwurst",
-    "Brau",
-    "Brave One",
-    "Braveheart",
-    "Bravo",
-    "Brawler",
-    "Brayden",
-    "Brea",
-    "Brea (bray-uh)",
-    "Breakfast",
-    "Breanne",
-    "Breathless Mahoney",
-    "Breezer",
-    "Breezy",
-    "Breezy Kitty",
-    "Bremen",
-    "Brenda",
-    "Brenda Lee",
-    "Brenda Starr",
-    "Brendan",
-    "Brendon",
-    "Brenna",
-    "Brenzev",
-    "Bret",
-    "Brett",
-    "Brew",
-    "Brewski",
-    "Brewskie",
-    "Brewsky",
-    "Brewster",
-    "Brezhnev",
-    "Brezzers",
-    "Brian",
-    "Brianna",
-    "Briar",
-    "Brick",
-    "Bridge O Rama",
-    "Bridger",
-    "Bridget",
-    "Bridget-Titania",
-    "Brie",
-    "Brier",
-    "Brier Rose",
-    "Brigand",
-    "Bright",
-    "Bright Eyes",
-    "Brightness",
-    "BrightSpot",
-    "Brill",
-    "Brilla",
-    "Brilla-Cat",
-    "Brillabrillabrilla",
-    "Brillo",
-    "Brina",
-    "Brindi",
-    "Brindle",
-    "Briney Deep",
-    "Brinley",
-    "Brioche",
-    "Brioni",
-    "Bristol",
-    "Brit",
-    "Brita",
-    "Britches",
-    "Brittany",
-    "Brittany Jane",
-    "Bro",
-    "Broadway",
-    "Broccoli",
-    "Brockie",
-    "Brody",
-    "Broken Bonz",
-    "Broken Tail",
-    "Bronco",
-    "Bronson",
-    "Bronson (Then Came Bronson)",
-    "BrontÎ",
-    "Bronwen-Penarddym",
-    "Brooke",
-    "Brooklyn",
-    "Brooks",
-    "Broom Hilda",
-    "Broom Hylda",
-    "Broomsticks",
-    "Broshka",
-    "Brother",
-    "Brouhaha",
-    "Brown",
-    "Brown Sugar",
-    "Brownie",
-    "Browser",
-    "Brrrdie",
-    "Bruce",
-    "Bruin",
-    "Bruiser",
-    "Brumas",
-    "Brunhilda",
-    "Brunhilde",
-    "Bruno",
-    "Bruschi  (after Tedy Bruschi of the New England Patriots)",
-    "Brute",
-    "Brutis",
-    "Brutus",
-    "Bryce Lynch",
-    "Bub",
-    "Buba",
-    "Bubastis",
-    "Bubba",
-    "Bubba Gump",
-    "Bubba Jr.",
-    "Bubba, Jr.",
-    "Bubbalouis",
-    "Bubbie",
-    "Bubble",
-    "Bubble Butt",
-    "Bubbles",
-    "Bubby Benjamin",
-    "Bubi",
-    "Bubster",
-    "Bubsy Bobcat",
-    "BuBu",
-    "Buca",
-    "Buccaneer",
-    "Bucci",
-    "Buck",
-    "Buckaroo",
-    "Buckaroo Banzai (after the movie)",
-    "Bucket",
-    "Buckeye",
-    "Buckhead",
-    "Buckingham",
-    "Buckminster",
-    "Bucko",
-    "Buckshot",
-    "Buckwheat",
-    "Bucky",
-    "Buco",
-    "Bud",
-    "Bud Lite",
-    "Bud-wiser",
-    "Budabut",
-    "Budd",
-    "Buddette (a female Buddy)",
-    "Buddha",
-    "Buddutyheado",
-    "Buddy",
-    "Buddy Boy",
-    "Buddy Cat",
-    "Buddy Gecko",
-    "Buderskottch",
-    "Budha",
-    "Budmeister",
-    "Budroe",
-    "Budrow",
-    "Budster",
-    "Budweiser",
-    "Buff",
-    "Buffalo Bill",
-    "Buffie",
-    "Buffington",
-    "Buffoon",
-    "Buffy",
-    "Buffy the Mouse Slayer",
-    "Buford",
-    "Bug",
-    "Bug Guy",
-    "Buger",
-    "Bugger-Because",
-    "Buggerlugs",
-    "Buggles",
-    "Buginarug",
-    "Bugle Boy",
-    "Buglet",
-    "Bugnose",
-    "Bugs",
-    "Bugsy",
-    "Bugtussie",
-    "Buick",
-    "Bull",
-    "Bull Rafferty",
-    "Bullcat",
-    "Bullet",
-    "Bullface",
-    "Bullion",
-    "Bulls",
-    "Bullseye",
-    "Bullwinkle",
-    "Bully",
-    "Bum",
-    "Bumba",
-    "Bumble",
-    "Bumblebee Tuna",
-    "Bumblemuffin",
-    "Bumbles",
-    "Bumbo",
-    "Bump",
-    "Bumper",
-    "Bumpkin",
-    "Bumps",
-    "Bundah",
-    "Bundle",
-    "Bundle'o'love",
-    "Bundy",
-    "Bungee-Punjab",
-    "Bungie",
-    "Bungle",
-    "Bungy",
-    "Bunifa",
-    "Bunji Fujimoto",
-    "Bunk",
-    "Bunkie",
-    "Bunkin",
-    "Bunksters",
-    "Bunky",
-    "Bunni",
-    "Bunny",
-    "Bunny Butt",
-    "Bunnywapitat",
-    "Bunsen",
-    "Bunter",
-    "Bunty",
-    "Burger",
-    "Burger Butt",
-    "Burgermeister",
-    "Burglar",
-    "Burgundy",
-    "Burl",
-    "Burlap",
-    "Burlington",
-    "Burly",
-    "Burma",
-    "Burmese",
-    "Burp",
-    "Burrito",
-    "Burroughs",
-    "Burt",
-    "Burton",
-    "Busby",
-    "Bushcat",
-    "Bushige (Siouan (Hidatsa dialect) for \\",
-    "Bussetta",
-    "Bussy",
-    "Busta",
-    "Buster",
-    "Buster Brown (after the Buster Brown Shoes)",
-    "Buster Buster Feather Duster",
-    "Buster Crab",
-    "Buster Crabbe",
-    "Buster Kitten",
-    "Bustopher Jones",
-    "Butch",
-    "Butch Catsidy",
-    "Buter",
-    "Buterscotch",
-    "Buteska",
-    "Butkus",
-    "Butler",
-    "Butt",
-    "Butt Nimbus Wacket",
-    "Butter",
-    "Butterball",
-    "Butterbean",
-    "Butterbutt",
-    "Buttercup",
-    "Butterfinger",
-    "Butterfingers",
-    "Butterfly",
-    "Buttermilk",
-    "Butternut",
-    "Butters (after the character in the \\",
-    "Butters (from the cartoon \\",
-    "Butterscotch",
-    "Buttersnap",
-    "Butterworth",
-    "Butthead",
-    "Button",
-    "Buttons",
-    "Buttooskie",
-    "Butts",
-    "Buyo",
-    "Buzby",
-    "Buzlingtonian Gingerbits",
-    "Buzz",
-    "Buzz Balls",
-    "Buzz Lightyear",
-    "Buzzard",
-    "Buzzy",
-    "Byron (after Lord Byron)",
-    "Byte",
-    "Bytops",
-    "BZBug",
-    "C'Est Moi",
-    "C'Mell (character in sf story by Cordwainer Smith, \\",
-    "C'mere (as in \\",
-    "C-A-T",
-    "C-fer (as in C for Cat)",
-    "C-Unit",
-    "C.A.T.",
-    "C.A.T. Cat (Charles Alexander Theodore Cat)",
-    "C.B. (Cat Ballou)",
-    "C.B. (Cato's Brother)",
-    "C.B. (Cry Baby)",
-    "C.B.S. (Cry Baby Sam)",
-    "C.C. (\\",
-    "C.C. (Camo Cat)",
-    "C.C. (Chiefs Cat)",
-    "C.C. Ryder",
-    "C.E.O.",
-    "C.H.I.P.s",
-    "C.J.",
-    "C.J. (after the Jeep)",
-    "C.W. (\\",
-    "C4Cat (\\",
-    "Ca.T.",
-    "Cabaret",
-    "Cabbage",
-    "Cabbage Patches",
-    "Cabbaraa",
-    "Cabinze",
-    "Cabo",
-    "Caboodle",
-    "Caboose",
-    "CacahuËte",
-    "Cacao",
-    "Cacciatore (Italian for \\",
-    "Cacity",
-    "Cad",
-    "Cadbury",
-    "Caddie",
-    "Caddy",
-    "Cadeca",
-    "Cadence",
-    "Cadet",
-    "Cadillac",
-    "Caduceus",
-    "Caelin",
-    "Caelin Le Mew",
-    "Caesar",
-    "Caesar Furmeister",
-    "Caesar Salad",
-    "Caeser",
-    "Cafu",
-    "Cagney",
-    "Cagney and Lacey",
-    "Caicos",
-    "Caillou (after the cartoon character)",
-    "Cain",
-    "Cain (and Able)",
-    "Caina",
-    "Cairo",
-    "Caisan",
-    "Caitlin",
-    "Caj Caj",
-    "Caji",
-    "Cajun",
-    "Cake",
-    "Caker",
-    "Cakes",
-    "Caki",
-    "Cal",
-    "Calaco",
-    "Calamity",
-    "Calamity Jane",
-    "Calamity Roo The Wild Thing From Hell",
-    "Caleb",
-    "Caledonia",
-    "Calhoun",
-    "Cali",
-    "Cali Girlie",
-    "Calib",
-    "Caliban",
-    "Caliber",
-    "Calico",
-    "Calico Bob",
-    "Calie",
-    "California",
-    "California Girl",
-    "California Poppy",
-    "Caligula",
-    "CaliLeigh",
-    "Calin (French meaning \\",
-    "Caliope",
-    "Calix (Greek for \\",
-    "Calla Kitty",
-    "Callah",
-    "Callas",
-    "Callaway Johnson",
-    "Calli",
-    "Calli (California)",
-    "Callie",
-    "Callie Kazoo",
-    "Callie Klein",
-    "Callie-Co",
-    "Callieboo",
-    "Calliope",
-    "Calliopey",
-    "Callipitter",
-    "Callisto",
-    "Calloway",
-    "Cally",
-    "Calpurnia",
-    "Calpurrnia",
-    "Calvert",
-    "Calvin",
-    "Caly",
-    "Calypso",
-    "Calyx",
-    "Calzetines (Spanish for \\",
-    "Calzone",
-    "CalzÈ (Italian for \\",
-    "Camanche",
-    "Camaro",
-    "Cambyses",
-    "Camden",
-    "Camelot",
-    "Camembert",
-    "Cameo",
-    "Cameron",
-    "Cameron Adam",
-    "Cami",
-    "Camiko",
-    "Camile",
-    "Camilla",
-    "Camille",
-    "Camillo",
-    "Camisa",
-    "Cammie",
-    "Cammy",
-    "Camo",
-    "Camry",
-    "Camus",
-    "Canaan",
-    "Canalope",
-    "Candace",
-    "Candis",
-    "Candsy",
-    "Candy",
-    "Candy Cane",
-    "Candy Corn",
-    "Candycane",
-    "Candyman",
-    "Canelle",
-    "Canelo",
-    "Canine Chaser",
-    "Canis",
-    "Cannoli",
-    "Canterbury (after the Canterbury Tales)",
-    "Canusa",
-    "Canyon",
-    "Caos",
-    "Caper",
-    "Capernica",
-    "Capi",
-    "Capo",
-    "Capone",
-    "Cappuccino",
-    "Cappy",
-    "Capreesch",
-    "Caprice",
-    "Capricious Kitty",
-    "Capricorn",
-    "Capt. Beauregard Schmoo-Diddeley (ret.)",
-    "Captain",
-    "Captain Cat",
-    "Captain Caveman",
-    "Captain Claws",
-    "Captain Cuddlepuss",
-    "Captain Cuddles",
-    "Captain D",
-    "Captain Fluffy Pants",
-    "Captain Furface",
-    "Captain Jack (from the Pirates of the Carribean)",
-    "Captain Kirk",
-    "Captain Midnight",
-    "Captain Nemo",
-    "Captain Picard",
-    "Captain Smoky",
-    "Cara",
-    "Cara de Changa",
-    "Caradoc",
-    "Caramba",
-    "Caramel",
-    "Caramel Cat",
-    "Caramelo",
-    "Caramia",
-    "Carbon",
-    "Carbucketty",
-    "Cargo",
-    "Cariboo",
-    "Caribou",
-    "Carla",
-    "Carleen",
-    "Carlisle",
-    "Carlo",
-    "Carlos",
-    "Carly",
-    "Carlyle",
-    "Carmel",
-    "Carmello",
-    "Carmen",
-    "Carmen Sandiego",
-    "Carnation",
-    "Carob",
-    "Carolina",
-    "Caroline",
-    "Carolus Rex",
-    "Carolyn",
-    "Carousel",
-    "Carpet Gator",
-    "Carraway",
-    "Carrie",
-    "Carrie Chapman Cattt",
-    "Carrie Nation",
-    "Carrot",
-    "Carson",
-    "Carson Elliot Andrew",
-    "Carter",
-    "Cartier",
-    "Cartman (after the character in the Southpark cartoons)",
-    "Cartoon Kitty",
-    "Cartouche",
-    "Caruso",
-    "Casablanca",
-    "Casanova",
-    "Casbah",
-    "Case Closed",
-    "Casee",
-    "Casey",
-    "Cash",
-    "Cashmere",
-    "Cashmir",
-    "Casie",
-    "Casino",
-    "Casookie",
-    "Caspar",
-    "Casper",
-    "Caspian",
-    "Caspian (from C.S. Lewis \\",
-    "Cassandra",
-    "Cassandra Louise",
-    "Cassanova",
-    "Cassidy",
-    "Cassie",
-    "Cassimir",
-    "Cassiopeia",
-    "Cassiopia",
-    "Cassiopia (after the constellation)",
-    "Cassis",
-    "Cassius",
-    "Cassius Clay",
-    "Cassy",
-    "Cassy Crap In Pants",
-    "Castaway",
-    "Castle",
-    "Castley",
-    "Castor",
-    "Castro",
-    "Cat",
-    "Cat Ballou",
-    "Cat Cat",
-    "Cat Dirt",
-    "Cat Fish",
-    "Cat From Hell",
-    "Cat Kabob",
-    "Cat King Coal",
-    "Cat Stevens",
-    "Cat!",
-    "Cat'n Kidd",
-    "Cat-lete",
-    "Cat-Man-Doo",
-    "Cat-Puppy-Bird-Fish",
-    "Cat-rina",
-    "Cataccino",
-    "Catalina",
-    "Catalina Kitty",
-    "Catamaran",
-    "Catastrophe",
-    "Catastropheena",
-    "Catastrophy",
-    "Catatonic",
-    "Catawba",
-    "Catbert",
-    "Catcall",
-    "Catch",
-    "Catera",
-    "Caterina",
-    "Caterpillar",
-    "Catfish",
-    "Cathal",
-    "Cather",
-    "Catherine",
-    "Cathulu",
-    "Catilda",
-    "Catilla the Hun",
-    "Catillac (play on Cadillac)",
-    "Cation (atom or group of atoms carrying a positive charge)",
-    "Catjo",
-    "Catkin",
-    "Catkin The Craven",
-    "Catlin",
-    "Catnip",
-    "Catnochio",
-    "Catnose",
-    "Cato",
-    "Catpachino",
-    "Catrat",
-    "Catrina",
-    "Catrina Mai Tai",
-    "Cats Domino",
-    "Catsby",
-    "Catsup",
-    "Catsy",
-    "Cattaira",
-    "Cattastrophie",
-    "Catte",
-    "Cattelina",
-    "Cattia",
-    "Cattie",
-    "Cattilla The Hon",
-    "Cattle Vania (after Castle Vania)",
-    "Cattspurr",
-    "Cattulus (after an ancient Greek poet)",
-    "Cattus",
-    "Catty the cat",
-    "Cattzenn",
-    "Caty",
-    "Catzilla",
-    "Catzy",
-    "Cauchmare",
-    "Cauw",
-    "Caviar",
-    "Cayan",
-    "Cayce",
-    "Cayenne",
-    "Cayenne Pepper",
-    "Cayley",
-    "Ceasar",
-    "Ceaser",
-    "Ceasta",
-    "Cece",
-    "Cecil",
-    "Cecile",
-    "Cecilia",
-    "Cecily",
-    "Cedric",
-    "Cedric the Red",
-    "Ceefer",
-    "Ceezer",
-    "Cefa",
-    "Cefis",
-    "Cefor",
-    "Ceilidh",
-    "Celebrity",
-    "Celest",
-    "Celeste",
-    "Celestial",
-    "Celia",
-    "Celina",
-    "Celine",
-    "Celine (after Celine Dion)",
-    "Celine Dion",
-    "Cellaneous",
-    "Cello",
-    "Cellophane",
-    "Celtic",
-    "Celtsy",
-    "Centeotl (Aztec mythology: the corn god)",
-    "Cents",
-    "Cerebrum",
-    "Cerebus",
-    "Ceres",
-    "Cerridwen",
-    "Cerridwen (named for the Welsh Goddess of wisdom)",
-    "Cesium (CEEZ-ee-yum, element that reacts violently to water)",
-    "Cesser (pronounced Kessar)",
-    "Cessie",
-    "Cessna",
-    "Ceylon (a Bombay)",
-    "Cha Su Bao",
-    "Cha-Cha",
-    "Chablis",
-    "Chacha",
-    "Chaco",
-    "Chad",
-    "Chad \\",
-    "Chaee",
-    "Chaffon",
-    "Chai",
-    "Chaia (Hebrew for \\",
-    "Chainsaw",
-    "Chairman Meow",
-    "Chalchiuhtlicue (Aztec mythology: the goddess of running water)",
-    "Chalet",
-    "Chalk",
-    "Challenger",
-    "Cham",
-    "Chambray",
-    "Chamois",
-    "Champ",
-    "Champagne",
-    "Champaigne",
-    "Champion",
-    "Champs",
-    "Chan",
-    "Chance",
-    "Chance (French for \\",
-    "Chandler",
-    "Chandler Bing (from the tv-series \\",
-    "Chandon (after the champagne)",
-    "Chandra (after the East Indian name for \\",
-    "Chanel",
-    "Chang And Eng",
-    "Change",
-    "Changeling",
-    "Chani Tailchaser",
-    "Channa",
-    "Chantel",
-    "Chantelle",
-    "Chantico (Aztec mythology: the goddess of hearth, fires, and volcanoes)",
-    "Chantilly",
-    "Chantilly Lace",
-    "Chaos",
-    "Chaos (Kay-oss)",
-    "Chaplin",
-    "Chapman",
-    "Char",
-    "Charade",
-    "Charbon",
-    "Charcoal",
-    "Chardy Bean",
-    "Charge d' Affairs",
-    "Charger",
-    "Charise",
-    "Charity",
-    "Charle",
-    "Charleen",
-    "Charlemagne",
-    "Charlene",
-    "Charles",
-    "Charles Darwin",
-    "Charles Montgomery Burns (Simpsons Character)",
-    "Charleston",
-    "Charley",
-    "Charley Brown",
-    "Charli Lickin Dickens",
-    "Charlie",
-    "Charlie Boy",
-    "Charlie Brown",
-    "Charlie Brown Cat",
-    "Charlie Bucket",
-    "Charlie Chan",
-    "Charlie Chaplin",
-    "Charlie Choo",
-    "Charlie Chubbs",
-    "Charlie Joe",
-    "Charlie Q. Bopper (Q for \\",
-    "Charlie Sooty Garfield",
-    "Charlie Tuna",
-    "Charlotte",
-    "Charm",
-    "Charmer",
-    "Charmin",
-    "Charolette",
-    "Charvet",
-    "Chas",
-    "Chase",
-    "Chaser",
-    "Chastity",
-    "Chat",
-    "Chat Noir",
-    "Chatool",
-    "Chatoyer",
-    "Chats",
-    "Chatte",
-    "Chatterbox",
-    "Chatton",
-    "Chaucer",
-    "Chauffeur",
-    "Chauncey",
-    "Chauncy",
-    "Chavo",
-    "Chaya",
-    "Chaz",
-    "Che Guevara",
-    "Cheap Thrills",
-    "Cheap Trills",
-    "Chec",
-    "Checca",
-    "Check",
-    "Checker",
-    "Checkers",
-    "Cheddar",
-    "Cheddder",
-    "Chee-Chee",
-    "Chee-to",
-    "Chee-toes",
-    "Cheech",
-    "Cheech And Chong",
-    "Cheeko",
-    "Cheeks",
-    "Cheeky",
-    "Cheerio",
-    "Cheerleader",
-    "Cheers",
-    "Cheese!",
-    "Cheeseball",
-    "Cheeseburger",
-    "Cheesecutter",
-    "Cheeser",
-    "Cheesey Annett",
-    "Cheesie",
-    "Cheesy",
-    "Cheesy Poof",
-    "Cheeta",
-    "Cheetah",
-    "Cheetara",
-    "Cheeto",
-    "Cheetos",
-    "Chef",
-    "Chekailarim",
-    "Chekhov",
-    "Chekov",
-    "Chella",
-    "Chelo",
-    "Chelsea",
-    "Chemo",
-    "Cher Bear",
-    "Cherokee",
-    "Cherokee Cherrypie",
-    "Cherrie",
-    "Cherry",
-    "Cherry Monster",
-    "Cherry Pie",
-    "Cherry Pig",
-    "Cherry Plump",
-    "Cherub",
-    "Cherus",
-    "Chery",
-    "Cheryl",
-    "Chesapeake",
-    "Cheshire Cat",
-    "Chesney Battersby Brown",
-    "Chesnut",
-    "Chessie",
-    "Chester",
-    "Chester the Jester",
-    "Chesterfield",
-    "Chestnut",
-    "Chet",
-    "Chevalier",
-    "Chevi",
-    "Chevis Regal",
-    "Chevoux",
-    "Chevy",
-    "Chevy Chase",
-    "Chevy-Cat",
-    "Chew-Chew",
-    "Chewbacca",
-    "Chewball",
-    "Chewbauka",
-    "Chewie",
-    "Chewy",
-    "Chewy Fingers",
-    "Chey",
-    "Cheyenne",
-    "Cheynenne",
-    "Chez Lou",
-    "ChezPaw",
-    "Chi",
-    "Chi Chi (Burmese for \\",
-    "Chi-Chi",
-    "Chi-Ki",
-    "Chia Pet",
-    "Chia-Chia",
-    "Chianti",
-    "Chiara",
-    "Chiaroscuro",
-    "Chibicat",
-    "Chic",
-    "Chica",
-    "Chicago",
-    "Chicago (the windy kitty)",
-    "Chichi",
-    "Chickasaw",
-    "Chicken",
-    "Chicken Butt",
-    "Chicken Chow Meow",
-    "Chicken Little",
-    "Chickory",
-    "Chicky",
-    "Chiclet",
-    "Chico",
-    "Chico (Spanish for \\",
-    "Chicomecoatl (Aztec mythology: the goddess of corn and fertility)",
-    "Chicory",
-    "Chief",
-    "Chieftan",
-    "Chiffon",
-    "Chigger",
-    "Chikako",
-    "Chikapoo",
-    "Chilawack",
-    "Chile (Pepper)",
-    "Chili",
-    "Chili Jauqin Mcgee (three famous baseball players)",
-    "Chili Pepper",
-    "Chills",
-    "Chilly-Bit",
-    "Chimi",
-    "Chimichanga (Mexican dish)",
-    "Chin",
-    "Chin-Chin",
-    "China",
-    "China Cat",
-    "China Cat Sunflower",
-    "China Doll",
-    "China Girl",
-    "Chinchilla",
-    "Chinette (from a book by Colette)",
-    "Chink",
-    "Chinnie",
-    "Chinny Chin Chin",
-    "Chino",
-    "Chinois",
-    "Chinook",
-    "Chinta",
-    "Chintz",
-    "Chip",
-    "Chipeta",
-    "Chipmeister",
-    "Chipmunk",
-    "Chipolata (after the dessert)",
-    "Chipper",
-    "Chipper Jr.",
-    "Chippermunk",
-    "Chippie",
-    "Chippy",
-    "Chippychip",
-    "Chips",
-    "Chips-Ahoy",
-    "Chipsie",
-    "Chipstix",
-    "Chiquita",
-    "Chirico",
-    "Chirito",
-    "Chispa (Spanish for \\",
-    "Chita",
-    "Chitchat",
-    "Chitters",
-    "Chivas",
-    "Chivas Regal",
-    "Chiya",
-    "Chloe",
-    "Chloe Ash",
-    "Chloe Macaroni",
-    "Chloe-butt",
-    "Chloelina",
-    "Chloemeister",
-    "Chloence J.",
-    "Chlomeister",
-    "Chlopi",
-    "Cho Mein",
-    "Cho-Cho",
-    "Cho-Cho-San",
-    "Choad",
-    "Chockus-stockus",
-    "Chocky",
-    "Choco-latte",
-    "Choco-Paws",
-    "Chocolata",
-    "Chocolate",
-    "Chocolate Cookie Cat",
-    "Chocolate Mousse",
-    "Choctaw",
-    "Choker",
-    "Chole",
-    "Cholo",
-    "Chong",
-    "Chonga",
-    "Choo Boo",
-    "Choo Choo Charlie",
-    "Choo-Choo",
-    "Chooberry Boo",
-    "Chooch",
-    "Chooch Pooch",
-    "Choochie",
-    "Choochie Pooh",
-    "Choosen",
-    "Chopin (pronounced \\",
-    "Chopper",
-    "Chopper Bates",
-    "Choppo",
-    "Chops",
-    "Chopsticks",
-    "Chorizo",
-    "Chotchke",
-    "Chow",
-    "Chow Chow",
-    "Chow Down",
-    "Chowder",
-    "Chowderhead",
-    "Chris",
-    "Chris Purr-ez",
-    "Chrischat",
-    "Chrissie",
-    "Chrissie Tina",
-    "Christabelle",
-    "Christian",
-    "Christie",
-    "Christina",
-    "Christine",
-    "Christmas Cat",
-    "Christmas Eve Princess Six Toes",
-    "Christofur",
-    "Christoper",
-    "Christopher",
-    "Christopher Curlumbus",
-    "Christopher Robin",
-    "Christy",
-    "Chrome",
-    "Chrysoberyl",
-    "Chub Chub Kitty",
-    "Chubbers",
-    "Chubbette",
-    "Chubbie",
-    "Chubbles",
-    "Chubbs",
-    "Chubby",
-    "Chubcub",
-    "Chubfish",
-    "Chublybumkins",
-    "Chubs",
-    "Chubserelli",
-    "Chuck",
-    "Chuckie",
-    "Chuckie Cheeser",
-    "Chuckie Joseph",
-    "Chucklehead",
-    "Chuckles",
-    "Chucky",
-    "Chula (after Prince Chula Chakrabongse, member of Siam's royal family)",
-    "Chulzpa",
-    "Chumbles (after the band Chumbawamba)",
-    "Chumley",
-    "Chump",
-    "Chunk",
-    "Chunks",
-    "Chunky",
-    "Chupa",
-    "Chupchic",
-    "Chuppy",
-    "Church",
-    "Churchill",
-    "Churchlady",
-    "Churchmouser",
-    "Chusko",
-    "Chutney",
-    "Chuty",
-    "Chutzpa",
-    "Chynna",
-    "Ci-Ci",
-    "Ciao",
-    "Ciate (pronounced \\",
-    "Cica",
-    "Cicero",
-    "Cici",
-    "Cid",
-    "Ciera",
-    "Cigi",
-    "Cigunia",
-    "Cihuacoatl (Aztec mythology: goddess whose roaring signalled war)",
-    "Ciji",
-    "Cika",
-    "Cika (Zairois for \\",
-    "Cilla (after the singer Cilla Black)",
-    "Cimarron",
-    "Cimcime",
-    "Cimmy",
-    "Cinamin",
-    "Cinawei",
-    "Cincicatti",
-    "Cinco",
-    "Cinda",
-    "Cindee",
-    "Cinder",
-    "Cinder Kitty",
-    "Cinderblock",
-    "Cinderell",
-    "Cinderella",
-    "Cinders",
-    "Cindii",
-    "Cindy",
-    "Cindy Roo",
-    "Cinema",
-    "Cinfetti",
-    "Cinii",
-    "Cinjun",
-    "Cinnabar",
-    "Cinnabun",
-    "Cinnamon",
-    "Cinnamon Bear",
-    "Cinnamon Buns",
-    "Cinnamon Cookie",
-    "Cinnamon Crumb Cake",
-    "Cinni Mini",
-    "Cinnomin",
-    "Cino",
-    "Cinthia",
-    "Cira",
-    "Circa",
-    "Circe",
-    "Cirmi",
-    "Cirocco",
-    "Cirrus",
-    "Cisco",
-    "Cisco Kid",
-    "Cissy",
-    "Cissy-Kitty",
-    "Cit Bolon Tum (Maya mythology: one of two gods of medicine)",
-    "Citron",
-    "Citrus",
-    "City Kitty",
-    "Civetta",
-    "Clack",
-    "Claire",
-    "Clairisse",
-    "Clanci",
-    "Clancy",
-    "Clara",
-    "Clarabelle",
-    "Clarence",
-    "Clarence Darrow",
-    "Claret",
-    "Clarice",
-    "Clarissa",
-    "Clark",
-    "Clark Gable",
-    "Clarke",
-    "Classy",
-    "Classy Cat",
-    "Claude",
-    "Claude Debussey",
-    "Claude Monet",
-    "Claudia",
-    "Claudius",
-    "Claudius Augustus",
-    "Claus",
-    "Clause",
-    "Clavulox",
-    "Claw",
-    "Clawde",
-    "Clawdette",
-    "Clawdius",
-    "Clawdya",
-    "Clawed",
-    "Clawed Monet",
-    "Claws",
-    "Clay",
-    "Claymore",
-    "Clea",
-    "Cleatis",
-    "Clem",
-    "Clem Bob",
-    "Clem Bob, the Arkansas Barn Cat",
-    "Clementine",
-    "Cleo",
-    "Cleocatra",
-    "Cleopatchie",
-    "Cleopatra",
-    "Cleveland",
-    "ClichÈ",
-    "Click",
-    "Clide",
-    "Cliff",
-    "Cliffhanger",
-    "Clifford",
-    "Cliffy",
-    "Clifton",
-    "Climber",
-    "Cling",
-    "Clinger",
-    "Clinkers",
-    "Clint",
-    "Clint Eastwood",
-    "Clio",
-    "Clipper",
-    "Cliquot (after Veuve-Cliquot, a champagne brandname)",
-    "Clive",
-    "Cloe",
-    "Cloey",
-    "Clone",
-    "Clooney (after the actor George Clooney)",
-    "Clorox",
-    "Cloud",
-    "Cloudwalker",
-    "Cloudy",
-    "Clouseau (after Inspector Clouseau from the Pink Panther movies)",
-    "Clouseau (after the character in the Pink Panther movies)",
-    "Clove",
-    "Clover",
-    "Clovis",
-    "Clowie",
-    "Clue",
-    "Clues",
-    "Clumsy Cat",
-    "Clyde",
-    "Clyde Guy",
-    "Clydester",
-    "Coach",
-    "Coach Potato",
-    "Coal",
-    "Coaldust",
-    "Coalport (after the English china company)",
-    "Cobarde (Spanish for \\",
-    "Cobber",
-    "Cobie",
-    "Cobol",
-    "Coca",
-    "Cocaine",
-    "Cocca Alicia",
-    "Cocca Ciro",
-    "Cocca Eduardo",
-    "Cocca Mae",
-    "Cochice",
-    "Cockpit",
-    "Coco",
-    "Coco Bean",
-    "Coco Loco",
-    "Coco The Campin' Kitty",
-    "Cocoa",
-    "Cocoa (cocoa Jumbo)",
-    "Cococabana",
-    "Coconut",
-    "Cocopuff",
-    "Coda",
-    "Cody",
-    "Coffee",
-    "Cognac",
-    "Cohen",
-    "Coke",
-    "Cola",
-    "Colby",
-    "Cole",
-    "Cole Porter",
-    "Coleco",
-    "Colette",
-    "Colla",
-    "Collision",
-    "Collision of Course",
-    "Colonel",
-    "Colores (Spanisch for \\",
-    "Colorfur",
-    "Colt",
-    "Colten",
-    "Coltrane",
-    "Columbia",
-    "Columbine",
-    "Columbo",
-    "Columbus",
-    "Comedian",
-    "Comedienne",
-    "Comedy Central",
-    "Comelia",
-    "Comet",
-    "Comet Tail",
-    "Comfy",
-    "Comiskey",
-    "Comma",
-    "Commotion",
-    "Compadre",
-    "Competition",
-    "Compucat",
-    "Comstock",
-    "Comus",
-    "Con Con",
-    "Conan",
-    "Concon",
-    "Condo",
-    "Condor",
-    "Confection",
-    "Confetti",
-    "Confucius",
-    "Conga",
-    "Congo",
-    "Conio",
-    "Conjurer",
-    "Connie",
-    "Connie Purrrrfect",
-    "Connor",
-    "Conrad",
-    "Conscience",
-    "Constance",
-    "Constantine",
-    "Contessa",
-    "Contrast",
-    "Control",
-    "Conway Kitty",
-    "Conway Twitty",
-    "Coo",
-    "Cookie",
-    "Cookie And Cutter",
-    "Cookie Dough",
-    "Cookie Monster",
-    "Cookies-n-Cream",
-    "Cooking Fat",
-    "Cool",
-    "Coon",
-    "Coon-cat",
-    "Coonie",
-    "Coonkitty",
-    "Coonmainea's Firebird Of Ambar",
-    "Coop",
-    "Cooper",
-    "Coors",
-    "Coors Lite",
-    "Coosa (after the river in Alabama)",
-    "Cooter",
-    "CootieBug",
-    "Cop",
-    "Cop Jr.",
-    "Copernicus",
-    "Copley",
-    "Copper",
-    "Copper Penny",
-    "Copper Tazmina Of Yasmine",
-    "Copy",
-    "Coquette",
-    "Coquille",
-    "Corafin",
-    "Coral",
-    "Corazon",
-    "Corbin",
-    "Corbin (from the movie The Fifth Element)",
-    "Cordelia",
-    "Cordial",
-    "Cordoba",
-    "Corduroy (after the Pearl Jam song)",
-    "Corelli (after the composer Arcangelo Corelli)",
-    "Corey",
-    "Cori",
-    "Coricopat",
-    "Corielle",
-    "Corinna",
-    "Corinne",
-    "Corkscrew",
-    "Corky",
-    "Cornelius",
-    "Cornell (Wilde-Cat)",
-    "Corney Cats",
-    "Cornflake",
-    "Corona",
-    "Coronado",
-    "Coronet",
-    "Correy",
-    "Corrigan",
-    "Corrina",
-    "Corsair",
-    "Corvette",
-    "Cory",
-    "Cosby",
-    "Cosenza",
-    "Cosette",
-    "Cosine",
-    "Cosmic",
-    "Cosmic Creeper (black cat in the movie \\",
-    "Cosmo",
-    "Cosmo Jack",
-    "Cossacks Varuska",
-    "Costner",
-    "Cotton",
-    "Cotton Candy",
-    "Cotton Rat (reverse initial consonants)",
-    "Couch Potato",
-    "Coucoune",
-    "Cougar",
-    "Couger",
-    "Couldn'tpossiblybemycat",
-    "Count",
-    "Count Basie",
-    "Count Chocula",
-    "Count Katula",
-    "Count KittyKat",
-    "Countach",
-    "Countess",
-    "Countess Minuet Patch",
-    "Countess Rumpleteazer Cattulus Anastasia Hecate-Baalith of Kalma Neffertiti Baghera Bastet la chate noire",
-    "Countessa Wilhelmina",
-    "Country Kitty",
-    "Coup",
-    "Coupten",
-    "Courage",
-    "Courtney",
-    "Courvoisier",
-    "Couscous",
-    "Cousie",
-    "Cousine (French for \\",
-    "Cousteau",
-    "Cow",
-    "Cowboy",
-    "Cowboy Kitty",
-    "Cowfoit",
-    "Cowgirl",
-    "Cozmo",
-    "Cozy",
-    "Cozy-mozy",
-    "Crabby",
-    "Cracker",
-    "Crackers",
-    "Crafty",
-    "Cranberry",
-    "Crasant",
-    "Crash",
-    "Crater",
-    "Crawdad",
-    "Crawford",
-    "Crayon",
-    "Crazy",
-    "Crazy Cat",
-    "Crazy Kitty",
-    "Crazy Otto",
-    "Cream",
-    "Creampuff",
-    "Creamsicle",
-    "Creamsoda",
-    "Creature",
-    "Creeper",
-    "Creme",
-    "Creola (named for the Jimmy Buffett song)",
-    "Crescent",
-    "Cresent",
-    "Crestone",
-    "Crichton (from the J.M. Barrie play \\",
-    "Crick",
-    "Cricket",
-    "Criendger",
-    "Crier",
-    "Criffin",
-    "Crimson",
-    "Cringer (after the tiger in the \\",
-    "Cris",
-    "Crisco",
-    "Crispy",
-    "Crisslynn",
-    "Crissy Cat",
-    "Cristyl",
-    "Critter",
-    "Critters",
-    "Crockett",
-    "Crocus",
-    "Croissant",
-    "Cromwell",
-    "Crookshanks (Hermione's cat in the Harry Potter books)",
-    "Crooksy",
-    "Crosby",
-    "Crosley (after Powell Crosley, the american entrepeneur)",
-    "Cross",
-    "Crotchety Ol' Man",
-    "Crouton",
-    "Crovax",
-    "Crow Jane",
-    "Cruella",
-    "Cruise Around Kitty B. Raines Cat",
-    "Cruiser",
-    "Crumb",
-    "Crumble",
-    "Crumpet",
-    "Crunch [White]",
-    "Cruncher",
-    "Crunchie",
-    "Crusader",
-    "Crusoe",
-    "Crusty",
-    "Crut",
-    "Crybaby",
-    "Crystabelle",
-    "Crystal",
-    "Crystal Blue",
-    "Crystal Smoke",
-    "Crystal Star",
-    "Cthulhu (from H.P. Lovecraft)",
-    "Cuba",
-    "Cubagoodingjunior",
-    "Cubby",
-    "Cuca",
-    "Cucaracha",
-    "Cuchicuchi",
-    "Cucina",
-    "Cuckoo",
-    "Cuddlebug",
-    "Cuddlefudge",
-    "Cuddler",
-    "Cuddles",
-    "Cuddly",
-    "Cue",
-    "Cuervo",
-    "Cuffles",
-    "Cuffy",
-    "Cujo",
-    "Culver",
-    "Cumulus",
-    "Cunch Punch",
-    "Cupcake",
-    "Cupid",
-    "Curious",
-    "Curious George",
-    "Curlie",
-    "Curly",
-    "Curmudgeon",
-    "Curry",
-    "Curtains",
-    "Cury (short for Curiosity)",
-    "Cusco",
-    "Custard",
-    "Custer",
-    "Cute",
-    "Cutey Button",
-    "Cuthbert",
-    "Cutie",
-    "Cutie Pie",
-    "Cutie-Patutie",
-    "Cutie-Pie",
-    "Cutiekins",
-    "Cutiepants",
-    "Cuttie Boodie",
-    "Cy",
-    "Cyan",
-    "Cyann",
-    "Cybermax",
-    "Cyclohexitol Inositol",
-    "Cyclops (one eyed monster)",
-    "Cyd",
-    "Cygnus",
-    "Cygnus X1",
-    "Cymbeline (Shakespearean play, rhymes with thin - and - lean)",
-    "Cyndar",
-    "Cyndy Maupurr",
-    "Cyparissus (male, from greek myhology)",
-    "Cypress",
-    "Cyprus",
-    "Cyrano",
-    "Cyrano de Beaurecat",
-    "Cyril",
-    "Cyrus",
-    "Cyrus Rumblethump",
-    "Czar",
-    "D'Arcy",
-    "D'Art",
-    "D'Artagnan",
-    "D.B.C. (\\",
-    "D.C. (\\",
-    "D.C. (Damn Cat)",
-    "D.C. (Darn Cat)",
-    "D.D.",
-    "D.J.",
-    "D.J. (\\",
-    "D.J. (Dale Junior)",
-    "D.L.H.",
-    "Da Vinci",
-    "Daaaleeeeeeeeaaaaaaaaaa",
-    "Daddy Long Legs",
-    "Daddy O",
-    "Daddy Woo",
-    "Daddy's Little Girl",
-    "Daddy-O",
-    "Daedalus",
-    "Daemon",
-    "Daffie",
-    "Daffy",
-    "Daffy Duck",
-    "Dag",
-    "Dagda",
-    "Dagger",
-    "Daggi",
-    "Dagmar",
-    "Dagms",
-    "Dagne",
-    "Dagney",
-    "Dagwood",
-    "Dah Dah Dah",
-    "Dahawk",
-    "Dahli",
-    "Dahlia",
-    "Daio",
-    "Daiquiri (Rum and fruit cocktail)",
-    "Dairy Princess",
-    "Dairy Queen",
-    "Daisy",
-    "Daisy Mae",
-    "Daja",
-    "Dajawa",
-    "Dakin",
-    "Dakota",
-    "Daktari",
-    "Dalai",
-    "Dalai Lama",
-    "Dale",
-    "Dale Jr. (after the Nascar driver Dale Earnheart Jr.)",
-    "Dali (painter)",
-    "DaLiang Shan",
-    "Dalila",
-    "Dallas",
-    "Dallin",
-    "Dalmation",
-    "Dalton",
-    "Dalton Gang",
-    "Damage",
-    "Damian",
-    "Damien",
-    "Dammit",
-    "Damn Cat",
-    "Damn It",
-    "Damocleus",
-    "Damon",
-    "Damsel",
-    "Damu (pronounced \\",
-    "Dan-dee",
-    "Dana Scully",
-    "Danae",
-    "Danaus",
-    "Dancer",
-    "Dances With Squirrels",
-    "Dancing",
-    "Dancing Girl",
-    "Dandelion",
-    "Dandy",
-    "Dandy Lion",
-    "Dane",
-    "Dane Grey",
-    "Dangerous",
-    "Dani",
-    "Dani California",
-    "Dania",
-    "Daniel",
-    "Danielle",
-    "Danila",
-    "Danilo",
-    "Dank",
-    "Dannon",
-    "Danny",
-    "Dano",
-    "Dante",
-    "Danu",
-    "Danube",
-    "Danyul",
-    "Daphine",
-    "Daphne",
-    "Daquari",
-    "Dar",
-    "Dara",
-    "Darcy",
-    "Dare",
-    "Daredevil",
-    "Daria",
-    "Darius",
-    "Dark",
-    "Dark Cloud",
-    "Dark Night",
-    "Dark Shadows",
-    "Darkie",
-    "Darkstar",
-    "Darla",
-    "Darlene",
-    "Darling",
-    "Darn Cat",
-    "Darren",
-    "Darrow",
-    "Darryl",
-    "Dart",
-    "Darth",
-    "Darth Vader",
-    "Darwin",
-    "Daryl",
-    "Daryl Strawberry",
-    "Das Boots",
-    "Dash",
-    "Dasha",
-    "Dashat",
-    "Dasher",
-    "Dashiell",
-    "Dashka",
-    "Dasiy",
-    "Dasiy Boo",
-    "Dasiy-May",
-    "Dass",
-    "Data",
-    "Dave",
-    "Davey",
-    "David",
-    "David And Goliath",
-    "David Hasselhoff",
-    "Davinci (after Leonardo Da Vinci)",
-    "Dawn",
-    "Dawn)",
-    "Dawnstar",
-    "Daws",
-    "Dawson",
-    "Dawson's Peep",
-    "Dax (from Deep Space Nine)",
-    "Dayla",
-    "Daylee",
-    "Daylight",
-    "Dayna",
-    "Daysha",
-    "Dazzle",
-    "Dazzler",
-    "DC",
-    "De Chirico",
-    "De La Croix",
-    "Deacon",
-    "Deago",
-    "Dean",
-    "Dean Martin",
-    "Deane",
-    "Deanna",
-    "Death",
-    "Deb",
-    "Debbie",
-    "Debby",
-    "Debonhair",
-    "Deborah",
-    "Debutante",
-    "Decathalon",
-    "Decca (after the British record company)",
-    "December",
-    "Decimal",
-    "Decker",
-    "Dee",
-    "Dee Lightful",
-    "Dee-Jay",
-    "Dee-lite",
-    "Deeber",
-    "Deeber-Deeber-Deeber",
-    "Deeber-Doo",
-    "Deedle",
-    "Deeohgee (spells D O G)",
-    "Deep Purr",
-    "Deetz",
-    "Degas",
-    "Degrassi",
-    "Deimos",
-    "Deirdre",
-    "Deisel",
-    "Deitda",
-    "Deja",
-    "Deka",
-    "Del",
-    "Delaney",
-    "Delano",
-    "Delbert",
-    "Delenn",
-    "Delerium",
-    "Delfay",
-    "Delhi",
-    "Delilah",
-    "Delirium",
-    "Delius",
-    "Della",
-    "Delta",
-    "Delta Burke",
-    "Delta King",
-    "Delta Queen",
-    "Demanda",
-    "Deme",
-    "Demelza (after the wife of Poldark)",
-    "Demento",
-    "Demeter",
-    "Demetrius",
-    "Demi",
-    "Demie-Lune",
-    "Demon",
-    "Demon Kitty",
-    "Dempsey",
-    "Denali",
-    "Dendrite",
-    "Deneuve",
-    "Denim",
-    "Denis",
-    "Dennis",
-    "Dennis M. Furry",
-    "Dennis The Menace",
-    "Denton",
-    "Denver",
-    "Denzil",
-    "Depeche",
-    "Dependent",
-    "Dependent One",
-    "Deporants",
-    "Depot",
-    "Der Vacumen (German for \\",
-    "Derby",
-    "Derek",
-    "Derek (and brother Domino, from the '70s rock group Derek and the Dominoes)",
-    "Derek Brody Wooten",
-    "Derringer (a little pistol)",
-    "Derry",
-    "Dersu Uzala",
-    "Descartes",
-    "Desdemona",
-    "Desert King",
-    "Desert Song",
-    "Desi",
-    "Desiree",
-    "Desmond",
-    "Desmonda",
-    "Desoto",
-    "Desperado",
-    "Desser The Poocher",
-    "Destin",
-    "Destiny",
-    "Destroyer",
-    "Destructo-o-cat",
-    "Detonator",
-    "Detour",
-    "Deuce",
-    "Dev Null",
-    "Deva",
-    "Devi",
-    "Devil",
-    "Devil Cat",
-    "Devin",
-    "Devlin",
-    "Devo",
-    "Dew",
-    "Dewdrop",
-    "Dewey",
-    "Dexedrine",
-    "Dext",
-    "Dexter",
-    "Dextrina",
-    "Dexy",
-    "Dez",
-    "Dharma",
-    "Dhia",
-    "Dhingle",
-    "Diablo",
-    "Diabolique",
-    "Diabolo",
-    "Diados",
-    "Diahnn",
-    "Diamond",
-    "Diamond (In The Rough)",
-    "Diana",
-    "Diane",
-    "Dianna",
-    "Dianne",
-    "Diavolo (Italian for \\",
-    "Dibbert",
-    "Dibey",
-    "Dica",
-    "Dice",
-    "Dicer",
-    "Dick",
-    "Dick Head",
-    "Dicken",
-    "Dickens",
-    "Dickie",
-    "Dickon",
-    "Dickory",
-    "Diddle",
-    "Diddley",
-    "Diddy",
-    "Dideaux (pronounced \\",
-    "Didgit",
-    "Didi",
-    "DiDiBaBa",
-    "Dido",
-    "Diego",
-    "Diesel",
-    "Dieter",
-    "Digalou",
-    "Digame",
-    "Digby",
-    "Digger",
-    "Diggin",
-    "Diggy",
-    "Digit",
-    "Digory (from the character in the C.S. Lewis book \\",
-    "Dijie",
-    "Dijon",
-    "Dilemma",
-    "Dill (after the herb)",
-    "Dillie Doodle",
-    "Dillinger",
-    "Dillon",
-    "Dilly and Dally",
-    "Dilly Dally",
-    "Dim Sum",
-    "Dimitri",
-    "Dimitry",
-    "Dimple",
-    "Dina",
-    "Dinah (Alice in Wonderland's cat)",
-    "Dinah Boo",
-    "Dinar",
-    "Ding",
-    "Ding A Ling",
-    "Ding Ding",
-    "Ding Dong",
-    "Dinger",
-    "Dinglehopper",
-    "Dingles",
-    "Dingo",
-    "Dingus",
-    "Dingy",
-    "Dink",
-    "Dinker",
-    "Dinker-Doodle",
-    "Dinkey",
-    "Dinkie",
-    "Dinkus",
-    "Dinky (dog on National Lampoon's Vacation)",
-    "Dino",
-    "Dino Jellybeano",
-    "Dio (after Ronnie James Dio, singer in the heavy-metal rock band Black Sabbath)",
-    "Dioggi (pronounced \\",
-    "Diomedes",
-    "Dion",
-    "Dionis",
-    "Dionysus (also \\",
-    "Dior",
-    "Dip-sh*t",
-    "Diphthong",
-    "DipSquat",
-    "Dipstick",
-    "Dirk",
-    "Dirtball",
-    "Dirty Face",
-    "Disaster",
-    "Disco Stu",
-    "Disney",
-    "Dit Dit",
-    "Dita (after Dita Von Teese)",
-    "Dittany",
-    "Ditto",
-    "Ditty",
-    "Ditzy",
-    "Diva",
-    "Divet",
-    "Divine",
-    "Divinepurrs",
-    "Divinity",
-    "Divot",
-    "Dixen",
-    "Dixi",
-    "Dixie",
-    "Dixie Fourpaws",
-    "Dixie's Midnight Rumbler",
-    "Dixie-Belle",
-    "Dixiecat",
-    "Diz",
-    "Dizzie Rascal",
-    "Dizzy",
-    "Django",
-    "Djema",
-    "Djengiz",
-    "Do the hustle",
-    "Dobby",
-    "Dobi (Malay for \\",
-    "Dobie Gillis",
-    "Doc",
-    "Dock",
-    "Doctor",
-    "Doctor Claw",
-    "Dodecahedron",
-    "Dodge",
-    "Dodger",
-    "DoDi",
-    "Dodo",
-    "Doesha",
-    "Doezel (Dutch for \\",
-    "Dog",
-    "Dog Meat",
-    "Dogfood",
-    "Dogg",
-    "Doggers",
-    "Doggie",
-    "Doggs",
-    "Doglet",
-    "Doheny",
-    "Doink.",
-    "Dolce Or Dulce",
-    "Dolf",
-    "Doll",
-    "Dolly",
-    "Dolly Cowbag",
-    "Dolly Dianna Little",
-    "Dolly Madison",
-    "Dolphinmao",
-    "Dom-Min-Nom",
-    "Dombey",
-    "Dombey the Zombie",
-    "Domina",
-    "Dominic",
-    "Dominin~O",
-    "Dominique",
-    "Domino",
-    "Domino Johny-Cat Learned the 2nd",
-    "Domino Odile",
-    "Dominuts",
-    "Don",
-    "Don Diego de la Vega",
-    "Don Juan",
-    "Don King",
-    "Donatello",
-    "Dong Dong",
-    "Donna",
-    "Donna Jane Perkins",
-    "Donner",
-    "Donneybrook",
-    "Donny And Marie",
-    "Doo-Da",
-    "Doobie",
-    "Doobie Brothers",
-    "Dooby",
-    "Doodle",
-    "Doodle Bug",
-    "Doodles",
-    "Doodoo",
-    "Doodsy",
-    "Doofus",
-    "Doogie",
-    "Doogie Bowser",
-    "Doogie Mouser",
-    "Dookey",
-    "Dookfree",
-    "Dookie",
-    "Doolittle",
-    "Doonesbury",
-    "Door Knob",
-    "Doozelmog",
-    "Dopey-Dum dum",
-    "Dora",
-    "Dorca",
-    "Dorian",
-    "Dorie",
-    "Doris",
-    "Doris Day",
-    "Doris George Volkswagon Jetta",
-    "Dorito",
-    "Dork",
-    "Dorkus",
-    "Dorothea",
-    "Dorothy",
-    "Dos Gatos",
-    "Dosey",
-    "Dosuni (Korean for \\",
-    "Dot",
-    "Dots",
-    "Dotta",
-    "Dottie",
-    "Dotty",
-    "Double-O-Seven",
-    "Double-Stuff",
-    "Doublestuff",
-    "Douche Bag",
-    "Doug",
-    "Dougal",
-    "Dough-Boy",
-    "Doughnut",
-    "Douglas Fur",
-    "Dougy",
-    "Doulin",
-    "Dowdiddie",
-    "Dozer",
-    "Dozie Darlin",
-    "Dozita",
-    "Dr. Bartolo (after the character in Mozart's \\",
-    "Dr. Bruce Gray",
-    "Dr. Drakken",
-    "Dr. Drool",
-    "Dr. Dude",
-    "Dr. Eggman (from the Sonic games)",
-    "Dr. Evil",
-    "Dr. Katz",
-    "Dr. Mittens",
-    "Dr. No",
-    "Dr. Pepper",
-    "Dr. Richard (after the Austrian bus company)",
-    "Dr. Ruth",
-    "Dr. Seuss",
-    "Dr. Spot",
-    "Dr. Who",
-    "Dr. Zhivago",
-    "Dr.Jekyll And Mr.Hyde",
-    "Draco",
-    "Dracula",
-    "Dracula Book",
-    "Dragon",
-    "Dragonheart",
-    "Dragonslayer",
-    "Dragutsa Mica (Romanian for \\",
-    "Draino",
-    "Drake",
-    "Drakus",
-    "Drama",
-    "Drambuie",
-    "Drammen",
-    "Draper",
-    "Draven",
-    "Dravyn",
-    "Dray (\\",
-    "Dreadnought",
-    "Dream Dancer",
-    "Dreamboat Annie",
-    "Dreamer",
-    "Dreamweaver",
-    "Drefan (old Anglo-Saxon name, means \\",
-    "Dreidel",
-    "Dresden",
-    "Drew",
-    "Dribble",
-    "Dribbles",
-    "Drifter",
-    "Drive Thru",
-    "Drizzle",
-    "Drool",
-    "Drooler",
-    "Droopy",
-    "Druff",
-    "Drummer",
-    "Drusilla",
-    "Dry Ice",
-    "Dua (Egyption Mythology: tomorrow)",
-    "Duane",
-    "Dubhgall",
-    "Dublin",
-    "Dubonnet",
-    "Duchess",
-    "Ducky",
-    "Duddley",
-    "Dude",
-    "Duder-Puder",
-    "Dudette",
-    "Dudley",
-    "Dudu",
-    "Duey",
-    "Duface",
-    "Duffy",
-    "Dufmeister",
-    "Dufus",
-    "Dugan",
-    "Dugong",
-    "Duke",
-    "Dukie",
-    "Duma",
-    "Dumb Cat",
-    "Dumb-butt",
-    "Dumbie",
-    "Dumble",
-    "Dumboy",
-    "Dumdum",
-    "Dumpling",
-    "Dumpy",
-    "Dumuzi (Mesopotamian mythology, the god of vegetation, fertility, and the underworld)",
-    "Dun",
-    "Dun-Ya",
-    "Duncan",
-    "Duncan Connar",
-    "Dundee (after the Marmelade)",
-    "Dune",
-    "Dunhill",
-    "Dunk",
-    "Dunka",
-    "Dunno",
-    "Duotone",
-    "Dupont",
-    "Dupree",
-    "Duracell",
-    "Duran Duran",
-    "Durango",
-    "Durin",
-    "Dushka (Russian name, means \\",
-    "Dusk",
-    "Dustbunny",
-    "Dusti",
-    "Dustie",
-    "Dustin",
-    "Dustmop",
-    "Dusty",
-    "Dusty Bear",
-    "Dusty Blue",
-    "Dusty Miller",
-    "Dusty Rose",
-    "Dutch",
-    "Dutchess",
-    "Dweeb",
-    "Dweeba",
-    "Dweezil",
-    "Dwinna",
-    "Dylan",
-    "Dynamite",
-    "Dynamo",
-    "Dyson",
-    "Dzindzine",
-    "DÈj‡ Vu",
-    "E-Cat",
-    "E.B. White (author of \\",
-    "E.C. (\\",
-    "E.M. (\\",
-    "E.T. (\\",
-    "E.T. (\\",
-    "E.V. (\\",
-    "Eamon",
-    "Earesistible",
-    "Earl",
-    "Earl Grey",
-    "Earline",
-    "Earnhardt",
-    "Earning Power",
-    "Ears",
-    "Ears R us",
-    "Earth",
-    "Eartha Kitt",
-    "Easel",
-    "Easter",
-    "Easter Cat",
-    "Eastwood",
-    "Eaton",
-    "Eban",
-    "Ebba",
-    "Ebbets",
-    "Ebby",
-    "Ebenezeer",
-    "Ebenezer",
-    "Eberhard",
-    "Ebi",
-    "Ebony",
-    "Ebony and Ivory",
-    "Ebony Lady of the Night",
-    "Ebow",
-    "Ebs",
-    "Echo",
-    "Eclair",
-    "Eclipse",
-    "Ed",
-    "Ed (from TV show Ed, Edd, and Eddy)",
-    "Ed Zeppelin",
-    "Eda Bagus mi Spudnick",
-    "Eddie",
-    "Eddy",
-    "Eddypuss",
-    "Edelweiss",
-    "Edgar",
-    "Edgar Allen Poe",
-    "Edge",
-    "Edhessa",
-    "Edie",
-    "Edison",
-    "Edith",
-    "Edmund",
-    "Edmunda",
-    "Edmundo",
-    "Edna",
-    "Edora",
-    "Edsel",
-    "Edseletta",
-    "Eduard the Great",
-    "Edward",
-    "Edward Scissor Paws",
-    "Edwin",
-    "Edy",
-    "EE",
-    "Eeaoo",
-    "Eeaoo The Fiercely Panther",
-    "Eecat",
-    "Eeney",
-    "Eeno",
-    "Eeyore",
-    "Effie",
-    "Efim",
-    "Efrem",
-    "Egbert",
-    "Egg Fu Young",
-    "Egg Roll",
-    "Egghead",
-    "Eggie (short for Eggletina)",
-    "Eggo",
-    "Eggplant",
-    "Eggroll",
-    "Eggs Benedict",
-    "Eggy",
-    "Egoiste",
-    "Egon",
-    "Egor",
-    "Egypt",
-    "Egyptian Queen",
-    "Eh?",
-    "Ehecatl (Aztec mythology: the god of wind)",
-    "Ei-Kan Be Friendly",
-    "Ei-Kan Sing The Blues",
-    "Ei-Kan Sometimes",
-    "Ei-Kan Tennymore",
-    "Ei-Kan Wind Up Toy",
-    "Eight-Ball",
-    "Eightball",
-    "Eiko",
-    "Einstein",
-    "Ekahau (Maya mythology: the god of travellers and merchants)",
-    "Ekaterina",
-    "Eko",
-    "Eko (after Mr. Eko in the tv series 'LOST')",
-    "El Cid, Cid!",
-    "El Gato",
-    "El Gato Flocko",
-    "El Toro",
-    "El-Ron Hubbard Squash",
-    "Ela",
-    "Elaina",
-    "Elana",
-    "Elanna",
-    "Elbee",
-    "Elderberry",
-    "Eldridge",
-    "Eleanor",
-    "Eleanor Rigby",
-    "Eleanor Roosevelt",
-    "Eleanor Roosevelt (wife of Franklin D. Roosevelt)",
-    "Electra",
-    "Elena",
-    "Eleni",
-    "Elenore",
-    "Elephant Head",
-    "Elephantop",
-    "Elephi (from the book \\",
-    "Eleven Fifty-Nine",
-    "Elf",
-    "Elfa",
-    "Elfie",
-    "Elfin",
-    "Elhomo",
-    "Eli",
-    "Eliah",
-    "Elian",
-    "Elias",
-    "Elie",
-    "Elijah",
-    "Elinor",
-    "Eliot (after the poet T.S. Eliot, author of the poems \\",
-    "Eliotte",
-    "Elisaveta",
-    "Elise",
-    "Elisei",
-    "Elite",
-    "Eliza",
-    "Elizabeth",
-    "Elizabeth Sterling Rose",
-    "Elizar",
-    "Elke",
-    "Ella",
-    "Elle (after the lead character from the movie \\",
-    "Ellen",
-    "Ellery (after the \\",
-    "Ellevis",
-    "Elli",
-    "Ellie",
-    "Ellie cat",
-    "Ellie Mae",
-    "Ellie Marie",
-    "Elliot",
-    "Elliot Ghoul",
-    "Elliott",
-    "Ellsworth",
-    "Elmar",
-    "Elmer",
-    "Elmer Fudd",
-    "Elmo",
-    "Elmolita",
-    "Elmyra",
-    "Eloise",
-    "Elphin",
-    "Elquatita",
-    "Elric",
-    "Elroy",
-    "Elsa",
-    "Elsa (named after the lioness in \\",
-    "Elsie",
-    "Eltie",
-    "Elton",
-    "Elton and John",
-    "Elvee",
-    "Elvie",
-    "Elvira",
-    "Elvira Sue",
-    "Elvis",
-    "Elvis Catley",
-    "Elvis Catstello",
-    "Elvis J. Kitty",
-    "Elvis Pretzel",
-    "Elway",
-    "Elwood and Jake (The Blues Brothers)",
-    "Em",
-    "Ember",
-    "Embers",
-    "Emelia",
-    "Emelian",
-    "Emelita",
-    "Emerald",
-    "Emerald Island Girl (song \\",
-    "Emerson",
-    "Emery (after the rock band)",
-    "Emi",
-    "Emil",
-    "Emil the Vicious",
-    "Emilie",
-    "Emiline the Feline",
-    "Emilio",
-    "Emily",
-    "Emily (named after Emily Bronte and Emily Dickinson)",
-    "Emily Kristina Patches",
-    "Emis",
-    "Emma",
-    "Emma Elizabeth",
-    "Emma Nintendo Motorboat",
-    "Emma Peel",
-    "Emma-Lee",
-    "Emmalee",
-    "Emmalith",
-    "Emmett",
-    "Emmie",
-    "Emmo",
-    "Emmy",
-    "Emmy Lou",
-    "Emo (pronounced EEE-MoWWWWW)",
-    "Emory",
-    "Emperior Creme De Coco",
-    "Emperor Shogun",
-    "Emrys",
-    "Enchantra",
-    "Enchantress",
-    "Enchilada",
-    "Encore",
-    "Ender",
-    "Endora",
-    "Endymion",
-    "Energizer",
-    "Englebert",
-    "English Rose",
-    "Enigma",
-    "Enterprise",
-    "Entropy",
-    "Enya",
-    "Enzo",
-    "Eo",
-    "Eowyn (from Lord of the Rings, the White Lady of Rohan, spouse of Faramir)",
-    "Epcot",
-    "Ephelia",
-    "Epic",
-    "Epidermis",
-    "Epsilon (Greek Letter E)",
-    "Epstein",
-    "Equal",
-    "Equiano",
-    "Equity",
-    "Eric",
-    "Erica",
-    "Erik",
-    "Erik the Red",
-    "Erin",
-    "Erin Andrews Marovich",
-    "Eris",
-    "Ermac (after the character in the Mortal Kombat game)",
-    "Ernest",
-    "Ernest T. Bass",
-    "Ernestine",
-    "Ernesto",
-    "Ernie",
-    "Eros",
-    "Erpy Cat",
-    "Errand Boy",
-    "Errol",
-    "Ertha Kitt",
-    "Escada",
-    "Escapade",
-    "Escher (after M.C. Escher)",
-    "Escondido",
-    "Escondito Bandito",
-    "Escort",
-    "Ese (Spanish for \\",
-    "Eshta",
-    "Eskimo",
-    "Eskimo Pie",
-    "Eskimo Spy",
-    "Esme",
-    "Esmeralda",
-    "Esmerelda",
-    "Esmond",
-    "Espanta (Spanish for \\",
-    "Espen",
-    "Espirit",
-    "Espresso",
-    "Esprit (French for \\",
-    "Esse",
-    "Essie",
-    "Esteban",
-    "Estee",
-    "Esther",
-    "Estos",
-    "Esty",
-    "Et Tu Brute",
-    "Etcetera",
-    "Eternity",
-    "Ethan",
-    "Ethel",
-    "Ethiopian Cat",
-    "Ethyl",
-    "Ethylene Goldbar",
-    "Etienne (from the movie LadyHawke)",
-    "Etta (after the Blues singer Etta James)",
-    "Etude Selene Vanadis Meri Ubastet",
-    "Euclid",
-    "Eudora",
-    "Euki",
-    "Eunice",
-    "Euphrate Kat",
-    "Euphrates",
-    "Eureka",
-    "Eureka Mao",
-    "Europa",
-    "Eurydice",
-    "Eurypides",
-    "Eustace",
-    "Eva",
-    "Evan",
-    "Evander",
-    "Eve",
-    "Evel",
-    "Evel Knievel",
-    "Evenrude",
-    "Everest",
-    "Everett",
-    "Everitt",
-    "Everly Brothers (Don and Phil)",
-    "Evie (Hebrew for \\",
-    "Eviesparrow",
-    "Evil",
-    "Evita",
-    "Ewok",
-    "Excalibur",
-    "Exeter",
-    "Exile",
-    "Exit, Stage Left!",
-    "Exit, Stage Right!",
-    "Exodus",
-    "Exotic Dancer",
-    "Exotica",
-    "Expi",
-    "Expialidocious",
-    "Expialidocious (brother to Supercalafragilistic)",
-    "Expresso",
-    "Extra",
-    "Extra Terrestrial",
-    "Eyeore",
-    "Eygpt",
-    "Eyore",
-    "Ezekiel",
-    "Ezmerelda",
-    "Ezra",
-    "Ezra Pound Kitty",
-    "F'rb'l (\\",
-    "F. Lee Bailey",
-    "F.C. (Funny Cat)",
-    "F.K. (Fish Killer)",
-    "F.W.",
-    "Faberette",
-    "Faberge",
-    "Fabio",
-    "Fable",
-    "Face",
-    "Faded",
-    "Fadei",
-    "Fafhrd",
-    "Fafnir (Swedish mythology: a dragon)",
-    "Fagan",
-    "Faina",
-    "Faire",
-    "Fairfax",
-    "Fairfax Fur Face",
-    "Fairway",
-    "Fairy",
-    "Faith",
-    "Faithful",
-    "Faja",
-    "Fajita",
-    "Fala",
-    "Falafel",
-    "Falcon",
-    "Falkor",
-    "Fallon",
-    "Falstaff",
-    "Family Guy",
-    "Fan-Fan",
-    "Fan-Fan the Van",
-    "Fancois",
-    "Fancy",
-    "Fancy Face",
-    "Fancy Feast",
-    "Fancy Pants",
-    "Fandango",
-    "Fang",
-    "Fang Baby",
-    "Fannie",
-    "Fanny",
-    "Fannymagee",
-    "Fanta",
-    "Fantasia",
-    "Faraday",
-    "Farasha (Female Arabian name, meaning \\",
-    "Farber",
-    "Farfel",
-    "Fargo",
-    "Farkas",
-    "Farkleberry",
-    "Farley",
-    "Farnsworth",
-    "Farpoint",
-    "Fartypants",
-    "Farukin",
-    "Fast Eddie",
-    "Fat Albert",
-    "Fat Baby Racoon",
-    "Fat Bastard",
-    "Fat Boy",
-    "Fat Cat",
-    "Fat Cat Mc.Cutey",
-    "Fat Freddy",
-    "Fat Knee",
-    "Fat Nitty",
-    "Fat One",
-    "Fat Pants",
-    "Fat Pig",
-    "Fat Puddin",
-    "Fat Sam",
-    "Fat Tail",
-    "Fat Thing",
-    "Fata (Italian for fairy, leprechaun, pixie)",
-    "Fatal Beauty",
-    "Fataz",
-    "FatBoy",
-    "Fatboy Paddington",
-    "Fatcat",
-    "Fatima",
-    "Fatouche (named after a type of Middle Eastern Salad)",
-    "Fatpants",
-    "Fatrick",
-    "Fats",
-    "Fats Domino",
-    "Fatsawobble",
-    "Fatsmo Cat",
-    "Fatso",
-    "Fattail",
-    "Fatty",
-    "Fatty Arbuckle",
-    "Fatty Boombalatti",
-    "Fatty Girl",
-    "Fatty Lumpkin",
-    "Fatty-Daddy-Catty",
-    "Fattycat",
-    "Fatz",
-    "Faucet Face",
-    "Fauna",
-    "Fauna (Roman religion: also called Bona Dea, the female counterpart of Faunus)",
-    "Fauntleroy",
-    "Faunus (Roman religion: woodland deity, protector of herds and crops)",
-    "Faust",
-    "Faustus",
-    "Faux Pas",
-    "Faux Paws",
-    "Fawn",
-    "Fax",
-    "Fay",
-    "Faya",
-    "Fayd",
-    "Fayoum (province in Egypt)",
-    "FBI Special Agent Kat",
-    "Fearful",
-    "Fearless",
-    "Fearless Fosdick",
-    "Fearless J. Mousebiter",
-    "Feather",
-    "Feather Boy",
-    "Febian",
-    "Fedia",
-    "Fedor",
-    "Fedora",
-    "Fedosia",
-    "Fedot",
-    "Fee-cat",
-    "Feedback",
-    "Feester",
-    "Feetee",
-    "Fefe",
-    "Feifel",
-    "Feisty",
-    "Fela",
-    "Feldmann",
-    "Feles",
-    "Felice (combination of Faith and Elise, meaning Joy)",
-    "Felicia",
-    "Felicicat",
-    "Felicity",
-    "Felicja",
-    "Felidae (lions, tigers, cats and others are members of the Felidae (feline) family)",
-    "Felina",
-    "Feline",
-    "Feline Unit",
-    "Felini",
-    "Felinoid",
-    "Felinus Divinus",
-    "Felipe Juan (after the Spanish prince Felipe Juan de Marichalar y BorbÛn)",
-    "Felis Domesticus MonoOculus Longintoothus",
-    "Felisha",
-    "Felix the Cat (cartoon character)",
-    "Feliz",
-    "Fellini",
-    "Felo",
-    "Female Kitten",
-    "Fender",
-    "Fender Bender",
-    "Fendi (after the fashion accessories brandname)",
-    "Fenella (Irish name meaning \\",
-    "Fenestra",
-    "Fennel",
-    "Fenton",
-    "Fenway",
-    "Fenway Frank (Red Sox)",
-    "Fenwick",
-    "Feo",
-    "Feodor",
-    "Feona",
-    "Feonia",
-    "Feral",
-    "Ferapont",
-    "Ferdinand",
-    "Ferdinand de la Casa",
-    "Ferdy",
-    "Fergie",
-    "Fergus",
-    "Ferlando",
-    "Fermi",
-    "Fermi-dee",
-    "Fermi-wirmi",
-    "Fern",
-    "Fernando",
-    "Feroscia",
-    "Ferrari",
-    "Ferreo",
-    "Ferret Face",
-    "Ferris",
-    "Fertile Myrtle",
-    "Fervel Hardeman",
-    "Fester",
-    "Festus",
-    "Fetch",
-    "Fetchercat",
-    "Fettucine",
-    "Fevronia",
-    "Fezzik",
-    "Fezziwig (character from Dickens' A Christmas Carol)",
-    "Fia Fia",
-    "Fianne",
-    "Fiapinho",
-    "Fibi",
-    "Fickle",
-    "Fidde",
-    "Fiddlesticks",
-    "Fidel",
-    "Fidel Catsro",
-    "Fideli",
-    "Fidelio",
-    "Fidget",
-    "Fido",
-    "Field",
-    "Fien",
-    "Fierce",
-    "Fiery",
-    "Fiesta",
-    "Fiesta Cat",
-    "Fiesty",
-    "Fievel",
-    "Fifi",
-    "Fig",
-    "Figaro",
-    "Figaroo",
-    "Figero",
-    "Figgie",
-    "Figgles",
-    "Figgus Pushtinky Pushmoshkin Bogenbroom McTavish",
-    "Figment",
-    "Figo",
-    "Figoro",
-    "Fiji",
-    "Fikri",
-    "Fila",
-    "Filbert",
-    "Filibuster",
-    "Filimon",
-    "Fillmore",
-    "Filo",
-    "Filofei",
-    "Filou (pronounced \\",
-    "Filthy Cat",
-    "Fima",
-    "Fimo",
-    "Finale",
-    "Findley",
-    "Findus",
-    "Fingers",
-    "Finian",
-    "Fink",
-    "Finlay",
-    "Finley",
-    "Finn",
-    "Finn MacCool",
-    "Finn The Wonder Rex",
-    "Finnegan",
-    "Finnigan",
-    "Finniminnigan",
-    "Finster",
-    "Fintoozler",
-    "Fiona",
-    "Fiore (Italian for \\",
-    "Fiorella (Italian for \\",
-    "Firdy",
-    "Fireball",
-    "Firebird",
-    "Firebug",
-    "Firecat",
-    "Firecracker",
-    "Firefly",
-    "Fireman Bob",
-    "Firenze",
-    "Fireside",
-    "Firousi",
-    "Fisby",
-    "Fisch",
-    "Fish",
-    "Fish Bait",
-    "Fish face",
-    "Fish head",
-    "Fishbone",
-    "FishFace",
-    "Fishhead",
-    "FishStick",
-    "Fishsticks",
-    "Fisnik",
-    "Fister",
-    "Fitch",
-    "Fittan",
-    "Fitts",
-    "Fitzgerald",
-    "Fitzhugh",
-    "FitziePie",
-    "Fitzpatrick",
-    "Fitzwillie",
-    "Fiver",
-    "Fizban",
-    "Fizz",
-    "Fizzgig",
-    "Fizzgig Felix Potvin (after the Dark Crystal and the goalie)",
-    "Fizzie",
-    "Fizzle",
-    "Fizzo",
-    "Fizzy",
-    "Fjodor",
-    "Flakey",
-    "Flaky-Jake",
-    "Flame",
-    "Flannel",
-    "Flap",
-    "Flapjacks",
-    "Flapper",
-    "Flare",
-    "Flash",
-    "Flash'n Dash",
-    "Flashlight",
-    "Flauta",
-    "Flavius",
-    "Flea",
-    "Flea Bags",
-    "Flea Bailey",
-    "Flea Brain",
-    "Flea Circus",
-    "Flea Feast",
-    "Flea Free",
-    "Flea Lady",
-    "Fleabag",
-    "Fleala",
-    "Fleas",
-    "Fledermaus",
-    "Flee",
-    "FleeBag",
-    "Fleetwood",
-    "Fletch",
-    "Fletcher",
-    "Fleur (French for \\",
-    "Fleurette",
-    "Flexx",
-    "Flick",
-    "Flicka",
-    "Flicker",
-    "Flicker Noodle",
-    "Fling",
-    "Flint",
-    "Flip",
-    "Flipflap",
-    "Flipper",
-    "Flippy",
-    "Flirt",
-    "Flirty-Girl",
-    "Fliss",
-    "Flo",
-    "Floatsom",
-    "Flocko",
-    "Floella",
-    "Floor",
-    "Floozy",
-    "Flop",
-    "Flopper",
-    "Flopper Bopper",
-    "Flopsy",
-    "Flora Or Fauna",
-    "Florence (after Florence Nightingale)",
-    "Florida",
-    "Florida Kitty",
-    "Florrie O'Driscoll",
-    "FlorÈnda",
-    "Flossy",
-    "Flounder",
-    "Flower",
-    "Flower Face",
-    "Flowerbelle",
-    "Floyd (after Pink Floyd)",
-    "Floydean",
-    "Flubbadubba",
-    "Flubberty",
-    "Fluff",
-    "Fluff Ball",
-    "Fluff Napoleon",
-    "Fluffee",
-    "Fluffer Kitty McNickles",
-    "Fluffernutter",
-    "Fluffers",
-    "Fluffers Meowkins",
-    "Fluffers Tail",
-    "Fluffinzee",
-    "Fluffles",
-    "Fluffly",
-    "Fluffmister",
-    "Fluffo",
-    "Fluffster",
-    "Fluffy",
-    "Fluffy And Sassy",
-    "Fluffy Bum Mc.Cuddles",
-    "Fluffy Butt",
-    "Fluffy Love",
-    "Fluffy-kins",
-    "Fluffybritches",
-    "Fluffypants",
-    "Fluke",
-    "Fluke Catwalker",
-    "Fluky",
-    "Flurri",
-    "Flurry",
-    "Flush",
-    "Fly By Nite",
-    "Fly Girl",
-    "Focker",
-    "Fog (from the line in the poem \\",
-    "Foggy",
-    "Foggy Bottoms",
-    "Foghorn",
-    "Foie Gras",
-    "Foka",
-    "Folderol",
-    "Foldilocks",
-    "Foley",
-    "Folletto (Italian for bogey, elf, elfin, goblin, gremlin, hobgoblin, imp, pixie, sprite)",
-    "Foma",
-    "Fondue",
-    "Fontaine",
-    "Fontana",
-    "Fonzi",
-    "Fonzie",
-    "Foo",
-    "Foo Man Choo",
-    "Foo-be-doo",
-    "Foobahwho",
-    "Foobar",
-    "Food",
-    "Food Face",
-    "Food Lion",
-    "Foody",
-    "Foody-Pudy",
-    "Foof",
-    "Foofus",
-    "Fooker-Doo",
-    "Fooshnickers",
-    "Football",
-    "Footee",
-    "Footnote",
-    "Foozle",
-    "Fopulgorus",
-    "Forbes",
-    "Ford",
-    "Forest Gump",
-    "Forever",
-    "Formless Spawn",
-    "Formosa",
-    "Forrest",
-    "Forrest Gump",
-    "Fortuna",
-    "Fos",
-    "Fosgate",
-    "Foster",
-    "Found",
-    "Four-By",
-    "Four-Legged Reason For Living",
-    "Four-Oh-Seven",
-    "Fox",
-    "Fox \\",
-    "Foxbat (after the animal, not the aircraft)",
-    "Foxi",
-    "Foxie",
-    "Foxx Il Madonna",
-    "Foxxy Lucas",
-    "Foxy",
-    "Foxy Roo",
-    "Foxy Roxy",
-    "Foxykat",
-    "Fozzy (from The Muppets)",
-    "Fozzy Bear",
-    "Frac (companion to Fric)",
-    "Fracinator",
-    "Frack",
-    "Fractal",
-    "Frafrik",
-    "Fraggle",
-    "Fragglewoof",
-    "Fraidee",
-    "Fraidey",
-    "Fraidy",
-    "Fraidy Cat",
-    "Fran",
-    "Frances",
-    "Francesca",
-    "Francesco",
-    "Franchesca",
-    "Franchise",
-    "Francine",
-    "Francis",
-    "Francis Albert",
-    "Francois",
-    "Frangelico",
-    "Frangipane",
-    "Franjelica",
-    "Frank",
-    "Frank Lloyd White",
-    "Frank N. Furter",
-    "Frankenfurter",
-    "Frankenstein",
-    "Frankie",
-    "Frankie Blue Eyes (after Frank Sinatra)",
-    "Frankincense and Purr",
-    "Franklberry Mchooterflurry",
-    "Franklin",
-    "Franklin Blue (named after \\",
-    "Franklin Delano Roosevelt",
-    "Franklin Delano Rosencat",
-    "Franko",
-    "Franky",
-    "Frannie",
-    "Franny",
-    "Franz",
-    "Franz Lisp",
-    "Franzie",
-    "Frasier",
-    "Frassy",
-    "Frau (German for \\",
-    "Frau Grau (German for \\",
-    "Frau Hintze",
-    "Frazer",
-    "Frazier",
-    "Frazzle",
-    "Frazzles",
-    "Freak",
-    "Freak Face",
-    "Freaker Beaker",
-    "Freaker Mao",
-    "Freakie",
-    "Freakmeister",
-    "Freakster",
-    "Freaky",
-    "Freaky Mc.Cutey",
-    "Freckles",
-    "Fred",
-    "Freddie",
-    "Freddo",
-    "Freddy",
-    "Freddy Cat",
-    "Freddy Kruger",
-    "Freddywetabeanbag",
-    "Frederica",
-    "Frederick",
-    "Frederick Chopin",
-    "Frederik",
-    "Frederina Ballerina",
-    "Fredie",
-    "Fredo (from \\",
-    "Fredrika",
-    "Fredsel",
-    "Fredseletta",
-    "Free",
-    "Free-Way",
-    "Freebie",
-    "Freeda",
-    "Freedom",
-    "Freek",
-    "Freeway",
-    "Freeza",
-    "Freida",
-    "Fremont",
-    "French Kiss",
-    "Frenchie",
-    "Frenzy",
-    "Freo",
-    "Freon",
-    "Fresca",
-    "Fresno",
-    "Freud",
-    "Frey (Viking mythology: the god of weather and fertility)",
-    "Freya (Viking mythology: the goddess of fertility)",
-    "Freyar",
-    "Freydis",
-    "Friar Tuck",
-    "Fric",
-    "Frick",
-    "Frida",
-    "Friday",
-    "Fridolin",
-    "Frieda",
-    "Friederike",
-    "Friend",
-    "Friendly",
-    "Friendly Kitty",
-    "Friendy",
-    "Frijole",
-    "Fringer",
-    "Frip",
-    "Frisbee",
-    "Frisco",
-    "Friskey",
-    "Friskie",
-    "Frisky",
-    "Fristie",
-    "Fritti",
-    "Fritz",
-    "Fritz Patrick",
-    "Fritzi",
-    "Fritzy",
-    "Frizzle",
-    "Frobisher",
-    "Frodo (from The Lord of the Rings)",
-    "Frog",
-    "Froggy",
-    "Froglet",
-    "Fromage",
-    "Fromagon",
-    "Fronk",
-    "Froopy",
-    "Frost",
-    "Frostbyte",
-    "Froster",
-    "Frostfur (cat from the \\",
-    "Frostie",
-    "Frosty",
-    "Frou-Frou",
-    "Frowsy",
-    "Fruit",
-    "Fruitbat",
-    "Fruitcake",
-    "Fruitcup",
-    "Fruitloop",
-    "Fruitstew",
-    "Fruity",
-    "Frumisera",
-    "Fu",
-    "Fu Man Chu",
-    "Fu Ming Chu",
-    "Fubar",
-    "Fuchsia",
-    "Fudd",
-    "Fuddles",
-    "Fudge",
-    "Fudgie",
-    "Fuel",
-    "Fuff",
-    "Fuffly",
-    "Fuffy Kitty",
-    "Fugazi",
-    "Fuji",
-    "Fujiama",
-    "Fuki (Japanese for \\",
-    "Fulton",
-    "Fungi",
-    "Fungus",
-    "FungusUmungus",
-    "Funguy",
-    "Funky",
-    "Funky Monkey",
-    "Funky Munky",
-    "Funky Music",
-    "Funny",
-    "Funny Bunny",
-    "Funny Face",
-    "Funnyface",
-    "Funnygirl",
-    "Funtime",
-    "Fur",
-    "Fur Ball Ester",
-    "Fur Elise",
-    "Fur Face",
-    "Fur Master",
-    "Fur Princess",
-    "Furari",
-    "Furbaby",
-    "Furbag",
-    "Furball",
-    "Furbeast",
-    "Furbee",
-    "Furbs",
-    "Furby",
-    "Furcat",
-    "Furdy",
-    "Furface",
-    "Furgie",
-    "Furgood",
-    "Furgus",
-    "Furica",
-    "Furigty",
-    "Furioso",
-    "Furman",
-    "Furp",
-    "FurPerson",
-    "Furr",
-    "Furr Ball",
-    "Furrball",
-    "Furrface",
-    "Furrfect",
-    "Furrgus",
-    "Furriness",
-    "Furrpurr",
-    "Furry",
-    "Furry Boy",
-    "Furry Elise",
-    "Furry Fuzzy Kitty",
-    "Furry Girl",
-    "Furry-Purry",
-    "Furstenberg",
-    "Fury",
-    "Fusser",
-    "Fusty",
-    "Fuuschnicken",
-    "Fuzz",
-    "Fuzz Ball",
-    "Fuzz Buster",
-    "Fuzz Butt",
-    "Fuzz-Brain",
-    "Fuzzball",
-    "Fuzzbrain",
-    "Fuzzbucket",
-    "Fuzzbunz",
-    "Fuzzbuster",
-    "Fuzzbutt",
-    "Fuzzbuzz",
-    "Fuzzface",
-    "Fuzzie",
-    "Fuzzle",
-    "Fuzzmeist",
-    "Fuzzmental",
-    "Fuzzmuzz",
-    "Fuzznut",
-    "Fuzzums",
-    "Fuzzy",
-    "Fuzzy Face",
-    "Fuzzy Inky Kitty",
-    "Fuzzy Wuzzy Baby Bear",
-    "Fuzzy Wuzzy Bear",
-    "Fuzzy-Moto",
-    "Fuzzybucket",
-    "Fuzzybugger",
-    "FuzzyButt",
-    "Fymi",
-    "Fyvush",
-    "G Whillikers",
-    "G-man",
-    "G.a.n.d.a.l.f. (Genetically Altered Naturally Deformed Alternative Lifeform)",
-    "G.E.M. (\\",
-    "G.e.n.d.e.l.f. (Genetically Engineered Naturally Deformed Eligent Life Form)",
-    "G.K. (\\",
-    "G.P.",
-    "G.S.C.",
-    "Gaazh",
-    "Gab-EE-Boy",
-    "Gabba-Goo",
-    "Gabbie (short for Gabriella)",
-    "Gabby",
-    "Gabby Tabby",
-    "Gabe",
-    "Gabielle",
-    "Gabriel",
-    "Gabriella",
-    "Gabrielle",
-    "Gabrielle St. Cloud",
-    "Gaby",
-    "Gadget",
-    "Gadir (island in Lake Van, Turkey)",
-    "Gaelic",
-    "Gag",
-    "Gage",
-    "Gageta",
-    "Gaia",
-    "Gaius",
-    "Gala",
-    "Galadriel (Lady of the Elves, Elven Princess)",
-    "Galahad",
-    "Galaxy",
-    "Galena (shiny gray stone known as the Truth Stone)",
-    "Galia",
-    "Galileo",
-    "Galina",
-    "Gallagher",
-    "Gallahad",
-    "Galleria",
-    "Galloise",
-    "Galloping Gor\\",
-    "Galloping Grey",
-    "Galooli",
-    "Galveston",
-    "Gambia",
-    "Gambino",
-    "Gambit",
-    "Gambler",
-    "Gamiel",
-    "Gamin",
-    "Gamina",
-    "Gamine",
-    "Gamma",
-    "Gamma Ray",
-    "Gandalf",
-    "Gandhi",
-    "Gandolf The Grey",
-    "Gandolf The Grey Cat",
-    "Gandy",
-    "Gangsta",
-    "Gangster",
-    "Ganit Gob",
-    "Ganymede (named after the moon of Jupiter)",
-    "Gar-Gar",
-    "Gara",
-    "Garbo",
-    "Garby",
-    "Garcia (after Jerry Garcia, the Grateful Dead)",
-    "Gareth",
-    "Garf",
-    "Garfeild",
-    "Garfield",
-    "Garfields Girlfriend",
-    "Garfiled",
-    "Garfunkle",
-    "Garfy",
-    "Gargamel",
-    "Gargantua",
-    "Gargoyle",
-    "Garlic",
-    "Garou",
-    "Garp",
-    "Garrett",
-    "Garrick",
-    "Garrick Utley",
-    "Garrison",
-    "Garrison Keillor",
-    "Garth",
-    "Garth Brooks",
-    "Garvin",
-    "Gary",
-    "Gash",
-    "Gasket",
-    "Gaskins",
-    "Gassy Boy",
-    "Gassy Girl",
-    "Gaston",
-    "Gata",
-    "Gata (Spanish for \\",
-    "Gatacito",
-    "Gateau",
-    "Gatekeeper",
-    "Gatinha (Portuguese for \\",
-    "Gatita",
-    "Gatita Roofshadow",
-    "Gato",
-    "Gator",
-    "Gatos",
-    "Gatsby",
-    "Gatu",
-    "Gatui",
-    "Gavin",
-    "Gavrila",
-    "Gawain",
-    "Gay",
-    "Gaye",
-    "Gaynor",
-    "Gazelle",
-    "Gazer",
-    "Gazette",
-    "Gazone",
-    "Gazoo",
-    "Gazork",
-    "Gazpacho",
-    "Gecko",
-    "Gedeon",
-    "Gee",
-    "Geebee",
-    "Geek",
-    "Geekie",
-    "Geena",
-    "Geena Davis",
-    "Geener",
-    "Geepee",
-    "Geesha (not Geisha)",
-    "Geezer",
-    "Geezer Guy Of Gisbourne",
-    "Gefahr",
-    "Gehenna (Hebrew for \\",
-    "Geisha",
-    "Geisha Girl",
-    "Gellar",
-    "Gelsemina",
-    "Gem",
-    "Gembles",
-    "Gemini",
-    "Gemma",
-    "Gemmie",
-    "Gemmie Wemmie",
-    "Gena",
-    "General",
-    "General Lee",
-    "General Tso",
-    "Generic Cat",
-    "Genesis",
-    "Genevieve",
-    "Gengero",
-    "Genghis",
-    "Genghiskhat",
-    "Genie",
-    "Genious",
-    "Genius",
-    "Genji",
-    "Gennessee Cream Ale",
-    "Genny",
-    "Genny (short for Generic Cat)",
-    "Geno",
-    "Genova",
-    "Gentile (pronounced Jean-tee-lay)",
-    "Gentlegift",
-    "Geoffrey",
-    "Geoph",
-    "Geordi",
-    "Georg",
-    "Georga",
-    "George",
-    "Georgia",
-    "Georgia O'Keefe",
-    "Georgiana",
-    "Georgie",
-    "Georgie Girl",
-    "Georgie Porgie",
-    "Georgina",
-    "Geppetto",
-    "Geppo",
-    "Gerald",
-    "Geraldine",
-    "Geranium",
-    "Gerard",
-    "Geras",
-    "Gerbil",
-    "German",
-    "Geronimo",
-    "Gershwin",
-    "Gertjie (Afrikaans version of \\",
-    "Gertrude",
-    "Gestapo",
-    "Get A Load Of This (father)",
-    "Get Down",
-    "Get Off Of The Counter, Now!",
-    "Get Shorty",
-    "Gex",
-    "Gggrrrace",
-    "Ghandi",
-    "Ghee",
-    "Ghengis Khan",
-    "Ghengis Khat",
-    "Ghetto",
-    "Ghiradelli",
-    "Ghiz",
-    "Ghizzy Girl",
-    "Ghost",
-    "Ghost Face Kitty",
-    "Ghostbuster",
-    "Ghostwalker",
-    "Giagantic Man",
-    "Giant",
-    "Giantic",
-    "Gib",
-    "Gibb",
-    "Gibber",
-    "Gibby",
-    "Gibster",
-    "Gica",
-    "Giddy",
-    "Giddy Kitty",
-    "Gideon",
-    "Gidget",
-    "Gifford",
-    "Gift Of Siam",
-    "Giga",
-    "Giga Bites",
-    "Giggles",
-    "Giggles The Cat",
-    "Giggs",
-    "Gigi",
-    "Gigia",
-    "Gigio",
-    "Gigolo",
-    "Gilbert",
-    "Gilbert Grape",
-    "Gilda",
-    "Gilda Radner",
-    "Gildo",
-    "Gilgamesh",
-    "Gilligan",
-    "Gilligan And Skipper",
-    "Gilmore",
-    "Gilroy",
-    "Gimi",
-    "Gimlet",
-    "Gimli (after the dwarf in Lord of the Rings)",
-    "Gimmy",
-    "Gimp",
-    "Gin (and Tonic)",
-    "Gin Gin",
-    "Gina",
-    "Gina Roo",
-    "Gina-Roo",
-    "Ginger",
-    "Ginger Ale Frisky Yin Miller",
-    "Ginger Jake",
-    "Ginger Rogers",
-    "Ginger Snap",
-    "Gingerchicken",
-    "Gingerell",
-    "Gingersnap",
-    "Gingervitis",
-    "Gingham",
-    "Ginginchicken",
-    "Ginko",
-    "Ginni",
-    "Ginnie",
-    "Ginny",
-    "Gino",
-    "Ginseng",
-    "Giorgio Armani",
-    "Giovanni",
-    "Gipper",
-    "Gipper (after football player George Gipp)",
-    "Girl",
-    "Girl Kitty",
-    "Girl Power",
-    "Girlfriend",
-    "GirlGirl",
-    "GirlieBoy",
-    "Giro",
-    "Giselle",
-    "Gismo",
-    "Given",
-    "Givey",
-    "Gizetta",
-    "Gizmacious",
-    "Gizmet",
-    "Gizmo",
-    "Gizzard",
-    "Gizzi Finkelstein",
-    "Gizzie",
-    "Gizzly",
-    "Gizzy",
-    "Glacial",
-    "Glacier",
-    "Glacieroonie",
-    "Gladstone",
-    "Gladys",
-    "Gladys Knight (with her baby, Pips)",
-    "Glaish",
-    "Glasha",
-    "Glasnost",
-    "Glee",
-    "Gleep",
-    "Glen",
-    "Glen Ellen",
-    "Glen's Stupid Cat",
-    "Glenda",
-    "Glenn",
-    "Glitter",
-    "Glitter Kitty",
-    "Glitzy",
-    "Glori",
-    "Gloria",
-    "Gloucester",
-    "Gloves",
-    "Glow",
-    "Glowy",
-    "Gnome",
-    "Gnoreha",
-    "Goalie",
-    "Goat",
-    "Gob",
-    "Gobaith",
-    "Gobble",
-    "Gobbles",
-    "Gobby",
-    "Gobin",
-    "Goblin",
-    "Goddess",
-    "Godess Cat",
-    "Godfather",
-    "Godfrey",
-    "Godiva",
-    "Godnilla",
-    "Godot",
-    "Godzilla",
-    "Godzilla Cat",
-    "Goethe",
-    "Goetta",
-    "Gojino (As in Goldy)",
-    "Golda",
-    "Golda My Ears",
-    "Goldberg",
-    "Golddigger",
-    "Golden Boy",
-    "Golden Girl",
-    "Goldenrod",
-    "Goldfinger",
-    "Goldie",
-    "Goldilocks",
-    "Golfball",
-    "Goliath",
-    "Gollum",
-    "Golly",
-    "Golly Gee",
-    "Gomer",
-    "Gomez",
-    "Gondra",
-    "Gonyaulux Catanella E.",
-    "Gonzilla",
-    "Gonzo",
-    "Goober",
-    "Goobernogen",
-    "Goobie Cat",
-    "Goobs",
-    "Gooch",
-    "Good Bye",
-    "Good Golly",
-    "Good Lookin",
-    "Goodbye Girl",
-    "Goodfella",
-    "Goodfellow",
-    "Goodie",
-    "Goodie Four-Paws",
-    "Goodie Girl",
-    "Goodie Goodie",
-    "Goodkitty",
-    "Goodness",
-    "Goodness Gracious",
-    "Goodyear",
-    "Goodyear The Blimp",
-    "Goof",
-    "Goofball",
-    "Goofus",
-    "Goofy",
-    "Goofy Cat",
-    "Goofy Goof",
-    "Googly",
-    "Googy",
-    "Goomba",
-    "Goose",
-    "Goosie",
-    "Gopher",
-    "Gorbachev Amadeus",
-    "Gorbechov",
-    "Gorbeh Bozorg",
-    "Gorbi",
-    "Gorby",
-    "Gordei",
-    "Gordo",
-    "Gordon",
-    "Gordy",
-    "Gorey",
-    "Gorgeous",
-    "Gorgeous Furboy",
-    "Gorilla",
-    "Gork",
-    "Gorky (after Arshielle Gorky, the painter)",
-    "Gorman",
-    "Goronwy",
-    "Gosha",
-    "Gosho",
-    "Gossamer",
-    "Got Milk?",
-    "Gotti",
-    "Gouda",
-    "Goudhi",
-    "Goulash",
-    "Goustav",
-    "Graaben",
-    "Grace",
-    "Grace (after Grace Kelly)",
-    "Grace and Glory",
-    "Grace Elizabeth",
-    "Grace Kitty",
-    "Grace Olivia",
-    "Gracie",
-    "Gracie Allen",
-    "Gracious",
-    "Grady",
-    "Grafitti",
-    "Graham",
-    "Graham Crackers",
-    "Gramma",
-    "Gramps",
-    "Grand",
-    "Grand Duke Friedman",
-    "Grand Waffle",
-    "Grandeur",
-    "Grandma",
-    "Grandpaw",
-    "Granger",
-    "Granit",
-    "Granite",
-    "Grannie",
-    "Grant",
-    "Grape-Nuts",
-    "Grapes",
-    "Grapple",
-    "Grasshoppah",
-    "Grasshopper",
-    "Grateful Ed",
-    "Gravedancer",
-    "Gravy",
-    "Gray",
-    "Gray Boy",
-    "Gray Ghost",
-    "Gray Guy",
-    "Gray Kitty Cat",
-    "Gray One",
-    "Gray-Puss",
-    "Grayboy",
-    "Grayce",
-    "Graycie",
-    "Grayman",
-    "Grayp's (Gray Puss)",
-    "Grayson",
-    "Graystoke",
-    "Grayus Kitty Cattus",
-    "Graza",
-    "Grazie",
-    "Grazzi",
-    "Grease Monkey",
-    "Greased Lightning",
-    "Greasy",
-    "Great Pet",
-    "Great Spud Wombler",
-    "Great-Grandma",
-    "Greatest Hits",
-    "Greco",
-    "Gredie",
-    "Greebo (after the witch's cat in the Terry Pratchett discworld novels)",
-    "Greebo (cat in the Discworld novels)",
-    "Greedy",
-    "Green Eyed Monster",
-    "Green-Eyes",
-    "Greeny Gerocious",
-    "Greg",
-    "Gregarious Gizmo",
-    "Gregory",
-    "Gregory the Great (Pope from 590)",
-    "Gremlin",
-    "Grendel",
-    "Greta",
-    "Greta Marie",
-    "Gretchec",
-    "Gretchen",
-    "Gretel (from \\",
-    "Gretzky",
-    "Greven",
-    "Grey",
-    "Grey A",
-    "Grey And White Baby",
-    "Grey Bear",
-    "Grey Cat",
-    "Grey Gatsby",
-    "Grey Girl",
-    "Grey Kitty",
-    "Grey Poupon",
-    "Greybear",
-    "Greyble",
-    "Greyboy",
-    "Greycloak",
-    "Greyel",
-    "Greyfuss",
-    "Greyjob",
-    "Greykin",
-    "Greyling",
-    "Greymalkin (after the grey cat familiar of the witches in \\",
-    "Greyson",
-    "Greystoke",
-    "Griddlebone",
-    "Griegerottoswanzig von der Bitte Doch Borussia Mˆnchengladbach",
-    "Griffin",
-    "Griffincat",
-    "Griffon (after the building decoration)",
-    "Griffy",
-    "Grigoriy",
-    "Grim (as in Reaper)",
-    "Grimalkin",
-    "Grimmy",
-    "Grincheux",
-    "Gringo",
-    "Griper",
-    "Gripette",
-    "Griselda (French for \\",
-    "Grisha",
-    "Grisou",
-    "Grits",
-    "Griz",
-    "Grizabell",
-    "Grizabella",
-    "Grizelda",
-    "Grizwald",
-    "Grizzelda",
-    "Grizzie",
-    "Grizzie Bear",
-    "Grizzle",
-    "Grizzly",
-    "Grizzly Bear",
-    "Grizzy",
-    "Grogan",
-    "Grohl (after the Nirvana drummer Dave Grohl)",
-    "Gromit",
-    "Gromph",
-    "Gronk",
-    "Groovycats Samuel Clemens",
-    "Grotton",
-    "Groucho",
-    "Grouchy",
-    "Grover",
-    "Growl",
-    "Growltiger",
-    "Grub",
-    "Grubber",
-    "Grublette",
-    "Gruenor",
-    "Gruesome",
-    "Grum",
-    "Grumbleduke",
-    "Grumitchka",
-    "Grummitch",
-    "Grumpcat",
-    "Grumpus",
-    "Grumpy",
-    "Grunge",
-    "Grunion",
-    "Grunt",
-    "Guaymas",
-    "Gub-Gub (Dr. Doolittle's pig)",
-    "Gucci",
-    "Guenhwyvar",
-    "Guenivere",
-    "Guffaw",
-    "Guffy",
-    "Guga (after the tennis player Gustavo Kuerten)",
-    "Guido",
-    "Guinevere",
-    "Guinness",
-    "Gulliver",
-    "Gully",
-    "Gumba",
-    "Gumba-gumba",
-    "Gumball",
-    "Gumbo",
-    "Gumby",
-    "Gumby And Pokey",
-    "Gumdrop",
-    "Gummie Bear",
-    "Gummitch",
-    "Gumnut",
-    "Gump",
-    "Gumpo",
-    "Gumps",
-    "Gumto",
-    "Gung Ho",
-    "Gunner",
-    "Gunsmoke",
-    "Gunter",
-    "Gunther",
-    "Guppy",
-    "Gurgi (after the character in the Disney movie \\",
-    "Gurgle",
-    "Gurrumina",
-    "Guru",
-    "Gus",
-    "Gus-Gus",
-    "Gusano",
-    "Guss",
-    "Gussie",
-    "Gussy",
-    "Gustaf",
-    "Gustalph Meowler",
-    "Gustalph Meowler Von Kittenshitz",
-    "Gustav",
-    "Gustav Mahler",
-    "Gustavus",
-    "Guster",
-    "Gusto",
-    "Gustopher",
-    "Gustopher Jones",
-    "Gustopher Robin",
-    "Gutsy",
-    "Guy",
-    "Guybrush",
-    "Guzo",
-    "Gwen",
-    "Gwendolyn",
-    "Gwenhyvar",
-    "Gweniviere",
-    "Gwennie",
-    "Gwin (after the character in the Inkheart novel by Cornelia Funke)",
-    "Gwynneth",
-    "Gyges",
-    "Gypper",
-    "Gypsaroo",
-    "Gypsy",
-    "Gypsyrose",
-    "Gyro",
-    "Gyzmo",
-    "H.A.K. (Hugs And Kisses)",
-    "H.A.L. (from the movie 2001)",
-    "H.D. (\\",
-    "H.S. Truman",
-    "H.W. (\\",
-    "Haagendaz",
-    "Haar",
-    "Habanero (variety of pepper, very hot)",
-    "Haberdasher",
-    "Haboko (Japanese for \\",
-    "Hachi-Ko",
-    "Hacker",
-    "Hacki-Sack",
-    "Hade-Na",
-    "Hades",
-    "Hadji",
-    "Hadjii",
-    "Hadley (heath covered meadow)",
-    "Hadron (subatomic particle)",
-    "Hagar",
-    "Hagar The Horrible",
-    "Hahn",
-    "Haida",
-    "Haides",
-    "Haiku",
-    "Haile",
-    "Haile Selassie",
-    "Hailey",
-    "Hair Ball",
-    "Hair Factory",
-    "Hair Licker",
-    "Hairball",
-    "Hairball Hockker the Horrible",
-    "Hairry",
-    "Hairy",
-    "Hairy Nettik",
-    "Hairy Truman",
-    "Haiya (means \\",
-    "Haj",
-    "Haji",
-    "Hajja",
-    "Hajur",
-    "Hal",
-    "Halaboot",
-    "Halc",
-    "Halcyon",
-    "Hale",
-    "Haley",
-    "Half And Half",
-    "Half Half And Half",
-    "Half Hot Chocolate",
-    "Half Moon",
-    "Half-pint",
-    "Halfacat",
-    "Halfshell",
-    "Halibut",
-    "Halleyween",
-    "Hallie",
-    "Halloween",
-    "Hallway",
-    "Halo",
-    "Halo of Venom",
-    "Halolo",
-    "Halon",
-    "Halsey",
-    "Ham",
-    "Ham and Beans",
-    "Ham and Eggs",
-    "Ham Sandwich",
-    "Hamelin",
-    "Hamilcar (after Hamilcar Barca, father of Hannibal)",
-    "Hamilton",
-    "Hamilton (after the american politician Alexander Hamilton)",
-    "Hamish",
-    "Hamlet",
-    "Hammer",
-    "Hammurabi",
-    "Hammy",
-    "Hampton",
-    "Han Solo",
-    "Hanable",
-    "Hancock",
-    "Handel",
-    "Handsome",
-    "Handsome Boy",
-    "Hang Ten",
-    "Hanibal",
-    "Hanibal Lickter",
-    "Hank",
-    "Hankock",
-    "Hanky",
-    "HankyPanky",
-    "Hanna",
-    "Hannabella",
-    "Hannah",
-    "Hannah Lamb",
-    "Hannah-Lamb",
-    "Hannibal",
-    "Hannibal the Cannibal",
-    "Hans",
-    "Hansel",
-    "Hansel And Gretel",
-    "Hansom Charlie Brown",
-    "Hantu (Malay for \\",
-    "Hanuman Babu Brown",
-    "Hap",
-    "Haplo",
-    "Happy",
-    "Happy Cat",
-    "Happy Feet",
-    "Happy Loo",
-    "Har Mar",
-    "Haran",
-    "Harbor",
-    "Hard Rock",
-    "Hardangervidda",
-    "Hardy",
-    "Harimau (Malay for \\",
-    "Hariton",
-    "Harlampiy",
-    "Harlee",
-    "Harlem",
-    "Harlequin",
-    "Harley",
-    "Harley Davidson",
-    "Harley Dude",
-    "Harlow",
-    "Harlow Alleyrogue",
-    "Harly D",
-    "Harmi",
-    "Harmonee",
-    "Harmony",
-    "Harmony May",
-    "Harold",
-    "Harold And Maude",
-    "Harold Bodean",
-    "Harpa",
-    "Harper",
-    "Harpo",
-    "Harriet",
-    "Harrison",
-    "Harrison Ford",
-    "Harry",
-    "Harry Houdini",
-    "Harvey",
-    "Harvey (as in The Pooka)",
-    "Harwood",
-    "Hasan",
-    "Hase",
-    "Hashish",
-    "Hasie",
-    "Haskel",
-    "Haskell",
-    "Haslyn-Shalin",
-    "Hastings",
-    "Hastle",
-    "Hatch",
-    "Hatcher",
-    "Hattie",
-    "Hattori Hanzo (after the character in the Kill Bill movie)",
-    "Haugesund",
-    "Havana",
-    "Havarti",
-    "Havoc",
-    "Havok",
-    "Hawaii",
-    "Hawk",
-    "Hawkeye",
-    "Hawthorne",
-    "Hay You",
-    "Hayden",
-    "Hayley",
-    "Hayley Bop",
-    "Hayley Mills",
-    "Hayley Spills",
-    "Hayley Victoria",
-    "Hayley-Baby",
-    "Hazel",
-    "Hazel Nut",
-    "Hazer",
-    "Hazle",
-    "Hazlenut",
-    "Hazy",
-    "Health",
-    "Hearadh Mac Alaisdeara (Gaelic for \\",
-    "Heart",
-    "Heart Nose",
-    "Heart of Gold",
-    "Heartbreaker",
-    "Hearto'Gold",
-    "Hearto'Mine",
-    "Hearts",
-    "Heath",
-    "Heathcliff",
-    "Heathcliff Aloysius",
-    "Heathcote",
-    "Heather",
-    "Heaven",
-    "Heavengaze",
-    "Heavenly",
-    "Heavenly Bliss",
-    "Heavenly Daze",
-    "Heavenly Kitty",
-    "Heavy",
-    "Hecate",
-    "Heckabe",
-    "Heckle",
-    "Hector",
-    "Hecuba",
-    "Hecubbus Hellcat",
-    "Hedda",
-    "Hedgehog",
-    "Hedley",
-    "Hedwig (after the musical/movie \\",
-    "Hedy",
-    "Hedy Lammarr",
-    "Heebee",
-    "Hefty",
-    "Hegel",
-    "Heidi",
-    "Heidi Ho",
-    "Heimao",
-    "Heimdall (Viking mythology: The guard of Bifrost)",
-    "Heiney Man",
-    "Heiress",
-    "Hektor",
-    "Hekyll",
-    "Hela",
-    "Helado (Spanish for \\",
-    "Helen",
-    "Helen of Coy",
-    "Helen of Troy",
-    "Helen Ratface Keller",
-    "Helena",
-    "Helena Diamond Onyx",
-    "Helgi",
-    "Helios",
-    "Helix",
-    "Hell Cat",
-    "Hell on Paws",
-    "Hellas (Greek for \\",
-    "Hellion",
-    "Hello Kitty",
-    "Hellodolly",
-    "Hellraiser",
-    "Hellweasel",
-    "Helmut",
-    "Helmut von Kat",
-    "Heloise",
-    "Helper",
-    "Helper Kitty",
-    "Hemey",
-    "Hemingway",
-    "Hemlock",
-    "Hemsky",
-    "Henley",
-    "Henna",
-    "Hennessey",
-    "Henoze",
-    "Henri",
-    "Henri Kissinger",
-    "Henrick",
-    "Henrietta",
-    "Henrijean",
-    "Henry",
-    "Henry Andres Midnight Moses",
-    "Henry Jones (from the song \\",
-    "Hepcat",
-    "Hephaistas",
-    "Hepzibah",
-    "Her Big Sister",
-    "Her Honor",
-    "Her Majesty Queen of the House",
-    "Her Nibs",
-    "Her Purriness",
-    "Her Purrs Highness",
-    "Her Royal Highness",
-    "Her Royal Princess",
-    "Hera",
-    "Herb",
-    "Herbal Tea",
-    "Herbert",
-    "Herbie",
-    "Hercat",
-    "Hercule Poirot",
-    "Hercules",
-    "Hercules Amok",
-    "Herdome",
-    "Here comes Trouble",
-    "Heritage",
-    "Herman",
-    "Hermes",
-    "Hermie",
-    "Hermione",
-    "Hermit",
-    "Hero",
-    "Hersey Bar",
-    "Hershel",
-    "Hershey",
-    "Hershey Bar",
-    "Hertzsprung",
-    "Hesche",
-    "HeShe",
-    "HeSheHimHerIt",
-    "Hessie",
-    "Hesta",
-    "Hester",
-    "Hester Primm",
-    "Hestia",
-    "Hevea",
-    "Hey",
-    "Hey You",
-    "Hey-Z",
-    "Hi-Cat",
-    "Hibernia (Roman name of Ireland)",
-    "Hickory",
-    "Hide-A-Way",
-    "Hidey",
-    "Hidyho",
-    "HieHie",
-    "Hieronymous",
-    "Hieronymus Merkin",
-    "Higgins",
-    "High-Tech",
-    "Highlite",
-    "Highway",
-    "Hijo del pollo (\\",
-    "Hilaria",
-    "Hilary",
-    "Hilary Clinton",
-    "Hilary Duff",
-    "Hilda",
-    "Hilda Mae Marie",
-    "Hilde",
-    "Hildegard",
-    "Hilery",
-    "Hillary",
-    "Hillary Rodham Kitten",
-    "Hilly",
-    "HimHer",
-    "Hincmar",
-    "Hincmars",
-    "Hindu Africana",
-    "Hini",
-    "Hip",
-    "Hip Hop",
-    "Hip Kitty",
-    "Hip-dip-nip",
-    "Hippo",
-    "Hippo Spottamus",
-    "Hippodrome",
-    "Hipster",
-    "Hiram",
-    "Hiri (Arabic for \\",
-    "His Highness",
-    "His Highness Sir Poo-Poo",
-    "His Lordship",
-    "His Lordship Sir William Timothy Fredrick Robert Smythe",
-    "His Majesty, King of the Sofa",
-    "His Royal Furriness",
-    "His Royalness",
-    "Hiss",
-    "Hissy",
-    "Hissy Face",
-    "Historia",
-    "Hit And Run",
-    "Hizanherz",
-    "Ho Chi",
-    "Ho Kitty",
-    "Ho' Cat",
-    "Hoagi",
-    "Hoagie",
-    "Hobart",
-    "Hobbe",
-    "Hobbes",
-    "Hobbikat",
-    "Hobbit",
-    "Hobbs",
-    "Hobgoblin Kattwinkel",
-    "Hobie",
-    "Hobie-Cat",
-    "Hobo",
-    "Hobson",
-    "Hochimin",
-    "Hockey Puck",
-    "Hocus-Pocus",
-    "Hodge",
-    "Hodge Podge Hairy Feet",
-    "Hodori",
-    "Hog",
-    "Hog N Daz",
-    "Hog Wilde",
-    "Hogan",
-    "Holden",
-    "Hollandaise",
-    "Holley",
-    "Hollie",
-    "Hollie Berry",
-    "Holly",
-    "Hollyberry",
-    "Hollywood",
-    "Holmes",
-    "Holothuroidea",
-    "Holy Mackerel",
-    "Holy Moly",
-    "Holy Smoke",
-    "Holy-chloe",
-    "Homeboy",
-    "Homer",
-    "Homere",
-    "Homey",
-    "Homi",
-    "Homie",
-    "Hominy Grits Jazz Cat",
-    "Hon",
-    "Hon Hon",
-    "Honcho",
-    "Honda",
-    "Honey",
-    "Honey Bear",
-    "Honey Bee",
-    "Honey Boy",
-    "Honey Child",
-    "Honey Chile",
-    "Honey-Bun",
-    "Honey-Lamb",
-    "Honeybee",
-    "Honeyboy",
-    "Honeybunny",
-    "HoneyCat",
-    "Honeycomb",
-    "Honeylamb",
-    "Honeypuff",
-    "Honeysuckle",
-    "Honeysuckle Rose",
-    "Hong-Soo Han",
-    "Honky",
-    "Honky-Tonk",
-    "Honolulu",
-    "Honora",
-    "Honu",
-    "Hony",
-    "Hoo",
-    "Hooch",
-    "Hood",
-    "Hoodoo",
-    "Hoofman",
-    "Hook",
-    "Hook Kitty",
-    "Hooligan",
-    "Hooper",
-    "Hoosier",
-    "Hoot of Iran",
-    "Hootch",
-    "Hootie",
-    "Hoover",
-    "Hop Scotch",
-    "Hope",
-    "Hopei",
-    "Hopi",
-    "Hopper",
-    "Hoppity Kitty",
-    "Hoppy",
-    "Hops",
-    "Horace",
-    "Horatio",
-    "Horlicks",
-    "Horrible",
-    "Horrid Hairy",
-    "Horror",
-    "Hors D'Ouvres",
-    "Horse",
-    "Horshack",
-    "Hortencia",
-    "Hortense",
-    "Horus (Egyptian god)",
-    "Hoser",
-    "Hoskins (after Bob Hoskins)",
-    "Hot Dog",
-    "Hot Java",
-    "Hot Rod",
-    "Hot Shot",
-    "Hot Stuff",
-    "Hotpoint",
-    "Hotshot",
-    "Hotspots",
-    "Hotspur",
-    "HotStuff Pete",
-    "Hotzie",
-    "Houdini",
-    "Houlie",
-    "Houston",
-    "Hovis",
-    "Howard",
-    "Howard Stern",
-    "Howe",
-    "Howe Bout This",
-    "Howie",
-    "Howler",
-    "Howling Hannibal",
-    "HRH Prince Andrew Tavin 2nd (Tav)",
-    "Hrissa",
-    "Hubba",
-    "Hubba Bubba",
-    "Hubba Hubba",
-    "Hubbard",
-    "Hubble",
-    "Hubert",
-    "Hubertus",
-    "Huck",
-    "Huck Du Bery",
-    "Huckeh",
-    "Huckelberry Finn",
-    "Huckle",
-    "Huckle Berry",
-    "Huckleberry",
-    "Hucko",
-    "Hudson",
-    "Huey",
-    "Huey Lewis",
-    "Huey Maximillian Bonfigliano",
-    "Huey Newton",
-    "Huffy",
-    "Hugga Wugga",
-    "Hugger-Mugger",
-    "Huggins (after Henry Huggins, children's book)",
-    "Huggy Bear",
-    "Hugh",
-    "Hugo",
-    "Hugs",
-    "Huh Rub",
-    "Huitzilopochtli (Aztec mythology: god of war and the sun)",
-    "Huixtocihuatl (Aztec mythology: the goddess of salt)",
-    "Hulk",
-    "Hulk Hogan",
-    "Hulkster",
-    "Human Shadow Puppet",
-    "Humdinger",
-    "Humle",
-    "Hummel",
-    "Hummer",
-    "Hummingbird",
-    "Hummy",
-    "Humperdink",
-    "Humphrey",
-    "Humphrey Bogart",
-    "HunBun",
-    "Hunka Hunka Burnin' Luv",
-    "Hunny",
-    "Hunny Bear",
-    "Hunny Bunny",
-    "Huno",
-    "Hunter",
-    "Huntley",
-    "Huntress",
-    "Hurley (after the skateboard brand)",
-    "Hurricane",
-    "Hurricane Andy",
-    "Husky",
-    "Hussy",
-    "Hutch",
-    "Huxley",
-    "Hyacinth (after the character in the sitcom \\",
-    "Hyde",
-    "Hydra",
-    "Hydrox",
-    "Hyper",
-    "Hyper Kitty",
-    "Hyperion",
-    "Hytek",
-    "Hyzen",
-    "I-want-a-Pounce",
-    "I.L.T.E.I.P. (\\",
-    "Iago",
-    "Iams",
-    "Ian",
-    "Ibble",
-    "Icarus",
-    "Ice",
-    "Ice Cream",
-    "Ice Maiden",
-    "Ice Man",
-    "Ice-Ice Kitty",
-    "Ice-T",
-    "Iceberg",
-    "Iceberg Slim",
-    "Icecapade",
-    "Icecat",
-    "Iceman",
-    "Icey",
-    "Ichabod",
-    "Ichi Ban (Japanese for \\",
-    "Ichigo (Japanese for strawberry; named after Ichigo Momomiya from the anime Tokyo Mew Mew)",
-    "Ickaldo Ickle Puss",
-    "Icon",
-    "Ida",
-    "Idalis",
-    "Iddy Biddy",
-    "Idgie",
-    "Idi",
-    "Idiot",
-    "Iditarod",
-    "Idjie",
-    "Idjut",
-    "Idun (Viking mythology: the goddess of youth)",
-    "Ifsingen",
-    "Iggy",
-    "Iggy Biggie",
-    "Iginla",
-    "Igloo",
-    "Igmoo Kipper",
-    "Igmu (Lakota (Souix) for \\",
-    "Ignacio",
-    "Ignat",
-    "Ignatius",
-    "Ignatowski (from TV show \\",
-    "Ignatz",
-    "Ignutz",
-    "Ignutz The Klutz",
-    "Igor",
-    "Ike",
-    "IlariÍ (after the song by Xuxa)",
-    "Ilia",
-    "Ilker",
-    "Illa",
-    "Ilsa Liao Klein",
-    "Ilya",
-    "Ilytria",
-    "Image",
-    "Imagine",
-    "Imakat",
-    "Iman (Turkish for \\",
-    "Imani",
-    "Imao",
-    "Imbri",
-    "Imhotep",
-    "Imp",
-    "Imprint",
-    "Impy",
-    "Imshi",
-    "Imzadi",
-    "Inari (from Japanese mythology, deity of fertility, rice, agriculture, foxes, industry, and worldly success)",
-    "Inca",
-    "Indah (Indonesian for \\",
-    "Indara",
-    "India",
-    "India Ink",
-    "Indian",
-    "Indiana",
-    "Indiana Jones",
-    "Indicus",
-    "Indie",
-    "Indigo",
-    "Indika",
-    "Indira Naidoo",
-    "Indo",
-    "Indu",
-    "Indy",
-    "Indy (after Indiana Jones)",
-    "Indy Cat",
-    "Indy Pins",
-    "Indy Q.",
-    "Indy-Cleopatra-M and M",
-    "Indycule",
-    "Indykins",
-    "Indypinnykinnykins",
-    "Inez",
-    "Inferno",
-    "Infinity",
-    "Inga",
-    "Ingham",
-    "Ingold",
-    "Ingrate",
-    "Ingrid",
-    "Iniki",
-    "Injun",
-    "Inka",
-    "Inkers",
-    "Inkheart (after the book by Cornelia Funke)",
-    "Inki",
-    "Inkin",
-    "Inkster",
-    "Inkster-Doodle",
-    "Inkus",
-    "Inkus Stinkus Domininkus",
-    "Inky",
-    "Inky Bear",
-    "Inky Dink",
-    "Inky Dinky Doo",
-    "Inky Poo",
-    "Inky-Stinky-Poo",
-    "Inna-gadda-da-vida",
-    "Inspector Gadget",
-    "Inspector Kibble",
-    "Intel Inside",
-    "Intelectus",
-    "Interkitty",
-    "International Man of Mystery",
-    "International Spy Kitty",
-    "Internet",
-    "Intie",
-    "Intrepid",
-    "Intruder",
-    "Invisible",
-    "Invitation",
-    "Io (pronounced: Ee-Oh)",
-    "Ioannina",
-    "Iodine",
-    "Iona",
-    "Ior",
-    "Iota",
-    "Ira",
-    "Irag",
-    "Iran",
-    "Irasan",
-    "Irie",
-    "Irina",
-    "Iris",
-    "Irish",
-    "Irish Cream",
-    "Irish Eyes",
-    "Irish Pride",
-    "Irix (after the operating system by Silicon Graphics)",
-    "Irma",
-    "Iro",
-    "Irresistible",
-    "Irving",
-    "Irwin",
-    "Isa",
-    "Isaac",
-    "IsaB (short for Isabella)",
-    "Isabeau (from the movie LadyHawke)",
-    "Isabel",
-    "Isabella",
-    "Isabella Jalepeno Gutierrez",
-    "Isabelle",
-    "Isabelle.",
-    "Isabelly Motts",
-    "Isabelly Motzarelli",
-    "Isadora",
-    "Isaiah",
-    "Isela",
-    "Isembard",
-    "Isha",
-    "Ishcabible",
-    "Ishido (Japanese for \\",
-    "Ishkabibble (named after a 1940s singer)",
-    "Ishmael",
-    "Ishta",
-    "Ishtar (goddess)",
-    "Isidor",
-    "Isis",
-    "Iskender (Turkish name of Alexander the Great)",
-    "Island Girl",
-    "Ismael",
-    "Isodora",
-    "Isolde",
-    "Isosceles",
-    "Isotta",
-    "Issabella",
-    "Issac",
-    "Issie (after the village \\",
-    "Isterband",
-    "Istoobad",
-    "IT",
-    "Ita Conchita Consuela",
-    "Itallia",
-    "Itch",
-    "Itchicus",
-    "Itchy",
-    "Itchy and Scratchy",
-    "Itchy Brother",
-    "Itsy",
-    "Itsy-Bitsy",
-    "Itty",
-    "Itty Bit",
-    "Itty Bitty",
-    "Itty Bitty Pretty Kitty",
-    "Itty-Bits",
-    "Itzpapalotl (Aztec mythology: goddess of agriculture)",
-    "Itzy",
-    "Ivan",
-    "Ivan Beauyevitch",
-    "Ivan the Terrible",
-    "Ivana",
-    "Ivar",
-    "Iverson",
-    "Ivory and Ebony",
-    "Ivy",
-    "Ivy League",
-    "Ix Chel (Maya mythology: the goddess of the moon)",
-    "Ixtab (Maya mythology: the goddess of the hanged)",
-    "Ixtlilton (Aztec mythology: the god of healing, feasting and games)",
-    "Izabella",
-    "Izmail",
-    "Izot",
-    "Izy",
-    "Izzie",
-    "Izzy",
-    "Izzy B",
-    "J-Cat",
-    "J. (Jay)",
-    "J. Cat",
-    "J. Edgar Hoover",
-    "J.A.C.K. (\\",
-    "J.B. (\\",
-    "J.B. Hoskins",
-    "J.C. (\\",
-    "J.D. (\\",
-    "J.F.C.L.",
-    "J.F.K.",
-    "J.J.",
-    "J.K. Cat",
-    "J.R. (after the TV character in \\",
-    "J.T.",
-    "Jabba",
-    "Jabba the Hut",
-    "Jabbar",
-    "Jabberwocky",
-    "Jabot",
-    "Jace",
-    "Jacee",
-    "Jacina",
-    "Jacinto",
-    "Jack",
-    "Jack (after the Georgetown University mascot, Jack the Bulldog)",
-    "Jack and Jill",
-    "Jack Burton",
-    "Jack Danger",
-    "Jack Daniel's",
-    "Jack Daniels Bourbon Pleasure",
-    "Jack Frost",
-    "Jack Frosted",
-    "Jack Roush (after a NASCAR car owner with the nickname \\",
-    "Jack Sparrow",
-    "Jack The Scratcher (play on Jack The Ripper)",
-    "Jack-o-Lantern",
-    "Jackie",
-    "Jackie O",
-    "Jackjack",
-    "Jackpot",
-    "Jackson",
-    "Jackson Brown",
-    "Jacmel (a town in Haiti)",
-    "Jaco",
-    "Jacob",
-    "Jacquar",
-    "Jacqueline",
-    "Jacuzzi",
-    "Jada",
-    "Jada John Jaquin Orlando Lance Oprah Pacey Dawson Joey Brown",
-    "Jade",
-    "Jade Judzia Maria Contessa vosh Kura Jones-shaffer",
-    "Jady",
-    "Jadzia",
-    "Jaeger",
-    "Jaffa",
-    "Jag",
-    "Jagger",
-    "Jago (A character in a Victorian book who battled against the odds)",
-    "Jaguar",
-    "Jai",
-    "Jai Alai",
-    "Jailbait",
-    "Jailbird",
-    "Jaina",
-    "Jaka",
-    "Jake",
-    "Jakey",
-    "Jakob",
-    "Jakoby",
-    "Jakov",
-    "Jala",
-    "Jalapeno (after a chile pepper)",
-    "Jalina",
-    "Jama",
-    "Jamaica",
-    "Jamal",
-    "Jambo (Swahili for \\",
-    "Jamee",
-    "James",
-    "James Belushi",
-    "James Brown",
-    "James Dean",
-    "James T. Kirk",
-    "James Taylor",
-    "Jameson",
-    "Jamesopia",
-    "Jamie",
-    "Jamie-Cat",
-    "Jamima",
-    "Jammer",
-    "Jamocha",
-    "Jana",
-    "Jane",
-    "Jane Furtin",
-    "Jane the Monkey Girl",
-    "Janel",
-    "Janet",
-    "Janie",
-    "Janipurr",
-    "Jansen",
-    "Janssen",
-    "Japan",
-    "Jareth (after Jareth the Goblin King in the movie 'Labyrinth')",
-    "Jarhad",
-    "Jarhead",
-    "Jarl",
-    "Jaromir",
-    "Jarred",
-    "Jarrett",
-    "Jarvis",
-    "Jasamine",
-    "Jasmine",
-    "Jason",
-    "Jaspa",
-    "Jasper",
-    "Jaspurr",
-    "JassBall (after the game Jezzball)",
-    "Jassmine",
-    "Jat",
-    "Java",
-    "Java Bean",
-    "Java City",
-    "Java Cup o'",
-    "Javert",
-    "Javex",
-    "Javi",
-    "Javia",
-    "Javier",
-    "Jaws",
-    "Jax",
-    "Jaya",
-    "Jayce",
-    "Jaymes and Bartles",
-    "Jazebel",
-    "Jazel",
-    "Jazmine",
-    "Jazmyn",
-    "Jazpurr",
-    "Jazz",
-    "Jazz Man",
-    "Jazz-purr",
-    "Jazzie",
-    "Jazzie Jo",
-    "Jazzlefrazzle",
-    "Jazzmen",
-    "Jazzpurr",
-    "Jazzy",
-    "Jazzy-Cat",
-    "Jazzycat",
-    "Je T'Aime (French for \\",
-    "Jean",
-    "Jean Luc",
-    "Jean-Claude",
-    "Jean-Clawed Kitty",
-    "Jean-Luc LeChat",
-    "Jean-Luc Picard",
-    "Jean-Luke",
-    "Jean-Paul Gizmondo",
-    "Jeanette",
-    "Jeannette",
-    "Jeannie",
-    "Jeaux",
-    "Jeb",
-    "Jecaro",
-    "Jeckle",
-    "Jed",
-    "Jedda",
-    "Jedi",
-    "Jeebee",
-    "Jeebie",
-    "Jeep",
-    "Jeepers Creepers",
-    "Jeeves",
-    "Jeevesy",
-    "Jeff",
-    "Jefferson",
-    "Jefferson Davis",
-    "Jeffery",
-    "Jeffrey",
-    "Jeffry",
-    "Jefrette",
-    "Jekyll",
-    "Jell-o",
-    "Jellaby (after the butler in Tom Stoppard's play \\",
-    "Jellicle",
-    "Jellico",
-    "Jellifur",
-    "Jello",
-    "Jelly",
-    "Jelly Baby",
-    "Jelly Bean",
-    "Jelly Belly",
-    "Jelly Roll",
-    "Jelly-Belly",
-    "Jellylorum",
-    "Jemima",
-    "Jen",
-    "Jeners",
-    "Jenga",
-    "Jenna",
-    "Jennet",
-    "Jennie",
-    "Jennifer",
-    "Jennifur",
-    "Jennifurr",
-    "Jennipurr",
-    "Jenny",
-    "Jenny Any Dots Marovich",
-    "Jenny Craig",
-    "Jenny Eizentier",
-    "Jenny Fur",
-    "Jenny Jones",
-    "Jenny-Le-Strange",
-    "Jenzy",
-    "Jeoffry",
-    "Jeramiah",
-    "Jeramiah Winton",
-    "Jeremy",
-    "Jericho",
-    "Jerk",
-    "Jerky",
-    "Jerome",
-    "Jeromes Gimli",
-    "Jeronimo",
-    "Jerred",
-    "Jerri-cat",
-    "Jerrie",
-    "Jerry (after Jerry Garcia, The Grateful Dead)",
-    "Jerry (from cartoon \\",
-    "Jerry Ford",
-    "Jerry Lee (after Jerry Lee Lewis)",
-    "Jerry Springer",
-    "Jerry Springy",
-    "Jersey",
-    "Jerzey",
-    "Jerzy",
-    "Jespah",
-    "Jess",
-    "Jessa Belle",
-    "Jessabunny",
-    "Jessakitty",
-    "Jessamine",
-    "Jesse",
-    "Jesse James",
-    "Jesse's Girl",
-    "Jesser",
-    "Jessi",
-    "Jessica",
-    "Jessie",
-    "Jessie James",
-    "Jessy",
-    "Jester",
-    "Jet",
-    "Jet Boy (after the song by New York Dolls)",
-    "Jet Ski",
-    "Jet Star",
-    "Jeter (after Derek Sanderson Jeter, Yankee's shortstop)",
-    "Jethro",
-    "Jethro Dante McFluffers",
-    "Jethro Tull",
-    "Jethrow",
-    "JetStream",
-    "Jetsum",
-    "Jett",
-    "Jetta",
-    "Jetty",
-    "Jewel",
-    "Jewels",
-    "Jezabel",
-    "Jezebel",
-    "Jezzabella",
-    "Jezzybelly",
-    "Jibbs",
-    "Jibril",
-    "Jig-A-Boots",
-    "Jigga",
-    "Jigger",
-    "Jiggie",
-    "Jiggle Belly",
-    "Jiggles",
-    "Jiggy",
-    "Jiggy Cornflakes",
-    "Jigsaw",
-    "Jiji (from the animated movie \\",
-    "Jill",
-    "Jilley",
-    "Jillian",
-    "Jillie",
-    "Jilly",
-    "Jim",
-    "Jimal",
-    "Jimeno",
-    "Jimi Hendrix",
-    "Jiminy",
-    "Jimmerson",
-    "jimmpyo",
-    "Jimmy",
-    "Jimmy Sue",
-    "Jimmy T.",
-    "Jin Jin",
-    "Jing",
-    "Jingle Cat",
-    "Jingles",
-    "Jinjee",
-    "Jinksy",
-    "Jinx",
-    "Jinx tiger",
-    "Jinxy",
-    "Jip Jap Pooper Lack",
-    "Jippsie",
-    "Jipsee",
-    "Jissy",
-    "Jitterbug",
-    "Jitters",
-    "Jiwfer",
-    "Jj",
-    "Jo",
-    "Jo Jo",
-    "Jo Jo Bean",
-    "Jo'Briel",
-    "Jo-Jo",
-    "Jo-Ni",
-    "Joan Blue-She",
-    "Joan The Cat",
-    "Joanna (after the character in \\",
-    "Job",
-    "Jock",
-    "Joe",
-    "Joe Cool",
-    "Joe Friday",
-    "Joe Katz",
-    "Joe-sip",
-    "Joel",
-    "Joeline",
-    "Joelle",
-    "Joely",
-    "Joey",
-    "Joey Bishop",
-    "Joey Elf",
-    "Joey Poos",
-    "Johann Sebastian Bach",
-    "Johann-Sebastian Cat",
-    "Johann-Sebastian Puss",
-    "Johannesburg",
-    "John",
-    "John Cougar Mellencat",
-    "John Cougar Mellocat",
-    "John Deere",
-    "John F. Kitty",
-    "John John",
-    "John Quincy Adams",
-    "Johnnie",
-    "Johnny",
-    "Johnny 5 (from the movie \\",
-    "Johnny B. Bad",
-    "Johnny B. Goode",
-    "Johnny Carson",
-    "Johnny Go Round",
-    "Joi",
-    "Joie",
-    "Joie de Vivre",
-    "Jojo",
-    "Jojoba",
-    "Joker",
-    "Joli",
-    "Jolie (French for \\",
-    "Joliet",
-    "Jolly",
-    "Jona",
-    "Jonah",
-    "Jonas",
-    "Jonathan",
-    "Jonathon",
-    "Jonathon Thomas St. John",
-    "Jones",
-    "Jonescat",
-    "Jonesie",
-    "Jonesy",
-    "Jonesy Girl",
-    "Joni Mitchell",
-    "Jonie",
-    "Jonsie",
-    "Joomper",
-    "Joon",
-    "Jop",
-    "Joplin",
-    "Joppy",
-    "Jordan",
-    "Jordana",
-    "Jordon",
-    "Jordy",
-    "Joris (Dutch for George)",
-    "Jorje (Spanish for George)",
-    "Joscelin",
-    "Jose",
-    "Jose Canseco",
-    "Jose Luis",
-    "Josee",
-    "Josefina",
-    "Joseph",
-    "Josephina",
-    "Josephine",
-    "Josette",
-    "Josey",
-    "Josh",
-    "Joshia",
-    "Joshua",
-    "Josie",
-    "Jossie",
-    "Jotunheimen",
-    "Jovan",
-    "Jovi (after Jon Bon Jovi)",
-    "Jovian",
-    "Joy",
-    "Joyce (after James Augustine Aloysius Joyce, Irish writer and poet)",
-    "Jp",
-    "JPS (pronounced Japes)",
-    "JR",
-    "JR Mewing",
-    "Jr.",
-    "JT",
-    "Jub",
-    "Jubei (after the character in the Japanese anime \\",
-    "Jubilation",
-    "Jubilee",
-    "Judas",
-    "Judd",
-    "Judge",
-    "Judge Judy",
-    "Judy",
-    "Judy Agnew",
-    "Judy Blue-Eyes",
-    "Juggernaut",
-    "Juggysmooch",
-    "Jughead",
-    "Juice",
-    "Juilee",
-    "Juilet",
-    "Juji (after \\",
-    "Juju",
-    "Jujube",
-    "Jukebox",
-    "Jukebox Hero",
-    "Julep",
-    "Jules",
-    "Jules Winfield",
-    "Julia",
-    "Julia Torped",
-    "Julian",
-    "Julie",
-    "Julie Sombrero",
-    "Juliet and Romeo",
-    "Juliette",
-    "Julio",
-    "Julius (after Julius Caesar)",
-    "Julius (from the book \\",
-    "Jumal",
-    "Jumanji",
-    "Jumbo",
-    "Jumpei",
-    "Jumper",
-    "Jumpin Jacques Flash",
-    "Jumpiter",
-    "Jumpy",
-    "Junco",
-    "June",
-    "June Bug",
-    "June Bugger Boo",
-    "Junebug",
-    "Junebugg",
-    "Jungle Girl",
-    "Jungle Jim",
-    "Jungle Kitty",
-    "Juninho",
-    "Junior",
-    "Junior Mint",
-    "Junior Partner",
-    "Juniper",
-    "Junkyard",
-    "Junkyard Dog",
-    "Juno",
-    "Jup Jup (after the character in the children's show \\",
-    "Jupiter",
-    "Jurgen",
-    "Jury Duty",
-    "Just",
-    "Just a Minute",
-    "Just in Time",
-    "Just Jack (after the character on the Will & Grace tv show)",
-    "Justa",
-    "Justa Boy",
-    "Justa Girl",
-    "Justa Kitty",
-    "Justice",
-    "Justin",
-    "Justin Tyme",
-    "Justine",
-    "Justus",
-    "Justy",
-    "Jutta",
-    "Jynx",
-    "Jynxetta Puny-pants (sweety-kitty) Pendragon",
-    "Jyrky",
-    "Jzero",
-    "K Cat",
-    "K'ee Kat",
-    "K-9",
-    "K-9's and Kit-10's",
-    "K-Cat",
-    "K-mart",
-    "K.B.",
-    "K.C. (Kitchen Cat)",
-    "K.C. (Kitty Cat)",
-    "K.D.",
-    "K.O.",
-    "K.P. (\\",
-    "K.T.",
-    "Kaa'I (Hawaiian for \\",
-    "Kaboodle",
-    "Kaboomkafkakaikajunkalikangarookarakarlo",
-    "Kabuda",
-    "Kabudal",
-    "Kabuki",
-    "Kacee",
-    "Kachina",
-    "Kaci",
-    "Kactus",
-    "Kadaffi",
-    "Kader",
-    "Kadi",
-    "Kady",
-    "Kaebi",
-    "Kaelyn",
-    "Kaeo (pronounced \\",
-    "Kaepa",
-    "Kafir",
-    "Kafka",
-    "Kafka Jabat",
-    "Kahlan (after the character in Terry Goodkind's \\",
-    "Kahlil (after Lebanese writer Kahlil Gibran)",
-    "Kahlua",
-    "Kahlua and Cream",
-    "Kahneeta",
-    "Kahula",
-    "Kahuna",
-    "Kai",
-    "Kaileb",
-    "Kailin (Irish for \\",
-    "Kailua (city on the Hawaiian island of Oahu)",
-    "Kairi",
-    "Kairo",
-    "Kaiser",
-    "Kaiten",
-    "Kaitlen",
-    "Kaiuai",
-    "Kaiwara",
-    "Kajenka",
-    "Kajtek",
-    "Kajun",
-    "Kaka",
-    "Kakapo",
-    "Kaki",
-    "Kakoa",
-    "Kakoo",
-    "Kala",
-    "Kalahari",
-    "Kalaman",
-    "Kalamazoo",
-    "Kaleidoscope",
-    "Kaleipuss",
-    "Kalhia",
-    "Kali (after the Indian goddess of death)",
-    "Kali-cat",
-    "Kalico Kat",
-    "Kalico Kidd",
-    "Kalifornia",
-    "Kalinik",
-    "Kalli",
-    "Kallisti (from a Greek myth)",
-    "Kallisticat",
-    "Kally",
-    "Kalyn",
-    "Kamala",
-    "Kamere",
-    "Kami",
-    "Kami Kaze Kutie",
-    "Kami Kaze Kutie Kitty",
-    "Kami Wami",
-    "Kami-kaze",
-    "Kamin (From Star trek episode \\",
-    "Kamina (after the El Camino car)",
-    "Kamper",
-    "Kamu",
-    "Kan-u-Uayeyab (Maya mythology: the god who guarded cities)",
-    "Kana",
-    "Kanace",
-    "Kanada",
-    "Kandinsky",
-    "Kandoo",
-    "Kandy",
-    "Kane",
-    "Kanga",
-    "Kanji",
-    "Kannika (Japanese for \\",
-    "Kantishna",
-    "Kanye (after the rap artist Kanye West)",
-    "Kao",
-    "Kaos Kitty",
-    "Kapiton",
-    "Kaptain Kitty Kat",
-    "Kara",
-    "Karakall",
-    "Karakall Kat",
-    "Karaoke",
-    "Karate Kid",
-    "Kareball",
-    "Kareem",
-    "Kareem Abdul-JumpsFar",
-    "Kareena",
-    "Karen",
-    "Kari",
-    "Karin",
-    "Karina",
-    "Karisma",
-    "Karlo",
-    "Karma",
-    "Karnak",
-    "Karschikiis",
-    "Kasablanka",
-    "Kasey Jo",
-    "Kasha",
-    "Kashin (from Flash Gordon cartoon)",
-    "Kashka",
-    "Kashka (Russian for \\",
-    "Kashmir",
-    "Kashmire",
-    "Kasia",
-    "Kasian",
-    "Kaska",
-    "Kaspaas (Afrikaans for Casper)",
-    "Kasper",
-    "Kaspurr",
-    "Kassandra",
-    "Kassu",
-    "Kastine",
-    "Kastoria",
-    "Kat",
-    "Kat Butt",
-    "Kat Kat",
-    "Kat Sam",
-    "Katalina",
-    "Katana",
-    "Katarina",
-    "Katawnay (play on Vitani, character in \\",
-    "Katayama",
-    "Kate",
-    "Kate and Allie",
-    "Kate The Cat",
-    "Katelyn",
-    "Katerchen (German for \\",
-    "Katerina",
-    "Katharina Witt",
-    "Katherine",
-    "Katherine the Gray",
-    "Kathi (after a character in the Lymond novels by Dorothy Dunnett)",
-    "Kathleen",
-    "Katia",
-    "Katiat",
-    "Katicat",
-    "Katie",
-    "Katie Cat",
-    "Katie K",
-    "Katie Kitty",
-    "Katie Lady",
-    "Katie Lynn",
-    "Katie Scarlet",
-    "Katie-Kins",
-    "Katina",
-    "Katinka (after the character in the movie \\",
-    "Katish",
-    "Katisha",
-    "Katisha Tish Push of Pitty-Tu",
-    "Katita",
-    "Katitzu",
-    "Katka",
-    "Katmandu",
-    "Kato",
-    "Katona",
-    "KaToosa",
-    "Katrina",
-    "Katrine The Great",
-    "Katrinka",
-    "Kattaiffi",
-    "Katten",
-    "Kattie",
-    "Katty",
-    "KattyWomper Katskill, Doctor of Womptometry",
-    "Katy",
-    "Katya",
-    "Katze (German for \\",
-    "Katzl",
-    "Katzu",
-    "Kavan",
-    "Kavik",
-    "Kay Bee",
-    "Kaya",
-    "Kaybee",
-    "Kaybill",
-    "Kayce Marie",
-    "Kaycee",
-    "Kayla",
-    "Kayle",
-    "Kayleigh",
-    "Kaylen",
-    "Kaylib",
-    "Kaysey",
-    "Kayzie",
-    "Kaz",
-    "Kazak",
-    "Kazam",
-    "Kazbah",
-    "Kazimir",
-    "Kazmir",
-    "Kazooie",
-    "Kazza The Second",
-    "Kazzie",
-    "Kazziebah",
-    "KC-10 (US Air Force refuelling jet)",
-    "Kea",
-    "Keanu",
-    "Keanu Kaki",
-    "Kechi",
-    "Keddie",
-    "Kedi (Turkish for \\",
-    "Kee",
-    "Kee-Koh-Pookie-Boo",
-    "Keebler",
-    "Keegan",
-    "Keekee",
-    "Keekeebooboo",
-    "Keeker",
-    "Keekoree",
-    "Keeks",
-    "Keekum",
-    "Keeky",
-    "Keely",
-    "Keepah",
-    "Keeper",
-    "Keepers",
-    "Keepurrs",
-    "Keesha",
-    "Keesha Julian",
-    "Keesha Kitty",
-    "Keetah",
-    "Keets",
-    "Keeva",
-    "Keewer",
-    "Keg",
-    "Kegger",
-    "Kegyma",
-    "Keifer",
-    "Keiki",
-    "Keiko",
-    "Keiko (Japanese for \\",
-    "Keira (after the actress Keira Knightley)",
-    "Keiran",
-    "Keisa (Finnish for \\",
-    "Keith",
-    "Keke",
-    "Keko-T (The \\",
-    "Kekoa",
-    "Kel",
-    "Kelby",
-    "Kelev",
-    "Keller",
-    "Kelli",
-    "Kellogg",
-    "Kelloggs",
-    "Kelly",
-    "Kelly Temp Cat",
-    "Kelou",
-    "Kelsey",
-    "Kelso",
-    "Kelvin",
-    "Kemage",
-    "Ken",
-    "Ken And Barbie",
-    "Kenai",
-    "Kenan",
-    "Kendall",
-    "Kendra",
-    "Kendra E'Kieron",
-    "Kenji (after Michael Kenji Shinoda, from the band Linkin Park)",
-    "Kennedy",
-    "Kenny",
-    "Kenny Gee",
-    "Keno",
-    "Kenshin",
-    "Kensington",
-    "Kentucky",
-    "Kenya",
-    "Keo",
-    "Keone (Hawaiian for \\",
-    "Kepler",
-    "Kepurr",
-    "Keri",
-    "Kermit",
-    "Kermit the Kat",
-    "Kermodi (after the white bear in B.C.)",
-    "Kerouac",
-    "Kerowyn",
-    "Kerry",
-    "Kes",
-    "Kesa",
-    "Kesakin",
-    "Kesha",
-    "Kestral",
-    "Keta",
-    "Keto",
-    "Kettums",
-    "Ketty",
-    "Ketut",
-    "Kevin",
-    "Kewpie",
-    "Key-Key",
-    "Keykas",
-    "Keys",
-    "Keyter",
-    "Kezia",
-    "Khaki",
-    "Khaleesi",
-    "Khamu (Egyptian for \\",
-    "Khan",
-    "Khara",
-    "Khatt",
-    "Khayman (character in Anne Rice's vampire chronicles)",
-    "Khina",
-    "KhitKhat",
-    "Khmer",
-    "Kholey",
-    "Khomeini",
-    "Khyber",
-    "Ki Ling",
-    "Kia",
-    "Kia Ora (Traditional Maori for \\",
-    "Kiana",
-    "Kiara",
-    "Kibbeling",
-    "Kibbles",
-    "Kibeth",
-    "Kickapoo",
-    "Kid",
-    "Kid E. Kat",
-    "Kidder",
-    "Kidino",
-    "Kidosho (Swahili for \\",
-    "Kiefer",
-    "Kielbasa",
-    "Kieri",
-    "Kifys",
-    "Kika",
-    "Kiki",
-    "Kikki",
-    "Kikki Neko",
-    "Kikky",
-    "Kiko",
-    "Kiku",
-    "Kiku (Japanese for 'chrysanthemum')",
-    "Kila",
-    "Kilby (after Craig Kilborn of the Late, Late Show)",
-    "Killalldogs",
-    "Killashandra",
-    "Killer",
-    "Killer Cat",
-    "Killian",
-    "Killing (Danish for \\",
-    "Killmouski",
-    "Kilo",
-    "Kim",
-    "Kim Chee",
-    "Kim Nuvoletta",
-    "Kim Possible (after the cartoon)",
-    "Kim The Dreaded Hamwort",
-    "Kimba",
-    "Kimbra",
-    "Kimbundu",
-    "Kimi",
-    "Kimmo",
-    "Kimmy",
-    "Kimmy Cat",
-    "Kimmy Kimmy",
-    "Kimo",
-    "Kimykat",
-    "Kincaid",
-    "Kinda Fat",
-    "King",
-    "King Arther",
-    "King Caesar",
-    "King Eric",
-    "King Grumble The Good",
-    "King Kong",
-    "King Louie XIV",
-    "King PooPoo",
-    "King Tut",
-    "Kingarthur",
-    "Kingfisher",
-    "Kinglear",
-    "Kingmidas",
-    "Kingsford",
-    "Kingsley",
-    "Kingston",
-    "Kinibari",
-    "Kinich Kakmo (Maya mythology: the sun god)",
-    "Kink",
-    "Kinko",
-    "Kinky",
-    "Kinky-Pie",
-    "Kinky-Poo",
-    "Kinny",
-    "Kino",
-    "Kinsey",
-    "Kinski",
-    "Kinta",
-    "Kinty",
-    "Kinza",
-    "Kioki",
-    "Kiowa",
-    "Kip",
-    "Kiph",
-    "Kipkat",
-    "Kipling",
-    "Kipling (after Rudyard Kipling, writer)",
-    "Kipp",
-    "Kipper",
-    "Kipper Moxley Fiercely Panthure Jackson-Pop",
-    "Kippiness",
-    "Kippy",
-    "Kir Kira",
-    "Kira",
-    "Kira Nerys",
-    "Kirby",
-    "Kiri",
-    "Kiriak",
-    "Kirii",
-    "Kirisawa",
-    "Kirk",
-    "Kirkwood",
-    "Kirsten",
-    "Kirstie Alley-Kat",
-    "Kirsty",
-    "Kisa (Russian for \\",
-    "Kisan",
-    "Kisha",
-    "Kisin (Maya mythology: the evil earthquake spirit)",
-    "Kismet",
-    "Kiss Kiss",
-    "Kiss Me Kate",
-    "Kiss Me Kitty",
-    "Kissa",
-    "Kissafur",
-    "Kisses",
-    "Kissi-fur",
-    "Kissie",
-    "Kissie Madonna",
-    "Kissimmee Baby",
-    "Kissin-Cat",
-    "Kissy",
-    "Kissy Kitty",
-    "Kissycat",
-    "Kit",
-    "Kit Cat",
-    "Kit Karson",
-    "Kit Kat",
-    "Kit Kat Bar",
-    "Kit'n Hook",
-    "Kit-Kat",
-    "Kit-Kit",
-    "Kita",
-    "Kitalie",
-    "Kitamus",
-    "Kitao",
-    "Kitara",
-    "Kitbag",
-    "Kitbull",
-    "Kitchy",
-    "Kitchy-Koo",
-    "Kite",
-    "Kite String",
-    "Kithic (Gaelic for \\",
-    "Kiti (Siberian Yupik for \\",
-    "Kitiara",
-    "Kiticorp",
-    "Kitina",
-    "Kitkat",
-    "Kitler",
-    "Kitryna",
-    "Kitsch",
-    "Kitsen",
-    "Kitska",
-    "Kitsu",
-    "Kitsune (Japanese for \\",
-    "Kitsy",
-    "Kitt",
-    "Kitta",
-    "Kittaloon",
-    "Kitten",
-    "Kitten Caboodle",
-    "Kitten Chow",
-    "Kitten From Hell",
-    "Kitten Head",
-    "Kitten Of Yasmin",
-    "Kitten-head",
-    "Kittens",
-    "KitterKatz",
-    "Kittery",
-    "Kittery Mae",
-    "Kitti",
-    "Kittie Kat Korn",
-    "Kittney",
-    "Kitto",
-    "Kitty",
-    "Kitty Ankrom",
-    "Kitty Ann",
-    "Kitty Baby",
-    "Kitty Boo",
-    "Kitty Boy",
-    "Kitty Butt",
-    "Kitty Capachina",
-    "Kitty Carlisle",
-    "Kitty Cat",
-    "Kitty Choo-Choo",
-    "Kitty Cootie Poopie Doodie",
-    "Kitty Fondue",
-    "Kitty Girl",
-    "Kitty Hawk",
-    "Kitty Kai",
-    "Kitty Kat",
-    "Kitty Kitty Loo La Banana",
-    "Kitty Kong",
-    "Kitty Lang",
-    "Kitty Lofton",
-    "Kitty Long Whiskers",
-    "Kitty Lou",
-    "Kitty Man",
-    "Kitty Monster",
-    "Kitty Mouse",
-    "Kitty My Love",
-    "Kitty Newton",
-    "Kitty Pants",
-    "Kitty Poo",
-    "Kitty Prat",
-    "Kitty Sales",
-    "Kitty Scarlett (from \\",
-    "Kitty T.O.O. (\\",
-    "Kitty Tom",
-    "Kitty Winston",
-    "Kitty Ziegenfuss",
-    "Kitty-cat",
-    "Kitty-dee",
-    "Kitty-rina",
-    "Kittybat",
-    "Kittycat",
-    "Kittyina",
-    "KittyKitty",
-    "Kittylicious",
-    "Kittypuss",
-    "Kitue",
-    "Kitwit",
-    "Kitzel",
-    "Kitzy",
-    "Kiv",
-    "Kiwi",
-    "Kiya (Egyptian mythology)",
-    "Kizmet",
-    "Kizzie",
-    "Kizzy (From \\",
-    "Klaara",
-    "Klahador",
-    "Klara",
-    "Klarissa",
-    "Klaus",
-    "Klava",
-    "Klavdia",
-    "Klaw",
-    "Kliban",
-    "Kliment",
-    "Klinket",
-    "Klister",
-    "Kloak",
-    "Kloey",
-    "Klondike",
-    "Klondike Gold",
-    "Klutz",
-    "Knaidel",
-    "Knick Knack Paddy Wack",
-    "Knick-Knack",
-    "Knickerbocker",
-    "Knight",
-    "Knockout",
-    "Knocky Jones",
-    "Knothead",
-    "Knucklehead",
-    "Knuckles",
-    "Knuckles Nuclear",
-    "Knurft",
-    "Ko-Ko",
-    "Ko-Yo",
-    "Koa (Hawaiian for \\",
-    "Koala",
-    "Koala Bear",
-    "Kobi",
-    "Kobie",
-    "Kobie Kat",
-    "Kobold (German for bogey, elf, gnome, goblin, gremlin, hobgoblin, imp, leprechaun, pixie, puck, sprite)",
-    "Koby",
-    "Koda",
-    "Kodak",
-    "Kodak Moment",
-    "Kodalith",
-    "Kodesh",
-    "Kodi",
-    "Kodiak",
-    "Kody",
-    "Koh-i-Noor (after the diamond, Persian for \\",
-    "Kohana",
-    "Kohl",
-    "Kohuna",
-    "Koi-San",
-    "Kojak",
-    "Koji",
-    "Koko",
-    "Koko And Yumyum",
-    "Koko Head",
-    "Kokokokochanski",
-    "Kokomo",
-    "Kola",
-    "Kolabara",
-    "Kolja",
-    "Kolle (Afrikaans for English name \\",
-    "Kolumbo",
-    "Kolumbus",
-    "Komet",
-    "Komett",
-    "Kona",
-    "Kondrat",
-    "Koneko",
-    "Koobees",
-    "Kookaburra",
-    "Kookie",
-    "Kool",
-    "Koontah",
-    "Koontah Kintay",
-    "Koopa",
-    "Koorama",
-    "Kooter Cat",
-    "Kootes",
-    "Kooze",
-    "Koozer",
-    "Korbel",
-    "Korky",
-    "Kormi",
-    "Koro",
-    "Kosher",
-    "Koshi",
-    "Koshka (Russian for \\",
-    "Kosmic",
-    "Kosmo",
-    "Kota",
-    "Koten",
-    "Kotyk (Ukrainian for \\",
-    "Kouros",
-    "Kow Kitty",
-    "Koy",
-    "Koyannisqatsi",
-    "Kozmo",
-    "Kp",
-    "Krabbelure",
-    "Kramer",
-    "Krazy",
-    "Krazy Kat",
-    "Kremhilde",
-    "Kribu (meaning \\",
-    "Kricket",
-    "Kriis-Riit",
-    "Krinkles",
-    "Kripple",
-    "Kripplecreek",
-    "Kris Kringle",
-    "Krishna",
-    "Krispies",
-    "Krispy",
-    "Krispycritter",
-    "Kristan",
-    "Kristen",
-    "Kristiansand",
-    "Kristin",
-    "Kristophine",
-    "Kristy",
-    "Kroag",
-    "Kronk",
-    "Kronos",
-    "Kruga",
-    "Kruger",
-    "Krumel",
-    "Kruschty (after Kruschev, the former Russian president)",
-    "Krusty (after Krusty the Clown from The Simpsons)",
-    "Krutherscats Kactus",
-    "Kryinshame",
-    "Krylon",
-    "Krypton",
-    "Kryptonite",
-    "KU",
-    "Ku'u'Ipo (hawaiian for \\",
-    "Kubala Khan",
-    "Kublah Kahn",
-    "Kublai",
-    "Kuble",
-    "Kuce (Ziarois for \\",
-    "Kucha (Aboriginal for \\",
-    "Kuddie",
-    "Kuddles",
-    "Kudos",
-    "Kudu",
-    "Kuiper",
-    "Kuja",
-    "Kujo",
-    "Kuken",
-    "Kuki",
-    "Kukla",
-    "Kukucan (Maya mythology: the wind god)",
-    "Kula (Hawaiian for \\",
-    "Kuma",
-    "Kumani (African word meaning \\",
-    "Kumquat",
-    "Kuna",
-    "Kundun (Tibettan name of Dalai Lama, meaning \\",
-    "Kung Fu Kitty",
-    "Kunta Kinte",
-    "Kunta Kitty",
-    "Kunz",
-    "Kupkake",
-    "Kurly",
-    "Kuronekosama (Japanese for 'honorable black cat')",
-    "Kurre",
-    "Kurt-Kat",
-    "Kurtney",
-    "Kushi Katu",
-    "Kuskaq (Alaskan Yupik for \\",
-    "Kussin",
-    "Kussy",
-    "Kutenai",
-    "Kutnshoot",
-    "Kuuipo (Hawaiian for \\",
-    "Kwai",
-    "Kwan-Yen",
-    "Kwanzaa",
-    "Kwibus Melancholicus",
-    "Kya",
-    "Kyalli",
-    "Kydar",
-    "Kykii",
-    "Kyle",
-    "Kylie",
-    "Kylie.",
-    "Kym",
-    "Kym Wilde",
-    "Kyra",
-    "Kyrie",
-    "Kzif",
-    "L.A.",
-    "L.B.",
-    "L.C. (Little Cat)",
-    "L.D.",
-    "L.D.A. (Little Dumb Ass)",
-    "L.L.C.M. (Lester Lester Child Molester)",
-    "L.S.",
-    "La Llarona (from Mexican folklore, \\",
-    "La Petite Purr-fette",
-    "Laana",
-    "LaBelle (French for \\",
-    "Labu",
-    "Labyrinth",
-    "Lace",
-    "Lacey",
-    "Lacy",
-    "Lad",
-    "Lada",
-    "Ladd",
-    "Ladron",
-    "Lady",
-    "Lady Abigail",
-    "Lady Blue",
-    "Lady Cameo",
-    "Lady Di",
-    "Lady Francesca",
-    "Lady Gabriella",
-    "Lady Godiva",
-    "Lady Guinevere",
-    "Lady Heidel von Squitenbaum of Berryburg",
-    "Lady Jane",
-    "Lady Jane Grey",
-    "Lady Kitty Lee",
-    "Lady Lee",
-    "Lady Leela",
-    "Lady Luck",
-    "Lady Luv",
-    "Lady Nicole",
-    "Lady Peaches",
-    "Lady Puff",
-    "Lady Sarah",
-    "Lady Serena of Redrock",
-    "Lady Teazle",
-    "Lady Tiffiny in White",
-    "Lady Wesley Star",
-    "Ladybug",
-    "Laela",
-    "Laelani",
-    "Laertes (from Shakespeare's \\",
-    "Lafeyette",
-    "Lagerlof",
-    "Lagniappe",
-    "Lai Tai",
-    "Laila",
-    "Lailea",
-    "Lainy",
-    "Laker",
-    "Lala",
-    "Lalli",
-    "Lalo",
-    "Lamaline (small village in Newfoundland)",
-    "Lamar",
-    "Lambchop",
-    "Lambert",
-    "Lambie",
-    "Lambie Par-Toodles",
-    "Lambie Pie Tart",
-    "Lambolina",
-    "Lamborghini",
-    "Lamintations",
-    "Lamisil",
-    "Lamisila",
-    "Lamont",
-    "Lamourghini",
-    "Lana",
-    "Lana McCheese",
-    "Lanada",
-    "Lance",
-    "Lancelot",
-    "Land",
-    "Land Seal",
-    "Lander-man",
-    "Lando Calrission (after the \\",
-    "Lane",
-    "Langley",
-    "Langston",
-    "Lani",
-    "Lap Cat",
-    "Lap Kitty",
-    "Lap Lover",
-    "Lap Magnet",
-    "Lap Slut",
-    "Lap Top",
-    "Lapis",
-    "Lapleach",
-    "Laplover",
-    "Lappie",
-    "Lapsang Souchong",
-    "Laptop",
-    "Lara",
-    "Laraza",
-    "Lard Butt",
-    "Lardass",
-    "Larisa",
-    "Larissa",
-    "Lark Hill",
-    "Larry",
-    "Lars (after the Metallica drummer Lars Ulrich)",
-    "Laser",
-    "Lasher",
-    "Lashes",
-    "Laska",
-    "Lasorda",
-    "Lass",
-    "Lassie",
-    "Lastat",
-    "Laszlo (after the character in the movie \\",
-    "Lathrop",
-    "Latke (after the character on the TV show Taxi)",
-    "Latte",
-    "Laughing Cow",
-    "Laughing Tree",
-    "Laurant",
-    "Laurel",
-    "Laurel And Hardy",
-    "Lauren",
-    "Lavender",
-    "Lavender Lace",
-    "Laverne and Shirley",
-    "Layla",
-    "Lazar",
-    "Lazaro",
-    "Lazarus",
-    "Lazy Cat",
-    "Lazyboy",
-    "Le Le Bomb",
-    "Lea",
-    "Leah",
-    "Leander",
-    "Leapol",
-    "Leapole",
-    "Learned Paw",
-    "Leash",
-    "Lebianco",
-    "Leddy",
-    "Ledo Lee",
-    "Lee",
-    "Lee Lee",
-    "Leechee",
-    "Leela",
-    "Leela Mew",
-    "Leeloo (after the character in the movie \\",
-    "Leemp",
-    "Leener-Beaner",
-    "Leeny",
-    "Leeza",
-    "Lefty",
-    "Legacy",
-    "Legend",
-    "Leggs",
-    "Legolas (Tolkien, \\",
-    "Leia",
-    "Leigh",
-    "Leila",
-    "Leilo",
-    "Leland",
-    "Lelani",
-    "Lelu (from the movie The Fifth Element)",
-    "Leluka (Greek for \\",
-    "Lembu (Malay for \\",
-    "Lemew",
-    "Lemieux",
-    "Lemmy (after Lemmy Kilmister of Motorhead)",
-    "Lemon",
-    "Lemur",
-    "Lemur Tail",
-    "Lena",
-    "Lenie",
-    "Lennie",
-    "Lennox",
-    "Lenny",
-    "Lenny And Squiggy",
-    "Lenny Bruce",
-    "Lenore",
-    "Leo",
-    "Leon",
-    "Leon Sphynx",
-    "Leona",
-    "Leonard",
-    "Leonardo",
-    "Leonardo DeCATprio",
-    "Leonela",
-    "Leonid",
-    "Leonora",
-    "Leopard",
-    "Leopardetta",
-    "Leopardette",
-    "Leopold",
-    "Leopold (after \\",
-    "Lerium",
-    "Leroy",
-    "Leroy Brown",
-    "Les Yeux Grandes",
-    "Lesky",
-    "Leslee",
-    "Leslie",
-    "Lessa",
-    "Lessay",
-    "Lestat",
-    "Lester",
-    "Lester Flatt",
-    "Lester Jean",
-    "Lettie",
-    "Leucorhinos",
-    "Leukocyte Catwalker",
-    "Levi",
-    "Lew",
-    "Lewis",
-    "Lewis And Clark",
-    "Lex",
-    "Lexi",
-    "Lexi2poo",
-    "Lexicon",
-    "Lexie",
-    "Lexilady",
-    "Leximer",
-    "Lexis",
-    "Lexus",
-    "Lexus Summer",
-    "Lexxy",
-    "Lexy",
-    "Lhasa",
-    "Lia",
-    "Liability",
-    "Liam",
-    "Libbie",
-    "Libby",
-    "Libby Lu",
-    "Libelula (Spanish for \\",
-    "Liberty",
-    "Liberty And Justice",
-    "Libra",
-    "Licil",
-    "Lick Me",
-    "Licker",
-    "Lickerish",
-    "Lickity-Split",
-    "Lickums",
-    "Licky",
-    "Licorice",
-    "Liddy",
-    "Lido",
-    "Liebchen",
-    "Liebling",
-    "Liero",
-    "Liger",
-    "Light Dancer",
-    "Lightnin",
-    "Lightning",
-    "Lightning Bug",
-    "Lightning Mcqueen",
-    "Lija",
-    "Lika",
-    "Lil Nicky",
-    "Lil Nugget",
-    "Lil Red",
-    "Lil' Abner",
-    "Lil' Bit",
-    "Lil' Buddy",
-    "Lil' Gray Guy",
-    "Lil' Guy",
-    "Lil' Mama Kitty",
-    "Lil' Miss Pickie",
-    "Lil' Monster",
-    "Lil' One",
-    "Lil' Striped Kitty",
-    "Lil'flip",
-    "Lila",
-    "Lilac",
-    "Lilac Rose",
-    "Lili",
-    "Lilia",
-    "Lilith (character in \\",
-    "Liliya",
-    "Lilla Tabycat",
-    "Lillan",
-    "Lillehammer",
-    "Lillian",
-    "Lillian Pooh Bear",
-    "Lilly",
-    "Lilo",
-    "Lily",
-    "Lilyput",
-    "Lima",
-    "Limbo",
-    "Lime",
-    "Limerick",
-    "Limite",
-    "Lina",
-    "Lina Bean",
-    "Lina Cat",
-    "Lina-Lina-Lina",
-    "Lincoln",
-    "Linda",
-    "Lindor",
-    "Lindy",
-    "Lindy Hop",
-    "Lindy-Brat",
-    "Lindy-Cat",
-    "Ling",
-    "Ling Ling",
-    "Link",
-    "Linka",
-    "Links",
-    "Linn",
-    "Linneaus",
-    "Lint",
-    "Linus",
-    "Linux",
-    "Linx",
-    "Lion",
-    "Lion Boy",
-    "Lion in Winter",
-    "Lion Of Judah",
-    "Lion-o",
-    "Lionel",
-    "Lionheart",
-    "Lipps",
-    "Lips",
-    "Lipstick",
-    "Liption",
-    "Lira",
-    "Lirael",
-    "Lisa",
-    "Lisa Catrow",
-    "Lisa Marie",
-    "Lisa-Marie",
-    "Lisbef",
-    "Lisbon",
-    "Lisha",
-    "Lishak",
-    "Lister",
-    "Lisu",
-    "Lita",
-    "Litl Bit",
-    "Litmus",
-    "Little",
-    "Little Angel",
-    "Little Annie Oakley",
-    "Little Bean",
-    "Little Bear",
-    "Little Big Eyes",
-    "Little Bit",
-    "Little Bits",
-    "Little Bitty 'Toe",
-    "Little Black Kitty",
-    "Little Bo Peep",
-    "Little Bones",
-    "Little Bot",
-    "Little Boy",
-    "Little Boy Blue",
-    "Little Briches",
-    "Little Bud",
-    "Little Buddha",
-    "Little Buddy",
-    "Little Bunkin",
-    "Little Buntnt",
-    "Little Butt",
-    "Little Cat",
-    "Little Cheese",
-    "Little Cutie",
-    "Little Dave",
-    "Little Dude",
-    "Little Duster",
-    "Little Early",
-    "Little Egypt",
-    "Little English",
-    "Little Fat Daddy",
-    "Little Feet",
-    "Little Fluffer Bean",
-    "Little Flyer",
-    "Little Foot",
-    "Little Frankie",
-    "Little Frieda",
-    "Little Friend",
-    "Little Fuzz",
-    "Little Girl",
-    "Little Goodie Two Shoes",
-    "Little Gray",
-    "Little Guy",
-    "Little Hairball",
-    "Little Her",
-    "Little Izzy",
-    "Little John",
-    "Little Kitty",
-    "Little Kitwort",
-    "Little Knucklebump",
-    "Little Lady",
-    "Little Lady Bug",
-    "Little Lady Pussycat",
-    "Little Lap Kitty",
-    "Little Liz",
-    "Little Liza Jane",
-    "Little Lord Fauntleroy",
-    "Little Lou",
-    "Little Love-Muffin",
-    "Little Madame",
-    "Little Mama",
-    "Little Man",
-    "Little Mew",
-    "Little Miss",
-    "Little Miss Softpaws",
-    "Little Mo",
-    "Little Murphy's",
-    "Little Nettik",
-    "Little O",
-    "Little One",
-    "Little Orange",
-    "Little Orange Poohbear",
-    "Little Paws",
-    "Little Pink Nose",
-    "Little Priss",
-    "Little Puddy",
-    "Little Raccoon Boy",
-    "Little Red",
-    "Little Richard",
-    "Little Runt",
-    "Little Shit",
-    "Little Sister",
-    "Little Sophie",
-    "Little Sox",
-    "Little Stevie",
-    "Little T(rouble)",
-    "Little Two-Ton",
-    "Little Vittle",
-    "Little Wing",
-    "Little-One",
-    "Littlebit",
-    "Littlecat",
-    "Littlefoot",
-    "Littlepage",
-    "Littlest One",
-    "Liver Fudge Boy",
-    "Livewire",
-    "Livia",
-    "Livorno",
-    "Livy",
-    "Liz",
-    "Liz Gallagher",
-    "Liza",
-    "Lizard",
-    "Lizzie",
-    "Lizzy",
-    "Lloyd",
-    "Loadie",
-    "Lobo",
-    "Lobster",
-    "Locke (after the philosopher \\",
-    "Loco",
-    "Locutus (from Star Trek)",
-    "Loekie (Dutch name of tv-character)",
-    "Loesje",
-    "Lofton",
-    "Lofty Softy",
-    "Logan",
-    "Logitech",
-    "Lois",
-    "Lois Lane",
-    "Lokai",
-    "Loke (Viking mythology: the untrustworthy god)",
-    "Loki",
-    "Loki Anklebiter",
-    "Lokiki",
-    "Lola",
-    "Loli",
-    "Lolipop",
-    "Lolita",
-    "Lollipop",
-    "Lollo",
-    "Lolly",
-    "Lolly-Pop",
-    "Lolo",
-    "London",
-    "Lone Star",
-    "Long John Silver",
-    "Long Socks",
-    "Long Tail",
-    "Long Tall Sally",
-    "Longcat",
-    "Loni",
-    "Lonni",
-    "Looby",
-    "Lookame",
-    "Looney Cat",
-    "Loony",
-    "Loopy Lulu",
-    "Loosey",
-    "Loosey Loosem",
-    "Lopez",
-    "Lord Caspian de Fluff",
-    "Lord Chubster",
-    "Lord Julius L'Orange",
-    "Lord Kitchner of Khartoum",
-    "Lord Thomas Morris Gallagher III",
-    "Lorelei",
-    "Lorenzo",
-    "Lorenzo Bandini",
-    "Loretta Lynn",
-    "Lorraine",
-    "Lorrie",
-    "Loser",
-    "Lostra Laptiger",
-    "Lots-O-Dots",
-    "Lotus",
-    "Lotus Flower",
-    "Lou",
-    "Lou Dog",
-    "Lou Reed",
-    "Lou-Lou Lemon",
-    "Loud Kitty",
-    "Loud Mouth",
-    "Loudmouth",
-    "Loueysmith",
-    "Louie",
-    "Louie Louie",
-    "Louie Waterlou",
-    "Louis",
-    "Louis Baudelaire (after French poet Charles Baudelaire)",
-    "Louise",
-    "Louise the Cat",
-    "Louisiana",
-    "Louisiel",
-    "LouLou",
-    "Lounge",
-    "Loup-Garou",
-    "Lousia",
-    "Love",
-    "Love Bug",
-    "Love Button",
-    "Love-Bug",
-    "Love-Pig",
-    "Lovebug",
-    "Lovecake",
-    "Lovee",
-    "Lovely",
-    "Lover",
-    "Loverboy",
-    "Lovergirl",
-    "Loves Meat",
-    "Lovesong",
-    "Lovey",
-    "Lovey Dovey",
-    "Lovey Kitty",
-    "Low",
-    "Low Chroma (after the scientists term for dark-grey wetland soil)",
-    "Lowell",
-    "Lowenbrau",
-    "Lowes",
-    "Loxley, after",
-    "Lucas",
-    "Luce",
-    "Lucey",
-    "Luci",
-    "Luci Baines",
-    "Luci Fur",
-    "Lucia",
-    "Lucia Bianca",
-    "Luciani",
-    "Lucidor",
-    "Lucifer",
-    "Lucifur",
-    "Lucilla",
-    "Lucille",
-    "Lucinda",
-    "Luciole (French for \\",
-    "Lucius",
-    "Luck 'O The Irish",
-    "Lucky",
-    "Lucky Doodle Lee Doo",
-    "Lucky Duck",
-    "Lucky-Bob",
-    "Lucretia",
-    "Lucy",
-    "Lucy  Twosee",
-    "Lucy And Ricardo",
-    "Lucy Belle",
-    "Lucy Girl",
-    "Lucy Loo Hoo",
-    "Lucy May",
-    "Lucy-Cat",
-    "Lucy-Fur",
-    "Lucy-lou",
-    "Lude",
-    "Ludlow",
-    "Ludo (after the character in the movie \\",
-    "Ludwig",
-    "Luey",
-    "Luffy (after Monkey D. Luffy, character in the \\",
-    "Lug",
-    "Lugh",
-    "Lugi",
-    "Lugosi (after 1940s Dracula actor \\",
-    "Luigi",
-    "Lujak (Named for Larry Lujack, a radio DJ in Chicago)",
-    "Luka",
-    "Luke",
-    "Luke Skywalker",
-    "Lukie",
-    "Lukin (after Matt Lukin, bassist)",
-    "Lukmee",
-    "Lukrets",
-    "Luky",
-    "Lula",
-    "Lulie Julie",
-    "Lullaby",
-    "Lulu",
-    "Lulubell",
-    "Lum",
-    "Lump Of Fluff",
-    "Lumps",
-    "Lumpy",
-    "Lumumba (after the hot drink with cocoa and cognac or brandy)",
-    "Luna",
-    "Lunatic",
-    "Lunchbox",
-    "Lunchmeat",
-    "Lunzie",
-    "Lupin",
-    "Lurch",
-    "Lurk",
-    "Lurkmeister",
-    "Lurky",
-    "Luron",
-    "Luschia",
-    "Luther",
-    "Lutin (French for pixie)",
-    "Lux (latin for \\",
-    "Luxor",
-    "Luzie",
-    "Lycos",
-    "Lycus",
-    "Lydia",
-    "Lyndon Johnson",
-    "Lynx",
-    "Lyonhart",
-    "Lyonne (short for Lioness)",
-    "Lypsinka",
-    "Lyra",
-    "Lyric",
-    "Lysanne",
-    "Lyzen",
-    "M&M",
-    "M&M's",
-    "M'Lou",
-    "M.C. (\\",
-    "M.C. Amadeus",
-    "M.D. (\\",
-    "M.E.S.L. (Meatball eyes and spagetti legs)",
-    "M.J.Tookers",
-    "Ma",
-    "Maalox",
-    "Maatjie (Afrikaans for \\",
-    "Mabel",
-    "Mabey",
-    "Mac",
-    "Mac Duff",
-    "Mac the Knife",
-    "Mac-Attack",
-    "Macaroni",
-    "Macasa",
-    "Macavity",
-    "Macbeth",
-    "Macchiavelli",
-    "Macduff",
-    "MacGillikitty",
-    "MacGregor",
-    "MacGyver",
-    "Macha (Irish Goddess)",
-    "Machete",
-    "Machiavelli",
-    "Macho",
-    "Machts Nichts",
-    "Macintosh",
-    "Mack",
-    "Mackdoodles",
-    "MacKenzie",
-    "Mackerel",
-    "Mackie",
-    "Macko",
-    "Mackroll",
-    "Macky Kat",
-    "Macky-Wacky",
-    "Macleay",
-    "Macmillan",
-    "Maco",
-    "Macpherson",
-    "MacTabby",
-    "MacTavish",
-    "Macuilxochitl (Aztec mythology: the god of music and dance)",
-    "Macusa (after the first girlfriend of Compay Segundo)",
-    "Macushla (Irish for \\",
-    "Macy",
-    "Mad Cat",
-    "Mad Dog",
-    "Mad Max",
-    "Mad Max the Road Warrior",
-    "Mad Maxx",
-    "Madam Boo",
-    "Madam Helena petrovich Blavatski",
-    "Madame Butterfly",
-    "Madame Cuddles",
-    "Madcap",
-    "Madcap Bad Cat",
-    "Madchen (German for \\",
-    "Madden",
-    "Maddie",
-    "Maddison",
-    "Madeira",
-    "Madeleine",
-    "Madeline",
-    "Madhuri",
-    "Madibug",
-    "Madie",
-    "Madison",
-    "Madlyn",
-    "Madmax",
-    "Madoka",
-    "Madoki",
-    "Madonna",
-    "Madore",
-    "Maduro",
-    "Maebelle",
-    "Maelstrom",
-    "Maestoso (musical term meaning \\",
-    "Maestro",
-    "Maestro Tuxedo",
-    "Maeve",
-    "Mafalda",
-    "Mafia",
-    "Mafioso",
-    "Mag",
-    "Maga",
-    "Magapaws",
-    "Magda",
-    "Magdalina",
-    "Magee",
-    "Magellan",
-    "Magellian",
-    "Magenta",
-    "Maggi",
-    "Maggie",
-    "Maggie Elise",
-    "Maggie Mae",
-    "Maggie May",
-    "Maggie Moneyeyes",
-    "Maggy",
-    "Magi",
-    "Magic",
-    "Magna",
-    "Magna Catta",
-    "Magnesium Hydroxide",
-    "Magnet",
-    "Magnificat",
-    "Magnolia",
-    "Magnolia Belle",
-    "Magnolia Mayhem",
-    "Magnum",
-    "Magnum P.I.",
-    "Magnus",
-    "Magnus Barf't",
-    "Magpie",
-    "Magritte",
-    "Magruder",
-    "Mags",
-    "Magus",
-    "Magwa",
-    "Magz",
-    "Maha",
-    "Mahalia",
-    "Maharishi",
-    "Mahi-Mahi",
-    "Mahimahi",
-    "Mahkucky",
-    "Mahogany",
-    "Mahogany Mist",
-    "Mahomet",
-    "Mahoot",
-    "Mahrio",
-    "Mahu",
-    "Mai Ling",
-    "Mai Tai",
-    "Mai Tai Tu",
-    "Mai-Ling",
-    "Maia",
-    "Maicho",
-    "Maika",
-    "Mail",
-    "Mailman",
-    "Mainard",
-    "Maine",
-    "Mainerd",
-    "Mainly Marvelous",
-    "Maire",
-    "Maisie",
-    "Maitos",
-    "Maizie",
-    "Maizy",
-    "Maja",
-    "Majesta",
-    "Majestic",
-    "Majesty",
-    "Maji",
-    "Majick",
-    "Majik",
-    "Major",
-    "Major Grey",
-    "Maka",
-    "Makar",
-    "Makayla",
-    "Makena",
-    "Makenzie",
-    "Maki",
-    "Makita",
-    "Mako",
-    "Maksi",
-    "Mal Leable",
-    "Mal'vina",
-    "Malachai",
-    "Malaquias",
-    "MaLarkey",
-    "Malcolm",
-    "Malcolm James",
-    "Malcolm The Boneless",
-    "Malcolm X",
-    "Malcom",
-    "Malcom Tent",
-    "Maley",
-    "Maliboo",
-    "Maliboo Canyon",
-    "Maliboo Canyon Bear",
-    "Malibu",
-    "Malice",
-    "Malichi",
-    "Malik (Arabic for \\",
-    "Malinki (after Lynley Dodd's childrens book \\",
-    "Malka",
-    "Malkin",
-    "Malkinor",
-    "Malkuth The Mush-Boy",
-    "Mallarde",
-    "Mallarde, Cat a la Orange",
-    "Malley",
-    "Mallorey",
-    "Mallory",
-    "Mallpark",
-    "Mallue",
-    "Mally",
-    "Mally Moe",
-    "Mallymal",
-    "Maloni",
-    "Malossi",
-    "Mam'selle",
-    "Mama",
-    "Mama Bumpity",
-    "Mama C",
-    "Mama Cat",
-    "Mama Girl",
-    "Mama Kitty",
-    "Mama's Boy",
-    "Mama's Missie",
-    "Mamacita",
-    "Mamala",
-    "Mamba",
-    "Mambo",
-    "Mamie",
-    "Mamma Cat",
-    "Mamo",
-    "Man",
-    "Man of Mystery",
-    "Man Of The Moon",
-    "Man Paws",
-    "Man Power",
-    "Manapua",
-    "Manchu",
-    "Manda",
-    "Mandal",
-    "Mandalay",
-    "Mandarijn",
-    "Mandela",
-    "Mandicat",
-    "Mandicus",
-    "Mandinga (after a traditional Cuban song)",
-    "Mandinka",
-    "Mandolin",
-    "Mandrake",
-    "Mandu (as in Cat Mandu)",
-    "Mandy",
-    "Mandy Balck",
-    "Maneca",
-    "Manefa",
-    "Manga",
-    "Mango",
-    "Mango (after the character in Saturday Night Live)",
-    "Mangos",
-    "Mangy Half-Breed",
-    "Mangykat",
-    "Manhasset (after a music stand company)",
-    "Manhattan",
-    "Maniac",
-    "Maniac Kitty-kat Pendragon",
-    "Manic Depressive",
-    "Manky",
-    "Mann",
-    "Mannaz",
-    "Manners",
-    "Mannie",
-    "Mannikavacakar",
-    "Manny",
-    "Manson",
-    "Manteau",
-    "Mantha",
-    "Manuel",
-    "Manx",
-    "Manxy",
-    "Manzer",
-    "Mao (Egyptian for \\",
-    "Mao-Mao (Cantonese for \\",
-    "Mao-tou Pu-sa (Chinese for \\",
-    "Mao-Tse Tung",
-    "Maotsetung",
-    "Mapes",
-    "Maple",
-    "Maple Syrup",
-    "Mara",
-    "Marabelle",
-    "Marabunta (after the Soldier ants in South America)",
-    "Maraschino",
-    "Marat",
-    "Marathon",
-    "Marauder",
-    "Marble",
-    "Marbler",
-    "Marbles",
-    "Marblet",
-    "Marbletski",
-    "Marcel",
-    "Marchello",
-    "Marcie",
-    "Marco",
-    "Marco Polo",
-    "Marcus",
-    "Marcus Welby",
-    "Marcy",
-    "Mardi Gras",
-    "Mareau",
-    "Marf",
-    "Marfa",
-    "Marfusha",
-    "Margaret (after Margaret Thatcher)",
-    "Margaret Hissyface",
-    "Margarine",
-    "Margarita",
-    "Margaritaville",
-    "Margaux",
-    "Margay",
-    "Marge",
-    "Margherita",
-    "Margie",
-    "Margin",
-    "Margo",
-    "Marguerita",
-    "Marguerite",
-    "Maria",
-    "Maria Conchita Gatopants",
-    "Mariachi",
-    "Mariah",
-    "Marianna",
-    "Marianne",
-    "Marichat",
-    "Maricho",
-    "Marie",
-    "Marie Antoinette",
-    "Marie Curie",
-    "Marie-Eve",
-    "Marieka",
-    "Marietta",
-    "Marigold",
-    "Marika",
-    "Marikatin Olga Andrejevna",
-    "Marilla",
-    "Marilou",
-    "Marilyn",
-    "Marilyn Monroe",
-    "Marin",
-    "Marina",
-    "Marinara",
-    "Mario",
-    "Mariole",
-    "Marion",
-    "Mariposa (Spanish for \\",
-    "Mariska",
-    "Marja",
-    "Marjoram",
-    "Mark",
-    "Mark Antonia",
-    "Mark I love you",
-    "Markel",
-    "Marker",
-    "Markiz",
-    "Marky-pooh Whiskers Nibble Corn",
-    "Marla",
-    "Marla Maples",
-    "Marlboro",
-    "Marlena",
-    "Marley",
-    "Marlin",
-    "Marlo",
-    "Marloe",
-    "Marlowe (after Philip)",
-    "Marmaduke",
-    "Marmalade",
-    "Marmelade",
-    "Marmie (short for Marmalade)",
-    "Marmite",
-    "Marmsyduke",
-    "Marney",
-    "Marnie",
-    "Marquee",
-    "Marrakesh",
-    "Mars",
-    "Marshall",
-    "Marshmallow",
-    "Marshmellow",
-    "Marsina",
-    "Marta",
-    "Marte",
-    "Martha",
-    "Martian",
-    "Martin",
-    "Martina",
-    "Martini",
-    "Marty",
-    "Marvelous",
-    "Marvelous Imperial Pussycat",
-    "Marvin",
-    "Mary",
-    "Mary Bagpipe Donut",
-    "Mary Catherine",
-    "Mary Katherine",
-    "Mary Magdalene",
-    "Mary-Ann",
-    "Mary-Kate Olsen",
-    "Maryellen",
-    "Marykay",
-    "Marylou",
-    "Marzipan",
-    "Marzipan (from the Flash cartoon Homestar Runner)",
-    "Mascara",
-    "Mascot",
-    "Masha",
-    "Mashka",
-    "Mashmaloo",
-    "Masia",
-    "Masik",
-    "Masika (Swahili for \\",
-    "Maso",
-    "Mason",
-    "Masquerade",
-    "Massander (after Massandra, a little village near Yalta, Crimea, Ukraine)",
-    "Master",
-    "Master Nicholas Christian",
-    "Master Sebastian",
-    "Master Sebastian, The Bastu Of Fu Manchu",
-    "Mastro",
-    "Masya",
-    "Masza",
-    "Mata Hari",
-    "Matador",
-    "Matca (Croatian for 'female cat')",
-    "Match Maker",
-    "Matches",
-    "Mater",
-    "Mateus",
-    "Matewis",
-    "Mathilda",
-    "Matilda",
-    "Matisse",
-    "Matje (Flemish for \\",
-    "Matka",
-    "Matok",
-    "Matou",
-    "Matra",
-    "Matrena",
-    "Matrix",
-    "Matrozkine",
-    "Matt",
-    "Matt Catt",
-    "Matter-of-Cat",
-    "Matthew",
-    "Mattie",
-    "Mattox",
-    "Matty",
-    "Matzo",
-    "Mau",
-    "Mauchai",
-    "Maud",
-    "Maude",
-    "Maui",
-    "Maule",
-    "Mauler",
-    "Maulie",
-    "Mauly Ringworm",
-    "Maunz",
-    "Maunz (catname in Struwwelpeter)",
-    "Maunzi",
-    "Maura",
-    "Maureen",
-    "Maurice",
-    "Maus",
-    "Mauser",
-    "Mausi",
-    "Mauve Mutz",
-    "Mauwse",
-    "Mave",
-    "Maverick",
-    "Mavis",
-    "Mavra",
-    "Max",
-    "Max a million",
-    "Max Houdini",
-    "Maxi",
-    "Maxie",
-    "Maxie Messmaker",
-    "Maxie-boo",
-    "Maxie-Moto",
-    "Maxiefaxiewaxietaxi",
-    "Maxima",
-    "Maximilian Liao Klein",
-    "Maximillian",
-    "Maximillion",
-    "Maximillion Diamond",
-    "Maximillion vonBadcat",
-    "Maximino",
-    "Maximoto",
-    "Maximum Cat",
-    "Maximus",
-    "Maximus Decimus Meridius",
-    "Maxine",
-    "Maxine MacArthur",
-    "Maxlie",
-    "Maxlin",
-    "Maxmillian",
-    "Maxwell",
-    "Maxwell P. Cat",
-    "Maxwell Silver-Hammer",
-    "Maxwell Smart",
-    "Maxx",
-    "Maxy",
-    "Maxy-P",
-    "May",
-    "May Kitty",
-    "May Thai",
-    "May-Ling",
-    "May-pole",
-    "Maya",
-    "Mayahuel (Aztec mythology: goddess of maguey)",
-    "Maybe",
-    "Maybe Baby",
-    "Maybelline",
-    "Mayfair",
-    "Mayflower",
-    "Mayhem",
-    "MayMay",
-    "Maynard",
-    "Mayor McCheese",
-    "Maysa",
-    "Mazel Tov",
-    "Mazie",
-    "Mazik",
-    "Mazo",
-    "MaÊka",
-    "McCavity",
-    "McCloud",
-    "McConnell",
-    "McCoy",
-    "McDuffy",
-    "McEntire",
-    "McGraw (after the american country music singer Tim McGraw)",
-    "McGreggor",
-    "McGurk",
-    "McKenzie",
-    "McKinley",
-    "McNeil Sylvester Waller-Orth",
-    "McNutt",
-    "McNuttless",
-    "McQue",
-    "McSalter",
-    "McTavish",
-    "Me Too",
-    "Me-Too",
-    "Mea",
-    "Mea Culpa (Latin for \\",
-    "Meade",
-    "Meadow",
-    "Meaghan",
-    "Mealy",
-    "Mealykaleekymacka (Christmas)",
-    "Meander",
-    "Meaness",
-    "Measles",
-    "Meat-a-licious",
-    "Meatball",
-    "Meathead",
-    "Meathook",
-    "Meatious Maximus",
-    "Meatloaf",
-    "Meatloaf (after the rock band)",
-    "Meatloaf Of Death",
-    "Meaty Boy",
-    "Meaty Feets",
-    "Meatyboy",
-    "Mebo",
-    "Medea",
-    "Medianoche",
-    "Medicine Kitty",
-    "Medicine Man",
-    "Medley",
-    "Medusa",
-    "Mee-Krob",
-    "Meecer",
-    "Meechako",
-    "Meecho",
-    "Meekins",
-    "Meeko",
-    "MeeMee",
-    "Meems",
-    "Meenie",
-    "Meep",
-    "Meepers",
-    "Meepy",
-    "Meer",
-    "MeerClar Sloane",
-    "Meesh",
-    "Meesha",
-    "Meeth",
-    "Meethie",
-    "Meetsi (German for \\",
-    "Meeuw (Afrikaans for \\",
-    "Meeuw (Dutch for \\",
-    "Meewow",
-    "Meezee",
-    "Meg",
-    "Mega",
-    "Megabyte",
-    "MegaDeath",
-    "Megadots",
-    "Megahertz",
-    "Megan",
-    "Megan Brooke",
-    "Megatoes",
-    "Megellan",
-    "Meggie",
-    "Meggie The Bitch Kitty",
-    "Meghann",
-    "Megs",
-    "Mehitabel",
-    "Mehkt Hakkikt",
-    "Mei Ling Shan",
-    "Mei Sin",
-    "Meisha",
-    "Meisie",
-    "Meissa (after Lambda Orionis, one of the stars in the Orion constellation)",
-    "Meistoe",
-    "Meiya Harley",
-    "Mejo (Spanish for \\",
-    "Meko",
-    "Mel",
-    "Mel Gibson",
-    "Melabie",
-    "Melan",
-    "Melange",
-    "Melanie",
-    "Melanippos",
-    "Melanistic",
-    "Melas (Biblical Greek word for black)",
-    "Melbourne",
-    "Mele",
-    "Meli (Greek for \\",
-    "Meliot (after Arthurian literary character \\",
-    "Melissa",
-    "Melitrissa",
-    "Mello",
-    "Mellon (Means \\",
-    "Mellow",
-    "Melodie",
-    "Melody",
-    "Melon",
-    "Melon-Head",
-    "Melquiades",
-    "Meluseth (she who loves the moon)",
-    "Melville",
-    "Melvin",
-    "Melvis",
-    "Mem",
-    "Meme",
-    "Memmy",
-    "Memmycat",
-    "Memnoch (after the character in Anne Rice's 'Vampire Chronicles')",
-    "Memoir",
-    "Memphis",
-    "Menage",
-    "Menchi",
-    "Mendle",
-    "Mendlesohn",
-    "Meneau",
-    "Meneki Nikko",
-    "Menelao",
-    "Mennis",
-    "Menolly Jazz",
-    "Mental",
-    "Mental Case",
-    "Meo",
-    "Meo Hao",
-    "Meouwz",
-    "Meow",
-    "Meow Meow",
-    "Meow Meow Girl",
-    "Meow Tse Tounge",
-    "Meow Tse-Tung",
-    "Meow-mee",
-    "Meowance",
-    "Meower",
-    "Meowie",
-    "Meowie Face",
-    "Meowkis",
-    "Meowmer",
-    "Meowsapuss",
-    "Meowser",
-    "Meowshroom",
-    "Meowski",
-    "Meowsta",
-    "Meowwow",
-    "Meowzabeth",
-    "Meowzer",
-    "Meowzers",
-    "Meowzie",
-    "Meph",
-    "Mephisto",
-    "Mephistopheles",
-    "Mercedes",
-    "Mercer",
-    "Mercury",
-    "Mercutio (character in Romeo and Juliet)",
-    "Mercy",
-    "Meredith",
-    "Meri Ubastet",
-    "Meri-Mehkmet (after an Egyptian queen)",
-    "Meriadoc",
-    "Meringue",
-    "Merissa",
-    "Merlan",
-    "Merle",
-    "Merlin",
-    "Merlin Mc.Cuddle Loaf",
-    "Merlino",
-    "Merlkins",
-    "Merlot",
-    "Merly",
-    "Merlyn",
-    "Merrick",
-    "Merricka",
-    "Merry",
-    "Merry Christmas",
-    "Merry Mews",
-    "Mervyn",
-    "Mery",
-    "Meryl",
-    "Meryl Peep",
-    "Mesa",
-    "Mesha",
-    "Meshak",
-    "Mesquite",
-    "Messy",
-    "Messyfase",
-    "Meta",
-    "Meta Mae",
-    "Metallica (after the rock/metal band)",
-    "Metaphor",
-    "Metaxa",
-    "Methos (an enigmatic TV show character with many cat characteristics)",
-    "Methyl",
-    "Metis",
-    "Metoo",
-    "Metric",
-    "Metricat",
-    "Metrick",
-    "Metrik",
-    "Metro",
-    "Metztli (Aztec mythology: the moon god)",
-    "Meuser",
-    "Mew",
-    "Mewbles",
-    "Mewlan",
-    "Mewler (after the Irish tenor)",
-    "Mewy",
-    "Mewymew",
-    "Meyer",
-    "Mi Nyo (Burmese for \\",
-    "Mi Tu",
-    "Mi-kay Seven (Japanese for \\",
-    "Mi-Ke",
-    "Mia",
-    "Miacis (50 million year old ancestor of the cat)",
-    "Miaow-Miaow",
-    "Miasma",
-    "Miata",
-    "Miauert",
-    "Miaumoto (Japanese swordsman/strategist)",
-    "Miav (Danish for \\",
-    "Mic Mac",
-    "Mica Pisika (Romanian for \\",
-    "Micaela",
-    "Micah",
-    "Micari",
-    "Mice Master",
-    "Micester",
-    "Michael",
-    "Michael Jordan",
-    "Michael Patrick O'Kittycat",
-    "Michael Thomas",
-    "Michaela",
-    "Michaelangelo",
-    "Michant",
-    "Micheal",
-    "Michel",
-    "Michelangelo",
-    "Michelin",
-    "Michelle",
-    "Michi",
-    "Michief",
-    "Michine (Mi-cheen)",
-    "Michkin",
-    "Micia",
-    "Micio",
-    "Mick",
-    "Mick Jagger",
-    "Mick St. Charles",
-    "Mickey",
-    "Mickey And Minnie",
-    "Mickey Blue",
-    "Mickey Mouser",
-    "Micki",
-    "Mickin",
-    "Mico",
-    "Mico (Spanish for \\",
-    "Micro",
-    "Microbes",
-    "Mictlan (Aztec mythology: the underworld)",
-    "Mictlantecuhtli (Aztec mythology: the god of Mictlan and the dead)",
-    "Midas",
-    "MiddieMeow",
-    "Middles",
-    "Midge",
-    "Midget",
-    "Midi",
-    "Midnight",
-    "Midnight Amber Foxy Kamber",
-    "Midnight Blue",
-    "Midnight Mariah (from the song \\",
-    "Midnight Rider (after the song by the Allman Brothers Band)",
-    "Midnight Shadow",
-    "Midnight Smedley",
-    "Midnight Special",
-    "Midnite",
-    "Midori",
-    "Midrange",
-    "Mie",
-    "Mie Mie (pronounced \\",
-    "Mie moe moe",
-    "Mieko",
-    "Miele",
-    "Miemur",
-    "Mies",
-    "Miescat",
-    "Mieschen",
-    "Miette",
-    "Miezer",
-    "Miffer",
-    "MiG",
-    "Mighty",
-    "Mighty Hunter",
-    "Mighty Mouth",
-    "Mighty Thor",
-    "Mignon",
-    "Miguel",
-    "Miika (after the finnish football player Miika Koppinen)",
-    "Mija (Spanisch for \\",
-    "Mika",
-    "Mikail",
-    "Mikaso",
-    "Mike",
-    "Mike Hammer",
-    "Mike Malone",
-    "Mike Malone Of Suzeran",
-    "Mike P. Hoover",
-    "Mikey",
-    "Mikey Jordan",
-    "Mikhail",
-    "Miki",
-    "Mikie",
-    "Mikkar",
-    "Mikkel",
-    "Mikkelbar Nelson (after the character on the Bob and Ray Radio show)",
-    "Mikki",
-    "Mikko",
-    "Miklo",
-    "Miko",
-    "Mila",
-    "Milady",
-    "Milagros (Spanish for \\",
-    "Milano",
-    "Mildew",
-    "Mile High",
-    "Milea",
-    "Milennium",
-    "Miles",
-    "Miles (of smiles)",
-    "Milhouse",
-    "Milk",
-    "Milk Misty",
-    "Milk Monster",
-    "Milkdud",
-    "Milkshake",
-    "Milky",
-    "Milky Way",
-    "Milkybooboo",
-    "Milla",
-    "Milla-Magia",
-    "Mille",
-    "Miller",
-    "Milli",
-    "Milli Vanilli",
-    "Millicent",
-    "Millicent (after the character in D.C. Simpson's online comic \\",
-    "Millie",
-    "Millie T. Cat",
-    "Millwood",
-    "Milly",
-    "Milly and Millford",
-    "Milly Molly Mandy",
-    "Milmil",
-    "Milo",
-    "Miloe",
-    "Milou",
-    "Milton",
-    "Mima",
-    "Mimas Maxamillian",
-    "Mime",
-    "Mimi",
-    "Mimi - Ow!",
-    "Mimine",
-    "Mimmi",
-    "Mimo",
-    "Mimosa",
-    "Mimsy",
-    "Min",
-    "Min-min",
-    "Mina",
-    "Mincer (catname in Struwwelpeter)",
-    "Mindinao",
-    "Mindy",
-    "Mindy Rae",
-    "Mine",
-    "Mineau",
-    "Minerva (after the Roman goddess of the hunt)",
-    "Minet",
-    "Minette",
-    "Ming",
-    "Ming Foo",
-    "Ming Li",
-    "Ming Ming the Circus Monkey",
-    "Ming Sue",
-    "Ming-Ling",
-    "Minga",
-    "Mingo",
-    "Mingus",
-    "Mini",
-    "Mini Gray",
-    "Mini Me",
-    "Mini Min",
-    "Mini Panther",
-    "Mini Pearl",
-    "Minica",
-    "Minie",
-    "Minilotto",
-    "Minime",
-    "Minimog",
-    "Minimum",
-    "Minimum-cat",
-    "Minipuss",
-    "Minis",
-    "Mink",
-    "Minka",
-    "Minkatze",
-    "Minke",
-    "Minki Man",
-    "Minkin",
-    "Minko",
-    "Minky",
-    "Minky Sue",
-    "Minneapolis",
-    "Minneapurrlis",
-    "Minnerva",
-    "Minnesota",
-    "Minni",
-    "Minnie",
-    "Minnie Mitchell",
-    "Minnie Moo",
-    "Minnie Moo Lazy",
-    "Minnie Mouse",
-    "Minnie Pearl",
-    "Minnow",
-    "Minny",
-    "Mino (French for \\",
-    "Minoe",
-    "Minoes",
-    "Minon (from the poem \\",
-    "Minoosh",
-    "Minor",
-    "Minou",
-    "Minou Noir",
-    "Minouche",
-    "Minow",
-    "Minsky",
-    "Minster",
-    "Minstrel",
-    "Mint (after the herb)",
-    "Mintaka",
-    "Mintie",
-    "Mintnight",
-    "Minue",
-    "Minuet",
-    "Minuette",
-    "Minuish",
-    "Minute Maid",
-    "MinWee",
-    "Minx",
-    "Minyen",
-    "Minz (catname in Struwwelpeter)",
-    "Mip",
-    "Mira",
-    "Mirabell",
-    "Miracle",
-    "Miracle Cat",
-    "Mirage",
-    "Miranda",
-    "Miranda Mabel",
-    "Mirci",
-    "Mircli",
-    "Miri",
-    "Miriam",
-    "Miribu",
-    "Mirka",
-    "Mirru",
-    "MirÛ",
-    "Misantrop",
-    "Mischa",
-    "Mischevious",
-    "Mischief",
-    "Mise",
-    "Misery",
-    "Misfit",
-    "Mish",
-    "Mish Mosh",
-    "Misha",
-    "Mishimi",
-    "Mishka",
-    "Mishka (Russian for \\",
-    "Mishmash",
-    "Mishnoodle",
-    "Mishra",
-    "Mishy",
-    "Misk",
-    "Miso",
-    "Misquita",
-    "Miss Abigail Buttonwood",
-    "Miss Adventure",
-    "Miss Angelica Pureheart",
-    "Miss Ashley",
-    "Miss Buffy",
-    "Miss Chief (Mischief)",
-    "Miss Cleo",
-    "Miss E.",
-    "Miss Ee",
-    "Miss Gabby",
-    "Miss Jessicat",
-    "Miss Kaya",
-    "Miss Kitty",
-    "Miss Lily",
-    "Miss Limpfooty",
-    "Miss Lucy",
-    "Miss Maple",
-    "Miss Marple",
-    "Miss Meow",
-    "Miss Modest",
-    "Miss Molly",
-    "Miss Moonstone",
-    "Miss Muffett",
-    "Miss Muffin",
-    "Miss Nellie Smellie Yellow-bellie",
-    "Miss Paws",
-    "Miss Penny",
-    "Miss Piggy",
-    "Miss Pittypat",
-    "Miss Pretty Princess Abigail Smooch Face",
-    "Miss Priss",
-    "Miss Prissy",
-    "Miss Purrrfect",
-    "Miss Puss",
-    "Miss Rae",
-    "Miss Relaxation",
-    "Miss Sarah",
-    "Miss Sarah Vaughan",
-    "Miss Strangelove",
-    "Miss T. Bell",
-    "Miss Tizz",
-    "Miss Wiggles",
-    "Miss-Queue",
-    "Missan",
-    "Misser (Danish for kitty)",
-    "Missie",
-    "Missing Link",
-    "Missle",
-    "Misst",
-    "Missy",
-    "Missy Kitty",
-    "Missy Tardee",
-    "Missycat",
-    "Mist",
-    "Mistee",
-    "Mister",
-    "Mister Brother",
-    "Mister Demonico",
-    "Mister Fuzzy Rubberlips",
-    "Mister MaGoo",
-    "Mister Mister",
-    "Mister Patootie Head",
-    "Mister Perkins",
-    "Mister Puddycat",
-    "Mister Something erother",
-    "Mister Thumbs",
-    "Misti",
-    "Mistiblue Mischief",
-    "Mistifur Mountain Kitty Kat",
-    "Mistifur Mountain Meadow Muffin",
-    "Mistique",
-    "Mistletoe",
-    "Mistoffeles",
-    "Mistress",
-    "Mistress Buffington",
-    "Mistress Of Fridge",
-    "Mistress Quickly",
-    "Misty",
-    "Mit Bo",
-    "Mit-tee",
-    "Mitaine",
-    "Mitch",
-    "Mitchell",
-    "Mithcah",
-    "Mithra",
-    "Mithra Cat",
-    "Mithra Louise",
-    "Mithril",
-    "Mitja",
-    "Mitka",
-    "Mitnal (Maya mythology: the underworld hell)",
-    "Mito",
-    "Mitou",
-    "Mitsi",
-    "Mitsou",
-    "Mitsy",
-    "Mitten",
-    "Mittens",
-    "Mitts",
-    "Mitz",
-    "Mitza",
-    "Mitzarena",
-    "Mitzi",
-    "Mitzmog",
-    "Mitzvah",
-    "Mitzy",
-    "Mitzy Mew",
-    "Mix",
-    "Mixed Up",
-    "Miz Lucy",
-    "Miz Piggy",
-    "Mizzy",
-    "Mlle Butterfly",
-    "Mme Hochi Min",
-    "Mo",
-    "Mo Cuirdh (Gaelic for \\",
-    "Mo Vaugh",
-    "Mo-fo",
-    "Mo-i-Rana",
-    "Mo-Jo",
-    "Mo-Mo",
-    "Mobius (after the mathematician)",
-    "Moby",
-    "Mocha",
-    "Mocha AKA PussyBoots",
-    "Mocha Manx",
-    "Mocha Mix",
-    "Mochi",
-    "Mocka",
-    "Moco",
-    "Mod",
-    "Modem",
-    "Modena",
-    "Modest",
-    "Moe",
-    "Moe Ellen Jeanmarie",
-    "Moe Moe",
-    "Moe-Monster",
-    "Moet",
-    "Moffitt",
-    "Mog",
-    "Mogadishu",
-    "Mogadon",
-    "Mogadonna",
-    "Mogget (after the character in the fantasy novels by Garth Nix)",
-    "Moggie",
-    "Moglet",
-    "Mogra",
-    "Mogsie",
-    "Mogul",
-    "Mogwai",
-    "Mogwyre",
-    "Mohave",
-    "Mohawk",
-    "Mohican",
-    "Mohrle",
-    "Moira",
-    "Moira Coon",
-    "Mojave",
-    "Moji",
-    "Mojo",
-    "Mojosito",
-    "Mojothunder",
-    "Moka",
-    "Mokey",
-    "Moki",
-    "Mokie",
-    "Mokin",
-    "Moku",
-    "Mold",
-    "Mole",
-    "Moll Flanders",
-    "Molley",
-    "Molley Muppett",
-    "Molli",
-    "Mollicoddle",
-    "Mollie",
-    "Molly",
-    "Molly Lou",
-    "Molly May Marie",
-    "Molly McButter",
-    "Molly Meganne Noelle",
-    "Molly Molla",
-    "Molly Silverpaws",
-    "Molly Sue",
-    "Mollye",
-    "Molson Moo Cat",
-    "Mom",
-    "Mom Kitty",
-    "Mom-Cat",
-    "Moma Puss",
-    "Momcat",
-    "Momma",
-    "Momma Cat",
-    "Momma Mutz",
-    "Mommy Kitty",
-    "Mommy-Kiddy",
-    "Mommycat",
-    "Momo (gangster from the movie \\",
-    "Momotaro",
-    "Mon Ami",
-    "Mon Cher Or Ma Cherie",
-    "Mona",
-    "Mona Lisa",
-    "Mondavi (from the californian winery)",
-    "Monday",
-    "Monet",
-    "Money",
-    "Money Honey",
-    "Monger",
-    "Mongo",
-    "Mongo (after a character in the movie Blazing Saddles)",
-    "Mongoose",
-    "Monica",
-    "Monica Kat",
-    "Monica Lewensky",
-    "Monika",
-    "Monique",
-    "Monk",
-    "Monkey",
-    "Monkey Face",
-    "Monkeybutt",
-    "Mono",
-    "Monochrome",
-    "Monroe",
-    "Monsanto",
-    "Monsieur",
-    "Monster",
-    "Monster Kitty",
-    "Monstrance",
-    "Montague",
-    "Montana",
-    "Monte",
-    "Monte Carlo",
-    "Montego",
-    "Monteque",
-    "Montezuma (after the Aztec god-king)",
-    "Montgomery",
-    "Montgomery Clift",
-    "Monther",
-    "Monty",
-    "Monty Python",
-    "Moo",
-    "Moo Moo Cat",
-    "Moo Moo Cow",
-    "Moo Shu",
-    "Moo-Moo",
-    "Mooby",
-    "Mooch",
-    "Moocher",
-    "Moochka",
-    "Moochmeister",
-    "Moochy",
-    "Moody",
-    "Moody Blue",
-    "Mooer",
-    "Moofik",
-    "Moofy",
-    "Mooggie",
-    "Moogie",
-    "Mookey Bear",
-    "Mookie",
-    "Mookie-Pookie",
-    "Mookitty",
-    "Moolie-moos",
-    "Moomoo",
-    "Moon",
-    "Moon Light",
-    "Moon Maiden",
-    "Moon Pie",
-    "Moon Unit",
-    "Moona",
-    "Moonbeam",
-    "Moonbean Or Moonmist",
-    "Mooncat",
-    "Moonchaser",
-    "Mooncritter",
-    "Moondance",
-    "Moondust",
-    "Moonflower",
-    "Moongoddess",
-    "Moonie (after the late drummer/hotel-room-wrecker Keith Moon)",
-    "Moonlight",
-    "Moonraker",
-    "Moonshadow",
-    "Moonshine",
-    "Moonstone Molly",
-    "Moonstruck",
-    "Moonunit",
-    "Moorea (island in Tahiti)",
-    "Moose",
-    "Mopar",
-    "Moped",
-    "Mopet",
-    "Mophead",
-    "Mophy",
-    "Moppet",
-    "Moppie Sloef",
-    "Mopsy",
-    "Moptop",
-    "Moqui",
-    "Morag",
-    "Morcheeba",
-    "Mordacious",
-    "Mordecai",
-    "Mordicai",
-    "Mordillo",
-    "Mordred",
-    "Morey",
-    "Morgaine",
-    "Morgan",
-    "Morgan Fairkitty",
-    "Morgan LeFey",
-    "Morgana",
-    "Morgen",
-    "Mori",
-    "Moriah",
-    "Moriarity",
-    "Moritz",
-    "Mork",
-    "Mork And Mindy",
-    "Morley",
-    "Morning Glory",
-    "Morning Star",
-    "Morocco",
-    "Morpheus",
-    "Morris",
-    "Morris Lynn",
-    "Morris Minor",
-    "Morrisey",
-    "Morrison",
-    "Morriz",
-    "Morse (after Inspector Morse)",
-    "Morsel",
-    "Mort",
-    "Mortcake",
-    "Morticia (Addams family)",
-    "Morticia Morena",
-    "Mortimer",
-    "Mortimore B. Zuckkerman",
-    "Mortina",
-    "Mortisha",
-    "Morton",
-    "Morty",
-    "Mosa",
-    "Mosby",
-    "Mose",
-    "Moselle",
-    "Moses",
-    "Mosey",
-    "Moshe",
-    "Moshto",
-    "Mosi (Navajo for \\",
-    "Mosis",
-    "Most",
-    "Most Handsome",
-    "Mother",
-    "Mother Lode",
-    "Mother Teresa",
-    "Motley",
-    "Motley Crue",
-    "Motley Tue",
-    "Moto",
-    "Motor",
-    "Motor Boat",
-    "Motor Man",
-    "Motor Unit",
-    "Motorino",
-    "Mottebal",
-    "Mouauia ibn Abihi (Arabic for \\",
-    "Moufette",
-    "Mough",
-    "Mountainlion",
-    "Mouse",
-    "Mouse Doggie",
-    "Mouse McNasty",
-    "Mousekewitz",
-    "Mouseman",
-    "Mouser",
-    "Mouser Pounce-Fast",
-    "Mouseripper",
-    "Mousetrap",
-    "Mousie",
-    "Moussaka",
-    "Mousse",
-    "Moussette",
-    "Moussine",
-    "Moustache",
-    "Moustic",
-    "Moustick",
-    "Mousy",
-    "Mouth",
-    "Mouton",
-    "Movado",
-    "Movie Star",
-    "Movie Star Cat",
-    "Mow",
-    "Mow Mow",
-    "Mowcha",
-    "Mowgli",
-    "Mowp",
-    "Mowpurrs",
-    "Mowse",
-    "Moxi",
-    "Moxie",
-    "Moxie Muffin",
-    "Moxy",
-    "Moya",
-    "Moyshi",
-    "Mozart",
-    "Mozez",
-    "Mozie",
-    "Mozzerella",
-    "Mr Biggelsworth",
-    "Mr Bruce",
-    "Mr Monster",
-    "Mr. \\",
-    "Mr. A. Gray",
-    "Mr. Alfred",
-    "Mr. Anderson",
-    "Mr. Apricot",
-    "Mr. Bean",
-    "Mr. Beans",
-    "Mr. Beast",
-    "Mr. Bentley",
-    "Mr. Big",
-    "Mr. Big Stuff",
-    "Mr. Biggles Worth",
-    "Mr. Bigglesworth",
-    "Mr. Bill",
-    "Mr. Blue",
-    "Mr. Bojangles",
-    "Mr. Bonkers (from \\",
-    "Mr. Boots",
-    "Mr. Bowles",
-    "Mr. Brown",
-    "Mr. Bubbles",
-    "Mr. Bunny",
-    "Mr. C",
-    "Mr. Cat",
-    "Mr. Chips",
-    "Mr. Choo",
-    "Mr. Clovis Grimm",
-    "Mr. Cold Paws",
-    "Mr. Cotton",
-    "Mr. Dainty Paws",
-    "Mr. Dogfood",
-    "Mr. Fatcat",
-    "Mr. Fi Fi",
-    "Mr. Fish",
-    "Mr. Flatley",
-    "Mr. Fluff",
-    "Mr. Fur",
-    "Mr. Furrbody",
-    "Mr. Fuzz Butt",
-    "Mr. Fuzzy Nose and Toes",
-    "Mr. Fuzzybuns",
-    "Mr. Gingipuss",
-    "Mr. Goober",
-    "Mr. Goodkitty",
-    "Mr. Gotti",
-    "Mr. Hahn (after Joe Hahn, from the band Linkin Park)",
-    "Mr. Happy",
-    "Mr. Hudson",
-    "Mr. Jade",
-    "Mr. Jenkins",
-    "Mr. Jones",
-    "Mr. K",
-    "Mr. Katt",
-    "Mr. Kitty",
-    "Mr. Kitty to You",
-    "Mr. Krabbs",
-    "Mr. Krinkle",
-    "Mr. LittleHead",
-    "Mr. Lucky",
-    "Mr. Lucy",
-    "Mr. Lurch",
-    "Mr. M.",
-    "Mr. Macgeezer",
-    "Mr. Magoo",
-    "Mr. Magoo.",
-    "Mr. McFluffer",
-    "Mr. Mealy",
-    "Mr. Men",
-    "Mr. Mir",
-    "Mr. Mister",
-    "Mr. Mistoffolees",
-    "Mr. Moe",
-    "Mr. Mouse",
-    "Mr. Moustache (after the song by Nirvana)",
-    "Mr. Neo",
-    "Mr. Newman (after Victor Newman from The Young and the Restless)",
-    "Mr. Nibblesworth",
-    "Mr. O'Mally",
-    "Mr. Peepers",
-    "Mr. Pi",
-    "Mr. Pickles",
-    "Mr. PoPo",
-    "Mr. President",
-    "Mr. Puddy",
-    "Mr. Purrbody",
-    "Mr. Purrfect",
-    "Mr. Pussy",
-    "Mr. Roosevelt",
-    "Mr. Sandman",
-    "Mr. Scarfies",
-    "Mr. Sleepers",
-    "Mr. Sleepy",
-    "Mr. Snickers",
-    "Mr. Snuggle Bum",
-    "Mr. Sonny L. Burke (L. for \\",
-    "Mr. Sox",
-    "Mr. Spaz",
-    "Mr. Taz Man",
-    "Mr. Tibbs",
-    "Mr. Tickle Bum",
-    "Mr. Tilly",
-    "Mr. Tinkles",
-    "Mr. Topplemeyer",
-    "Mr. Tubbsaflubbs",
-    "Mr. Uhtman",
-    "Mr. Underfoot",
-    "Mr. Whiskers",
-    "Mr. Winkie",
-    "Mr. Winston (Winnie)",
-    "Mr. Wiskers",
-    "Mr. Woo",
-    "Mr. Wooten",
-    "Mr.Cuddly Buns",
-    "Mrackbudha",
-    "Mracks-A-Lot",
-    "Mri'Fa",
-    "Mrrow",
-    "Mrrranda",
-    "Mrs. Naugatuck",
-    "Mrs. Noris (after Filch's cat in the Harry Potter books)",
-    "Mrs. Peel (after the character in the tv-series \\",
-    "Mrs. Silverspoon",
-    "Mrs. Tabitha Twitchet (from \\",
-    "mrs. Twinklebottoms",
-    "Ms. Agnes Depesto",
-    "Ms. Beach",
-    "Ms. Beasley",
-    "Ms. Bigglesworth",
-    "Ms. Cat",
-    "Ms. Cornwallis",
-    "Ms. Dikky",
-    "Ms. Grey",
-    "Ms. Kitty",
-    "Ms. Lester",
-    "Ms. Meowkins",
-    "Ms. Morgan",
-    "Ms. Piggy",
-    "Ms. President",
-    "Ms. Rascalini",
-    "Ms. Sassy Cat",
-    "Ms. Scott",
-    "Ms. Sweet",
-    "Ms. Terry",
-    "Ms. Woogies",
-    "Mu",
-    "Mu Shu",
-    "Muca (Gypsy for \\",
-    "Muchpurr",
-    "Muckl",
-    "Mucus",
-    "Mud",
-    "Mud duck",
-    "Mud Pie",
-    "Mud Puddle",
-    "Mudd",
-    "Muddles",
-    "Mudgie",
-    "Mudpie",
-    "Mudslide",
-    "Muenster",
-    "Mufasa (from The Lion King)",
-    "Mufasa (from the movie The Lion King)",
-    "Muff",
-    "Muffassa",
-    "Muffet",
-    "Muffi",
-    "Muffie",
-    "Muffie (from the Battle Star Glactica tv series)",
-    "Muffie-Roo",
-    "Muffin",
-    "Muffin Man",
-    "Muffin Muffin",
-    "Muffin-head",
-    "Muffinhead",
-    "Muffinman",
-    "Muffins",
-    "Muffinster",
-    "Muffioso",
-    "Muffster",
-    "Muffy",
-    "Mufti",
-    "Mug",
-    "Mugabe",
-    "Mugatu (after the character in the movie \\",
-    "Mugger",
-    "Muggle Bear",
-    "Muggsy",
-    "Mugin",
-    "Mugsy",
-    "Mugwump",
-    "Muha",
-    "Muhammad Ali",
-    "Muira",
-    "Muk",
-    "Mulberry",
-    "Mulder",
-    "Muldoon",
-    "Mulle",
-    "Mullet",
-    "Mumbles (after the castle in Wales)",
-    "Mumford",
-    "Mumma",
-    "Mummies Little Angel Pie",
-    "Mummu Kitty",
-    "Mumsy",
-    "Muncher",
-    "Munchie",
-    "Munchkin",
-    "Munchy",
-    "Munchykin",
-    "Mundo",
-    "Mungo",
-    "Mungojerrie",
-    "Munk",
-    "Munku",
-    "Munkustrap",
-    "Munster",
-    "Muon",
-    "Mupee",
-    "Muppet",
-    "Mupps",
-    "Murcielago (Lamborghini)",
-    "Murderdoll Mayhem (after the band Murderdolls)",
-    "Murdock",
-    "Murfee",
-    "Murfy",
-    "Muriel",
-    "Murka",
-    "Murph",
-    "Murphy",
-    "Murphy Brown",
-    "Murray",
-    "Murrimann",
-    "Murzik",
-    "Muscatelli",
-    "Musch",
-    "Muscrat",
-    "Muse",
-    "Muselix",
-    "Musetta",
-    "Mushi",
-    "Mushka",
-    "Mushroom",
-    "Mushy",
-    "Muska",
-    "Muskustrap",
-    "Musli",
-    "Mustang",
-    "Mustard",
-    "Mutant",
-    "Mutiny",
-    "Mutt",
-    "Mutt the Bald",
-    "Mutza",
-    "Mutzy",
-    "Muu-Muu",
-    "MVP",
-    "My Girl",
-    "My Lady Sam",
-    "My Little Cat",
-    "My Little Girl",
-    "My Little Girl Girl",
-    "My Little One",
-    "My Little Pumpkin",
-    "My love",
-    "My Meow-Meow",
-    "Mya",
-    "Mycroft (named for Sherlock Holmes \\",
-    "Myer",
-    "Mykah",
-    "Myki",
-    "Mykonos",
-    "Myles",
-    "Mylette",
-    "Mymlan",
-    "Myna",
-    "Mynta",
-    "Mynx Poo-gas Pendragon",
-    "Myra",
-    "Myron Henry Miracle",
-    "Myrtle",
-    "Mysha",
-    "Mysin",
-    "Myska",
-    "Mystaya",
-    "Mystery",
-    "Mystery Girl",
-    "Mysti",
-    "Mystic",
-    "Mystina",
-    "Mystique",
-    "Myth",
-    "Mytsz",
-    "N.N.Y. (\\",
-    "Nabbenna",
-    "Nabie",
-    "Nabis",
-    "Nacho",
-    "Nachos",
-    "Nacon (Maya mythology: the god of war)",
-    "Nadena",
-    "Nadezhda",
-    "Nadia",
-    "Nadia Komenech",
-    "Nadine (from the Chuck Berry song)",
-    "Nag",
-    "Nairobi",
-    "Naive",
-    "Naji (Arabic for \\",
-    "Nakamichi",
-    "Nakia",
-    "Nakieta",
-    "Nala",
-    "Nala (African for \\",
-    "Nala (from The Lion King)",
-    "Nalii",
-    "Nalle",
-    "Nallie",
-    "Namu",
-    "Nana",
-    "Nanaki",
-    "Nancy",
-    "Nancy Drew",
-    "Nancy Reagan",
-    "Nandita",
-    "Nando",
-    "Nani (Hawaiin for \\",
-    "Nanki Poo",
-    "Nanki-Poo",
-    "Nannetta",
-    "Nanny",
-    "Nano",
-    "Nanuq (Inuit for 'polar bear')",
-    "Naomi",
-    "Napa",
-    "Napalm",
-    "Napoleon",
-    "Napoleon Bonapaws",
-    "Napoleon Solo",
-    "Napoli",
-    "Nappers",
-    "Nappy",
-    "Napster",
-    "Napy",
-    "Naranja (Spanish for \\",
-    "Narisah (Goddess of Light)",
-    "Narkis",
-    "Narnia",
-    "Nary",
-    "Nashella",
-    "Nashville Cat",
-    "Nasreddin (character in Turkish folktales)",
-    "Nastasi",
-    "Nasty",
-    "Nasty Boy",
-    "Nat",
-    "Nat Brat",
-    "Nat Brat Cat",
-    "Natalia",
-    "Natalie",
-    "Natasha",
-    "Nate",
-    "Nathan",
-    "Nathan Willy-Ogleby",
-    "Natia",
-    "Naughtybeauty",
-    "Naum",
-    "Navajo",
-    "Navar",
-    "Navarre",
-    "Navarro",
-    "Navigator",
-    "Nayjay",
-    "Nayla",
-    "Nazar",
-    "Nazgar",
-    "Neapolis",
-    "Near Miss",
-    "Nebbu",
-    "Nebu",
-    "Nebuchadnezzar",
-    "Nebula",
-    "Nebushaa",
-    "Neco",
-    "Necro",
-    "Ned",
-    "Neddy Edward",
-    "Needles",
-    "Needy",
-    "Neek",
-    "Neeko",
-    "Neela",
-    "Neelah",
-    "Neemski Pooski Rimsky Korsakov",
-    "Neener the little weiner",
-    "Neezzuu",
-    "Nefarian",
-    "Nefer",
-    "Neferkitty",
-    "Nefertiti (Egyptian Queen)",
-    "Neffer",
-    "Negra",
-    "Negro",
-    "Negus",
-    "Neige (French for \\",
-    "Neko (Japanese for 'cat')",
-    "Neko-Chan",
-    "Nelda",
-    "Nelia",
-    "Nell",
-    "Nellie",
-    "Nellinda Taelo (\\",
-    "Nelly",
-    "Nels",
-    "Nelson",
-    "Nelson John LaPurr",
-    "Nelson Mingdella",
-    "Neltarr",
-    "Nemesis",
-    "Nemko",
-    "Nemo",
-    "Nemu",
-    "Nena",
-    "NeNe",
-    "Neo (from The Matrix movies)",
-    "Neo Mia Cara (Latin for \\",
-    "Neon",
-    "Neopolatin",
-    "Nepenthe (1. A drug mentioned in the Odyssey as a remedy for grief. 2. Something that induces forgetfulness of sorrow or eases pain.)",
-    "Nephthys (Egyptian goddess)",
-    "Neptune",
-    "Nera",
-    "Nerble",
-    "Nerdy",
-    "Nerf",
-    "Nerida (Aboriginal for \\",
-    "Nermal",
-    "Nero",
-    "Nerolo",
-    "Nervey",
-    "Nesbit",
-    "Nespi",
-    "Ness",
-    "Nessu",
-    "Nessus (character in sf novel by Larry Niven, \\",
-    "Nessy",
-    "Nester",
-    "Nestle",
-    "Nestlee",
-    "Nestles Chocolate Bit",
-    "Nestor",
-    "Nestor Le Freep",
-    "Nether",
-    "Netherworld",
-    "Netscape",
-    "Nettie",
-    "Nettle",
-    "Neuro",
-    "Neusance",
-    "Neuteronomy",
-    "Neutrino",
-    "Neutron",
-    "Neutron Star",
-    "Nevermore",
-    "Neville",
-    "Nevvy",
-    "New Cat",
-    "New Kitty",
-    "New York",
-    "Newark",
-    "Newie",
-    "Newman",
-    "Newport",
-    "Newsprint",
-    "Newt",
-    "Newtie",
-    "Newton",
-    "NezPas",
-    "Nezumi (Japanese for \\",
-    "Ngaio (after New Zealand mystery writer Ngaio Marsh)",
-    "Ngongee Nguhn",
-    "Niabi",
-    "Niagra Falls",
-    "Niagra Falls Down",
-    "Niah",
-    "Niarobi",
-    "Nibbles",
-    "Nibblet",
-    "Nibs",
-    "Nicademus",
-    "Nice",
-    "Nice Guy",
-    "Nicedemos",
-    "Nicholas",
-    "Nicias",
-    "Nick",
-    "Nick-the-Cat",
-    "Nickedemus",
-    "Nickel",
-    "Nickerson",
-    "Nicki",
-    "Nicki-Baby",
-    "Nickleby",
-    "Nickles",
-    "Nicky",
-    "Nicky Jean",
-    "Nicky Legs",
-    "Nico",
-    "Nicodemus",
-    "Nicolas Fosbury",
-    "Nicole",
-    "Nicolette",
-    "Nicolodeon",
-    "Nicorette",
-    "Nie-Ma-Imie (Polish for \\",
-    "Nielsen (after Rick Nielsen, the Cheap Trick guitarist)",
-    "Nietzsche",
-    "Nieves",
-    "Niffer",
-    "Nifty",
-    "Nigbee",
-    "Nigel",
-    "Night",
-    "Nightcrawler",
-    "Nightcrouler",
-    "Nightmare",
-    "Nightshade",
-    "Nightshadow",
-    "Nigra (Latin for \\",
-    "Nigthmare",
-    "Nihn",
-    "Nijinsky",
-    "Nik Nak Paddy Wak",
-    "Nika",
-    "Nikademus",
-    "Nike",
-    "Nike Air",
-    "Niki",
-    "Nikia",
-    "Nikita",
-    "Nikki",
-    "Nikki Kitty",
-    "Nikkita",
-    "Nikko",
-    "Nikkoa (\\",
-    "Niko",
-    "Nikochan (Filipino for cat-girl)",
-    "Nikolai",
-    "Nikolaus",
-    "Nikolina",
-    "Nikta (Greek word for \\",
-    "Niky",
-    "Niles",
-    "Nilla",
-    "Nilla-bean",
-    "Nilla-nilla-nilla",
-    "Niller",
-    "Nils (After \\",
-    "Nilson",
-    "Nimaway",
-    "Nimbus",
-    "Nimitz",
-    "Nimmao",
-    "Nimo",
-    "Nimoosh (Native American for \\",
-    "Nina",
-    "Ninetynine (Maxwell Smart and Agent)",
-    "Ningeluu Mallaguuga",
-    "Nini",
-    "Ninja",
-    "Ninja Racoon",
-    "Ninky",
-    "Ninny",
-    "Nintendo",
-    "Nin~O",
-    "Nin~O-Cat",
-    "Nin~O-Nin~O-Nin~O",
-    "Nin~O-Nuts",
-    "Niobie",
-    "Nipford",
-    "Nipper",
-    "Nippers",
-    "Nipple Fritz Demon",
-    "Nippy",
-    "Nipto",
-    "Nirvana",
-    "Nisha (Hindu for \\",
-    "Nishka",
-    "Nismoasis",
-    "Nissan",
-    "Nisse",
-    "Nistka",
-    "Nit",
-    "Nite",
-    "Nitecrawler",
-    "Nitnoi JaiJai",
-    "Nitny",
-    "Nitro",
-    "Nitro Glitter",
-    "Nitrogen",
-    "Nittany",
-    "Nixdorf",
-    "Niyah",
-    "Nizmo",
-    "Njord (Viking mythology: the god of wind and sea)",
-    "Nkechi (meaning \\",
-    "No",
-    "No Kiss",
-    "No Name",
-    "No Pain",
-    "No!",
-    "No-No Bad Cat",
-    "No-tail",
-    "No.1 Suncat",
-    "Noah",
-    "Nobu",
-    "Noby",
-    "Nocturnal Kitty",
-    "Nocturne",
-    "Nod",
-    "Noddy",
-    "Nodin (Ojibway-Cree for \\",
-    "Noel",
-    "Noelle",
-    "Noes",
-    "Noey",
-    "Nog",
-    "Noi",
-    "Noire",
-    "Noise Pollution",
-    "Noisemaker",
-    "Noisette",
-    "Noisy",
-    "Noisy Kitty",
-    "Noisy Noodle Nuisance",
-    "Nokia",
-    "Nokky",
-    "Nola",
-    "Nolan",
-    "Nomad",
-    "Nomi",
-    "Nona",
-    "Noni",
-    "Nonna",
-    "Nonsense",
-    "Noodge",
-    "Noodle",
-    "Noodle Bug",
-    "Noodlehead",
-    "Noodles",
-    "Noodnick the Puissant",
-    "Noogie",
-    "Noogies",
-    "Nook",
-    "Noomster",
-    "Noonie",
-    "Nopurr",
-    "Nora",
-    "Norbert",
-    "Norgay",
-    "Nori",
-    "Noriko",
-    "Norka (Russian for \\",
-    "Norma",
-    "Normajean",
-    "Norman",
-    "Norman Stanley Fletcher (from Porridge)",
-    "Norman Tinkle Tinkle",
-    "Normania",
-    "Normie",
-    "Norris",
-    "Northrup",
-    "Norton",
-    "Nose",
-    "Nosebud",
-    "Nosekins",
-    "Nosey",
-    "Nosferatu",
-    "Noster",
-    "Nostradamus",
-    "Nosy Rosy",
-    "Notebook",
-    "Notso Bright",
-    "Nova",
-    "Novella",
-    "Novi",
-    "Nox (latin for \\",
-    "Nsync",
-    "Nubbins",
-    "Nubby",
-    "Nubeluz (Spanish for \\",
-    "Nudge",
-    "Nudger",
-    "Nuebby",
-    "Nuget",
-    "Nugget",
-    "Nugget (as in Chicken)",
-    "Nuggettes",
-    "Nuggie",
-    "Nuisance",
-    "Nula",
-    "Null",
-    "Numa Numa",
-    "Numb Nuts",
-    "Number 1",
-    "Number 1 Champion Sparkplug (Sparky)",
-    "Nummy Muffin Coocoo Butter",
-    "Numnod",
-    "Nuna",
-    "Nunkie",
-    "Nuno",
-    "Nuppi (Finnish for \\",
-    "Nuray (Turkish for \\",
-    "Nuria",
-    "Nut-Nut",
-    "Nute",
-    "Nuthonda",
-    "Nutmeg",
-    "Nutnaree",
-    "Nutsy",
-    "Nya",
-    "Nyan-Nyan",
-    "Nyla",
-    "Nyles",
-    "Nymph",
-    "Nymphadora (after the Nymphadora Tonks character in Harry Potter)",
-    "Nyssa",
-    "Nystan (Swedish for \\",
-    "Nytrogen",
-    "Nyx (Greek goddess of night)",
-    "O'Malley",
-    "O'Mally",
-    "O'Neil",
-    "O'Roy",
-    "O-Ren Ishii (after the character in the \\",
-    "O.B.",
-    "O.B. (Orange Boy",
-    "O.C. (Ordinary Cat)",
-    "O.C. (Other Cat)",
-    "O.F.C. (Our First Cat)",
-    "O.J.",
-    "O.J. Simpson",
-    "O.N.N.A.O. (Oh No, Not Another One)",
-    "O.T.M.",
-    "Oaf",
-    "Oakes",
-    "Oakichobi",
-    "Oakii",
-    "Oakley",
-    "Oakley Lucifer Fila Nike Levi Reebok",
-    "Oasis",
-    "Oatcake",
-    "Oatmeal",
-    "Oats",
-    "Obelix",
-    "Oberon",
-    "Oberon Casimir Badpaintjob",
-    "Oberon The Wonder Gut (Lord of the Faery Cats)",
-    "Oberon-Smiley",
-    "Obi",
-    "Obi Wan Kenobi",
-    "Obie (O.B.)",
-    "Obijuan",
-    "Obo",
-    "Obsidian",
-    "Obsididan",
-    "Obstinate",
-    "Ocabar",
-    "Occi",
-    "Occupant",
-    "Ocelot",
-    "Oci Osborne",
-    "Ocitar",
-    "Octavia",
-    "October",
-    "Odan",
-    "Odd",
-    "Oddball",
-    "Oddibe",
-    "Oddly McStrange",
-    "Odeipus",
-    "Odessa",
-    "Odette",
-    "Odie",
-    "Odile",
-    "Odin (Viking mythology: the allmighty god)",
-    "Odo",
-    "Odyssey",
-    "Oedipus",
-    "Ofel",
-    "Ofelia",
-    "Off!",
-    "Off-License",
-    "Often",
-    "Og",
-    "Ogden",
-    "Ogies (Afrikaans for \\",
-    "Ogopogo",
-    "Oh Arrogant One",
-    "Oh Captain My Captain",
-    "Oh Oh",
-    "Oh-lee",
-    "Oi!",
-    "Oingo",
-    "Oink",
-    "Okavango",
-    "Okee",
-    "Okesha",
-    "Oki",
-    "Okie",
-    "Okinawa",
-    "Oklahoma",
-    "Okra",
-    "Oksana",
-    "Ol Yeller",
-    "Ol' Buddy",
-    "Ol' Sport",
-    "Olaf",
-    "Old D",
-    "Old Deuteronomy",
-    "Old Grandad",
-    "Old School",
-    "Old Sweetie",
-    "Old Yeller",
-    "Olde Scratch",
-    "Oleg",
-    "Oleo",
-    "Olga",
-    "Olhausen",
-    "Olia",
-    "Olimpia",
-    "Olive",
-    "Oliver",
-    "Oliver Sebastian",
-    "Oliver Stone",
-    "Oliver Twister",
-    "Olivette",
-    "Olivia",
-    "Olivia Pawdancer",
-    "Olivia The Otter Cat",
-    "Olivier Serpentine",
-    "Olja",
-    "Olla",
-    "Ollendorff",
-    "Olli",
-    "Ollie",
-    "Ollie Bollie Mc Follie",
-    "Ollie North",
-    "Ollie South",
-    "Olliecat",
-    "Oloff",
-    "Olsen.",
-    "Oly",
-    "Olympia DuKatKis",
-    "Olympician",
-    "Olympus Mons (after the great volcano on the planet Mars)",
-    "Omaha",
-    "Omar",
-    "Omar Khayyam",
-    "Omar Sharif",
-    "Omega",
-    "Omelet",
-    "Omen",
-    "Ometecuhtli (Aztec mythology: the god of duality)",
-    "Omi",
-    "Omiros (Greek for \\",
-    "Omni",
-    "Omniscious",
-    "Omonoia",
-    "Onassis",
-    "Ondine",
-    "One Nut",
-    "One-eyed Jack",
-    "One-Pat",
-    "Oni (Japanese for 'demon')",
-    "Oni Cheeto",
-    "Onion",
-    "Onions",
-    "Only",
-    "Onnee",
-    "Onomatopoeia",
-    "Onya",
-    "Onyx",
-    "Onyx O'Kitty",
-    "Ooga-Booga",
-    "Ooh-la-la",
-    "Oona",
-    "Ooopy Poopy",
-    "Ooowwwrrraahh",
-    "Oops",
-    "Oosha",
-    "Ootzsatootsie",
-    "Oozie",
-    "Opal",
-    "Opaline",
-    "Ophelia",
-    "Opie",
-    "Opium",
-    "Oprah",
-    "Oprah Anne",
-    "Oprah Whiskers",
-    "Optimistic",
-    "Opus",
-    "Orange",
-    "Orange Blossom",
-    "Orange Boy",
-    "Orange Cat",
-    "Orange Harvey",
-    "Orange Juice",
-    "Orange Kitty",
-    "Orange Pekoe",
-    "Orange Pico",
-    "Orange Wishes",
-    "OrangEndymion",
-    "Oranges",
-    "Orangie",
-    "Orangina",
-    "Orangy",
-    "Orbit",
-    "Orca",
-    "Ord",
-    "Ordinary",
-    "Ore",
-    "Oreao",
-    "Oregano",
-    "Oreo",
-    "Oreo Bigfoot Thunderkitty",
-    "Oreo Purrowitz",
-    "Organa (named after Princess Leia Organa)",
-    "Orion",
-    "Oriondo",
-    "Orla (Irish name meaning \\",
-    "Orlando",
-    "Orleans (after the city)",
-    "Orlon",
-    "Orman",
-    "Ornery",
-    "Orphan",
-    "Orphan Annie",
-    "Orphelia",
-    "Orpheus",
-    "Orpheus And Euridice",
-    "Orrin G. Cat",
-    "Orsino",
-    "Orson",
-    "Orson Winslow",
-    "Orville",
-    "Orville And Wilbur",
-    "Orvis",
-    "Osborn",
-    "Oscar",
-    "Oscar Mayer",
-    "Oscar Pisser",
-    "Osceola",
-    "Oscer",
-    "Osgood",
-    "Oshi",
-    "Osirira",
-    "Osiris",
-    "Oslo",
-    "Osman",
-    "Oso",
-    "Oswald",
-    "Otari",
-    "Othello",
-    "Other",
-    "Other Guy",
-    "Otis",
-    "Otter",
-    "Otto",
-    "Otto Octavius",
-    "Oui",
-    "Ouija",
-    "Ouisa (oh-wee-sah)",
-    "Our Gigi",
-    "Outi",
-    "Outlaw",
-    "Outrigger",
-    "Ouzo",
-    "Oven Mitt",
-    "Overboard",
-    "Overdrive",
-    "Ovid",
-    "Ow!",
-    "Owas-sa",
-    "Owen",
-    "Owl",
-    "Ox",
-    "Oxford",
-    "Oxley",
-    "Oy",
-    "Oyen",
-    "Oz",
-    "Ozma (after the character in \\",
-    "Ozone",
-    "Ozu",
-    "Ozymandius",
-    "Ozzie",
-    "Ozzy",
-    "Ozzy Pawsburn",
-    "P'Tit",
-    "P-Bear",
-    "P-Cat",
-    "P. Cat",
-    "P. Kitty",
-    "P. Wee",
-    "P.A.L.",
-    "P.C.",
-    "P.C. (Picky Cat)",
-    "P.D.F. (Princess Dirty Feet)",
-    "P.I.T.A. (\\",
-    "P.J.",
-    "P.J. (Peanut butter and Jelly)",
-    "P.K. (\\",
-    "P.K. (\\",
-    "P.K. (Psycho Kitty)",
-    "Pab",
-    "Pablo",
-    "Pabst",
-    "Pacco",
-    "Pace",
-    "Pacer",
-    "Pacey",
-    "Pachyderm",
-    "Pacific",
-    "Pacific Blue",
-    "Pacino",
-    "Packcat",
-    "Packrat",
-    "Packy",
-    "Paco",
-    "Paddie",
-    "Paddie O'Kitty",
-    "Paddin",
-    "Paddington",
-    "Paddles",
-    "Paddwinkle",
-    "Paddy",
-    "Paddy Paws",
-    "Paddy The Large",
-    "Padfoot",
-    "Padme",
-    "Padre",
-    "Padrino",
-    "Padua",
-    "Pagan",
-    "Pagan Pinky",
-    "Page",
-    "Pagoda",
-    "Paige",
-    "Pain",
-    "Paint",
-    "Paintor",
-    "Paisley",
-    "Paka (Swahili for \\",
-    "Pako",
-    "Pal",
-    "Palamino",
-    "Palermo",
-    "Palla",
-    "Pallas",
-    "Pallister",
-    "Pally",
-    "Palmer",
-    "Palo",
-    "Palo Duro",
-    "Paloma",
-    "Palomino",
-    "Paloosa",
-    "Pamplemousse",
-    "Pan",
-    "Pan-Pan",
-    "Pana",
-    "Panache",
-    "Panama",
-    "Panama Red",
-    "Pancake",
-    "Pancakes",
-    "Pancho",
-    "Pancho Kitty",
-    "Pancho Villa",
-    "Pand'a",
-    "Panda",
-    "Panda Bear",
-    "Pandemonium",
-    "Pandora",
-    "Pandora La Principessa",
-    "Pandoura",
-    "Pandy",
-    "Pangor",
-    "Pangur",
-    "Pangur Ban",
-    "Panics And Purrs",
-    "Pankake",
-    "PanPan",
-    "Pansey",
-    "Pansy",
-    "Pantelej",
-    "Panter",
-    "Pantha",
-    "Panther",
-    "Panther-cat",
-    "Panthro",
-    "Pantie",
-    "Pantoufle (French for \\",
-    "Pants",
-    "Pants Boy",
-    "Panzer",
-    "Panzy",
-    "Papa",
-    "Papa Doc",
-    "Papagena",
-    "Papageno",
-    "Paper Moon",
-    "Paper Tiger",
-    "Paperclip",
-    "Papillon",
-    "Papoose",
-    "Paprika",
-    "Papu",
-    "Papuchni",
-    "Papyrus",
-    "Parable",
-    "Paradigm",
-    "Paradise",
-    "Paraffin",
-    "Paragon",
-    "Paramon",
-    "Paramour",
-    "Parano",
-    "Pardo",
-    "Parfen",
-    "Pariah",
-    "Paris",
-    "Parkay",
-    "Parker",
-    "Parlbleu",
-    "Parsley",
-    "Partner",
-    "Pascal",
-    "Pascale",
-    "Pascha",
-    "Pascht",
-    "Pasha",
-    "Pashakin",
-    "Pashmak",
-    "Pashmina (after the mohair accesories, and the character in the Hamtaro cartoons)",
-    "Pashu",
-    "Pasiphae Paleface",
-    "Pasquale",
-    "Pasqualina",
-    "Passe-Poil",
-    "Passion",
-    "Passion Puddy",
-    "Passive",
-    "Passport",
-    "Passura",
-    "Pasta",
-    "Pat Puma",
-    "Patachou",
-    "Patapaws",
-    "Patch",
-    "Patchee",
-    "Patches",
-    "Patches a Calico",
-    "Patches Jr.",
-    "Patchita",
-    "Patchouli",
-    "Patchy",
-    "Patecatl (Aztec mythology: the god of medicine)",
-    "Patenkats",
-    "Patent Leather Kitty",
-    "Pathfinder",
-    "Patience",
-    "Patio Kitty",
-    "Patoche",
-    "Patola (a type of fabric from India)",
-    "Patootalinski",
-    "Patootalnski",
-    "Patrice",
-    "Patrick",
-    "Patrick Duffy",
-    "Patrick McGoohan",
-    "Patrick Millo Zooloo",
-    "Patrick O'Brien",
-    "Patrick PrÈvÈreau",
-    "Patrick Swayze",
-    "Patrikei",
-    "Patriot",
-    "Patsy",
-    "Patsy Climb",
-    "Patter",
-    "Patti",
-    "Patton",
-    "Patty Cake",
-    "Patty Paws",
-    "Pattycakes",
-    "Paty",
-    "Paul",
-    "Paul McCartney",
-    "Paul Simon",
-    "Paul the Walrus",
-    "Paula",
-    "Pauli",
-    "Paulie",
-    "Paulinus",
-    "Paupa New Guinea",
-    "Pauper",
-    "Pause",
-    "Pavarotti",
-    "Pavel",
-    "Pavla",
-    "Pavlonia",
-    "Pavlov",
-    "Pavlova",
-    "Pavo",
-    "Paw McCatney",
-    "Paw-bot",
-    "Pawline",
-    "Pawprints",
-    "Paws",
-    "Pawsha",
-    "Pawsome",
-    "Paxil",
-    "Paxton",
-    "Paynal (Aztec mythology: the messenger to Huitzilopochtli)",
-    "Pays",
-    "Payton",
-    "Pazlo",
-    "Pazzo",
-    "Pea",
-    "Peaball",
-    "Peabody",
-    "Peace",
-    "Peach",
-    "Peach Pie",
-    "Peaches",
-    "Peaches 'N Cream",
-    "Peaches Creampuff",
-    "Peachie",
-    "Peachy",
-    "Peak",
-    "Peak Freen",
-    "Pean",
-    "Peanet",
-    "Peanuckle",
-    "Peanut",
-    "Peanut Butter",
-    "Peanutbutter",
-    "Peanuts",
-    "Peapod",
-    "Pearl",
-    "Pearl CloudDancer",
-    "Pearl Django",
-    "Pearlite",
-    "Peaseblossom",
-    "Peaslake",
-    "Peasy",
-    "Pebble",
-    "Pebbles",
-    "Pebbles (after the character in 'The Flintstones' cartoons)",
-    "Peca",
-    "Pecan",
-    "Peche",
-    "Pecos",
-    "Pecos Bill",
-    "Pedro",
-    "Pee",
-    "Pee Girl",
-    "Pee Wee Herman",
-    "Pee Winky",
-    "Pee-Girl",
-    "Pee-pee-poo-poo-chew-chew",
-    "Pee-U",
-    "Peek",
-    "Peek-a-boo",
-    "Peeka",
-    "Peekie",
-    "Peeky Pinky Sally Whitepaws Kathryn Mather Brooks",
-    "Peep-Bo",
-    "Peeper",
-    "Peeper-doobie",
-    "Peepers",
-    "Peepy",
-    "Peesh-Peesh",
-    "Peeve",
-    "Peevies",
-    "Peewee",
-    "PeeWeePuck",
-    "Peewer",
-    "Peezer",
-    "Pegasus",
-    "Peggy",
-    "Peka",
-    "Pekie",
-    "Pekoe",
-    "Pekoe (after orange pekoe tea)",
-    "Pelagea",
-    "Pele",
-    "Pelican",
-    "Pembroke",
-    "Pendragon",
-    "Penelope",
-    "Penelope Peanut",
-    "Penelope Sophia",
-    "Penguin",
-    "Penile",
-    "Penn",
-    "Penne",
-    "Penny",
-    "Penny Lane",
-    "Penny No!",
-    "Penthouse",
-    "Peony",
-    "People-person",
-    "Pepe",
-    "Pepin",
-    "Pepin the Red",
-    "Pepita",
-    "Peppa",
-    "Pepper",
-    "Pepper Ann",
-    "Peppercat",
-    "Peppermint",
-    "Pepperone",
-    "Pepperoni",
-    "Peppino",
-    "Pepppa",
-    "Peppurr",
-    "Peppy",
-    "Peppy Pooperdoodle",
-    "Pepsi",
-    "Pepsi-Kitty",
-    "Pequena",
-    "Perch",
-    "Percival",
-    "Perculating Pooky",
-    "Percy",
-    "Perdita",
-    "Perdito",
-    "Pere",
-    "Peregrine",
-    "Perfect Tommy",
-    "Perfection",
-    "Peri",
-    "Peri (Turkish for elf, faerie, faery, fairy, fay, genie, peri, pixie, spirit, sprite)",
-    "Peritar",
-    "Periwinkle",
-    "Perkins",
-    "Perky",
-    "Permanently Pretty",
-    "Pernod",
-    "Perrin Goldeneyes",
-    "Perriwinkle",
-    "Perro",
-    "Perry",
-    "Perry Mason",
-    "Persephone",
-    "Perseus",
-    "Pershing",
-    "Persia",
-    "Persil",
-    "Persimmon",
-    "Persy",
-    "Perth",
-    "Perzazz",
-    "Pescame",
-    "Pesky",
-    "Peso",
-    "Pest",
-    "Pester",
-    "Pesticus Domesticus",
-    "Pestilence",
-    "Pesto",
-    "Pesty",
-    "Peta Ugo",
-    "Petal",
-    "Petalwing",
-    "Pete",
-    "Pete Puma",
-    "Peter",
-    "Peter Pan",
-    "Peter Piper",
-    "Peter The Terrible",
-    "Peterbilt",
-    "Petey",
-    "Petey-Rama",
-    "Petie",
-    "Petifour",
-    "Petipoint",
-    "Petit Ange",
-    "Petja",
-    "Petoskey",
-    "Petr",
-    "Petra",
-    "Petrarch",
-    "Petrie",
-    "Petroccia",
-    "Petronius",
-    "Petros",
-    "Petrusha",
-    "Petty",
-    "Petulia",
-    "Petunia",
-    "Peugeot",
-    "Pewflette",
-    "Pewter",
-    "Peyote",
-    "Peyton",
-    "Pfeffa Spookysocks",
-    "Pfeffer",
-    "Pfefferneuse",
-    "Pfeiffer",
-    "Phaedra",
-    "Phalen",
-    "Phantom",
-    "Pharaoh",
-    "Pharoah",
-    "Pharoh",
-    "Pharos",
-    "Pheonix",
-    "Phibsie",
-    "Phigment",
-    "Phil",
-    "Phil II",
-    "Philadelphia",
-    "Philbob",
-    "Philip",
-    "Philippe",
-    "Phillip Robert",
-    "Phineas",
-    "Phippsia",
-    "Phish",
-    "Phluffball",
-    "Phobos",
-    "Phoebe",
-    "Phoebe Phrankenfeet",
-    "Phoebe Snow (after the singer)",
-    "Phoenix",
-    "Phoolan Devi",
-    "Phosphorus",
-    "Phred",
-    "Phred Phang Klah",
-    "Phredd",
-    "Phurpy (furry Purry)",
-    "Phurson (\\",
-    "Phut Phat",
-    "Phydeaux (\\",
-    "Phyllo",
-    "Phyrbl",
-    "Pi",
-    "Piazza",
-    "Pica",
-    "Pica-Paca",
-    "Picasso",
-    "Piccilu",
-    "Picco",
-    "Piccolo",
-    "Pickett",
-    "Pickle",
-    "Pickle Puss",
-    "Pickles",
-    "Pickwick",
-    "Picky Picky",
-    "Picnic",
-    "Pico",
-    "Picot",
-    "Piddle",
-    "Piddypat",
-    "Pidge",
-    "Pids",
-    "Pie",
-    "Piedmont",
-    "Piepje",
-    "Pierre",
-    "Piesporter",
-    "Pieter (a Dutch Friesian name)",
-    "Piewacket",
-    "Piff",
-    "Piffles",
-    "Pig",
-    "Pig Kitty",
-    "Pigasus",
-    "Pigeon Poop",
-    "Pigfoot",
-    "Piggles-Wiggles",
-    "Pigglesworth",
-    "Piggly Wiggily",
-    "Piggy",
-    "Piggy-Wiggy",
-    "Piglet",
-    "Pigling Bland",
-    "Pigment",
-    "Pigpen",
-    "Pika",
-    "Pikaboo",
-    "Pikachu",
-    "Pikachy",
-    "Pikal",
-    "Pike",
-    "Pike's Peak",
-    "Pikey",
-    "Pikka",
-    "Pilate",
-    "Pilchard (French for \\",
-    "Pilgrim",
-    "Pili",
-    "Pilkku",
-    "Pillow",
-    "Pilot",
-    "Pim (Dutch name)",
-    "Pima (after the native american indian tribe)",
-    "Pimpsta",
-    "Pin Pinnacle Pinskinski Lowinski (aka Pin)",
-    "Pinanta Divine",
-    "Pinar",
-    "Pincushion",
-    "Pindar (Greek poet, known for his victory odes)",
-    "Pineapple",
-    "Pinecone",
-    "Pinenut",
-    "Piney",
-    "Ping",
-    "Ping Pong",
-    "Pingie",
-    "Pingy",
-    "Pinhead",
-    "Pink",
-    "Pink & Floyd (2 cats)",
-    "Pink Panther",
-    "Pink Paws",
-    "Pink-Nosed Curled-Toed Kitty",
-    "Pinkerbee",
-    "Pinkey",
-    "Pinky",
-    "Pinky (For Pinky Lee, the painting, and the color of her nose)",
-    "Pinky Bubbles",
-    "Pinky Girl",
-    "Pinky Pinkster Pinkowitz",
-    "Pinnacle",
-    "Pinnar",
-    "Pinnochio",
-    "Pinnochle",
-    "Pinocchio",
-    "Pinot Noir",
-    "Pins",
-    "Pintas",
-    "Pinto",
-    "Pinto Bean",
-    "Pinwheel",
-    "Piouacket ('Bell, Book and Candle' cat)",
-    "Pious",
-    "Pip",
-    "Piper",
-    "Piper Belle",
-    "Pipes",
-    "Pipi",
-    "Pippa",
-    "Pippen",
-    "Pippi",
-    "Pippi Longstockings",
-    "Pippin",
-    "Pippy",
-    "Pipsqueak",
-    "Pipsqueek",
-    "Piquin",
-    "Piranha",
-    "Pirate",
-    "Pirate Pearl",
-    "Pirouette",
-    "Pisa",
-    "Pisancho",
-    "Pisces",
-    "Pischi",
-    "Pish",
-    "Pish-Posh",
-    "Piskey Willow",
-    "Pistachio",
-    "Pistol",
-    "Piston",
-    "Pit-Stop",
-    "Pita",
-    "Pita Pocket",
-    "Pitch",
-    "Piter",
-    "Pitten",
-    "Pitter",
-    "Pitter-Pat",
-    "Pitter-Patter",
-    "Pittsburgh",
-    "Pitty Pat",
-    "Pity",
-    "Piva",
-    "Piwaket",
-    "Pix",
-    "Pix The Cat",
-    "Pixel",
-    "Pixel Purrfect",
-    "Pixie",
-    "Pixie Dust",
-    "Pixie Stix",
-    "Pixo",
-    "Pizza",
-    "Pizza Boy",
-    "Pizzazz",
-    "PJ",
-    "Plankton",
-    "Plastic Monster",
-    "Platinum",
-    "Plato",
-    "Platon",
-    "Platter Puss",
-    "Platty",
-    "Play Play",
-    "Player",
-    "Playful",
-    "Playgirl",
-    "Pleades",
-    "Pleasance",
-    "Please",
-    "Pleez",
-    "Pleiddes",
-    "Plinko",
-    "Plogy",
-    "Plush-Pelt",
-    "Pluto",
-    "Plymouth",
-    "Po Po",
-    "Po'Cat",
-    "Pocahontas",
-    "Poco",
-    "Poco Loco",
-    "Podkayne",
-    "Poe",
-    "Poes",
-    "Poet",
-    "Pogo",
-    "Poindexter",
-    "Poison",
-    "Poji",
-    "Pokanos",
-    "Pokanose",
-    "Pokemon",
-    "Pokerface",
-    "Pokey",
-    "Pokey Paws",
-    "Pokipsey",
-    "Pokipsy (used to be Poughkeepsie, but she found that too hard to spell.)",
-    "Polar Bear",
-    "Polaris",
-    "Policy Wonk",
-    "Polina",
-    "Polini",
-    "Politix",
-    "Polka Dot",
-    "Pollux",
-    "Polly",
-    "Polly-Esther",
-    "Pollyanna",
-    "Pollygon",
-    "Polo",
-    "Poltergeist",
-    "Poly",
-    "Polyester",
-    "Pom",
-    "Pom-Pom",
-    "Pompidou (after the french prime minister George Pompidou)",
-    "Pompomdou",
-    "Ponce de Leon",
-    "Ponch (after the character in the TV series \\",
-    "Ponchielli",
-    "Poncho",
-    "Poncy",
-    "Ponder",
-    "Pong",
-    "Pongo",
-    "Ponkles",
-    "Pono",
-    "Poo",
-    "Poo Bear",
-    "Poo-Poo",
-    "Poo-poo Nose Girl",
-    "Poo-Poo Platter",
-    "Pooch",
-    "Poochess",
-    "Poochess Delectisse",
-    "Poochie",
-    "Poochini Opera",
-    "Pood",
-    "Pooddy Tat (from Tweety Bird)",
-    "Poodeedoots",
-    "Pooders",
-    "Poody Tat",
-    "Pooey",
-    "Poof-Pewf",
-    "Pooflette",
-    "Poofy",
-    "Poogie",
-    "Pooh",
-    "Pooh Bear",
-    "Pooh of Pooh Corner",
-    "Pooh-Bah",
-    "Poohbear",
-    "Poohface",
-    "Pook",
-    "Pook A La",
-    "Pooka",
-    "Pookah",
-    "Pookahontas",
-    "Pooker",
-    "Pookers",
-    "Pookerville",
-    "Pookey",
-    "Pooki",
-    "Pookie",
-    "Pookie Pie",
-    "Pookie Turtle",
-    "Pookner",
-    "Pookster",
-    "Pooky",
-    "Pooky Monster",
-    "Poon Tang Plenty (aka Poon, Pooner)",
-    "Pooopsiiiieee",
-    "Poop",
-    "Pooper",
-    "Pooperdinker",
-    "Poopie",
-    "Poopiepants",
-    "PooPoo Butt",
-    "Poopoolini",
-    "PoopPoop",
-    "Poops",
-    "Poops McGillicutty",
-    "Poopsie",
-    "Poopty-Oopty",
-    "Poopy head",
-    "Poor Thing",
-    "Poosey Boy",
-    "Poosha",
-    "Pooshka",
-    "Pooter (slang for pussycat)",
-    "Pooter Scooter",
-    "Pootie",
-    "Pootle (aka His Satanic Majesty Pootle-Flump the Third)",
-    "Pootle (character in the childrens tv series \\",
-    "Poozle",
-    "Pop",
-    "Popcorn",
-    "Pope",
-    "Pope Cat IV",
-    "Pope John Paul The 2nd",
-    "Popeye",
-    "Popia (accent on the second syllable, Hokkien Chinese for \\",
-    "Popo",
-    "Popoki (Hawaiian for \\",
-    "Popover",
-    "PoppaCat",
-    "Poppela",
-    "Popper",
-    "Poppet Ann Softpaws",
-    "Poppett",
-    "Poppie",
-    "Poppins",
-    "Popples (after the 1985-1987 cartoon and toys)",
-    "Poppy",
-    "Poppy-Cat",
-    "Poppy-paws-pumkin",
-    "Poppyseed",
-    "Pops",
-    "Popsicle",
-    "PopTart",
-    "Porcelina",
-    "Porcelina (aka Porce)",
-    "Porche",
-    "Porgie",
-    "Pork Boy",
-    "Porkchop",
-    "Porker",
-    "Porky",
-    "Porky Appleyard",
-    "Porky Pig",
-    "Porky Pine",
-    "Porridge",
-    "Porsche",
-    "Porsha",
-    "Porter",
-    "Portia",
-    "Portly",
-    "Portnoy",
-    "Posada",
-    "Posey",
-    "Posha",
-    "Possom",
-    "Possum",
-    "Possum Fluff",
-    "Poster Nutbag",
-    "Posy",
-    "Poter",
-    "Potpourri (sometimes spelled poe-purry)",
-    "Potter",
-    "PouchPuella",
-    "Pouhka (after mischievous spirit that takes animal form)",
-    "Pouilly-FuissÈ",
-    "Pouka",
-    "Pounce",
-    "Pounce A Daily On",
-    "Pounce de Leon (aka deLion)",
-    "Pouncequick",
-    "Pouncer",
-    "Pouncer (catname in Struwwelpeter)",
-    "Pouncival",
-    "Pounter",
-    "Poupee (French for \\",
-    "Poutsa",
-    "Powder",
-    "PowderPuff",
-    "Power Girl",
-    "Power of Love",
-    "Power Wucket",
-    "Powerful Puddy",
-    "Prana",
-    "Prancer",
-    "Praskovia",
-    "Preakness",
-    "Precious",
-    "Precious Beardpuller",
-    "Precious Russell Cuddlekins",
-    "Predator",
-    "Premier",
-    "Prescott",
-    "Presh (short for 'precious')",
-    "President",
-    "Presley",
-    "Presouse",
-    "Presto",
-    "Preston",
-    "Prettipaws",
-    "Pretty",
-    "Pretty Baby",
-    "Pretty Boy",
-    "Pretty Boy Floyd",
-    "Pretty Girl",
-    "Pretty Kitty",
-    "Pretty Precious Py Puddy",
-    "Pretty-Eyes",
-    "Prettyboy",
-    "Prettymama",
-    "Pretzel",
-    "Pricilla",
-    "Prickle",
-    "Prietztl",
-    "Prigecto",
-    "Prima",
-    "Prima Donna",
-    "Primo",
-    "Primrose",
-    "Primrose Path",
-    "Prince",
-    "Prince Charles",
-    "Prince Charlie (after the male lead character in 'Cinderella')",
-    "Prince Charming",
-    "Prince Fluff",
-    "Prince Harry The Second",
-    "Prince Hiniyana",
-    "Prince Metternich",
-    "Prince Myshkin (after the character in Dostoevsky's \\",
-    "Prince Simi",
-    "Prince Velvetine",
-    "Princepessa",
-    "Princeska Pooch",
-    "Princess",
-    "Princess Annistasia",
-    "Princess Baby Kitten",
-    "Princess Charlie",
-    "Princess Christmas Katerina",
-    "Princess Di",
-    "Princess Diana",
-    "Princess Eleanor of Leanna",
-    "Princess Furball",
-    "Princess Gobnit",
-    "Princess Gutter",
-    "Princess Jasmine",
-    "Princess Leia",
-    "Princess M'Lady Portia",
-    "Princess Pasha",
-    "Princess Peach (from Super Mario Brothers)",
-    "Princess Penelope Peapod",
-    "Princess Puddypat",
-    "Princess Sarah",
-    "Princess T'Salanah (tsuh-lah-nah)",
-    "Princess Toes",
-    "Princess Victoria",
-    "Princess Yoda Zebedee Rose",
-    "Princeton",
-    "Pring",
-    "Prinsess",
-    "Prinsess Tigger Lilly",
-    "Prinstin",
-    "Pris",
-    "Priscilla",
-    "Prisila",
-    "Priss",
-    "Priss Illa",
-    "Prissy",
-    "Prissy Sissy With The Sassy Tail",
-    "Priya",
-    "Priya (Sanskrit for \\",
-    "Pro X",
-    "Procurl Harem",
-    "Prodigy",
-    "Professor",
-    "Professor Moriarty",
-    "Progidy",
-    "Prom Queen",
-    "Prometheus",
-    "Promicious",
-    "Promise",
-    "Prongs",
-    "Proton",
-    "Proton the Wonder Cat",
-    "Proud Mary",
-    "Prowler",
-    "Proxy",
-    "Prozac",
-    "Prrzetz",
-    "Prudence",
-    "Prue",
-    "Prune",
-    "Prunella",
-    "Prunella Scales",
-    "Psalms",
-    "Psillycybe (silly head)",
-    "Psipsinella (Greek for \\",
-    "Pslemish (Arabic curse meaning \\",
-    "Pssst",
-    "Psycho Kitten",
-    "Psycho Kitty",
-    "Psyco-pants",
-    "Puccini",
-    "Puce (French for \\",
-    "Puchtka",
-    "Puck",
-    "Pucky",
-    "Pud (a shortened form of the slang term pud-pud)",
-    "Pudd",
-    "Puddence Wucket",
-    "Puddin",
-    "Puddin britches",
-    "Puddin'tain",
-    "Pudding",
-    "Puddle",
-    "Puddles",
-    "Puddnum",
-    "Puddy",
-    "Puddy-foots",
-    "Puddypaws",
-    "PuddyTat",
-    "Pudge",
-    "Pudge-Puss",
-    "Pudgette",
-    "Pudgy Bunners",
-    "Pudgy Bunny",
-    "Pudgy Buns",
-    "Puff",
-    "Puff Baby",
-    "Puffalump",
-    "Puffaluptycus (Puff or Puffer for short)",
-    "Puffball",
-    "Puffer",
-    "Pufferbelly",
-    "Puffin",
-    "Puffing Billy",
-    "Puffle",
-    "Puffy",
-    "Pug",
-    "Pugi-Fatface",
-    "Pugnose",
-    "Pugsley",
-    "Puka",
-    "Pukahontas",
-    "Puke Boy",
-    "Puke Face",
-    "Pukey",
-    "Pukie-kun",
-    "Pukkedemus",
-    "Pukketje",
-    "Pukkie",
-    "Pukpuk",
-    "Puma",
-    "Pumba",
-    "Pumkin",
-    "Pumpernickle",
-    "Pumpkin",
-    "Pumpkin Pie",
-    "Pumpkin Pyewacket",
-    "Pumpkinator",
-    "Pumpkinseed",
-    "Pumpy",
-    "Punch",
-    "Pundit",
-    "Pungee",
-    "Punk",
-    "Punken",
-    "Punkin",
-    "Punkin Poodas",
-    "Punkin Puss",
-    "Punkin Seed",
-    "Punkin Spooks Kitty",
-    "Punkintat",
-    "Punko",
-    "Punkster",
-    "Punky",
-    "Punky and Ozzie (sister siamese)",
-    "Punky Rouxster",
-    "Punt",
-    "Pup",
-    "Pupa",
-    "Pupi",
-    "Pupo",
-    "Puppers",
-    "Puppy",
-    "Puppy Cat",
-    "Purcell (after composer Henry Purcell)",
-    "Purdey",
-    "Purdy",
-    "Purdykat",
-    "Pureheart",
-    "Purl",
-    "Purnickity",
-    "Purple",
-    "Purr \\",
-    "Purr Baby",
-    "Purr-bot",
-    "Purr-fect",
-    "Purr-fecto",
-    "Purr-Fette",
-    "Purr-o-matic",
-    "Purr-Power",
-    "Purrabus Grazen",
-    "Purranha",
-    "Purrball",
-    "Purrbox",
-    "Purrcival",
-    "Purrcy",
-    "Purrdie",
-    "Purrdita",
-    "Purreaux",
-    "Purri",
-    "Purrie",
-    "Purrkins",
-    "Purrl",
-    "Purrmethius",
-    "Purrsharita",
-    "Purrsian",
-    "Purrsnickitty",
-    "Purrsnickity",
-    "Purrsuit",
-    "Purry",
-    "Purry Mason",
-    "Purrzie",
-    "Pursula",
-    "Purty Kitter",
-    "Purvis",
-    "Pushka",
-    "Pushkin (Russian for \\",
-    "Pushy",
-    "Puss",
-    "Puss Cat",
-    "Puss in Boots",
-    "Puss Puss",
-    "Puss-Puss (aka The Tormalator)",
-    "Pussafuss",
-    "Pusscat",
-    "Pusshead",
-    "Pussita",
-    "Pusskin",
-    "Pussums",
-    "Pussy",
-    "Pussy Galore",
-    "Pussy Gata",
-    "Pussy Pussy",
-    "Pussy Willow",
-    "Pussyfoot",
-    "Pussywillow",
-    "Putin",
-    "Putnam",
-    "Putt-Putt",
-    "Putter",
-    "Puttintat",
-    "Putty Cat",
-    "Putty Tat",
-    "Putz",
-    "Putzi",
-    "Puying Maigae",
-    "Puzzball",
-    "Puzzie",
-    "Puzzles",
-    "Py",
-    "Py Kitty",
-    "Py Kitty Good Kitty",
-    "Pyanfar",
-    "Pye",
-    "Pyepye",
-    "PyePye (aka The Pye, PyeBoy (short for Pyewacket))",
-    "Pyewacket",
-    "Pyewackett",
-    "Pyewackett (aka Pye-Pye)",
-    "Pygmy",
-    "Pyotra",
-    "Pyper",
-    "Pyrex",
-    "Pywacket",
-    "Pywacki",
-    "P‚tÈ",
-    "Q (after the character in Star Trek)",
-    "Q-A-T",
-    "Q-Bert (after an Atari game)",
-    "Q-bopper",
-    "Q-Tip",
-    "Q.T.",
-    "Qana",
-    "Qantas",
-    "Qaylie",
-    "Qeena",
-    "Qettah (female cat in Arabic)",
-    "Qihai",
-    "Qu'Appelle",
-    "Quaalude",
-    "Quacker",
-    "Quakencats",
-    "Quaker",
-    "Quaker Oats",
-    "Quakey",
-    "Quana",
-    "Quango",
-    "Quantas",
-    "Quantum",
-    "Quantum Leaper",
-    "Quanyin",
-    "Quark",
-    "Quark (subatomic particle)",
-    "Quarky",
-    "Quarter Pound",
-    "Quartz",
-    "Quasar",
-    "Quasi",
-    "Quasimodo",
-    "Quasor",
-    "Quat",
-    "Quaxo",
-    "Que",
-    "Quedo",
-    "Queen",
-    "Queen Alien",
-    "Queen Bee",
-    "Queen Fang",
-    "Queenie",
-    "Queeny",
-    "Quendi",
-    "Quentin",
-    "Quentina",
-    "Querida",
-    "Quesa",
-    "Quesadilla",
-    "Question Mark",
-    "Questor (from the Latin 'quaestor' meaning a judge, a seeker of facts)",
-    "Quetinka",
-    "Quetzalcoati (Aztec and Toltec mythology: the feathered serpant god)",
-    "Quetzalcoatl (Mexican mythology: the god of the air and commerce)",
-    "Quiche",
-    "Quiches",
-    "Quick",
-    "Quickpounce",
-    "Quicksilver",
-    "Quid Pro Quo",
-    "Quiet One",
-    "Quigley",
-    "Quill",
-    "Quilla (Irish-Gaelic: cub)",
-    "Quimby",
-    "Quincy",
-    "Quinley",
-    "Quinn",
-    "Quintessential Kitty",
-    "Quinto",
-    "Quirk",
-    "Quirp",
-    "Quistador",
-    "Quit It",
-    "Quiver",
-    "Quixote",
-    "Quiz",
-    "Quizzical",
-    "Quoddy",
-    "Qute Qitty",
-    "Qwilleran",
-    "R.C. Fitzhugh",
-    "R.C. Fitzhugh (aka Resident Cat Fitzhugh",
-    "R.I.C.O. (Relaxing Interesting Cuddly Observant)",
-    "R.P. MacMurphy",
-    "R.T.",
-    "R2 D2",
-    "Raaee",
-    "Rabbi",
-    "Rabbit",
-    "Rabi",
-    "Rabindranath",
-    "Raccoo",
-    "Race Car",
-    "Racer",
-    "Rachel",
-    "Rachel (from the TV sitcom \\",
-    "Rachel (from the tv-series \\",
-    "Racso",
-    "Radar",
-    "Radar D Kat",
-    "Radburn",
-    "Radcliffe",
-    "Radiance",
-    "Raelin",
-    "Rafael",
-    "Rafajia",
-    "Rafe",
-    "Rafferty",
-    "Raffles",
-    "Rag Muffin",
-    "Ragamopp",
-    "Ragamour",
-    "Ragamuffin",
-    "Ragdoll",
-    "Rage",
-    "Raggedy Ann",
-    "Raggey Andy",
-    "Raggey Ann",
-    "Raggie",
-    "Raggles",
-    "Raging Bull",
-    "Ragmeister",
-    "Ragmop",
-    "Rags",
-    "Rags 2 Riches",
-    "Ragtime",
-    "Ragu",
-    "Rah Rah",
-    "Rahjah",
-    "Rahnee",
-    "Raidar",
-    "Raider",
-    "Rain",
-    "Rain Dancer Mao-ness",
-    "Rainbo",
-    "Rainbow",
-    "Rainbow Brite",
-    "Rainbow Dancer",
-    "Raincheck",
-    "Rainmaker",
-    "Raintree",
-    "Rainy",
-    "Raisin",
-    "Raison",
-    "Raja",
-    "Rajah",
-    "Raleigh",
-    "Ralph",
-    "Ralph Jr.",
-    "Ralphie",
-    "Ralphite",
-    "Ram",
-    "Rama",
-    "Rambis",
-    "Rambo",
-    "Rambunctious",
-    "Rameesh",
-    "Ramera",
-    "Ramirez (after Juan Sanchez Villalobos Ramirez in the movie \\",
-    "Ramone",
-    "Ramsay",
-    "Ramses",
-    "Ramsey",
-    "Ramu",
-    "Ran",
-    "Rana",
-    "Rance",
-    "Rand",
-    "Randall",
-    "Randall Flagg",
-    "Randi",
-    "Randolph",
-    "Random",
-    "Random Numbers",
-    "Randy",
-    "Ranger",
-    "Rani",
-    "Ransom",
-    "Raoul",
-    "Raow'n",
-    "Rappel",
-    "Rapsodia",
-    "Raptor",
-    "Rapture",
-    "Rapunzel",
-    "Raquel",
-    "RaRa",
-    "Ras",
-    "Rascal",
-    "Rascle",
-    "Rasgo",
-    "Rasheeba",
-    "Rashka",
-    "Rasputin",
-    "Raspy",
-    "Rasselas",
-    "Rassmuss",
-    "Rasta",
-    "Rasti",
-    "Rastus",
-    "Rat",
-    "Rat-Boy",
-    "Rat-Fink",
-    "Ratatat",
-    "Ratbag",
-    "Ratboy",
-    "Ratchet",
-    "Ratkiller",
-    "Ratly",
-    "Rattail",
-    "Rattles",
-    "Ratty",
-    "Ratumi",
-    "Raucci",
-    "Raul",
-    "Rav",
-    "Ravel",
-    "Raven",
-    "Ravenna",
-    "Ravi",
-    "Ravioli",
-    "Rawhide",
-    "Rax",
-    "Ray",
-    "Ray Charles",
-    "Ray Man",
-    "Rayata",
-    "Rayburn",
-    "Raymond",
-    "Raymond Burr",
-    "Raymond Chandler",
-    "Rayne",
-    "Raz",
-    "Razmataz",
-    "Razor",
-    "Razor Blade",
-    "Razz",
-    "Razzie",
-    "Razzle",
-    "Razzmatazz",
-    "Ready",
-    "Reagan",
-    "Reaper",
-    "Reba",
-    "Rebbi",
-    "Rebecah",
-    "Rebecca",
-    "Rebecca Sarah",
-    "Rebekah",
-    "Rebel",
-    "Reboot",
-    "Rebound",
-    "Red",
-    "Red Butler",
-    "Red Cloud",
-    "Red Or Redhead",
-    "Red Prince",
-    "Red Riding Hood",
-    "Red Rory",
-    "Redbeard",
-    "Redbone",
-    "Redbud",
-    "Redgent",
-    "Redi-whip",
-    "Redkilowatt",
-    "Redline",
-    "Redmond",
-    "Redneck",
-    "Redrose",
-    "Redwood",
-    "Reebok",
-    "Reebuls",
-    "Reef",
-    "Reefer",
-    "Reekey",
-    "Reena",
-    "Reeny",
-    "Reese",
-    "Reeses",
-    "Reeses Peanutbutter Cup (aka Fats)",
-    "Refund",
-    "Reg",
-    "Rega",
-    "Regalo",
-    "Regan",
-    "Regent",
-    "Reggae Sunsplash",
-    "Reggie",
-    "Regina",
-    "Regina Joan",
-    "Regina Phalange",
-    "Regional Transportation District (RTD for short)",
-    "Regis",
-    "Regulus",
-    "Rehnquist",
-    "Reilly",
-    "Reina de Corazones (Spanish for \\",
-    "Reindeer",
-    "Reisinho (Portugese: little king)",
-    "Reject",
-    "Reka Mao",
-    "Rella",
-    "Rem",
-    "Rema",
-    "Rembrandt",
-    "Rembrant",
-    "Remel",
-    "Remington",
-    "Remnants",
-    "Remo",
-    "Remus",
-    "Remy",
-    "Ren And Stimpy",
-    "Renaissance",
-    "Renaissance (Renai for short)",
-    "Renata",
-    "Rene Toupee",
-    "Renee",
-    "Renegade",
-    "Renfeild",
-    "Rennenka",
-    "Renny",
-    "Reno",
-    "Renoir",
-    "Renovia",
-    "Rental",
-    "Reo",
-    "Repete",
-    "Repo",
-    "Rerun",
-    "Rescue",
-    "Rescued",
-    "Resident Cat",
-    "Resigne",
-    "Retuy",
-    "Reuben",
-    "Rev",
-    "Reverend",
-    "Reverend Not Fredsel Dammit",
-    "Rex",
-    "Rex (after the Rex Banner character in The Simpsons cartoons)",
-    "Rexus",
-    "Rey",
-    "Rey de Corazones (Spanish for \\",
-    "Reyna",
-    "Reynold",
-    "RG Max",
-    "Rhapsody",
-    "Rhea",
-    "Rhedd Butler",
-    "Rheilly",
-    "Rhesus",
-    "Rhett",
-    "Rhett Butler",
-    "Rhia",
-    "Rhianna",
-    "Rhiannon",
-    "Rhinestone",
-    "Rhino",
-    "Rhoda",
-    "Rhode Island",
-    "Rhodes",
-    "Rhodesia",
-    "Rhonda",
-    "Rhone",
-    "Rhu And Barb",
-    "Rhubarb",
-    "Rhubard",
-    "Rhya",
-    "Rianne",
-    "Ribbon",
-    "Ribbons",
-    "Riboflavin",
-    "Ribs",
-    "Rica",
-    "Ricardo",
-    "Richelle",
-    "Riches",
-    "Richter",
-    "Rick",
-    "Rick (aka Richard, Dick and Little Man)",
-    "Ricka",
-    "Rickey",
-    "Ricki Lake",
-    "Rickie",
-    "Ricky",
-    "Ricky Ghostspirit",
-    "Ricky Ricardo",
-    "Ricky Ticky Tabby",
-    "Ricky-Ticky-Tavi",
-    "Rico",
-    "Rico (aka Jerico)",
-    "Ricochet",
-    "Ricotta",
-    "Riddle",
-    "Riddler",
-    "Rider",
-    "Ridgeway (aka - Reggie, Wiggly, Whichway or Fattyboy)",
-    "Ridiculous",
-    "Riel",
-    "Riff",
-    "Riff-Raff",
-    "Riffraff",
-    "Rigby",
-    "Riggor",
-    "Rigley",
-    "Rigoletto",
-    "Rikki",
-    "Rikki-Tikki-Kitty",
-    "Rikki-Tikki-Tavi",
-    "Rikkibain",
-    "Riley",
-    "Rima",
-    "Rimbaud",
-    "Rin",
-    "Rin Rin",
-    "Rin Tin Tin",
-    "Rindy",
-    "Ringleader",
-    "Ringo",
-    "Ringo Starr",
-    "Rio",
-    "Rip",
-    "Rip Van Winkle",
-    "Rip-Van-Winkle",
-    "Ripley",
-    "Ripley (after the novel and the movie \\",
-    "Ripple",
-    "Rippy",
-    "Riri (short for retard)",
-    "Rita",
-    "Ritty",
-    "Ritz",
-    "Ritz Or Ritzy",
-    "River Bean",
-    "River Dancer",
-    "River Mama",
-    "River Walker",
-    "Rix",
-    "Riyadh",
-    "Riz",
-    "Rizla",
-    "Rizzo",
-    "RJ",
-    "Ro",
-    "Roach",
-    "Roadkill",
-    "Roald Berntsen (aka Toonces, named after a private investigator in Norway)",
-    "Roast",
-    "Roast-A-Kitty",
-    "Rob Roy",
-    "Robbie",
-    "Robert",
-    "Robert Cohen",
-    "Robert Redford",
-    "Robin",
-    "Robin Goodfellow",
-    "Robin of Loxley (Loxley is the birthplace of the original Robin Hood)",
-    "Robo-cat",
-    "Robocat",
-    "Robroy",
-    "Robyn",
-    "Rocca",
-    "Rocco",
-    "Rochester",
-    "Rock",
-    "Rockafella Skank",
-    "Rockefeller",
-    "Rocker",
-    "Rocket",
-    "Rocket Cat",
-    "Rocketman",
-    "Rockford",
-    "Rocko",
-    "Rocksteady",
-    "Rocky",
-    "Rocky And Bullwinkle",
-    "Rococo",
-    "Rodeo",
-    "Rodesia",
-    "Rodgers & Hammerstein",
-    "Rodman",
-    "Rodney",
-    "Rodney (after the character in the british sitcom \\",
-    "Rodrigo",
-    "Roedtop",
-    "Rogan",
-    "Roger",
-    "Roger Crat",
-    "Roger the Dodger",
-    "Rogue",
-    "Rojo",
-    "Roland",
-    "Rolex",
-    "Rolf",
-    "Roli",
-    "Rolls",
-    "Rolo (Burmese)",
-    "Roma",
-    "Roman",
-    "Romana",
-    "Romani",
-    "Romano",
-    "Romeo",
-    "Romeo And Juliet",
-    "Romeow",
-    "Rommie",
-    "Romola",
-    "Romp",
-    "Romper",
-    "Romulus",
-    "RomÈo Cliffhanger",
-    "Ron (Ronald) Reagan",
-    "Ronaldo",
-    "Rondeau",
-    "Roni",
-    "Ronin",
-    "Ronja",
-    "Ronjerimie",
-    "Ronnie",
-    "Ronron",
-    "Ronto",
-    "Rontu",
-    "Rontuarue",
-    "Roo",
-    "Rooby",
-    "Rooikat",
-    "Rooikat (in Afrikaans. English is Redcat)",
-    "Rookie",
-    "Roommate",
-    "Roopis",
-    "Roopis Lert",
-    "Roosevelt",
-    "Rooster",
-    "Rooster-Roo",
-    "Root Beer",
-    "Ror",
-    "Rorschach Inkblot",
-    "Rory",
-    "Rory (aka Rors)",
-    "Rosabells",
-    "Rosalind",
-    "Rosanna",
-    "Rosanna Banana",
-    "Rosario",
-    "Rosarita",
-    "Roscoe",
-    "Roscoe Rascalini",
-    "Rose",
-    "Rose Kennedy Cat",
-    "Rosebean",
-    "Rosebean (from a book by John Lennon)",
-    "Rosebud",
-    "Roselily",
-    "Rosemary",
-    "Rosencrantz (from Rosencrantz & Guildenstern are Dead)",
-    "Rosey",
-    "Rosi",
-    "Rosie",
-    "Rosie Derrida",
-    "Rosita (after Joey's chair in Friends)",
-    "Ross",
-    "Ross (from the TV sitcom \\",
-    "Ross (from the tv-series \\",
-    "Rossa",
-    "Rossalini",
-    "Rossini",
-    "Rostislav",
-    "Roswelle",
-    "Rot",
-    "Rothschild",
-    "Rotten",
-    "Rotten Little Kitty",
-    "Rouge",
-    "Rouhilio",
-    "Roussi",
-    "Route 3",
-    "Roux",
-    "Rouxamond",
-    "Rouxster",
-    "Rover",
-    "Row",
-    "Rowan",
-    "Rowan Tree",
-    "Rowdy",
-    "Rowen (Welsh for \\",
-    "Rowin",
-    "Rox",
-    "Rox In Sox",
-    "Roxanna",
-    "Roxanne",
-    "Roxas",
-    "Roxette",
-    "Roxi Doodle Bug",
-    "Roxie",
-    "Roxorama",
-    "Roxy",
-    "Roxysan",
-    "Roxysaurus",
-    "Roxzee",
-    "Roy",
-    "Roy Rogers",
-    "Royal",
-    "Royal Emerald Steele",
-    "Roz",
-    "Roza",
-    "Rozalia",
-    "Rozz",
-    "Ru'Bella",
-    "Ru'Bella (aka Bella or Belly)",
-    "Ruari (Irish for \\",
-    "Ruben",
-    "Rubu Dugan",
-    "Ruby",
-    "Ruby Jean",
-    "Ruby Tuesday",
-    "Rucker",
-    "Ruddibuddy",
-    "Rude Boy",
-    "Rudi",
-    "Rudie",
-    "Rudikins",
-    "Rudolf",
-    "Rudolph",
-    "Rudolph Orangino",
-    "Rudolph Patoodolph",
-    "Rudy",
-    "Rudy Patootie",
-    "Rudyard",
-    "Rue",
-    "Ruff",
-    "Ruff Ruff I Love Fetch",
-    "Ruffian",
-    "Ruffles",
-    "Rufie",
-    "Ruford",
-    "Rufus",
-    "Rufus Redcat",
-    "Rufus T. Fleance L'Orange Jones",
-    "Rufus the naked mole cat",
-    "Rug",
-    "Rug Rat",
-    "Ruggles",
-    "Rugrat",
-    "Rum",
-    "Rum Tum",
-    "Rum Tum Tugger",
-    "Rumball",
-    "Rumblekitty",
-    "Rumblepurr",
-    "Rumbles",
-    "Rumhead",
-    "Rumi",
-    "Rumpelstiltskin",
-    "Rumple",
-    "Rumple-Teazer",
-    "Rumplenuts",
-    "Rumples",
-    "Rumplestiltzkin",
-    "Rumpleteazer",
-    "Rumpole Of The Bailey",
-    "Rumpus",
-    "Rumpus Cat",
-    "Runner",
-    "Runt",
-    "Runtis",
-    "Runway",
-    "Rupaul",
-    "Rupert",
-    "Rupert (middle name: Biggles)",
-    "Rupert [Middle Name: Biggles]",
-    "Ruppert",
-    "Ruru",
-    "Rusafee",
-    "Rush",
-    "Rusifi",
-    "Ruskie",
-    "Ruskin",
-    "Russell",
-    "Russia",
-    "Russian",
-    "Rust",
-    "Rustle",
-    "Rustler",
-    "Rusty",
-    "Ruth",
-    "Rutherford B. Hayes",
-    "Ruthie (aka Baby Ruth)",
-    "Rutledge",
-    "Ryanne",
-    "Ryder",
-    "Ryeli",
-    "Ryelle",
-    "Ryon",
-    "S'Kitty (from CatFantastic)",
-    "S'mores",
-    "S**tBird",
-    "S.C. (\\",
-    "S.C. (Stupid.Cat)",
-    "S.F. (Stupid Face)",
-    "S.F.B. (= Sh*t for Brains)",
-    "S.N. (Snore Alot",
-    "S.U.S.A.C. (\\",
-    "Sa'Jin (Korean)",
-    "Saab",
-    "Saabre",
-    "Saavik",
-    "Saba",
-    "Sabastian",
-    "Sabbaee",
-    "Sabbath",
-    "Sabby",
-    "Sabella",
-    "Saber",
-    "Saber-Tooth",
-    "Sabian",
-    "Sabina",
-    "Sabine",
-    "Sable",
-    "Sabra",
-    "Sabre Tooth",
-    "Sabria",
-    "Sabriel",
-    "Sabrina",
-    "Sabrina Snow",
-    "Sacchan",
-    "Sacco",
-    "Sacco The Amazing Fetch Kitty",
-    "Sachiko",
-    "Sachin",
-    "Sackett (from a book about a family named \\",
-    "Sacko",
-    "Sad Sack",
-    "Sada",
-    "Sadaka (means \\",
-    "Sadhi",
-    "Sadie",
-    "Sadie Hawkins",
-    "Sadie Jadzia Hommel",
-    "Sado",
-    "Sadora",
-    "Safari",
-    "Saffi",
-    "Saffiare",
-    "Saffron",
-    "Saffy",
-    "Safi",
-    "Safram",
-    "Saga",
-    "Sagan",
-    "Sage",
-    "Sage Felicity Bridgette",
-    "Sagebrush",
-    "Sagwa",
-    "Sahara",
-    "Sahib",
-    "Sahiba (Arabic for \\",
-    "Sail",
-    "Sailor",
-    "Sailor Boy",
-    "Saint",
-    "Saint Ashlar",
-    "Saint Inklemann",
-    "Saint Paw",
-    "Saint Pawl",
-    "Saja",
-    "Sajak",
-    "Saji",
-    "Sake",
-    "Saki",
-    "Sal",
-    "Salamaller",
-    "Salamander",
-    "Salem",
-    "Salerno",
-    "Salley Cat (Female alley Cat )",
-    "Sallie",
-    "Sallllllllly",
-    "Sally",
-    "Sally Luna",
-    "Salom",
-    "Salome",
-    "Salon",
-    "Salsa",
-    "Salt II",
-    "Salt/Pepper",
-    "Salter",
-    "Salty",
-    "Salvador",
-    "Salvatore",
-    "Sam",
-    "Sam Cat",
-    "Sam Furman",
-    "Sam I Am",
-    "Sam Spade",
-    "Sam The Ratcat",
-    "Sam-Girl",
-    "Sam-I-Am",
-    "Samantha",
-    "Samantha Meowington",
-    "Samara (after the character in \\",
-    "Samara Kitty",
-    "Samatha",
-    "Samatha Louise",
-    "Samba",
-    "Sambo",
-    "Sambrina",
-    "Sambuca",
-    "Sambuka",
-    "Samda Cat",
-    "Samflash",
-    "Sami",
-    "Samitha",
-    "Sammantha",
-    "Sammi",
-    "Sammie",
-    "Sammieguy",
-    "Sammsa",
-    "Sammy",
-    "Sammy Blacfoot",
-    "Sammy Dash",
-    "Sammy Davis, Jr.",
-    "Sammy Malone",
-    "Sammy Silverpaws",
-    "Samori",
-    "Sampson",
-    "Samson",
-    "Samson And Delilah",
-    "Samtu",
-    "Samuel",
-    "Samuel Adams",
-    "Samuel Jackson",
-    "Samuel Peckinpaw",
-    "Samurai",
-    "Samus Aran (from the Nintendo game \\",
-    "Samwise (Lord of the Rings)",
-    "San Soo",
-    "Sanani",
-    "Sanar",
-    "Sanborn",
-    "Sancho",
-    "Sanctifikitty",
-    "Sand Rat",
-    "Sanders",
-    "Sandie",
-    "Sandler",
-    "Sandler (after the actor Adam Sandler)",
-    "Sandman",
-    "Sandoval",
-    "Sandra",
-    "Sandrake",
-    "Sandrine",
-    "Sandunga (from a Mexican song)",
-    "Sandy",
-    "Sandy Claws",
-    "Sandy Koufax (after Sanford Koufax, baseball pitcher)",
-    "Sangievese",
-    "Sangria",
-    "Sanspoof",
-    "Santa",
-    "Santa (after the novel by Federico Gamboa)",
-    "Santa Fe",
-    "Santa's Little Helper",
-    "Santal",
-    "Santana",
-    "Santaria",
-    "Santi",
-    "Santi (aka santi claws, a found cat who had been stuck in a chimney 4 days)",
-    "Santini",
-    "Santo",
-    "Sanura (Egyptian for \\",
-    "Sany",
-    "Saphi",
-    "Saphi (short for Sapphire Eyed Baby)",
-    "Sapphire",
-    "Sappho",
-    "Sara",
-    "Sara Burnheart",
-    "Sara Lee",
-    "Sara Rose",
-    "Sarabeth",
-    "Sarabi (from The Lion King)",
-    "Sarafina",
-    "Sarah",
-    "Sarah's Champagne Truffle",
-    "Saraneth",
-    "Sarasota",
-    "Sarge",
-    "Sargent",
-    "Sarha",
-    "Sari",
-    "Sarina",
-    "Sarj",
-    "Sarsaparilla",
-    "Saru (\\",
-    "Sasa (after the DJ from Hong Kong)",
-    "Sasaparilla",
-    "Sascha",
-    "Sasche",
-    "Sasha",
-    "Sasha Jhoie",
-    "Sasha Silvertoes",
-    "Sasha Whitebelly",
-    "Sasha Yar",
-    "Sasha-Pasha",
-    "Sashapuss",
-    "Sashi",
-    "Sashimi",
-    "Sashquatch",
-    "Saskia",
-    "Sasquach",
-    "Sasquatch",
-    "Sasquatch (has extra toes and hence is a bigfoot)",
-    "Sass",
-    "Sassa-Cat",
-    "Sassafras",
-    "Sassafrass (Sassy)",
-    "Sassea",
-    "Sassenach (those who are not Scottish)",
-    "Sassette",
-    "Sassy",
-    "Sassy McCat",
-    "Sassy Pearl",
-    "Sassy Stinson",
-    "Satai (pronounced suh+tie - from the tv show Babylon 5. It means revered one)",
-    "Satana",
-    "Satay",
-    "Satchel",
-    "Satchmo",
-    "Satellite",
-    "Sati (Egyptian Goddess whose arrow was so swift it kept rivers flowing)",
-    "Satin",
-    "Satin Doll",
-    "Satin Doll Baby",
-    "Satine (after the character in the musical 'Moulin Rouge')",
-    "Sativa",
-    "Satori",
-    "Saturday",
-    "Saturn",
-    "Saturnian Amulet",
-    "Sauce Or Saucy",
-    "Saucey (for Saucier Mississippi)",
-    "Saucy",
-    "Sausage",
-    "Sauvage",
-    "Savage",
-    "Savanna",
-    "Savannah",
-    "Savernake",
-    "Savoy",
-    "Savvers",
-    "Savvy",
-    "Sawda (Female Arabian name, meaning \\",
-    "Sawyer",
-    "Saxon",
-    "Saxton",
-    "Say",
-    "Saydee",
-    "Sayonara",
-    "Scally Wag",
-    "Scallywag",
-    "Scaly Joe",
-    "Scamp",
-    "Scampennelli",
-    "Scamper",
-    "Scamper Baby",
-    "Scampi",
-    "Scamps",
-    "Scampurr",
-    "Scandalous",
-    "Scar (from The Lion King)",
-    "Scaramouche (a character in the play \\",
-    "Scarborough",
-    "Scardey",
-    "Scardie-Cat",
-    "Scare Muche",
-    "Scaredie",
-    "Scaredy",
-    "Scaredy Cat",
-    "Scarface",
-    "Scarlet",
-    "Scarlett",
-    "Scarlett And Rhett",
-    "Scarsborough the Fair",
-    "Scary Mary",
-    "Scat (as in Scat-Cat)",
-    "Scatter",
-    "Schatzie",
-    "Scheherazade",
-    "Schizo",
-    "Schlumphene",
-    "Schmedl",
-    "Schmeichel",
-    "Schmitty the little kitty",
-    "Schmoo",
-    "Schmooze",
-    "Schmoozer",
-    "Schmuckie",
-    "Schnapps",
-    "Schnee",
-    "Schnee (\\",
-    "Schnickles",
-    "Schnitzel",
-    "Schnitzy",
-    "Schnog",
-    "Schnook",
-    "Schnuggems",
-    "Scholastica",
-    "Schooner",
-    "Schputtie Butt-toosk",
-    "Schrodinger",
-    "Schrodinger's Cat (of physics fame)",
-    "Schroeder",
-    "Schuffalufagus",
-    "Schuler",
-    "Schultzie",
-    "Schuyler",
-    "Schwartz",
-    "Schwarzkopf",
-    "Schwazili",
-    "Schweppes",
-    "Scintilla",
-    "Scissor",
-    "Scissors",
-    "Sco",
-    "Scone",
-    "Scoobie",
-    "Scoobs",
-    "Scooby",
-    "Scooby Doobie Doo",
-    "Scooby Doobies",
-    "Scooby-Doo",
-    "Scootacious P. Fruitwinkle (aka Scooty, aka Scooty Fruit)",
-    "Scooter",
-    "Scooter Loo",
-    "Scooter Pie",
-    "Scooter The Midnight Hooter",
-    "Scooter Toot-toot Tat",
-    "Scooter-Boodah",
-    "Scorpanon",
-    "Scorpio",
-    "Scorpion",
-    "Scotch",
-    "Scotch & Soda",
-    "Scott",
-    "Scottie",
-    "Scotty",
-    "Scoundrel",
-    "Scout",
-    "Scrapper",
-    "Scrappleton Pie",
-    "Scrappy",
-    "Scrappy Too",
-    "Scrappy-Doo",
-    "Scratch",
-    "Scratchy",
-    "Scratchy McFleaface III",
-    "Scratchy-Patchy",
-    "Scrawny",
-    "Scrawny Cat",
-    "Screamer",
-    "Screaming Meme",
-    "Screech",
-    "Screwtop",
-    "Scribbles",
-    "Scrissie",
-    "Scrooge",
-    "Scruff",
-    "Scruffy",
-    "Scruge",
-    "Scrumptious",
-    "Scrumpy (after the home-made apple cider)",
-    "Scsi",
-    "Scsi (\\",
-    "Scsi2",
-    "Scsi2 (\\",
-    "Scuba",
-    "Scud",
-    "Scudder",
-    "Scully",
-    "Scully-faced Butthead",
-    "Scuma",
-    "Scummy",
-    "Scutter",
-    "Scuzzface",
-    "Scylla",
-    "Sea Bisquit",
-    "Sea Dog",
-    "Seabone Sam",
-    "Seabreeze",
-    "Seairah",
-    "Seal",
-    "SeaLab 2021",
-    "Seamus",
-    "Sean",
-    "Seanna",
-    "Seanna, Goddess of Water",
-    "Search And Destroy",
-    "Seargent Tibbs (from 101 Dalmations)",
-    "Seattle",
-    "Sebastian",
-    "Sebastian Napolean Bonaparte Bartholomew",
-    "Sebastian Napolean Bonaparte Bartholomew MacGillikitty II",
-    "Sebastian White Paws",
-    "Sebatstion",
-    "Sebby",
-    "Sebbys",
-    "Sedona Sage",
-    "See Saw",
-    "See-A-Tee (after the spelling of c-a-t)",
-    "Seeger",
-    "Sef (Egyption Mythology: loday)",
-    "Sefton",
-    "Sega",
-    "Segun",
-    "Seiko",
-    "Seinfeld",
-    "Seka",
-    "Sekita",
-    "Sekmet",
-    "Sekmet (named after the Egyption lion-headed goddess)",
-    "Sekou",
-    "Selby",
-    "Selena",
-    "Selena (after the goddess Selene)",
-    "Selene",
-    "Selene (after the Greek godess of the moon)",
-    "Selene Lilth Zildjian",
-    "Selenium",
-    "Selig",
-    "Selina",
-    "Selkie",
-    "Selma",
-    "Selmer",
-    "Seltzer",
-    "Semba",
-    "Semi",
-    "Semik",
-    "Seminole",
-    "Senator Loomis P Nutley III",
-    "Seneca",
-    "Senior",
-    "Senior Assistant Mouser",
-    "Senior Kitty",
-    "Senna",
-    "Senneca",
-    "Senorita",
-    "Senorita Kitty",
-    "Senorita Margarita",
-    "Sensei",
-    "Sentral",
-    "Sephanie",
-    "Sephanine",
-    "Sepher",
-    "Sepher-Do",
-    "Sepher-Doodle",
-    "Sephie",
-    "Sephie-Sephie-Sefie",
-    "Sephora",
-    "Sephronia",
-    "Sequoia",
-    "Sera",
-    "Serafim",
-    "Serafima",
-    "Serai",
-    "Serai (aka Rennie, Renley, Rai, Dragon (a giant red tabby))",
-    "Seraphim (Hebrew word for angels)",
-    "Seren (for Serendipidity)",
-    "Seren (from the word \\",
-    "Serena",
-    "Serenade",
-    "Serendipity",
-    "Serengeti",
-    "Serenity",
-    "Serfina",
-    "Serge",
-    "Sergeant",
-    "Sergei",
-    "Serina",
-    "Serve",
-    "Sesame",
-    "Sesi",
-    "Sessan",
-    "Set",
-    "Seth",
-    "Setra (after the coach brand \\",
-    "Settete",
-    "Seurat",
-    "Seuss",
-    "Seven",
-    "Seventh Heaven",
-    "Seventy Five",
-    "Severus",
-    "Seville",
-    "Sevvie",
-    "Seward",
-    "Sexkitten",
-    "Sexton",
-    "Sexy Cat",
-    "Sexy Kelsey",
-    "Seychelles",
-    "Seymore (Our cat who likes to hide that we want to \\",
-    "Seymour",
-    "Sgt. Pepper",
-    "Sha-Na-Na",
-    "Sha-Sha",
-    "Shaaz",
-    "Shabanu (after the book \\",
-    "Shabou",
-    "Shack",
-    "Shada",
-    "Shades of Grey",
-    "Shadi",
-    "Shadow",
-    "Shadow",
-    "Shadow \\",
-    "Shadow Chat",
-    "Shadow-Bear",
-    "Shadowfax",
-    "Shadowfoot",
-    "Shadowstorm",
-    "Shadrach",
-    "Shady",
-    "Shaft",
-    "Shaggy",
-    "Shah",
-    "Shahalie",
-    "Shai (hebrew for \\",
-    "Shaina",
-    "Shajanapur",
-    "Shaka Zulu",
-    "Shakes",
-    "Shakespeare",
-    "Shakespurr",
-    "Shakilah (Pygmy for \\",
-    "Shakira",
-    "Shalimar",
-    "Shalklad",
-    "Shalom",
-    "Sham",
-    "Shama",
-    "Shaman",
-    "Shammy",
-    "Shamrock",
-    "Shamrocka",
-    "Shamu",
-    "Shamus",
-    "Shamus Blue",
-    "Shana (Yiddish for \\",
-    "Shandy",
-    "Shane",
-    "Shanghi",
-    "Shangri-la",
-    "Shani",
-    "Shania",
-    "Shannenay",
-    "Shannon",
-    "Shanti",
-    "Shaq",
-    "Shaquille O'Neil",
-    "Shar",
-    "Share",
-    "Sharkey",
-    "Sharky",
-    "Sharni",
-    "Sharp",
-    "Shasha",
-    "Shashi Kapoor (after the Indian actor)",
-    "Shasta",
-    "Shastri",
-    "Shatzie",
-    "Shaun",
-    "Shawn",
-    "Shawnee",
-    "Shay",
-    "Shayna",
-    "Shaynabear",
-    "Shaynala",
-    "Shaynapet",
-    "Shaynapie",
-    "Shaynapoo",
-    "Shaynapretzel",
-    "Shaynapuddin'",
-    "Shaynie",
-    "Shaynmeister",
-    "Shazbot",
-    "Shazo",
-    "Shazzam",
-    "She-Devil",
-    "She-she",
-    "Sheba",
-    "Sheba-Do",
-    "Sheba-Maud",
-    "Shebe-Debe",
-    "Sheeba (after the cat food)",
-    "Sheeber",
-    "Sheena",
-    "Sheer",
-    "Sheera",
-    "Sheeva",
-    "Sheffield",
-    "Shego (character in the \\",
-    "Shegwah",
-    "Sheik",
-    "Sheik Djobouti",
-    "Sheila",
-    "Shelby",
-    "Sheldon",
-    "Shelley",
-    "Shelly",
-    "Shelton",
-    "Shemaya",
-    "Shenanigans",
-    "Shepert",
-    "Shepherd",
-    "Sherazade (variation of Scheherazade)",
-    "Sherbert",
-    "Sherbet",
-    "Shere Khan",
-    "Sheridan",
-    "Sheriff",
-    "Sheringham",
-    "Sherlock",
-    "Sherlock and Watson",
-    "Sherlock Holmes",
-    "Sherly",
-    "Sherman",
-    "Sherman Tank",
-    "Sherry",
-    "Sherwin",
-    "Sherwood",
-    "Shia",
-    "Shicalf",
-    "Shiitake",
-    "Shika",
-    "Shikilah (Pygmy for \\",
-    "Shiko (Japanese for \\",
-    "Shiksa",
-    "Shila",
-    "Shilo",
-    "Shiloh",
-    "Shim Shim Shiree",
-    "Shima",
-    "Shimi",
-    "Shimmer",
-    "Shimmering Ice Puzzle",
-    "Shimmy",
-    "Shine",
-    "Shingles",
-    "Shingy",
-    "Shining Star",
-    "Shinka",
-    "Shino (Japanese for \\",
-    "Shiny New Penny",
-    "Shirah",
-    "Shiraz",
-    "Shirin (Persian for \\",
-    "Shirley",
-    "Shirley Temple",
-    "Shish",
-    "Shishka",
-    "Shit",
-    "Shitakii",
-    "Shitface",
-    "Shithead",
-    "Shittin",
-    "Shitty Kitty",
-    "Shiva",
-    "Shlomo",
-    "Shmatte (Yiddish for \\",
-    "Shminok",
-    "Shmoo",
-    "Shmoopie",
-    "Shmoosy",
-    "Shmuzie",
-    "Shnapple",
-    "Shnoo",
-    "Shnookums",
-    "Sho-Shona",
-    "Shoda",
-    "Shodabear (Hebrew for \\",
-    "Shoela",
-    "Shoeless",
-    "Shogun",
-    "Shohornemar (Hebrew for \\",
-    "Shoni",
-    "Shoobbie",
-    "Shoogar",
-    "Shooter",
-    "Short Cake",
-    "Short Circuit",
-    "Short Socks",
-    "Shortcake",
-    "Shortstop",
-    "Shorttail",
-    "Shorty",
-    "Shorty Mcshort Shorts",
-    "Shosh",
-    "Shoshony",
-    "Shotgun",
-    "Shotzie",
-    "Shotzy",
-    "Shout",
-    "Shovel Head",
-    "Show",
-    "Showboat",
-    "Showdy",
-    "Showoff",
-    "Shpookums",
-    "Shrambles",
-    "Shramsberg",
-    "Shrapnel",
-    "Shredder",
-    "Shreen",
-    "Shrek",
-    "Shrimp",
-    "Shuana",
-    "Shuber",
-    "Shubert",
-    "Shuffin",
-    "Shuggy",
-    "Shukran",
-    "Shunka Witco",
-    "Shunkman",
-    "Shut Up",
-    "Shy",
-    "Shy One",
-    "Shy-Ann",
-    "Shylo",
-    "Shylock",
-    "Shyvie",
-    "Sia",
-    "Siam",
-    "Siamese",
-    "Siamsa",
-    "Siani",
-    "Siati (pronounced C-A-T (Si-A-Ti))",
-    "Siberian Tiger",
-    "Sibyl",
-    "Siciliano",
-    "Sicily",
-    "Sid",
-    "Sid And Nancy",
-    "Sid Vicious",
-    "Sideways",
-    "Sidewinder",
-    "Sidmeister",
-    "Sidney",
-    "Sidney No Knees",
-    "Sidonie",
-    "Sidster",
-    "Siegfried",
-    "Sienna",
-    "Siepie",
-    "Siera",
-    "Sierra",
-    "Sierra Leone",
-    "Sifka",
-    "Sigma",
-    "Sigmund",
-    "Sigri (from the Greek Isle of the same name)",
-    "Sigurd",
-    "Siki",
-    "Sikkim",
-    "Silence",
-    "Silhouette",
-    "Silicone",
-    "Silk",
-    "Silke",
-    "Silken",
-    "Silkenfire",
-    "Silkers",
-    "Silkwood",
-    "Silkworth",
-    "Silky",
-    "Silky Beast",
-    "Sillabub",
-    "Silly",
-    "Silly Maybelline The Acid Queen",
-    "Silly Sidney",
-    "Silva",
-    "Silver",
-    "Silver Fox",
-    "Silver Mountain",
-    "Silver Streak",
-    "Silver Toes",
-    "Silverspoon",
-    "Silverstein",
-    "Silvester",
-    "Silvia",
-    "Silvie",
-    "Silvina",
-    "Silvio (from the sitcom \\",
-    "Sim-shin",
-    "Sim-Silly-Sim",
-    "Sima",
-    "Simba",
-    "Simba (from The Lion King)",
-    "Simba Kie",
-    "Simba Sue",
-    "Simbad",
-    "Simena",
-    "Simeon",
-    "Simkin",
-    "Simochka",
-    "Simon",
-    "Simon Says",
-    "Simon Sez",
-    "Simone",
-    "Simons",
-    "Simpatico",
-    "Simply Red",
-    "Simpson",
-    "Sin",
-    "Sinatra",
-    "Sinbad",
-    "Sinbar",
-    "Sinclair",
-    "Sinder",
-    "Sine",
-    "Sing Lee A-Cha-Cha",
-    "Singe",
-    "Singer",
-    "Singh (Hindu for \\",
-    "Sinister",
-    "Sinker",
-    "Sinoe",
-    "Sinora",
-    "Sinta (after the Indonesian mythical princess)",
-    "Sintya",
-    "Sir",
-    "Sir Callaway",
-    "Sir Ding Bat of Ashburn",
-    "Sir Fat Lowis",
-    "Sir Fatness",
-    "Sir Higgenpoof",
-    "Sir Lancelot",
-    "Sir Little Bigfeets",
-    "Sir Little Bigfoot",
-    "Sir Max the Fearful",
-    "Sir Meowington Pudger Cat The Third",
-    "Sir Michael's Harley of Campton",
-    "Sir Nicholas",
-    "Sir Nickapoopalot",
-    "Sir Poop-a-lot",
-    "Sir Poops-A-Lot",
-    "Sir Prance Alot",
-    "Sir Purr-A-Lot",
-    "Sir Purrs-a-lot",
-    "Sir Raider",
-    "Sir Sebastian",
-    "Sir Seddrik",
-    "Sir Simon Cinnamon",
-    "Sir Stinkalot the 1st",
-    "Sir Thomas Lipton",
-    "Sir Tigger The Blue (after Tigger in Winnie the Pooh)",
-    "Sir Weebit",
-    "Sir Weeble Wobblybottom",
-    "Sir William",
-    "Sir Winston Whines-A-lot",
-    "Sir Wyles of Ashencoat (a play on \\",
-    "Sirana",
-    "Siren",
-    "Sirius",
-    "Sirus",
-    "Sisco",
-    "Siskel And Ebert",
-    "Sisko",
-    "Sissy",
-    "Sister",
-    "Sita",
-    "Sitar",
-    "Sitka",
-    "Sitsa",
-    "Sitting Bull",
-    "Siva",
-    "Siva (after the Hindu god of destruction)",
-    "Six",
-    "Six Toes",
-    "Sixer",
-    "Sixpence",
-    "Sixty-Niner",
-    "Sizi",
-    "Sizzle",
-    "Sjakie",
-    "Sjimmie",
-    "Sjors (Dutch version of George)",
-    "Skank",
-    "Skanky",
-    "Skat",
-    "Skattie (Afrikaans for \\",
-    "Skatz",
-    "Skedaddle",
-    "Skeeder",
-    "Skeet",
-    "Skeeter",
-    "Skeletor (character in the Masters of the Universe cartoon)",
-    "Sketchy",
-    "Skidder",
-    "Skids",
-    "Skinhead",
-    "Skinner",
-    "Skip",
-    "Skipper",
-    "Skippy",
-    "Skitchy",
-    "Skitszo",
-    "Skittah",
-    "Skitter",
-    "Skittle",
-    "Skittlehead",
-    "Skittles",
-    "Skitty",
-    "SKL (Silk)",
-    "Skookum",
-    "Skor",
-    "Skosh",
-    "Skoshee",
-    "Skoshi",
-    "Skoshy",
-    "Skrawny",
-    "Skully",
-    "Skunk",
-    "Skunkers",
-    "Skunky",
-    "Sky",
-    "Sky Hawk",
-    "Skye",
-    "Skyelar Cricket Sc'thyst",
-    "Skyla",
-    "Skyler",
-    "Skymble",
-    "Skyrocket",
-    "Skyttles",
-    "Skywalker",
-    "Slammer",
-    "Slartibartfast",
-    "Slash",
-    "Slash Brown",
-    "Slasher",
-    "Slate",
-    "Slats",
-    "Slax",
-    "Sleek",
-    "Sleepy",
-    "Sleepy Cat",
-    "Sleepy Eye",
-    "Sleepy Jackson",
-    "Sleestack",
-    "Slenderback Treecatimous",
-    "Slicer",
-    "Slick",
-    "Slick Willie",
-    "Slicker",
-    "Slickers",
-    "Slicks",
-    "Slickster",
-    "Slicky the Porch Panther",
-    "Slider",
-    "Slim",
-    "Slim Jim",
-    "Slinker",
-    "Slinkerdoodle",
-    "Slinkus.",
-    "Slinky",
-    "Slinky D.",
-    "Slinky Malinky",
-    "Slinky Pinky",
-    "Slinx",
-    "Slipknot",
-    "Slippers",
-    "Slippery",
-    "Slither",
-    "Slither Cat",
-    "Slitzercoo",
-    "Slobbash Butterball",
-    "Slobbechops",
-    "Slobber-Puss",
-    "Slobbers",
-    "Sloopy",
-    "Sloppy",
-    "Sloth",
-    "Slugger",
-    "Sluggo",
-    "Slurp",
-    "Slut Cat",
-    "Sly",
-    "Sly Boy",
-    "Slykitty",
-    "Slytherin",
-    "Smack",
-    "Small Man in a Catsuit",
-    "Smartie",
-    "Smarty",
-    "Smash",
-    "Smasher",
-    "Smeagol",
-    "Smedly",
-    "Smeghammer",
-    "Smelly Cat",
-    "Smidge",
-    "Smidgen",
-    "Smidgeons",
-    "Smidget",
-    "Smidgewidge",
-    "Smiles",
-    "Smiley",
-    "Smiley Buttons",
-    "Smirkin",
-    "Smith",
-    "Smith And Wesson",
-    "Smither the Poop",
-    "Smitty",
-    "Smizza",
-    "Smocky",
-    "Smog",
-    "Smok'n Sally",
-    "Smoka",
-    "Smoke",
-    "Smoker",
-    "Smokeshack",
-    "Smokey",
-    "Smokey Jo",
-    "Smokey Joe",
-    "Smokey Joe roach",
-    "Smokey Kitty",
-    "Smokey the Bandit",
-    "Smokey/Smokie",
-    "Smokie",
-    "Smoko",
-    "Smoky",
-    "Smoky Baby",
-    "Smoky Cat",
-    "Smoky One-Eye",
-    "Smoochee",
-    "Smoocher",
-    "Smoochers",
-    "Smoochie",
-    "Smoochini",
-    "Smoogee",
-    "Smores",
-    "Smuckers",
-    "Smudge",
-    "Smudgeface",
-    "Smudges",
-    "Smulan",
-    "Smurfette",
-    "Smushy",
-    "Smutley",
-    "Snack",
-    "Snaggle",
-    "Snaggletooth",
-    "Snags",
-    "Snaker",
-    "Snakers",
-    "Snap",
-    "Snapes",
-    "Snapper",
-    "Snappy",
-    "Snapshot",
-    "Snarl",
-    "Snarley",
-    "Snazzy",
-    "Sneakers",
-    "Sneaky",
-    "Sneaky Joe",
-    "Sneezy",
-    "Snicker",
-    "Snicker Doddles",
-    "Snicker Doodles",
-    "Snicker-Doodle",
-    "Snickers",
-    "Snickle Fritz",
-    "SnickleFritz Schnurren (German for 'Purry Rascal')",
-    "Sniff",
-    "Sniffer",
-    "Sniffles",
-    "Snifter",
-    "Sniper",
-    "Snippet",
-    "Snit",
-    "Snitch",
-    "Sno-Pea",
-    "Snoball",
-    "Snocap",
-    "Snodgrass",
-    "Snoez",
-    "Snoogie",
-    "Snoogin' Kitty",
-    "Snoogybear",
-    "Snook",
-    "Snooker",
-    "Snookie",
-    "Snookles",
-    "Snooks",
-    "Snookster",
-    "Snookums",
-    "Snooky",
-    "Snooky Wooky",
-    "Snoop",
-    "Snooper",
-    "Snoops",
-    "Snoopy",
-    "Snooty",
-    "Snorkler",
-    "Snorky",
-    "Snorky Kitty",
-    "Snorri",
-    "Snorter",
-    "SnotBall",
-    "Snotje",
-    "Snots",
-    "Snout",
-    "Snow",
-    "Snow Princess",
-    "Snow White",
-    "Snow-girl",
-    "Snowball",
-    "Snowberry",
-    "Snowbird",
-    "Snowbunny",
-    "Snowcat",
-    "Snowfall",
-    "Snowfire",
-    "Snowflake",
-    "Snowie",
-    "Snowman",
-    "Snowmist",
-    "Snowshoe",
-    "Snowshoes",
-    "Snowstorm",
-    "Snowy",
-    "Snuff",
-    "Snuffelufugus",
-    "Snuffles",
-    "Snuffy",
-    "Snug",
-    "Snugganuts",
-    "Snugglebunny",
-    "Snugglepuss",
-    "Snuggles",
-    "Snuggles Or Snuggle-Puss",
-    "Snˆggur",
-    "So Me",
-    "Sobby",
-    "Sock 'em Boppers",
-    "Sockie Boy",
-    "Socks",
-    "Socrates",
-    "Socs",
-    "Soda",
-    "Sodom And Gomorrah",
-    "Sofa",
-    "Sofia",
-    "Sofia Luisa Princess Dirty Feet",
-    "Sofka (Russian for \\",
-    "Soft",
-    "Sohare",
-    "Sok",
-    "Solan",
-    "Solar",
-    "Soleil",
-    "Solid Snake (from the video game \\",
-    "Solie",
-    "Soliloquy",
-    "Solitaire",
-    "Sollie",
-    "Solo",
-    "Soloman",
-    "Solomon",
-    "Solsjakeer",
-    "Solskjaer (pronounced \\",
-    "Solstice",
-    "Solt",
-    "Soluna",
-    "Somara",
-    "Sombra (Spanish for \\",
-    "Somchai",
-    "Some Sissy Kitty",
-    "SOMEone!",
-    "Somerset",
-    "Sonar",
-    "Sonata",
-    "Song",
-    "Sonia",
-    "Sonic",
-    "Sonja",
-    "Sonnet",
-    "Sonny",
-    "Sonny And Cher",
-    "Sonny Bono",
-    "Sonny Delight",
-    "Sonoma",
-    "Sonora",
-    "Sonta",
-    "Sony",
-    "Sonya",
-    "Soo-Soou",
-    "Sook",
-    "Sooner",
-    "Soosh",
-    "Sooshy",
-    "Soot5",
-    "Sooti",
-    "Sootica",
-    "Sootikin",
-    "Sooty",
-    "Sooty Smudge",
-    "Sopher",
-    "Sophia",
-    "Sophie",
-    "Sophie Lilac",
-    "Sophie/Sophia",
-    "Sora",
-    "Soran",
-    "Sorassa",
-    "Sorbet",
-    "Sorcerer Or Sorceress",
-    "Sorceror",
-    "Sorcha",
-    "Sorcorn",
-    "Sorry",
-    "Sorsha Marie",
-    "Sorsha Softpaw",
-    "Sosha Dee",
-    "Soueee",
-    "Souki",
-    "Soup",
-    "Sour Soup",
-    "Sourdough",
-    "Southern Comfort",
-    "Southern Lady",
-    "Southpaw",
-    "Souverain",
-    "Sox",
-    "Sox/Soxy",
-    "Soxy",
-    "Soybay",
-    "Space Cadet",
-    "Spacey",
-    "Spackman",
-    "Spade",
-    "Spades",
-    "Spaette",
-    "Spaetzle.",
-    "Spaghetti",
-    "Spago",
-    "Spam",
-    "Spam Wucket",
-    "Spamela",
-    "Spandex",
-    "Spanky",
-    "Spare",
-    "Spare Cat",
-    "Spare Parts",
-    "Spare Tire",
-    "Sparecat",
-    "Sparkey",
-    "Sparkey Or Sparkle",
-    "Sparkle",
-    "Sparkles",
-    "Sparklett",
-    "Sparkplug",
-    "Sparks",
-    "Sparky",
-    "Sparrow",
-    "Spartacus",
-    "Sparti",
-    "Spatches",
-    "Spats",
-    "Spatz",
-    "Spaz",
-    "Spazmo",
-    "Spazz",
-    "Spazzster",
-    "Spazzy",
-    "Speagle",
-    "Special",
-    "Special K (Special Kat)",
-    "Special Kay",
-    "Speck",
-    "Speckie",
-    "Speckle Butt",
-    "Speckles",
-    "Specks",
-    "Specs",
-    "Specter",
-    "Spectra",
-    "Sped (Special Ed)",
-    "Speed",
-    "Speed Bump",
-    "Speedie",
-    "Speedy",
-    "Speedy Gonzales",
-    "Speedy Gonzalez",
-    "Spellbinder",
-    "Spencer",
-    "Spencer The Power Meower",
-    "Spenser",
-    "Sphinx",
-    "Spiccoli",
-    "Spice",
-    "Spice 'O Life",
-    "Spice Girl",
-    "Spice Kitty",
-    "Spicecake",
-    "Spicelab",
-    "Spicy",
-    "Spider",
-    "Spider Kitty",
-    "Spiderman",
-    "Spidey",
-    "Spiff",
-    "Spiffy",
-    "Spiggy (One of Gods cats)",
-    "Spigot",
-    "Spike",
-    "Spikey",
-    "Spinach",
-    "Spincter Boy",
-    "Spinet",
-    "Spinner",
-    "Spinoza",
-    "Spirit",
-    "Spitfire",
-    "Spitha (Greek for \\",
-    "Spitsey",
-    "Spitz (from the video game \\",
-    "Splash",
-    "Splasher",
-    "Splat",
-    "Splat (reference to the Unix * symbol)",
-    "Spliff",
-    "Splinter",
-    "Splish (and Splash)",
-    "Splodge",
-    "Splotch",
-    "Splotches",
-    "Spluge",
-    "Spock",
-    "Spokane",
-    "Sponge Bob Square Pants",
-    "Spongebob",
-    "Spoofy",
-    "Spooge",
-    "Spook",
-    "Spookers",
-    "Spookey",
-    "Spookie",
-    "Spookins",
-    "Spookster",
-    "Spookums",
-    "Spooky",
-    "Sport",
-    "Sporty",
-    "Spot",
-    "Spot (after Data's cat on \\",
-    "Spotta",
-    "Spotty",
-    "Spotzilla",
-    "Spreana",
-    "Spreckels",
-    "Spreckles",
-    "Spring",
-    "Springer",
-    "Sprinkale",
-    "Sprinkales",
-    "Sprinkles",
-    "Sprite",
-    "Spritzer",
-    "Sprocket",
-    "Sprout",
-    "Spud",
-    "Spudnik (like Spud, but with a \\",
-    "Spuds",
-    "Spudster",
-    "Spumanti",
-    "Spumoni",
-    "Spunkey",
-    "Spunki",
-    "Spunki Munki",
-    "Spunkie",
-    "Spunkie Girl",
-    "Spunky",
-    "Spur",
-    "Sputnik",
-    "Sputz",
-    "Sputza",
-    "Sputza Kitty",
-    "Spy",
-    "Spy Kitty",
-    "Spyder",
-    "Spyro",
-    "Squat",
-    "Squeak",
-    "Squeakbox",
-    "Squeaker",
-    "Squeaker Doodle",
-    "Squeakers",
-    "Squeakie",
-    "Squeaks of the Long Whiskers",
-    "Squeaky",
-    "Squeaky Cat",
-    "Squeaky LaRue",
-    "Squeek",
-    "Squeekie",
-    "Squeeks",
-    "Squeeky",
-    "Squeeler",
-    "Squeezebox",
-    "Squeezy",
-    "Squib",
-    "Squibbly",
-    "Squibbly Wibbly",
-    "Squid",
-    "Squidge",
-    "Squidward",
-    "Squierl Meat",
-    "Squiffel",
-    "Squiggy",
-    "Squinklemeyer",
-    "Squinklemeyer Jones",
-    "Squinky",
-    "Squir-Cat",
-    "Squirm",
-    "Squirrel",
-    "Squirt",
-    "Squirt Kitty",
-    "Squirts",
-    "Squishy",
-    "Squit",
-    "Sqwert",
-    "Srinath",
-    "St. Nicholas",
-    "Stacey",
-    "Stache",
-    "Stackhouse",
-    "Stacy",
-    "Stage",
-    "Stage One",
-    "Stain",
-    "Stalin",
-    "Stallone",
-    "Stalone",
-    "Stan",
-    "Stan (after the South Park character Stan Marsh)",
-    "Stanislav",
-    "Stanley",
-    "Stanley Mitchell",
-    "Stanley Tiggeywinkles",
-    "Star",
-    "Star Wars",
-    "Starball",
-    "Starbuck",
-    "Starburst",
-    "Stardust Or Starlight",
-    "Stargazer",
-    "Stark",
-    "Starkey",
-    "Starla",
-    "Starlet",
-    "Starlight",
-    "Starr",
-    "Starr-O'-The-West",
-    "Starry",
-    "Starry Eyes",
-    "Stars (and Stripes)",
-    "Starsky",
-    "Starstruck",
-    "Stash",
-    "Stasha",
-    "Static",
-    "Stauby",
-    "Stavanger",
-    "Stay Put White Kitty",
-    "Stealth",
-    "Steamer",
-    "Steave",
-    "Stefanny",
-    "Stefany",
-    "Stefean",
-    "Steinbeck",
-    "Steinway",
-    "Stella",
-    "Stellar",
-    "Stenchman",
-    "Stennis",
-    "Stephanie",
-    "Stephen",
-    "Sterling",
-    "Sterling Price (after the cat in John Wayne's movie \\",
-    "Sterling Silver",
-    "Stetson",
-    "Steve",
-    "Steve \\",
-    "Steve O",
-    "Steven",
-    "Stevenstien",
-    "Steverino",
-    "Stevers",
-    "Steverspoo",
-    "Stevester",
-    "Stevie",
-    "Stevie Ray",
-    "Stevie Ray Vaughn",
-    "Stevie Van",
-    "Stevie Wonder",
-    "Stevie Wondercat",
-    "Steviekins",
-    "Stew",
-    "Stich",
-    "Stick",
-    "Sticky",
-    "Stiffy",
-    "Stig (after the racing driver in the Top Gear tv show)",
-    "Stigr",
-    "Stillwell",
-    "Stiltcat",
-    "Stimpson J. Cat",
-    "Stimpy",
-    "Sting",
-    "Stingray",
-    "Stink",
-    "Stinker",
-    "Stinker Or Stinker Belle",
-    "Stinker Pinker",
-    "Stinkey Pukey",
-    "Stinktapoo",
-    "Stinkus Bodinkus",
-    "Stinky",
-    "Stinky-Butt Girl",
-    "Stinkybutt",
-    "Stippy",
-    "Stir Fry",
-    "Stirling Mossacino The First",
-    "Stitch",
-    "Stitch (after the character in the Lilo And Stitch cartoon)",
-    "Stitchery",
-    "Stitches",
-    "Stolen",
-    "Stoli",
-    "Stoltzpus (from the Pennsylvania Dutch name \\",
-    "Stoner",
-    "Stonewall",
-    "Stoney",
-    "Stoodle-Ann",
-    "Stop That!",
-    "Stop-That-You-Little-Bastard",
-    "Stopper",
-    "Storm",
-    "Storm Cloud",
-    "Storm Or Stormy",
-    "Storm Shadow",
-    "Storm`ee",
-    "Stormdragon",
-    "Stormie",
-    "Stormy",
-    "Stormy Belker",
-    "Stormy Gail",
-    "Stormy Teide",
-    "Stout",
-    "Stowaway",
-    "Stranger",
-    "Stranger Danger",
-    "Stranger Ranger",
-    "Stranger Than Most",
-    "Stratford",
-    "Strawberry",
-    "Stray",
-    "Streaker",
-    "Street Walker",
-    "Strega",
-    "Strepe",
-    "Strepe (Afrikaans for \\",
-    "Stress",
-    "Stress Reliever",
-    "Stretch",
-    "Stribe",
-    "Strider",
-    "Strike",
-    "Striker",
-    "String",
-    "Stripe",
-    "Striper",
-    "Stripes",
-    "Stripey",
-    "Stripey Lady",
-    "Stripeypants",
-    "Stripington",
-    "Stroker (brother of McGurk - named after a '50s hot rod magazine cartoon)",
-    "Stroodles",
-    "Strudel",
-    "Strutter",
-    "Stryper (named after the Christian rock group)",
-    "Stuart",
-    "Stuart Chester",
-    "Stuart Chesters",
-    "Stuart Little",
-    "Stubb",
-    "Stubbles",
-    "Stubborn",
-    "Stubbs",
-    "Stubby",
-    "Stubman",
-    "Stud",
-    "Studebaker",
-    "Studley",
-    "Studley J. Schackleford",
-    "Studmuffin",
-    "Stump",
-    "Stumpy",
-    "Stumpy Joe",
-    "Stupid",
-    "Stupid Cat",
-    "Stupid Kat",
-    "Stymie",
-    "Styx (from Greek mythology, the river that formed the boundary between earth and the underworld)",
-    "Sublime",
-    "Succotash",
-    "Sucky",
-    "SuddenLee",
-    "Sudi (Egyptian for \\",
-    "Sue",
-    "Sue Ellen Mewing",
-    "Suede",
-    "Sugar",
-    "Sugar And Spice",
-    "Sugar Bear",
-    "Sugar Magnolia",
-    "Sugar Ray",
-    "Sugar'n Spice",
-    "Sugar-Plum",
-    "Sugarbabe",
-    "Sugarbaby",
-    "Sugarbaker",
-    "Sugarbear",
-    "Sugarbob Funkybunch",
-    "Sugarfoot",
-    "Sugarlumpskittyjr",
-    "Sugarpine",
-    "Sugarplum",
-    "Sugarpuss",
-    "Sugie",
-    "Sugie Bear",
-    "Sugus",
-    "Suibne",
-    "Suitcase",
-    "Suk",
-    "Sukanta",
-    "Sukhothai (Thai for \\",
-    "Suki",
-    "Suki Aki",
-    "Sukiyaki",
-    "Sula (Eskimo for \\",
-    "Sulayman",
-    "Sulfur",
-    "Sullivan",
-    "Sully",
-    "Sultan",
-    "Sultana",
-    "Sulu",
-    "Sumatra",
-    "Sumi",
-    "Summer",
-    "Summer Cherry",
-    "Summer Lovin",
-    "Summer Sol",
-    "Sumo",
-    "Sun",
-    "Sun Ra",
-    "Sun Tzu Liao Klein",
-    "Sun-King",
-    "Sun-Knife",
-    "Sunball",
-    "Sundae",
-    "Sundance",
-    "Sundance Kit",
-    "Sundance Sunny Delight",
-    "Sunday",
-    "Sundown",
-    "Sunflower",
-    "Suni",
-    "Sunkiss",
-    "Sunkist",
-    "Sunni",
-    "Sunnie",
-    "Sunny",
-    "Sunnyboy",
-    "Sunnybrook",
-    "Sunrise",
-    "Sunset",
-    "Sunset Adria",
-    "Sunshine",
-    "Sunshine Kitty",
-    "Super",
-    "Super French",
-    "Super Kitty",
-    "Supercalafragelistic",
-    "Supercat",
-    "SuperGirl",
-    "Superpuss",
-    "Supertramp",
-    "Surinai",
-    "Surplus",
-    "Survivor",
-    "Susan",
-    "Susanna",
-    "Sushi",
-    "Susi",
-    "Susie",
-    "Susie Creamcheese",
-    "Susie Sex Change",
-    "Suske",
-    "Suss",
-    "Sussudio",
-    "Sussuro (Spanisch for \\",
-    "Sussy",
-    "Susu",
-    "Susu (Malay for \\",
-    "Suzanka",
-    "Suze",
-    "Suzette",
-    "Suzi",
-    "Suzie",
-    "Suzie Sweetheart",
-    "Suzie-poo",
-    "Suzy",
-    "Suzy Q",
-    "SV",
-    "Svede",
-    "Svedish",
-    "Sven",
-    "Svenn",
-    "Sveta",
-    "Svetlana",
-    "Swami",
-    "Swampy",
-    "Swan",
-    "Swayze",
-    "Sweathog",
-    "Swede",
-    "Swedish",
-    "Swedish Par-Toodles",
-    "Swedish Pie",
-    "Swedish Pie Tart",
-    "Swee-Pea",
-    "Swee-Pee",
-    "Swee-Swee",
-    "Sweeny",
-    "Sweep",
-    "Sweet",
-    "Sweet Annie",
-    "Sweet Baby Kitty",
-    "Sweet Cheeks",
-    "Sweet Feet",
-    "Sweet Fluffums",
-    "Sweet Girl",
-    "Sweet Ness",
-    "Sweet Pea",
-    "Sweet Pee",
-    "Sweet Tart",
-    "Sweet Will",
-    "Sweetcakes",
-    "SweetFeet",
-    "Sweetheart",
-    "Sweetie",
-    "Sweetie Bear",
-    "Sweetie Kitty",
-    "Sweetie Pie",
-    "Sweetie-Cakes",
-    "Sweetie-Heart",
-    "Sweetiekins",
-    "Sweetikins",
-    "Sweeting",
-    "Sweetness",
-    "Sweetpea",
-    "Sweets",
-    "Sweetums",
-    "Swimmer Girl",
-    "Swiper",
-    "Swiss",
-    "Swizzle",
-    "Swizzle Stix",
-    "Swoozie",
-    "Sy",
-    "Sybil",
-    "Sycko",
-    "Sydney",
-    "Sydni",
-    "Syiah",
-    "Syian",
-    "Sylmony",
-    "Sylvester",
-    "Sylvester Francis",
-    "Sylvia",
-    "Sylvie",
-    "Sylvin",
-    "Syma",
-    "Symba",
-    "Symeon",
-    "Symon",
-    "Sympathy",
-    "Symphony",
-    "Synda",
-    "Syndey Renee",
-    "Syndi",
-    "Syndrome (after the character in the movie \\",
-    "Synergy",
-    "Syntax",
-    "Syracuse",
-    "T'pring",
-    "T-Bone",
-    "T-Cat",
-    "T-Nook",
-    "T-Rex",
-    "T-Tri (Tabby-three)",
-    "T. (Tia)",
-    "T.C. (Tazzy Cat)",
-    "T.C. (The Cat)",
-    "T.C. (Toe Cheese)",
-    "T.C. (Top Cat",
-    "T.C. (Top Cat)",
-    "T.C. (Totally Confused)",
-    "T.C. (Tough Cat)",
-    "T.D. (Touchdown)",
-    "T.D.C. (That Damn Cat)",
-    "T.G.O. (The Gray One)",
-    "T.J. (Thomas Jefferson)",
-    "T.J. (Titus Jr.)",
-    "T.J. (Tommy Jo)",
-    "T.K.",
-    "T.L.C.",
-    "T.M. (Tex Mex)",
-    "T.M. (Thomas Magnum)",
-    "T.N.T.",
-    "T.O.E.F.L. (Test Of English as a Foreign Language)",
-    "T.P.",
-    "T.S. Ellicat",
-    "T.T.F.N. (Ta Ta For Now)",
-    "Tab",
-    "Tabakitty",
-    "Tabarra",
-    "Tabasco",
-    "Tabatha",
-    "Tabaturd",
-    "Tabba To",
-    "Tabbella",
-    "Tabby",
-    "Tabby Too",
-    "Tabby-Bo",
-    "TaBet",
-    "Tabether",
-    "Tabian",
-    "Tabioca",
-    "Tabitha",
-    "Tabitha Belle",
-    "Tabitha Marie",
-    "Tabitha the Wonder Mutt",
-    "Tabitha Tick",
-    "Taboo",
-    "Tabriz",
-    "Tabu",
-    "Tac",
-    "Tacky",
-    "Taco",
-    "Taco Bill",
-    "Tacos",
-    "Tacytusa",
-    "Tad",
-    "Tadd",
-    "Tadley",
-    "Tadpole",
-    "Tadzio",
-    "Taeki",
-    "Taffata (aka Taffy)",
-    "Taffee",
-    "Taffi",
-    "Taffy",
-    "Tag",
-    "Tagger",
-    "Taglifero",
-    "Tags",
-    "Tahiti",
-    "Tahj",
-    "Tahja",
-    "Tahoe",
-    "Tai",
-    "Tai Chi",
-    "Tail Tuck Tom",
-    "Tail-Or",
-    "Tailchaser",
-    "Tails",
-    "Tailspin",
-    "Tain",
-    "Taittinger",
-    "Taj",
-    "Taka (Native American for \\",
-    "Takeya",
-    "Taki (Japanese for \\",
-    "Takishi-do (Japanese for \\",
-    "Talahache",
-    "Talara",
-    "Talbot",
-    "Talia",
-    "Taliesin",
-    "Talisman",
-    "Talitha",
-    "Talker",
-    "Talley",
-    "Tallula",
-    "Tallyho",
-    "Talon",
-    "Talsim",
-    "Taltos",
-    "Talula",
-    "Talulah",
-    "Talyn",
-    "Tama",
-    "Tamahto",
-    "Tamara",
-    "Tamikah",
-    "Tamina",
-    "Tammy",
-    "Tamora",
-    "Tampest",
-    "Tamrou",
-    "Tamsin",
-    "TamËre",
-    "Tandy (after the brand)",
-    "Tang",
-    "Tangelo",
-    "Tangent",
-    "Tangerine",
-    "Tango",
-    "Tango Juliette (from the spelling alphabet used in aviation)",
-    "Tango Terrortoes",
-    "Tanier",
-    "Taniika",
-    "Tanimal",
-    "Tanja",
-    "Tanjia",
-    "Tank",
-    "Tanka",
-    "Tanker",
-    "Tanner",
-    "Tanquray",
-    "Tansy",
-    "Tantomile",
-    "Tantrumina",
-    "Tanuki",
-    "Tanya",
-    "Tao",
-    "Tao Jones",
-    "Taorrorist",
-    "Taos",
-    "Tapanga",
-    "Taphrina",
-    "Tapioca",
-    "Tappan",
-    "Tappers",
-    "Tappy",
-    "Tar",
-    "Tar Baby",
-    "Tar Pit",
-    "Tara",
-    "Taragon",
-    "Tarantella",
-    "Tarantula",
-    "Taras",
-    "Tarbaby",
-    "Tardus",
-    "Targa",
-    "Targea",
-    "Taro",
-    "Tarot",
-    "Tarquin",
-    "Tarr",
-    "Tarragon",
-    "Tartine",
-    "Tartuffe (a classic Moliere play)",
-    "Tarzan",
-    "Tarzan And Jane",
-    "Tasch",
-    "Tash",
-    "Tasha",
-    "Tashi",
-    "Tashiana Black Magic",
-    "Tashie",
-    "Tashka",
-    "Tasma",
-    "Tasmanian Devil",
-    "Tasmin",
-    "Tassam",
-    "Tassle",
-    "Tasslehoff",
-    "Tastrophe",
-    "Tatanya",
-    "Taterman",
-    "Tatiana",
-    "Tatonka (from movie \\",
-    "Tator Tot",
-    "Tatters",
-    "Tattersall",
-    "Tattianna",
-    "Tattletale",
-    "Tattoo",
-    "Tatty",
-    "Taty",
-    "Tatyana Meru Nikolaievitch",
-    "Taurus",
-    "Tauskey",
-    "Tavi",
-    "Tavia",
-    "Tavish MacGregor",
-    "Tavra",
-    "Tawney",
-    "Tawni",
-    "Tawnos",
-    "Tawny",
-    "Tawnymom",
-    "Taxi",
-    "Taya",
-    "Taylor",
-    "Taylor Junior",
-    "Tayna",
-    "Taz",
-    "Taz-Main",
-    "Tazer",
-    "Tazimoto",
-    "Tazmanian Devil",
-    "Tazmo",
-    "Tazriel",
-    "Tazziboo",
-    "Tazzie",
-    "Tazzie Maggo",
-    "TC",
-    "Tchibi (Japanese for \\",
-    "Tchikovsky",
-    "Te Kats",
-    "Tea Bone",
-    "Teabag",
-    "Teacup",
-    "Teak",
-    "Teaka",
-    "Teal",
-    "Teal Mocha",
-    "Tearose",
-    "Tease Or Teaser",
-    "Teaser",
-    "Teaser Omaly Confetti Magee",
-    "Teashzmo",
-    "Teasle",
-    "Teaspoon",
-    "Teazer",
-    "Tech",
-    "Tech 9",
-    "Techno",
-    "Techno-Cat",
-    "Technology",
-    "Tecky",
-    "Teddie Marie Bear",
-    "Teddy",
-    "Teddy Bear",
-    "Teddyroxben",
-    "Tedither",
-    "Tedley",
-    "Tee-nuh R. Cat",
-    "Teeko",
-    "Teeney",
-    "Teeny",
-    "Teeny-Beeny",
-    "Teeny-Weeny",
-    "Teenybaby",
-    "Teeti",
-    "Tegan",
-    "Tegan Keefer",
-    "Tegoo The Tortishell",
-    "Teka",
-    "Telewhatsis",
-    "Telhudo (Portugease for bogey, elf, elfin, hob, hobgoblin, imp, leprechaun, pixie, spirit, sprite)",
-    "Telker",
-    "Telkie",
-    "Tella",
-    "Tellenka",
-    "Telly",
-    "Telstar",
-    "Tempest",
-    "Templeton",
-    "Tempura (after the Japanese food)",
-    "Tempus",
-    "Ten Speed",
-    "Tenchi (after \\",
-    "Tenessys",
-    "Tennesee",
-    "Tennessee",
-    "Tennessee Tabby",
-    "Tennis",
-    "Tennyson",
-    "Tennyson (after Alfred Lord Tennyson, english poet 1809-1892)",
-    "Tension",
-    "Tenzing",
-    "Tenzing (after Tenzing Norgay, a Nepalese Sherpa mountaineer)",
-    "Tenzlaa",
-    "Teodolinda",
-    "Teodora",
-    "Teoyaomqui (Aztec mythology: the god of dead warriors)",
-    "Teq (short for Tequila)",
-    "Tequila",
-    "Tequila Sunrise",
-    "Tequila Willy",
-    "Tereza",
-    "Teri",
-    "Teriyaki",
-    "Terminator",
-    "Terpsicore",
-    "Terra",
-    "Terra-Cotta",
-    "Terrabyte",
-    "Terracat",
-    "Terrance",
-    "Terrible Tabby",
-    "Terror",
-    "Terry",
-    "Tess",
-    "Tessa",
-    "Tessa Kasinsky",
-    "Tessie",
-    "Tessla",
-    "Testarossa",
-    "Tetris",
-    "Teufel",
-    "Teva",
-    "Tewey",
-    "Tex",
-    "Texas",
-    "Thackeray",
-    "Thackeray Daquiri Do",
-    "Thackeray Daquiri Doc",
-    "Thackie",
-    "Thaddeus",
-    "Thadeus",
-    "Thai",
-    "Thai Ling",
-    "Thaicat",
-    "Thalia",
-    "Thangs",
-    "That Cat On Naff",
-    "Thatcher",
-    "Thayer",
-    "The Artful Dodger",
-    "The Baby",
-    "The Bear",
-    "The Beeger",
-    "The Big M",
-    "The Big Stink",
-    "The Caelin",
-    "The Calvinator",
-    "The Cat",
-    "The Cheat",
-    "The Cheezer",
-    "The Chief",
-    "The Coast-To-Coast Cat",
-    "The Cold One",
-    "The Crimson Chin",
-    "The Crisco Kid",
-    "The Drooler",
-    "The Dude",
-    "The Duke",
-    "The Duke Alexander Blue",
-    "The Emperor",
-    "The Engine Of Destruction",
-    "The Face",
-    "The Fair Gwen",
-    "The Feline Garbo",
-    "The Flirt",
-    "The Giz Word",
-    "The Gizmonster",
-    "The Godfather",
-    "The Good Cat",
-    "The Good Guy",
-    "The Gray One",
-    "The Great and Glorious Katman",
-    "The Great Catsby",
-    "The Great Pudge",
-    "The Grey Mouser",
-    "The Hobbit",
-    "The Hog",
-    "The Killer Attack Ball Of Fluff",
-    "The King",
-    "The King and I",
-    "The Kitten",
-    "The Kitty",
-    "The Lacerator",
-    "The Lion King",
-    "The Lion Queen",
-    "The Little Bastard",
-    "The Little Guy",
-    "The Little One",
-    "The Little Prince",
-    "The Lizard",
-    "The Love Pig",
-    "The Lurker At The Threshold",
-    "The Merciless",
-    "The Merlamonster",
-    "The Mighty Mouser",
-    "The Mollie",
-    "The Mouth",
-    "The Nanny",
-    "The Pet That Should Not Be",
-    "The Phantom",
-    "The Pookster",
-    "The Poop",
-    "The Red One",
-    "The Scribe",
-    "The Scud",
-    "The Shaynster",
-    "The Smooch",
-    "The Snork-Meister",
-    "The Sponge/Sponge Kitty",
-    "The Spudnick",
-    "The Squirminator",
-    "The Stealth",
-    "The Stinker",
-    "The Supervisor",
-    "The Sylvan Pan",
-    "The Terminator",
-    "The Texas Thai Tycoon",
-    "The Thing On The Doorstep",
-    "The Weller",
-    "The White Cat",
-    "The Widget",
-    "The Wildman",
-    "The Zooter",
-    "Thea",
-    "Thelma",
-    "Thelma Louise (from the movie \\",
-    "Thelonious",
-    "Theo",
-    "Theodopholous",
-    "Theodore",
-    "Theodore Locklyn Spook",
-    "Theos",
-    "Thermal",
-    "Thessaloniki",
-    "Thia",
-    "Thimble",
-    "Thing-a-ma-jig",
-    "Thingy",
-    "Thirston",
-    "Thirteen",
-    "Thisbe",
-    "Thistle",
-    "Thistle-A",
-    "Tholu",
-    "Thom Thumbs",
-    "Thomas",
-    "Thomas Mouth",
-    "Thomas O' Maley",
-    "Thomas T. Doolittle",
-    "Thomas The Tank Engine",
-    "Thomas Twelvetoes",
-    "Thomasina",
-    "Thomcat",
-    "Thompson",
-    "Thooni",
-    "Thor (Viking mythology: the ruler of the weather)",
-    "Thor-Wegian",
-    "Thoreau",
-    "Thorgal",
-    "Thorin",
-    "Thorn Or Thistle",
-    "Thorndike",
-    "Thorne",
-    "Thove",
-    "Three-eleven",
-    "Thruway",
-    "Thud",
-    "Thudpaw",
-    "ThudWink",
-    "Thug",
-    "Thumbaleena",
-    "Thumbellina",
-    "Thumbs",
-    "Thumper",
-    "Thumpurr",
-    "Thunder",
-    "Thunder Cloud",
-    "Thunder Cloud - Soft but LOUD",
-    "Thunder Paw",
-    "Thunderbolt",
-    "Thundercat",
-    "Thunderkat",
-    "Thunderkitty",
-    "Thunderpaws",
-    "Thunderthud",
-    "Thundertoes",
-    "Thurston",
-    "Thusnelda",
-    "Thuvia",
-    "Thyme",
-    "Ti Amo",
-    "Ti-Pou",
-    "Tia",
-    "Tiani",
-    "Tiara",
-    "Tibbles",
-    "Tibbs",
-    "Tibby",
-    "Tiber",
-    "Tiberius",
-    "Tibo",
-    "Tiburon (after a freeway exit in Marin County, CA)",
-    "Tic",
-    "TICA",
-    "Tick Tock",
-    "Ticker",
-    "Tickity-Boo",
-    "Tickle-Ear",
-    "Tickle-me-cat-o",
-    "Tickles",
-    "TicTac",
-    "Tid Bit",
-    "Tidbit",
-    "Tiddle Bits",
-    "Tiddles",
-    "Tiddly Wink",
-    "Tidus",
-    "Tie-Dye",
-    "Tiema",
-    "Tiephareth",
-    "Tiephareth (from the Quaballah)",
-    "Tiff",
-    "Tiffany",
-    "Tiffany Marie",
-    "Tiffer",
-    "Tiffer Doodles",
-    "Tiffi",
-    "Tiffy",
-    "Tig",
-    "Tigar",
-    "Tigaress",
-    "Tigby",
-    "Tiger",
-    "Tiger Beat",
-    "Tiger Lily",
-    "Tiger Louie",
-    "Tiger One",
-    "Tiger Pete",
-    "Tiger Shan",
-    "Tiger Teich",
-    "Tiger Three",
-    "Tiger Two",
-    "Tigerboy",
-    "Tigerkitty",
-    "Tigerlily",
-    "Tigerman",
-    "Tigerpaw",
-    "Tigersloth",
-    "Tigg R. Beast",
-    "Tigger",
-    "Tigger (from Winnie the Pooh)",
-    "Tigger Lynn",
-    "Tigger T. Leadbelly (The 'T' stands for \\",
-    "Tiggerbutt",
-    "Tiggrah, the Destroyer",
-    "Tiggy",
-    "Tigi",
-    "Tigmeister",
-    "Tigner",
-    "Tigra",
-    "Tigre",
-    "Tigress",
-    "Tigrou",
-    "Tija",
-    "Tika",
-    "Tiki",
-    "Tikka",
-    "Tikki",
-    "Tikko",
-    "Tiko",
-    "TikTok (after the character in \\",
-    "Tilda",
-    "Tilda May",
-    "Tildy",
-    "Tillich (after Paul Tillich)",
-    "Tillie",
-    "Tilly",
-    "Tillybug",
-    "Tilts",
-    "Tim",
-    "Tim-Tam (as in the chocolate biscuit)",
-    "Tim-Tim",
-    "Timba",
-    "Timber",
-    "Timbre",
-    "Timbuktu",
-    "Timers",
-    "Timex",
-    "Timid",
-    "Timmy",
-    "Timmy Tiger",
-    "Timon",
-    "Timone",
-    "Timothy",
-    "Timothy Duncan Underfoot",
-    "Timour",
-    "Timpany",
-    "Tims",
-    "Tin Tan (after the alias of Germ·n ValdÈs)",
-    "Tin-Tin",
-    "Tina",
-    "Tina Tesse",
-    "Tina-Roo",
-    "Tine",
-    "Ting",
-    "Ting A Ling",
-    "Tinghert",
-    "Tink",
-    "Tinka",
-    "Tinka Tinka",
-    "Tinkabella",
-    "Tinkas-stinkas",
-    "Tinker",
-    "Tinker Tay",
-    "Tinker Toy",
-    "Tinkerbell",
-    "Tinkerbelle",
-    "Tinkertoy",
-    "Tinkie",
-    "Tinkle",
-    "Tinkle Bell",
-    "Tinkle Tinkle",
-    "Tinky Trink",
-    "Tinman",
-    "Tinsel",
-    "Tiny",
-    "Tiny Dancer",
-    "Tiny Elvis",
-    "Tiny Teddy",
-    "Tiny the Teddy Bear",
-    "Tiny Tim",
-    "Tiny Timmy",
-    "Tiny Whiny",
-    "Tip",
-    "Tip E. Toes",
-    "Tippecanoe",
-    "Tipper",
-    "Tippi",
-    "Tippy",
-    "Tippy Canoe",
-    "Tippy Toe Chin",
-    "Tippy Toes",
-    "Tipsy",
-    "Tiptoe",
-    "Tipton",
-    "Tiramisu",
-    "Tirepump",
-    "Tiruvacakam",
-    "Tirya Clearsong",
-    "Tirzah",
-    "Tish",
-    "Tish Tash Tosh",
-    "Tisha",
-    "Tishtry",
-    "Tishy Baby",
-    "Tisi",
-    "Tisiphone",
-    "Tissot",
-    "Tissy",
-    "Titan",
-    "Titania",
-    "Titanic",
-    "Titch",
-    "Titi",
-    "Titian",
-    "Titicaca (after the lake in the Andes Mountains)",
-    "Titten",
-    "Titter",
-    "Titterbiddles",
-    "Tittle",
-    "Titty Tat",
-    "Titus",
-    "Tivaly",
-    "Tivvi",
-    "Tivvy Tumples",
-    "Tizer (after the beverage)",
-    "Tizou",
-    "Tizzie",
-    "Tizzy",
-    "Tizzy Or Tizz",
-    "Tjuth",
-    "Tlaloc (Aztec mythology: the great rain and fertility god)",
-    "Tlalocan (Aztec mythology: the paradise of Tlaloc)",
-    "Tlazolteotl (Aztec mythology: the goddess of licentiousness)",
-    "Tnooky",
-    "Toad",
-    "Toadie",
-    "Toast",
-    "Toastie",
-    "Toaty",
-    "Tobasco",
-    "Tobbi",
-    "Tobelstrom",
-    "Tobey",
-    "Tobi",
-    "Tobias",
-    "Tobie",
-    "Tobita",
-    "Tobkins",
-    "Toblerone",
-    "Tobs",
-    "Toby",
-    "Toby Juan Konobi",
-    "Toby Jyinx",
-    "Toby Keith",
-    "Toby The Tubby Tabby",
-    "Toby Tiberius Tucker Anthony Clark",
-    "Tobycat",
-    "Todd",
-    "Toddles",
-    "Todi",
-    "Todor",
-    "Toe",
-    "Toe Kitten",
-    "Toe Monster",
-    "Toe Toe",
-    "Toe Toes",
-    "Toes",
-    "Toff",
-    "Toffee",
-    "Toffy",
-    "Tofu",
-    "Tofy",
-    "Toggles",
-    "Toi",
-    "Tojo",
-    "Tokayla",
-    "Toki",
-    "Tokla",
-    "Toklat",
-    "Tokyo",
-    "Toledo",
-    "Toler",
-    "Tolstoy",
-    "Tom",
-    "Tom And Huck",
-    "Tom Cat",
-    "Tom E. Cat",
-    "Tom Jones",
-    "Tom Kaley",
-    "Tom Katz",
-    "Tom Kitten",
-    "Tom Kitty",
-    "Tom Slick",
-    "Tom Tom",
-    "Tom Tub O'Lard",
-    "Tom-Tom",
-    "Toma",
-    "Tomahawk",
-    "Tomard",
-    "Tomas",
-    "Tomasina",
-    "Tomba",
-    "Tombo",
-    "Tomboy",
-    "Tombstone",
-    "Tomcat",
-    "Tomitza",
-    "Tomkinson",
-    "Tomlinson",
-    "Tommie",
-    "Tommy",
-    "Tommy Boy",
-    "Tommy girl",
-    "Tompson",
-    "Tomtom",
-    "Tonacatecuhtli (Aztec mythology: the creator and provider of food)",
-    "Tonatiuh (Aztec mythology: a sun-god, the eagle and heavenly warrior)",
-    "Tonchi",
-    "Tonga",
-    "Toni",
-    "Tonia",
-    "Tonic",
-    "Tonk",
-    "Tonka",
-    "Tonka Toy",
-    "Tons A Fun",
-    "Tonto",
-    "Tony",
-    "Tony Fabio",
-    "Tonya",
-    "Too",
-    "Too Slim the Tail Dragger",
-    "Tooby Tooby Tooo",
-    "Tood",
-    "Toodles",
-    "Toodles MacFarland",
-    "Toodles McGrief",
-    "Toody Boots",
-    "Tooee",
-    "Tookey",
-    "Tookie",
-    "Toom",
-    "Toomey",
-    "Toompers",
-    "Toomperscoompers",
-    "Toon",
-    "Toonces",
-    "Toonces (named for Toonces the Driving Cat of Saturday Night Live fame)",
-    "Toonie",
-    "Toonies",
-    "Tooshy",
-    "Toot",
-    "Tooter",
-    "Tootie",
-    "Tootle",
-    "Toots",
-    "Tootsen",
-    "Tootsie",
-    "Top Cat",
-    "Topanga (from the sitcom \\",
-    "Topaz",
-    "Topin",
-    "Topka ot Vlas",
-    "Topo",
-    "Topo Gigio",
-    "Topper",
-    "Topsey",
-    "Topsping",
-    "Topsy",
-    "Tora (Japanese for \\",
-    "Torbie Tyler",
-    "Toreador",
-    "Tori",
-    "Tori Bell",
-    "Toric",
-    "Torie",
-    "Torino",
-    "Tornado",
-    "Toro",
-    "Torque",
-    "Tort",
-    "Tortelini",
-    "Torti",
-    "Tortia",
-    "Tortie",
-    "Tortoiseshell",
-    "Torts",
-    "Tory",
-    "Tosca",
-    "Tosco",
-    "Tosh",
-    "Tosha",
-    "Toshiba",
-    "Toshibba",
-    "Toshiya",
-    "Toska",
-    "Tossum",
-    "Toti",
-    "ToTickleYa",
-    "Toto",
-    "Totoro (after the character in the movie \\",
-    "Totot",
-    "Touche",
-    "TouchÈ",
-    "Toufon (Persian for \\",
-    "Tough Guy",
-    "Toukie",
-    "Toula (after a character in the movie My Big Fat Greek Wedding)",
-    "Toulouse",
-    "Toulouse (after a kitten in the movie Aristocats)",
-    "Tounces",
-    "Toupee",
-    "Tourmaline",
-    "Toussaint",
-    "Toutou",
-    "Tova",
-    "Towser",
-    "Toxic Kitty",
-    "Toy",
-    "Toya",
-    "Toybox",
-    "Toyger",
-    "Toyota",
-    "Tozier",
-    "Tracey",
-    "Track Rat",
-    "Tractor",
-    "Tracy",
-    "Tracy Tu-tu-wa-wa Queen of the Complex",
-    "Traffinsci",
-    "Trail Mix",
-    "Trailblazer",
-    "Trailor Trash",
-    "Trakker",
-    "Tramp",
-    "Trampuss (after Trampas in The Virginian)",
-    "Trance",
-    "Tranquility",
-    "Trap",
-    "Trapper Joe",
-    "Trapper John",
-    "Trash Cat",
-    "Traut",
-    "Traveler",
-    "Traveling Wilbury",
-    "Traviesa",
-    "Travis",
-    "Travis McGee",
-    "Tre' (as in a 3 point shot - basketball)",
-    "Treacle",
-    "Treasure",
-    "Treat",
-    "Treats",
-    "Treck",
-    "Tree",
-    "Treesweet",
-    "Trekkie",
-    "Trekky",
-    "Tremor",
-    "Trent",
-    "Trevor",
-    "Trevor Gray",
-    "Tri-isopropylbenzenesulfonyl Kitty-Cat",
-    "Tribble",
-    "Tricia",
-    "Trickster",
-    "Tricky",
-    "Tricky-Doo",
-    "Triger",
-    "Trigger",
-    "Trilogy",
-    "Trin",
-    "Trina",
-    "Trinity",
-    "Trinket",
-    "Trinky-Tink",
-    "Trip",
-    "Tripod",
-    "Tripp",
-    "Tripper",
-    "Tripsy",
-    "Tripsyl",
-    "Tris",
-    "Triscuit (brother Biscuit)",
-    "Trisha",
-    "Tristan",
-    "Tristen Farnon Campion",
-    "Tristessa",
-    "Tristin",
-    "Triton (after Neptune's moon)",
-    "Trivia",
-    "Trivit",
-    "Trix",
-    "Trixie",
-    "Trixy",
-    "Trixy Evil Pixy",
-    "Trizzia",
-    "Trogg",
-    "Troic",
-    "Trojan",
-    "Troll",
-    "Trollheimen (name of a mountain)",
-    "Tron",
-    "Trondheim",
-    "Trooper",
-    "Tropicana",
-    "Tros",
-    "Trosky",
-    "Troubadour",
-    "Trouble",
-    "Trouble Bubble",
-    "Trouper",
-    "Trout",
-    "Trout-Cat",
-    "Troy",
-    "Truckeer Star",
-    "Trucker",
-    "Trudi",
-    "Trudy",
-    "Truffaut",
-    "Truffel",
-    "Truffle",
-    "Trufflehunter",
-    "Truffles",
-    "Truman",
-    "Trump",
-    "Trumpet",
-    "Trurman",
-    "Tryst",
-    "Tsa-Tsa",
-    "Tsathagguoa",
-    "Tse-Ping",
-    "Tsif-tsif",
-    "Tsimshian",
-    "Tsuki",
-    "Tsukikage (Japanese for \\",
-    "Tsunami",
-    "Tsura",
-    "Tu",
-    "Tu-can",
-    "Tua",
-    "Tubbo",
-    "Tubbs",
-    "Tubby",
-    "Tubs",
-    "Tuchie",
-    "Tuchie Poo",
-    "Tuck",
-    "Tuck Uncommon (wordplay on Tutankhamun)",
-    "Tucker",
-    "Tucksy",
-    "Tucky",
-    "Tuco Benidito Pacifico Juan Maria Ramirez (from the movie \\",
-    "Tuddy Woody",
-    "Tudor",
-    "Tuesday",
-    "Tuesday Molly",
-    "Tuey",
-    "Tuff",
-    "Tuff Cookie",
-    "Tuff Stuff",
-    "Tuffster",
-    "Tuffy",
-    "Tuffy Cat",
-    "Tug",
-    "Tugboat",
-    "Tugger",
-    "Tuggles",
-    "Tui",
-    "Tukey",
-    "Tula",
-    "Tula Rose",
-    "Tulip",
-    "Tull",
-    "Tulose (after the character in the Disney movie \\",
-    "Tulsar",
-    "Tum",
-    "Tuma (From \\",
-    "Tumani (pronounced Too Many)",
-    "Tumblebrutus",
-    "Tumbleweed",
-    "Tummy",
-    "Tuna",
-    "Tuna Breath",
-    "Tuna Pussy",
-    "Tuna-breath",
-    "Tuna-Foot",
-    "Tundra",
-    "Tungsten",
-    "Tunuvele",
-    "Tupid",
-    "Tuppence",
-    "Tuppenny",
-    "Tuppy",
-    "Tuppyaka",
-    "Tuptin",
-    "Tura",
-    "Turandot",
-    "Turbo",
-    "Turbo 2 Toes",
-    "Turd",
-    "Turk",
-    "Turkey",
-    "Turks",
-    "Turtle",
-    "Turtle-face",
-    "Turtleneck",
-    "Turue",
-    "Tuscany (after the Italian region)",
-    "Tush",
-    "Tushii Butt",
-    "Tusker",
-    "Tusse",
-    "Tussie",
-    "Tustin",
-    "Tut",
-    "Tut (after Tutankhamun, or King Tut)",
-    "Tutti Fruitti",
-    "Tutti Frutti",
-    "Tutti-Frutti",
-    "Tuttles",
-    "Tutu",
-    "Tuula",
-    "Tuvok (after the vulcan character on the Star Trek Voyager tv series)",
-    "Tux",
-    "Tuxedo",
-    "Tuxie",
-    "Tuxt",
-    "Tweek",
-    "Tweek (after the character in the South Park cartoons)",
-    "Tweeter",
-    "Tweetie",
-    "Tweetie-Pie",
-    "Tweety",
-    "Tweety Bird",
-    "Tweezer",
-    "Twenty Two",
-    "Twerp",
-    "Twiggy",
-    "Twighlight",
-    "Twilight",
-    "Twilighteyes",
-    "Twini",
-    "Twinight (Baseball term)",
-    "Twink",
-    "Twinken (after the character in \\",
-    "Twinkie",
-    "Twinkie the Dominatrix",
-    "Twinkle",
-    "Twinkle Toes",
-    "Twinkle-Toes",
-    "Twinkleberry",
-    "Twinkles",
-    "Twinkles Betsy D.",
-    "Twinkletoes",
-    "Twinks",
-    "Twinky",
-    "Twisser",
-    "Twister",
-    "Twisty",
-    "Twit",
-    "Twitten",
-    "Twitz",
-    "Twix",
-    "Twixi",
-    "Twizzle",
-    "TwizzleSticks",
-    "Twizzy",
-    "Two",
-    "Two Tone",
-    "Two-bit",
-    "Two-Four",
-    "Two-Socks",
-    "Two-Ton",
-    "Twoface",
-    "Twotone",
-    "Twyla",
-    "Ty",
-    "Tybalt",
-    "Tyche",
-    "Tycho",
-    "Tycoon",
-    "Tye",
-    "Tyemoon",
-    "Tyg",
-    "Tygger",
-    "Tygress",
-    "Tyke",
-    "Tykkemis",
-    "Tyla",
-    "Tyler",
-    "Tyler Lee Spangler",
-    "Tyler Teich",
-    "Tyler Too",
-    "Tylis Ty Tyler",
-    "Tymoch",
-    "Typha",
-    "Typhoo",
-    "Typhoon",
-    "Tyr",
-    "Tyr (Viking mythology: the god of war)",
-    "Tyrant Tiberius Tyranasorus",
-    "Tyrone",
-    "Tyrone Cower",
-    "Tyson",
-    "Tytain",
-    "Tzitzi",
-    "Tzitzulica",
-    "Ubas",
-    "Ubas (Tagalog for \\",
-    "Uber",
-    "Ubi",
-    "Ubu",
-    "Udi",
-    "Udo",
-    "Uglier",
-    "Ugly",
-    "Ugly Cat Joe",
-    "Ugly Katie Mills",
-    "Ugly-Bugly",
-    "UH",
-    "Uhura (after the female character in Star Trek)",
-    "Uki",
-    "Ulee",
-    "Ulian",
-    "Ulla",
-    "Ultimate",
-    "Ultimate Kitty",
-    "Ultimate Warrior",
-    "Ultra",
-    "Ultra Sonic",
-    "Ultra Sound",
-    "Ultraviolet",
-    "Ulysses",
-    "Uma",
-    "Uma (after the actress Uma Thurman)",
-    "Umbra",
-    "Umgow (after the old Tarzan movie word which meant anything)",
-    "Umgowa",
-    "Umi",
-    "Umma (Turkish for \\",
-    "Umpa Lumpa",
-    "Unagi",
-    "Unbee",
-    "Unbelievable",
-    "Uncle Buster",
-    "Uncle Charles",
-    "Uncle Charles Willoughby",
-    "Uncle Charlie",
-    "Uncle Eeker",
-    "Uncle Fester",
-    "Uncle Marshmallows",
-    "Uncle Pee",
-    "Unco",
-    "Uncommon",
-    "Under My Foot",
-    "Under My Thumb",
-    "Underdog",
-    "Underfoot",
-    "Undun",
-    "Unicat",
-    "Unicorn",
-    "Unique",
-    "Unit",
-    "United Kittydom",
-    "Unity",
-    "Uno Emily",
-    "Unusual",
-    "Unusual Suspect",
-    "Unzen",
-    "Unzen (after the vulcano in Japan)",
-    "Upside Down Kitty",
-    "Upton",
-    "Uranium",
-    "Uranus",
-    "Urban",
-    "Urchin",
-    "Urgent",
-    "Uriah",
-    "Urrp (Purr inside-out, or for audiophiles, it's an out of phase purr)",
-    "Ursa",
-    "Ursa Major",
-    "Ursa Minor",
-    "Ursula",
-    "Urza",
-    "Useless",
-    "Usher",
-    "Ushki",
-    "Ushki (Russian for \\",
-    "Usual",
-    "Usual Suspect",
-    "Usually",
-    "Usul",
-    "Uther",
-    "Utopia",
-    "Uwe",
-    "Uzee",
-    "Uzi",
-    "Uzo",
-    "Vaca",
-    "Vader",
-    "Vadim",
-    "Vagabond",
-    "Vagrant",
-    "Vail",
-    "Valandil",
-    "Valen",
-    "Valentina",
-    "Valentine",
-    "Valentino",
-    "Valerie",
-    "Valeriy",
-    "Valikee Caut",
-    "Valium",
-    "Valium Cat",
-    "Valja",
-    "Valkyrie",
-    "Valleygirl",
-    "Vally",
-    "Valmont",
-    "Valume",
-    "Vamp",
-    "Vampira",
-    "Van",
-    "Van Gogh",
-    "Van Morrison",
-    "Van-Damme",
-    "Vanadis (Old Norwegian for \\",
-    "Vance",
-    "Vanda (Swedish for \\",
-    "Vandal",
-    "Vandergraff",
-    "Vanderputten",
-    "Vandy",
-    "Vanessa",
-    "Vanessa Redpaws",
-    "Vanilla",
-    "Vanilla Ice",
-    "Vanille",
-    "Vanish",
-    "Vanity",
-    "Vanity Fair",
-    "Vann",
-    "Vanna",
-    "Vanna White",
-    "Vannili",
-    "Vanpaws",
-    "Vanya",
-    "Vaquero",
-    "Vargas",
-    "Vaseline",
-    "Vash",
-    "Vashka",
-    "Vashti",
-    "Vasia",
-    "Vasilissa",
-    "Vasiliy",
-    "Vasja",
-    "Vassar",
-    "Vatch",
-    "Vaughn",
-    "Vector",
-    "Veda",
-    "Vedra",
-    "Veenee",
-    "Veera",
-    "Veevee",
-    "Vega",
-    "Vegas",
-    "Veggie",
-    "Vegimite",
-    "Velcra",
-    "Velcro",
-    "Velcro Kitty",
-    "Velma",
-    "Velociroxy",
-    "Velocity",
-    "Velvet",
-    "Velvet Bunny Paws",
-    "Velvet Ears",
-    "Velvet Jones",
-    "Velvet Kitty",
-    "Velvet Paws",
-    "Venezia",
-    "Venom",
-    "Venus",
-    "Venus And Mars",
-    "Venus De Milo",
-    "Vera",
-    "Verdi",
-    "Vermin",
-    "Verminette",
-    "Vermont",
-    "Vern",
-    "Vernon",
-    "Verona",
-    "Veronica",
-    "Veronika",
-    "Vertigo",
-    "Veruca Salt (named for the spoiled girl in Willy Wonka)",
-    "Verushka",
-    "Vesper",
-    "Vespucci",
-    "Vezyah",
-    "Vi",
-    "Viagra",
-    "Vibrissa Whiskers",
-    "Vic",
-    "Vichyssoise",
-    "Vicious",
-    "Vicky",
-    "Victor",
-    "Victor Victoria",
-    "Victoria",
-    "VicuÒa (after the animal from the camel family)",
-    "Vida",
-    "Videlle",
-    "Viencke",
-    "Vienna (after the cat in a British tv comedy called \\",
-    "Viking Princess",
-    "Vikki",
-    "Viktor",
-    "Vilatika",
-    "Vimbo",
-    "Vince",
-    "Vincent",
-    "Vincent Chase",
-    "Vincent Price",
-    "Vincent Van Gogh",
-    "Vincent Van Gray",
-    "Vincent Vega",
-    "Vincenzo Arturo Guiseppe",
-    "Vinegar",
-    "Vinnie",
-    "Vinnie-my-boy",
-    "Vinny",
-    "Viola",
-    "Violet",
-    "Violet Violent",
-    "Viper",
-    "Vipurr",
-    "Virgil",
-    "Virginia Mew",
-    "Virgule",
-    "Virtual Kitty",
-    "Vis'Kag The Bloodletter",
-    "Visa",
-    "Vito",
-    "Vito Corleone",
-    "Vittles",
-    "Viva",
-    "Vivaldi",
-    "Vivi",
-    "Vivia",
-    "Vivian",
-    "Vivian.",
-    "Vivica",
-    "Vix",
-    "Vixen",
-    "Vixie",
-    "Vizzy",
-    "Vlad (after Vlad the Impaler)",
-    "Vlad the Impaler",
-    "Vladimir",
-    "Vladimir Ramses Pani",
-    "Vladimir the Impaler Fearless Mau",
-    "Vladimire",
-    "Vladir",
-    "Vladko the Warlord",
-    "Vodka",
-    "Voltaire",
-    "Voltron",
-    "Volvo",
-    "Voodoo",
-    "Voodoo Magic",
-    "Vork",
-    "Vorpal Kitty",
-    "Vortigern",
-    "Vouvray",
-    "Voyager",
-    "Vroom Vroom",
-    "Vulcan",
-    "W.T. (Weird Thing)",
-    "Wabash Cannonball",
-    "Wabash Cuddlewumps",
-    "Wabash Kissywumps",
-    "Wabba",
-    "Wabbit",
-    "Wabbly",
-    "Wackey Cat",
-    "Wacky",
-    "Wackywoo",
-    "Waddles",
-    "Wade",
-    "Wadsworth (after Henry Wadsworth Longfellow, american poet)",
-    "Wadworth (after the brewery in Devizes, Wiltshire, England)",
-    "Waffle",
-    "Waffles",
-    "Wag",
-    "Wag-A-Lot",
-    "Waggie",
-    "Waggler",
-    "Waggles",
-    "Wagner",
-    "Wags",
-    "Wagter",
-    "Wahboo",
-    "Wahine (Hawaiian for \\",
-    "Waifer",
-    "Wainwright",
-    "Wait-a-Minute",
-    "Walden",
-    "Waldo",
-    "Waldo KITTY",
-    "Wales",
-    "Walker",
-    "Walker Texas Ranger",
-    "Wallace",
-    "Wallflower",
-    "Wallie",
-    "Wallis",
-    "Walllie Miranda",
-    "Wally",
-    "Walnut",
-    "Walrus",
-    "Walt",
-    "Walter",
-    "Walter Croncat",
-    "Waltermitty",
-    "Walton",
-    "Waluigi",
-    "Wampie",
-    "Wanda",
-    "Wanna-be",
-    "Wannenay",
-    "Warhol",
-    "Warlock",
-    "Warmlet",
-    "Warren",
-    "Warrior",
-    "Wart",
-    "Warthog",
-    "Warui (Japanese for \\",
-    "Wasabe",
-    "Wasabi",
-    "Washington",
-    "Waterpaw",
-    "Watkins",
-    "Watney (after \\",
-    "Watson",
-    "Watson.",
-    "Watti",
-    "Wavence",
-    "Waverly",
-    "Wayne",
-    "Wayne And Garth",
-    "Wayne Gretsky",
-    "Weasel",
-    "Weasel Kitty",
-    "Weasler",
-    "Web",
-    "Webb",
-    "Webis",
-    "Webster",
-    "Weckle",
-    "Wedgewood",
-    "Wedggie",
-    "Wednesday",
-    "Wee Willy Wonka",
-    "Wee-Wee",
-    "Weebee",
-    "Weeble (after the toy \\",
-    "Weed",
-    "Weedy Bit",
-    "Weenie",
-    "Weenie Eenie",
-    "Weeone",
-    "Weeoo",
-    "Weetabix",
-    "Weeza",
-    "Weezie",
-    "Weird Al (after Weird Al Yankovich)",
-    "Welby",
-    "Wella",
-    "Wellington",
-    "Wellington Boots",
-    "Welly",
-    "Welly-Baby",
-    "Wembley",
-    "Wench",
-    "Wendel",
-    "Wendell",
-    "Wendy",
-    "Wendy Whiner",
-    "Weowek",
-    "Werder",
-    "Werewolf",
-    "Werido",
-    "Werner",
-    "Werner Kitten",
-    "Werner Von Brown",
-    "Wesley",
-    "Westbrook",
-    "Westie",
-    "Westmont",
-    "Weston",
-    "Westwood",
-    "Wezie",
-    "Whack",
-    "Whacky",
-    "Whale",
-    "Whale-Foot",
-    "What-a-mess",
-    "Whatchamacallit",
-    "Whatever",
-    "Whats-you-ma-call-it",
-    "Wheaties",
-    "Wheaton Mephistopheles",
-    "Wheelock",
-    "Wheezer",
-    "Whimsey",
-    "Whiner",
-    "Whinny",
-    "Whiny Boy",
-    "Whiny Cat",
-    "Whipiinn Creme",
-    "Whirlwind",
-    "Whiskee",
-    "Whiskers",
-    "Whiskey",
-    "Whisky",
-    "Whisper",
-    "Whisper Or Whisperwind",
-    "Whispurr",
-    "Whistle",
-    "Whistler",
-    "Whit",
-    "White",
-    "White Cat",
-    "White Face",
-    "White Foot",
-    "White Little Princess",
-    "White Mittens",
-    "White Moustache",
-    "White Nettik",
-    "White One",
-    "White Paws",
-    "White Satin",
-    "White Shadow",
-    "White Spot",
-    "White Thing",
-    "White Tiger",
-    "White Witch",
-    "White-white",
-    "Whiteboy",
-    "Whitefoot",
-    "Whitenose",
-    "Whiteshoes",
-    "Whitey",
-    "Whitman",
-    "Whitney",
-    "Whittaker",
-    "Whittakers",
-    "Whizzbang Kattwinkel",
-    "Whizzer",
-    "Whoopi",
-    "Whoopie",
-    "Whoopie Goldpaws",
-    "Whoopie Goldpurrs",
-    "Whoopie Goldtoes",
-    "Whoosey",
-    "Whooss",
-    "Why Not",
-    "Whyville",
-    "Wicca",
-    "Wichapi",
-    "Wicked",
-    "Wickedness",
-    "Wicker",
-    "Wicket",
-    "Wide Load",
-    "Widget",
-    "Wieners",
-    "Wiff",
-    "Wiff n Poof",
-    "Wiggins",
-    "Wiggles",
-    "Wiggly",
-    "Wiggy",
-    "Wiglaf",
-    "Wilbur",
-    "Wild",
-    "Wild Bill",
-    "Wild Child",
-    "Wild Kat",
-    "Wild Thing",
-    "Wilder",
-    "Wilderness",
-    "Wildthing",
-    "Wildwood",
-    "Wiley",
-    "Wilfred",
-    "Wilhelmina",
-    "Wiliam Andrew Katz",
-    "Wilkerson",
-    "Wilkie",
-    "Wilkie Poo",
-    "Willa",
-    "Willa Catter",
-    "Willafurs",
-    "Willameena",
-    "Willamina",
-    "Willard",
-    "Willey",
-    "William",
-    "William T",
-    "William The Conqueror",
-    "William Thor",
-    "Willie",
-    "Willie Wonka",
-    "Willis",
-    "Willoughby",
-    "Willow",
-    "Wills",
-    "Willum",
-    "Willy",
-    "Willy for short",
-    "Willy G",
-    "Willy Whiskers",
-    "Willy Wonka",
-    "Wilma and Betty",
-    "Wilmer",
-    "Wilmington",
-    "Wilson",
-    "Wilton",
-    "Wim",
-    "Wimba",
-    "Wimbleton",
-    "Wimpy",
-    "Win-Dixie",
-    "Winchester",
-    "Winder",
-    "Windex",
-    "Windham",
-    "Windjammer",
-    "Windsor",
-    "Windy",
-    "Winfield",
-    "Wing Nut",
-    "Wings",
-    "Wingy",
-    "Wink",
-    "Winken",
-    "Winkie",
-    "Winkle",
-    "Winkler",
-    "Winklynymph",
-    "Winkster",
-    "Winky",
-    "Winnetoe",
-    "Winnie",
-    "Winnie Pooh",
-    "Winnie The Pooh",
-    "Winny",
-    "Wino (official mascot of a Napa Valley winery)",
-    "Winsdor",
-    "Winsdor Ketsl",
-    "Winslow",
-    "Winsome",
-    "Winston",
-    "Winston Churchcat",
-    "Winston O Boogie",
-    "Winter",
-    "Wintermute (named after William Gibson's AI in \\",
-    "Winthrop",
-    "Wiseguy",
-    "Wishbone",
-    "Wiskers",
-    "Wister (after the wood-climbing vines Wisteria)",
-    "Wistful",
-    "Wistful Diffidence",
-    "Witch",
-    "Witchy-poo",
-    "Witty Kitty",
-    "Witvoet (Dutch for \\",
-    "Wixie",
-    "Wiz",
-    "Wizard",
-    "Wizkid",
-    "Wizz",
-    "Woden",
-    "Wolf",
-    "Wolfcat Jack",
-    "Wolfer",
-    "Wolfgang",
-    "Wolfie",
-    "Womble",
-    "Wonder Kitty",
-    "Wong Mau",
-    "Wonka",
-    "Wonkity",
-    "Wonton",
-    "Woo Kitty",
-    "Woobie",
-    "Woodpile Karin",
-    "Woodruff (after the herb)",
-    "Woodstock",
-    "Woodwind",
-    "Woody",
-    "Woof",
-    "Woofie",
-    "Woofy",
-    "Woogie",
-    "Woogiemiester",
-    "Woogies",
-    "Woois",
-    "Wookie",
-    "Wooley",
-    "Wooley Wooten",
-    "Woolly Bear",
-    "Woolly Mammoth",
-    "Wooly",
-    "Wooly Bully",
-    "Wooly Mammoth",
-    "Woony Woo",
-    "Woopit",
-    "Wooshie",
-    "Wooster (as in sauce)",
-    "Woosy",
-    "WooWoo",
-    "Wordsworth",
-    "Worf",
-    "Worm",
-    "Wort (after the character in Disney's \\",
-    "Worthless Ball of Fur",
-    "Wotan",
-    "Wrangler",
-    "Wren",
-    "Wriggle",
-    "Wriglett",
-    "Wrigley",
-    "Wrinkles",
-    "Wryly",
-    "Wumps",
-    "Wunderdog",
-    "Wupert",
-    "Wupit",
-    "Wurb",
-    "Wuss",
-    "Wuzei",
-    "Wuzzie",
-    "Wuzzle",
-    "Wuzzley",
-    "Wuzzums",
-    "Wyatt (English name meaning \\",
-    "Wycliffe",
-    "Wyla",
-    "Wylie",
-    "Wylie Post",
-    "Wynken",
-    "Wynston",
-    "Wynton",
-    "Wysiwyg",
-    "X Marks the Spots",
-    "X-actly",
-    "X-cess",
-    "X-Files",
-    "X-Ie-Poo",
-    "X-Lax",
-    "X-Man",
-    "X-Quisit",
-    "X-Rated",
-    "X-Ray",
-    "Xabi Alonso (after the footballer Xabier Alonso Olano)",
-    "Xabier",
-    "Xaliah",
-    "Xanadu",
-    "Xander",
-    "Xanthus",
-    "Xanthus (Achille's horse)",
-    "Xany",
-    "Xaram",
-    "Xarello",
-    "Xavier",
-    "Xcell",
-    "Xena",
-    "Xena And Gabrielle",
-    "Xena, Warrior Princess",
-    "Xenia",
-    "Xenophon",
-    "Xerxes",
-    "Xi'An",
-    "Xia",
-    "Xiao Meow (Xiao is Chinese for \\",
-    "Xilonen (Aztec mythology: the goddess of young maize)",
-    "Xina",
-    "Xio Ling",
-    "Xipe Totec (Aztec mythology: the god of seedtime)",
-    "Xit",
-    "Xmas",
-    "Xnlt Kittycat",
-    "Xo",
-    "Xochi",
-    "Xochipilli (Aztec mythology: the god of feasting and young maize)",
-    "XS",
-    "Xtra",
-    "Xtra Fun",
-    "Xury",
-    "Xuxa",
-    "Xuxa la Gata",
-    "Xylon",
-    "Xylophone",
-    "Xzana (pronounced Zana)",
-    "Yabba-Dabba-Doo",
-    "Yabby (after the South Eastern Australia small freshwater crayfish)",
-    "Yacatecuhtli (Aztec mythology: the god of merchant adventurers)",
-    "Yacov (Hebrew form of the name \\",
-    "Yago",
-    "Yahoo",
-    "Yak",
-    "Yaki Mondu",
-    "Yala",
-    "Yam",
-    "Yamasee",
-    "Yancy",
-    "Yanet",
-    "Yang",
-    "Yankee",
-    "Yar",
-    "Yardley",
-    "Yasha",
-    "Yashi (short for Kobiyashi Maru, Starfleet academy test that Kirk \\",
-    "Yashie",
-    "Yasmine",
-    "Yawgmoth",
-    "Yawhmoth",
-    "Yawney",
-    "Yaxche (Maya mythology: the tree of heaven under which good souls rejoice)",
-    "Yaya",
-    "Yeager",
-    "Yedi",
-    "Yeep",
-    "Yeller Yang",
-    "Yellow",
-    "Yellow Cat",
-    "Yellow Man",
-    "Yellow Mellow",
-    "Yellppy",
-    "Yeltsin",
-    "Yemma",
-    "Yemma-Lee",
-    "Yenta",
-    "Yenta Banana",
-    "Yentyl",
-    "Yeow",
-    "Yes",
-    "Yessir",
-    "Yessirree",
-    "Yeti",
-    "Yicks",
-    "Yicky Sticky Chicky",
-    "Yin",
-    "Yin Mae (beautiful female)",
-    "Yin-Yang",
-    "Ying",
-    "Yip",
-    "Yipes Stripes",
-    "Yippee",
-    "Yitzak",
-    "Ymie",
-    "Ymilie",
-    "Yo Yo",
-    "Yo-Yo",
-    "Yoda",
-    "Yodel",
-    "Yodelaheehoo",
-    "Yodeller",
-    "Yodi",
-    "Yodler",
-    "Yogi",
-    "Yogi Bear",
-    "Yogso'Thoth",
-    "Yogurt",
-    "Yokia",
-    "Yoko",
-    "Yoko Fudgeface",
-    "Yoko Oh No!",
-    "Yoko Ono",
-    "Yolanda",
-    "Yommie T. Bear",
-    "Yonori",
-    "Yoomper",
-    "Yoppie",
-    "Yorcat",
-    "Yorgy",
-    "York",
-    "Yosemite",
-    "Yosemite Sam",
-    "Yoshi",
-    "Yosie",
-    "You",
-    "You Go",
-    "You Rotten Feline!",
-    "You Too",
-    "Young Fella",
-    "Young Yeller",
-    "Your Cat",
-    "Your Highness",
-    "Your Hugeness",
-    "Your Immensity",
-    "Yours",
-    "Yours, Mine and Ours",
-    "Youser",
-    "Yow-sers",
-    "Yowler",
-    "Yoyo",
-    "Ysidro",
-    "Yue",
-    "Yugo",
-    "Yuki",
-    "Yukon",
-    "Yukon Cronilius",
-    "Yul",
-    "Yule",
-    "Yum Kaax (Maya mythology: the maize god)",
-    "Yuma",
-    "Yumi",
-    "Yumiee",
-    "Yummy",
-    "Yumyum",
-    "Yuppie Cat",
-    "Yuppy",
-    "Yuri (Japanese for \\",
-    "Yushamishi",
-    "Z Man",
-    "Z-Cat",
-    "Zabaglione",
-    "Zabar",
-    "Zabrina",
-    "Zabriskie",
-    "Zabu",
-    "Zac",
-    "Zach",
-    "Zacharia",
-    "Zacharius",
-    "Zachary",
-    "Zachary Binks (from the movie Hocus Pocus)",
-    "Zachary Tigger Pyat",
-    "Zachie",
-    "Zachy",
-    "Zack",
-    "Zackery",
-    "Zada-Butt",
-    "Zadi",
-    "Zadok",
-    "Zadok (after the christian high priest)",
-    "Zadok Thadeous Jaquish III",
-    "Zadora",
-    "Zafer",
-    "Zaffe",
-    "Zafyl",
-    "Zag",
-    "Zahir",
-    "Zahlman",
-    "Zahra (Persian variation of Sarah)",
-    "Zaire",
-    "Zak",
-    "Zakaiah",
-    "Zake",
-    "Zakhar",
-    "Zaki",
-    "Zalian",
-    "Zalina",
-    "Zalman",
-    "Zambanie",
-    "Zambia",
-    "Zambini",
-    "Zambinie",
-    "Zamboni",
-    "Zamiec",
-    "Zamm",
-    "Zampa",
-    "Zane",
-    "Zane Grey",
-    "Zang",
-    "Zanie",
-    "Zanuba",
-    "Zanuck",
-    "Zany",
-    "Zany Spots",
-    "Zanza",
-    "Zanzi",
-    "Zanzibar",
-    "Zap",
-    "Zapata",
-    "Zapato (Spanish for \\",
-    "Zapeli",
-    "Zaphod",
-    "Zaphod Beeblebrox (from Hitchhiker's Guide to the Galaxy)",
-    "Zappa",
-    "Zapper",
-    "Zappi",
-    "Zappy",
-    "Zaq",
-    "Zara",
-    "Zara (Arabic for \\",
-    "Zarabeth",
-    "Zarathustra",
-    "Zarenna",
-    "Zaria (City in Nigeria)",
-    "Zarina",
-    "Zarko",
-    "Zarya (Russian for \\",
-    "Zaspanec (Slovenian for \\",
-    "Zasu",
-    "Zatara",
-    "Zathras",
-    "Zathrus",
-    "Zatney",
-    "Zaun",
-    "Zaw",
-    "Zayda",
-    "Zaza (from the Bible, meaning \\",
-    "Zazi",
-    "Zazie cum Flops",
-    "Zazou",
-    "Zazu",
-    "Zazzerus",
-    "Zazzie Zoe",
-    "Zazzy",
-    "Zazzy Osborne",
-    "Zealot",
-    "Zeb",
-    "Zeba",
-    "Zebb",
-    "Zebbie",
-    "Zebeddee",
-    "Zebedeus",
-    "Zebediah",
-    "Zeberdy",
-    "Zebra",
-    "Zebu",
-    "Zed",
-    "Zee",
-    "Zeebie",
-    "Zeek",
-    "Zeema",
-    "Zeerox",
-    "Zeezee",
-    "Zeff",
-    "Zeffer",
-    "Zeffirelli",
-    "Zeit",
-    "Zeitgeist",
-    "Zeke",
-    "Zeki",
-    "Zelda",
-    "Zeldabar",
-    "Zelig",
-    "Zella",
-    "Zelle",
-    "Zelleta",
-    "Zelma",
-    "Zemwald",
-    "Zen",
-    "Zen Bagel",
-    "Zen-Tai",
-    "Zena",
-    "Zenia",
-    "Zenith",
-    "Zeno",
-    "Zenobia",
-    "Zentaur",
-    "Zenzero (Italian for \\",
-    "Zeodite",
-    "Zepellin",
-    "Zeph",
-    "Zephan",
-    "Zepher",
-    "Zephyr",
-    "Zephyrus",
-    "Zeppelin",
-    "Zeppo",
-    "Zer-Zer Kitty",
-    "Zerkle",
-    "Zero",
-    "Zero Gravity Kitty",
-    "Zesse",
-    "Zesta",
-    "Zesty",
-    "Zeta",
-    "Zethus",
-    "Zeus",
-    "Zev",
-    "Zevo",
-    "Zezalier",
-    "Zhang",
-    "Zhanna",
-    "Zhazhda (Russian for \\",
-    "Zhenja",
-    "Zhukov",
-    "Zia",
-    "Zia Marie",
-    "Ziah",
-    "Ziba",
-    "Zibou",
-    "Zica",
-    "Zico",
-    "Ziegfeld",
-    "Ziescat",
-    "Zig",
-    "Zigfried",
-    "Zigge",
-    "Zigger",
-    "Ziggy",
-    "Ziggy Ba Ba",
-    "Ziggy Stardust",
-    "Ziggy Stardust (after the album from David Bowie)",
-    "Ziggy Zops",
-    "Zigi",
-    "Zigzag",
-    "Zilch",
-    "Zilla",
-    "Zilpha Pearl Draper",
-    "Zima",
-    "Zimba",
-    "Zimbabou",
-    "Zimbabwe",
-    "Zimbalist",
-    "Zimbelstern",
-    "Zimbra",
-    "Zimmi",
-    "Zina",
-    "Zina Aberina",
-    "Zinc",
-    "Zinfandel",
-    "Zing",
-    "Zing-a-ling",
-    "Zing-a-long",
-    "Zingboom",
-    "Zinger",
-    "Zingia",
-    "Zingo",
-    "Zinko",
-    "Zinnia",
-    "Zion",
-    "Zip",
-    "Zip A Dee Doo Daa",
-    "Zip Cody",
-    "Zipcode",
-    "Zipes",
-    "Ziploc",
-    "Zipper",
-    "Zippity",
-    "Zippity Do Da",
-    "Zippo",
-    "Zippy",
-    "Zippy The Pinhead",
-    "Zippy The Wondercat",
-    "Zirconia",
-    "Zisseleh (Yiddish for \\",
-    "Zita",
-    "Zither",
-    "Zity",
-    "Ziyal",
-    "Zizi",
-    "Znoober",
-    "Zobi",
-    "Zodiac",
-    "Zody",
-    "Zoe",
-    "Zoeller",
-    "Zoesephina Yoselinda McPheonix",
-    "Zoey",
-    "Zohar",
-    "Zohara",
-    "Zoi",
-    "Zoid",
-    "Zoie",
-    "Zoisia",
-    "Zoja",
-    "Zola",
-    "Zola Budd (runner from South Africa, gold medal winner Olympic Games)",
-    "Zollymilo",
-    "Zoloft",
-    "Zoltan",
-    "Zoltar",
-    "Zoltron the Moocher",
-    "Zombie",
-    "Zombie III",
-    "Zona",
-    "Zonker",
-    "Zoo Pal",
-    "Zoo-loose",
-    "Zoo-Roo",
-    "Zooey",
-    "Zoom",
-    "Zoom Zoom",
-    "Zoomer",
-    "Zoomi",
-    "ZoomPig",
-    "Zoot",
-    "Zoppico",
-    "Zora",
-    "Zora Neale",
-    "Zorahaida",
-    "Zorba",
-    "Zorch",
-    "Zori",
-    "Zork",
-    "Zorka",
-    "Zoro",
-    "Zoroaster",
-    "Zorro",
-    "Zouzette",
-    "Zowy",
-    "Zoya",
-    "Zoysia",
-    "Zsa Zsa",
-    "Zsa Zsa Gabor",
-    "Zsazsa",
-    "Zu Zu",
-    "Zuba",
-    "Zubbles",
-    "Zubin",
-    "Zucca",
-    "Zucca ",
-    "Zucchini",
-    "Zuchini",
-    "Zucker",
-    "Zudden",
-    "Zuedo",
-    "Zukerman",
-    "Zuki",
-    "Zula",
-    "Zulu",
-    "Zummo",
-    "Zuni",
-    "Zurich",
-    "Zurich Direct",
-    "Zutka",
-    "Zutty",
-    "Zuzzy Buzzy",
-    "Zwieback",
-    "Zwindler",
-    "Zwing",
-    "Zwingli",
-    "ZZ Cat",
-    "ZZ Top",
-    "ZZ Top Cat",
-    "ZzZzZzZz",
-};
+size_t get_cat_names_count(void) {
+    return CAT_NAMES_COUNT;
+}
 
-static const size_t cat_names_count = 16913;
+_Static_assert(CAT_NAME_LENGTH_BUCKETS == DICT_LENGTH_BUCKETS,
+               "generated length index does not match DICT_LENGTH_BUCKETS");
+_Static_assert(CAT_NAME_FRONT_BLOCK == DICT_FRONT_BLOCK,
+               "generated name blocks do not match DICT_FRONT_BLOCK");
 
-const char **get_cat_names(void) {
-    return (const char **)cat_names;
+static const Dictionary cat_dictionary = {
+    cat_name_front,
+    sizeof(cat_name_front),
+    cat_name_restarts,
+    cat_name_length_start,
+    cat_name_by_length,
+    CAT_NAMES_COUNT,
+    CAT_NAME_FRONT_BLOCK,
+    NULL,
+    0,
+    NULL
+};
+
+NameView get_cat_name(size_t index, char buf[DICT_WORD_BUF]) {
+    return dictionary_word(&cat_dictionary, index, buf);
 }
 
-size_t get_cat_names_count(void) {
-    return cat_names_count;
+const Dictionary *get_cat_dictionary(void) {
+    return &cat_dictionary;
 }
@@ -0,0 +1,317 @@
+/*
+ * classify.c - Character Class and Histogram Kernels
+ * MeowPassword - Cat Name Based Secure Password Generator
+ *
+ * Classifies bytes as lower/upper/digit/space/symbol with the same rules
+ * ctype uses in the "C" locale (the program never calls setlocale), 16, 32
+ * or 64 bytes per step on x86 with SSE2, AVX2 or AVX-512BW. The widest
+ * kernel the CPU supports is picked once at runtime; other platforms use
+ * the scalar kernel. The same dispatch drives the name normalization
+ * kernels used to compile wordlists into dictionaries.
+ *
+ * Copyright (c) 2025 Jeffrey Kunzelman
+ * MIT License
+ */
+
+#include <string.h>
+#include <pthread.h>
+#include "meowpass.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define MEOWPASS_X86_SIMD 1
+#include <immintrin.h>
+#endif
+
+/* Inputs at least this long use four interleaved histograms */
+#define HISTOGRAM_SPLIT_MIN 1024
+
+/**
+ * Class of one byte, matching islower/isupper/isdigit/isspace in "C"
+ */
+static unsigned classify_byte(unsigned char c) {
+    if ((unsigned char)(c - 'a') < 26) return CHAR_CLASS_LOWER;
+    if ((unsigned char)(c - 'A') < 26) return CHAR_CLASS_UPPER;
+    if ((unsigned char)(c - '0') < 10) return CHAR_CLASS_DIGIT;
+    if (c == ' ' || (unsigned char)(c - '\t') < 5) return 0;
+    return CHAR_CLASS_SYMBOL;
+}
+
+static unsigned classify_scalar(const unsigned char *p, size_t len) {
+    unsigned flags = 0;
+    for (size_t i = 0; i < len; i++) {
+        flags |= classify_byte(p[i]);
+    }
+    return flags;
+}
+
+/**
+ * Lowercase A-Z and drop spaces and carriage returns
+ */
+static size_t normalize_scalar(const unsigned char *p, size_t len, unsigned char *out) {
+    size_t o = 0;
+    for (size_t i = 0; i < len; i++) {
+        unsigned char c = p[i];
+        if (c == ' ' || c == '\r') continue;
+        if ((unsigned char)(c - 'A') < 26) c |= 0x20;
+        out[o++] = c;
+    }
+    return o;
+}
+
+/**
+ * Close the gaps left by dropped lanes in a block already stored at out
+ * @return Bytes kept
+ */
+static size_t compact_block(unsigned char *out, uint32_t keep, int lanes) {
+    size_t w = 0;
+    for (int k = 0; k < lanes; k++) {
+        if (keep >> k & 1) out[w++] = out[k];
+    }
+    return w;
+}
+
+#ifdef MEOWPASS_X86_SIMD
+
+/*
+ * Each kernel ORs per-lane class masks across the input: a lane is in
+ * [lo, lo + n) when min(c - lo, n - 1) == c - lo (unsigned bytes).
+ */
+
+__attribute__((target("sse2")))
+static unsigned classify_sse2(const unsigned char *p, size_t len) {
+    const __m128i a = _mm_set1_epi8('a'), A = _mm_set1_epi8('A');
+    const __m128i zero = _mm_set1_epi8('0'), tab = _mm_set1_epi8('\t');
+    const __m128i sp = _mm_set1_epi8(' ');
+    const __m128i n25 = _mm_set1_epi8(25), n9 = _mm_set1_epi8(9), n4 = _mm_set1_epi8(4);
+    __m128i any_lower = _mm_setzero_si128(), any_upper = _mm_setzero_si128();
+    __m128i any_digit = _mm_setzero_si128(), any_symbol = _mm_setzero_si128();
+    size_t i = 0;
+
+    for (; i + 16 <= len; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(const void *)&p[i]);
+        __m128i t;
+        t = _mm_sub_epi8(x, a);
+        __m128i lower = _mm_cmpeq_epi8(_mm_min_epu8(t, n25), t);
+        t = _mm_sub_epi8(x, A);
+        __m128i upper = _mm_cmpeq_epi8(_mm_min_epu8(t, n25), t);
+        t = _mm_sub_epi8(x, zero);
+        __m128i digit = _mm_cmpeq_epi8(_mm_min_epu8(t, n9), t);
+        t = _mm_sub_epi8(x, tab);
+        __m128i space = _mm_or_si128(_mm_cmpeq_epi8(_mm_min_epu8(t, n4), t),
+                                     _mm_cmpeq_epi8(x, sp));
+        __m128i known = _mm_or_si128(_mm_or_si128(lower, upper), _mm_or_si128(digit, space));
+        any_lower = _mm_or_si128(any_lower, lower);
+        any_upper = _mm_or_si128(any_upper, upper);
+        any_digit = _mm_or_si128(any_digit, digit);
+        any_symbol = _mm_or_si128(any_symbol, _mm_andnot_si128(known, _mm_set1_epi8(-1)));
+    }
+
+    unsigned flags = classify_scalar(&p[i], len - i);
+    if (_mm_movemask_epi8(any_lower)) flags |= CHAR_CLASS_LOWER;
+    if (_mm_movemask_epi8(any_upper)) flags |= CHAR_CLASS_UPPER;
+    if (_mm_movemask_epi8(any_digit)) flags |= CHAR_CLASS_DIGIT;
+    if (_mm_movemask_epi8(any_symbol)) flags |= CHAR_CLASS_SYMBOL;
+    return flags;
+}
+
+__attribute__((target("avx2")))
+static unsigned classify_avx2(const unsigned char *p, size_t len) {
+    const __m256i a = _mm256_set1_epi8('a'), A = _mm256_set1_epi8('A');
+    const __m256i zero = _mm256_set1_epi8('0'), tab = _mm256_set1_epi8('\t');
+    const __m256i sp = _mm256_set1_epi8(' ');
+    const __m256i n25 = _mm256_set1_epi8(25), n9 = _mm256_set1_epi8(9), n4 = _mm256_set1_epi8(4);
+    __m256i any_lower = _mm256_setzero_si256(), any_upper = _mm256_setzero_si256();
+    __m256i any_digit = _mm256_setzero_si256(), any_symbol = _mm256_setzero_si256();
+    size_t i = 0;
+
+    for (; i + 32 <= len; i += 32) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(const void *)&p[i]);
+        __m256i t;
+        t = _mm256_sub_epi8(x, a);
+        __m256i lower = _mm256_cmpeq_epi8(_mm256_min_epu8(t, n25), t);
+        t = _mm256_sub_epi8(x, A);
+        __m256i upper = _mm256_cmpeq_epi8(_mm256_min_epu8(t, n25), t);
+        t = _mm256_sub_epi8(x, zero);
+        __m256i digit = _mm256_cmpeq_epi8(_mm256_min_epu8(t, n9), t);
+        t = _mm256_sub_epi8(x, tab);
+        __m256i space = _mm256_or_si256(_mm256_cmpeq_epi8(_mm256_min_epu8(t, n4), t),
+                                        _mm256_cmpeq_epi8(x, sp));
+        __m256i known = _mm256_or_si256(_mm256_or_si256(lower, upper), _mm256_or_si256(digit, space));
+        any_lower = _mm256_or_si256(any_lower, lower);
+        any_upper = _mm256_or_si256(any_upper, upper);
+        any_digit = _mm256_or_si256(any_digit, digit);
+        any_symbol = _mm256_or_si256(any_symbol, _mm256_andnot_si256(known, _mm256_set1_epi8(-1)));
+    }
+
+    unsigned flags = classify_sse2(&p[i], len - i);
+    if (_mm256_movemask_epi8(any_lower)) flags |= CHAR_CLASS_LOWER;
+    if (_mm256_movemask_epi8(any_upper)) flags |= CHAR_CLASS_UPPER;
+    if (_mm256_movemask_epi8(any_digit)) flags |= CHAR_CLASS_DIGIT;
+    if (_mm256_movemask_epi8(any_symbol)) flags |= CHAR_CLASS_SYMBOL;
+    return flags;
+}
+
+__attribute__((target("avx512f,avx512bw")))
+static unsigned classify_avx512(const unsigned char *p, size_t len) {
+    const __m512i a = _mm512_set1_epi8('a'), A = _mm512_set1_epi8('A');
+    const __m512i zero = _mm512_set1_epi8('0'), tab = _mm512_set1_epi8('\t');
+    const __m512i sp = _mm512_set1_epi8(' ');
+    const __m512i n26 = _mm512_set1_epi8(26), n10 = _mm512_set1_epi8(10), n5 = _mm512_set1_epi8(5);
+    __mmask64 any_lower = 0, any_upper = 0, any_digit = 0, any_symbol = 0;
+    size_t i = 0;
+
+    /* Full blocks, then one masked load for the tail */
+    while (i < len) {
+        size_t take = (len - i < 64) ? len - i : 64;
+        __mmask64 valid = (take == 64) ? ~(__mmask64)0 : (((__mmask64)1 << take) - 1);
+        __m512i x = _mm512_maskz_loadu_epi8(valid, &p[i]);
+        __mmask64 lower = _mm512_mask_cmplt_epu8_mask(valid, _mm512_sub_epi8(x, a), n26);
+        __mmask64 upper = _mm512_mask_cmplt_epu8_mask(valid, _mm512_sub_epi8(x, A), n26);
+        __mmask64 digit = _mm512_mask_cmplt_epu8_mask(valid, _mm512_sub_epi8(x, zero), n10);
+        __mmask64 space = _mm512_mask_cmplt_epu8_mask(valid, _mm512_sub_epi8(x, tab), n5) |
+                          _mm512_mask_cmpeq_epi8_mask(valid, x, sp);
+        any_lower |= lower;
+        any_upper |= upper;
+        any_digit |= digit;
+        any_symbol |= valid & ~(lower | upper | digit | space);
+        i += take;
+    }
+
+    unsigned flags = 0;
+    if (any_lower) flags |= CHAR_CLASS_LOWER;
+    if (any_upper) flags |= CHAR_CLASS_UPPER;
+    if (any_digit) flags |= CHAR_CLASS_DIGIT;
+    if (any_symbol) flags |= CHAR_CLASS_SYMBOL;
+    return flags;
+}
+
+/*
+ * Normalization kernels store each lowercased block whole, then compact
+ * it only if it held a space or CR. Output never runs ahead of input, so
+ * normalizing in place is safe.
+ */
+
+__attribute__((target("sse2")))
+static size_t normalize_sse2(const unsigned char *p, size_t len, unsigned char *out) {
+    const __m128i A = _mm_set1_epi8('A'), n25 = _mm_set1_epi8(25);
+    const __m128i case_bit = _mm_set1_epi8(0x20);
+    const __m128i sp = _mm_set1_epi8(' '), cr = _mm_set1_epi8('\r');
+    size_t i = 0, o = 0;
+
+    for (; i + 16 <= len; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(const void *)&p[i]);
+        __m128i t = _mm_sub_epi8(x, A);
+        __m128i upper = _mm_cmpeq_epi8(_mm_min_epu8(t, n25), t);
+        x = _mm_or_si128(x, _mm_and_si128(upper, case_bit));
+        uint32_t drop = (uint32_t)_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(x, sp),
+                                                                  _mm_cmpeq_epi8(x, cr)));
+        _mm_storeu_si128((__m128i *)(void *)&out[o], x);
+        o += (drop == 0) ? 16 : compact_block(&out[o], ~drop & 0xFFFF, 16);
+    }
+    return o + normalize_scalar(&p[i], len - i, &out[o]);
+}
+
+__attribute__((target("avx2")))
+static size_t normalize_avx2(const unsigned char *p, size_t len, unsigned char *out) {
+    const __m256i A = _mm256_set1_epi8('A'), n25 = _mm256_set1_epi8(25);
+    const __m256i case_bit = _mm256_set1_epi8(0x20);
+    const __m256i sp = _mm256_set1_epi8(' '), cr = _mm256_set1_epi8('\r');
+    size_t i = 0, o = 0;
+
+    for (; i + 32 <= len; i += 32) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(const void *)&p[i]);
+        __m256i t = _mm256_sub_epi8(x, A);
+        __m256i upper = _mm256_cmpeq_epi8(_mm256_min_epu8(t, n25), t);
+        x = _mm256_or_si256(x, _mm256_and_si256(upper, case_bit));
+        uint32_t drop = (uint32_t)_mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(x, sp),
+                                                                        _mm256_cmpeq_epi8(x, cr)));
+        _mm256_storeu_si256((__m256i *)(void *)&out[o], x);
+        o += (drop == 0) ? 32 : compact_block(&out[o], ~drop, 32);
+    }
+    return o + normalize_sse2(&p[i], len - i, &out[o]);
+}
+
+#endif /* MEOWPASS_X86_SIMD */
+
+static SimdLevel detected_level = SIMD_SCALAR;
+static pthread_once_t detect_once = PTHREAD_ONCE_INIT;
+
+static void detect_level(void) {
+#ifdef MEOWPASS_X86_SIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512bw")) detected_level = SIMD_AVX512;
+    else if (__builtin_cpu_supports("avx2")) detected_level = SIMD_AVX2;
+    else if (__builtin_cpu_supports("sse2")) detected_level = SIMD_SSE2;
+#endif
+}
+
+SimdLevel simd_detect(void) {
+    pthread_once(&detect_once, detect_level);
+    return detected_level;
+}
+
+unsigned classify_characters_at(SimdLevel level, const char *str, size_t len) {
+    const unsigned char *p = (const unsigned char *)str;
+    if (level > simd_detect()) level = simd_detect();
+
+    switch (level) {
+#ifdef MEOWPASS_X86_SIMD
+    case SIMD_AVX512: return classify_avx512(p, len);
+    case SIMD_AVX2:   return classify_avx2(p, len);
+    case SIMD_SSE2:   return classify_sse2(p, len);
+#endif
+    default:          return classify_scalar(p, len);
+    }
+}
+
+unsigned classify_characters(const char *str, size_t len) {
+    return classify_characters_at(simd_detect(), str, len);
+}
+
+size_t normalize_text_at(SimdLevel level, const char *src, size_t len, char *dst) {
+    const unsigned char *p = (const unsigned char *)src;
+    unsigned char *out = (unsigned char *)dst;
+    if (level > simd_detect()) level = simd_detect();
+
+    /* Byte compaction needs VBMI2 at 512 bits; AVX-512 CPUs use AVX2 here */
+    switch (level) {
+#ifdef MEOWPASS_X86_SIMD
+    case SIMD_AVX512:
+    case SIMD_AVX2:   return normalize_avx2(p, len, out);
+    case SIMD_SSE2:   return normalize_sse2(p, len, out);
+#endif
+    default:          return normalize_scalar(p, len, out);
+    }
+}
+
+size_t normalize_text(const char *src, size_t len, char *dst) {
+    return normalize_text_at(simd_detect(), src, len, dst);
+}
+
+unsigned classify_character(unsigned char c) {
+    return classify_byte(c);
+}
+
+void byte_histogram(const char *str, size_t len, uint32_t counts[256]) {
+    const unsigned char *p = (const unsigned char *)str;
+    size_t i = 0;
+
+    /* Scattered increments do not vectorize; on long input, rotating over
+     * four tables instead breaks the store-to-load chain on repeated bytes */
+    if (len >= HISTOGRAM_SPLIT_MIN) {
+        uint32_t part[3][256];
+        memset(part, 0, sizeof(part));
+        for (; i + 4 <= len; i += 4) {
+            counts[p[i]]++;
+            part[0][p[i + 1]]++;
+            part[1][p[i + 2]]++;
+            part[2][p[i + 3]]++;
+        }
+        for (int c = 0; c < 256; c++) {
+            counts[c] += part[0][c] + part[1][c] + part[2][c];
+        }
+    }
+    for (; i < len; i++) {
+        counts[p[i]]++;
+    }
+}
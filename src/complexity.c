@@ -8,26 +8,53 @@
 
 #include <stdlib.h>
 #include <string.h>
-#include <ctype.h>
 #include <math.h>
+#include <pthread.h>
 #include "meowpass.h"
 
 /* Hash table size for character counting */
 #define HASH_SIZE 256
 
-double calculate_shannon_entropy(const char *str) {
-    if (!str || *str == '\0') return 0.0;
+/* LZ77 estimator: window covers a whole password; chains are capped so
+ * the cost per position is bounded */
+#define LZ_WINDOW 128               /* Power of two */
+#define LZ_HASH_BITS 6
+#define LZ_MIN_MATCH 3
+#define LZ_MAX_MATCH 255
+#define LZ_MAX_CHAIN 16
 
-    size_t len = strlen(str);
-    int char_counts[HASH_SIZE] = {0};
+/* Extra fractional bits computed by log2_fixed before rounding to Q16 */
+#define LOG2_EXTRA_BITS 4
 
-    /* Count character occurrences */
-    for (size_t i = 0; i < len; i++) {
-        unsigned char c = (unsigned char)str[i];
-        char_counts[c]++;
-    }
+/* Suffix automaton sizes for an n-character string */
+#define SAM_MAX_STATES(n) (2 * (n) + 1)
+#define SAM_MAX_EDGES(n)  (3 * (n) + 4)
+
+/* Suffix automaton state; transitions are a singly linked edge list */
+typedef struct {
+    int len;
+    int link;
+    int first_edge;
+} SamState;
+
+typedef struct {
+    int to;
+    int next;
+    unsigned char c;
+} SamEdge;
 
-    /* Calculate entropy */
+typedef struct {
+    SamState *states;
+    SamEdge *edges;
+    int state_count;
+    int edge_count;
+    int last;
+} SuffixAutomaton;
+
+/**
+ * Shannon entropy from a byte histogram of len bytes
+ */
+static double entropy_from_histogram(const uint32_t char_counts[HASH_SIZE], size_t len) {
     double entropy = 0.0;
     double dlen = (double)len;
 
@@ -41,13 +68,27 @@ double calculate_shannon_entropy(const char *str) {
     return entropy;
 }
 
-double calculate_compression_ratio(const char *str) {
-    if (!str || *str == '\0') return 0.0;
+/**
+ * Shannon entropy of len bytes
+ */
+static double shannon_entropy_len(const char *str, size_t len) {
+    if (len == 0) return 0.0;
 
-    size_t len = strlen(str);
+    uint32_t char_counts[HASH_SIZE] = {0};
+    byte_histogram(str, len, char_counts);
+    return entropy_from_histogram(char_counts, len);
+}
 
-    /* Simple run-length encoding approximation */
-    int compressed = 0;
+double calculate_shannon_entropy(const char *str) {
+    if (!str) return 0.0;
+    return shannon_entropy_len(str, strlen(str));
+}
+
+/**
+ * Units in a simple run-length encoding: runs of 2+ cost 2, singles 1
+ */
+static size_t rle_units(const char *str, size_t len) {
+    size_t compressed = 0;
     char previous = '\0';
     int run_length = 1;
 
@@ -62,102 +103,232 @@ double calculate_compression_ratio(const char *str) {
         }
     }
     compressed += (run_length > 1) ? 2 : 1;
+    return compressed;
+}
+
+/* Source of the compression ratio term (set once, before scoring) */
+static CompressionMethod compression_method = COMPRESSION_RLE;
 
-    return 1.0 - ((double)compressed / (double)len);
+static uint32_t lz_hash(const unsigned char *p) {
+    uint32_t v = ((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2];
+    return (v * 2654435761u) >> (32 - LZ_HASH_BITS);
 }
 
 /**
- * Get substrings of specified max length and count unique ones
+ * Units in a greedy LZ77 parse: a literal costs 1, an (offset, length)
+ * match costs 2, the same scale rle_units uses. Hash chains link earlier
+ * positions with the same 3-byte prefix; nothing is allocated.
  */
-double calculate_pattern_complexity(const char *str) {
+static size_t lz_units(const char *str, size_t len) {
+    const unsigned char *p = (const unsigned char *)str;
+    int32_t head[1 << LZ_HASH_BITS];
+    int32_t prev[LZ_WINDOW];
+    size_t units = 0;
+    size_t i = 0;
+
+    memset(head, 0xff, sizeof(head));
+    while (i < len) {
+        size_t best_len = 0;
+
+        if (i + LZ_MIN_MATCH <= len) {
+            int32_t cand = head[lz_hash(&p[i])];
+            size_t limit = (len - i < LZ_MAX_MATCH) ? len - i : LZ_MAX_MATCH;
+            for (int depth = 0; cand >= 0 && depth < LZ_MAX_CHAIN &&
+                                i - (size_t)cand <= LZ_WINDOW; depth++) {
+                size_t n = 0;
+                while (n < limit && p[(size_t)cand + n] == p[i + n]) n++;
+                if (n > best_len) best_len = n;
+                cand = prev[(size_t)cand & (LZ_WINDOW - 1)];
+            }
+        }
+
+        size_t step = (best_len >= LZ_MIN_MATCH) ? best_len : 1;
+        units += (best_len >= LZ_MIN_MATCH) ? 2 : 1;
+        for (size_t end = i + step; i < end; i++) {
+            if (i + LZ_MIN_MATCH <= len) {
+                uint32_t h = lz_hash(&p[i]);
+                prev[i & (LZ_WINDOW - 1)] = head[h];
+                head[h] = (int32_t)i;
+            }
+        }
+    }
+    return units;
+}
+
+/**
+ * Compressed size units using the selected estimator
+ */
+static size_t compression_units(const char *str, size_t len) {
+    return (compression_method == COMPRESSION_LZ) ? lz_units(str, len) : rle_units(str, len);
+}
+
+void set_compression_method(CompressionMethod method) {
+    compression_method = method;
+}
+
+CompressionMethod get_compression_method(void) {
+    return compression_method;
+}
+
+double calculate_compression_ratio(const char *str) {
     if (!str || *str == '\0') return 0.0;
 
     size_t len = strlen(str);
-    if (len < 2) return 0.0;
-
-    int max_substr_len = 4;
-    int total_substrings = 0;
-    int unique_substrings = 0;
-
-    /* Simple uniqueness check using array comparison */
-    /* For each substring length 2 to max_substr_len */
-    char **substrings = NULL;
-    size_t substr_capacity = 0;
-    size_t substr_count = 0;
-
-    for (int slen = 2; slen <= max_substr_len && slen <= (int)len; slen++) {
-        for (size_t start = 0; start <= len - slen; start++) {
-            total_substrings++;
-
-            /* Check if this substring is unique */
-            int is_unique = 1;
-            for (size_t j = 0; j < substr_count; j++) {
-                if (strncmp(&str[start], substrings[j], slen) == 0 &&
-                    strlen(substrings[j]) == (size_t)slen) {
-                    is_unique = 0;
-                    break;
-                }
-            }
+    return 1.0 - ((double)compression_units(str, len) / (double)len);
+}
+
+double calculate_compression_ratio_lz(const char *str) {
+    if (!str || *str == '\0') return 0.0;
+
+    size_t len = strlen(str);
+    return 1.0 - ((double)lz_units(str, len) / (double)len);
+}
+
+static int sam_find(const SuffixAutomaton *sam, int state, unsigned char c) {
+    for (int e = sam->states[state].first_edge; e >= 0; e = sam->edges[e].next) {
+        if (sam->edges[e].c == c) return e;
+    }
+    return -1;
+}
+
+static void sam_add_edge(SuffixAutomaton *sam, int from, unsigned char c, int to) {
+    SamEdge *edge = &sam->edges[sam->edge_count];
+    edge->c = c;
+    edge->to = to;
+    edge->next = sam->states[from].first_edge;
+    sam->states[from].first_edge = sam->edge_count++;
+}
 
-            if (is_unique) {
-                /* Add to list */
-                if (substr_count >= substr_capacity) {
-                    substr_capacity = (substr_capacity == 0) ? 64 : substr_capacity * 2;
-                    char **new_arr = realloc(substrings, substr_capacity * sizeof(char *));
-                    if (!new_arr) break;
-                    substrings = new_arr;
-                }
-                substrings[substr_count] = malloc(slen + 1);
-                if (substrings[substr_count]) {
-                    strncpy(substrings[substr_count], &str[start], slen);
-                    substrings[substr_count][slen] = '\0';
-                    substr_count++;
-                    unique_substrings++;
-                }
+static int sam_new_state(SuffixAutomaton *sam, int len, int link) {
+    SamState *state = &sam->states[sam->state_count];
+    state->len = len;
+    state->link = link;
+    state->first_edge = -1;
+    return sam->state_count++;
+}
+
+/**
+ * Append one character (standard online construction, amortized O(1))
+ */
+static void sam_extend(SuffixAutomaton *sam, unsigned char c) {
+    int cur = sam_new_state(sam, sam->states[sam->last].len + 1, 0);
+    int p = sam->last;
+    int e;
+
+    while (p >= 0 && sam_find(sam, p, c) < 0) {
+        sam_add_edge(sam, p, c, cur);
+        p = sam->states[p].link;
+    }
+
+    if (p >= 0) {
+        int q = sam->edges[sam_find(sam, p, c)].to;
+        if (sam->states[p].len + 1 == sam->states[q].len) {
+            sam->states[cur].link = q;
+        } else {
+            int clone = sam_new_state(sam, sam->states[p].len + 1, sam->states[q].link);
+            for (e = sam->states[q].first_edge; e >= 0; e = sam->edges[e].next) {
+                sam_add_edge(sam, clone, sam->edges[e].c, sam->edges[e].to);
+            }
+            while (p >= 0 && (e = sam_find(sam, p, c)) >= 0 && sam->edges[e].to == q) {
+                sam->edges[e].to = clone;
+                p = sam->states[p].link;
             }
+            sam->states[q].link = clone;
+            sam->states[cur].link = clone;
         }
     }
+    sam->last = cur;
+}
 
-    /* Free allocated memory */
-    for (size_t i = 0; i < substr_count; i++) {
-        free(substrings[i]);
+/**
+ * Count distinct substrings with length in [2, max_len]. Each automaton
+ * state stands for the substrings of length (len(link), len(state)].
+ */
+static uint64_t sam_count_distinct(const SuffixAutomaton *sam, int max_len) {
+    uint64_t distinct = 0;
+    for (int v = 1; v < sam->state_count; v++) {
+        int lo = sam->states[sam->states[v].link].len + 1;
+        int hi = sam->states[v].len;
+        if (lo < 2) lo = 2;
+        if (hi > max_len) hi = max_len;
+        if (hi >= lo) distinct += (uint64_t)(hi - lo + 1);
     }
-    free(substrings);
+    return distinct;
+}
 
-    if (total_substrings == 0) return 0.0;
-    return (double)unique_substrings / (double)total_substrings;
+double calculate_pattern_complexity(const char *str) {
+    return calculate_pattern_complexity_max(str, PATTERN_MAX_SUBSTRING);
 }
 
-double calculate_character_diversity(const char *str) {
-    if (!str || *str == '\0') return 0.0;
+/**
+ * Distinct and total substrings of length 2..max_substring (<= 0 for all)
+ * @return 0 on success, -1 if there is nothing to count or no memory
+ */
+static int pattern_counts(const char *str, size_t len, int max_substring,
+                          uint64_t *unique_substrings, uint64_t *total_substrings) {
+    if (len < 2 || len > (size_t)(INT32_MAX / 4)) return -1;
+
+    int n = (int)len;
+    int max_len = (max_substring <= 0 || max_substring > n) ? n : max_substring;
+    if (max_len < 2) return -1;
 
-    int has_lower = 0;
-    int has_upper = 0;
-    int has_digit = 0;
-    int has_symbol = 0;
+    /* Passwords fit on the stack; only unusually long input touches the heap */
+    SamState stack_states[SAM_MAX_STATES(MAX_PASSWORD_LENGTH)];
+    SamEdge stack_edges[SAM_MAX_EDGES(MAX_PASSWORD_LENGTH)];
+    SuffixAutomaton sam = {stack_states, stack_edges, 0, 0, 0};
+    void *heap = NULL;
 
-    for (const char *p = str; *p; p++) {
-        unsigned char c = (unsigned char)*p;
-        if (islower(c)) has_lower = 1;
-        else if (isupper(c)) has_upper = 1;
-        else if (isdigit(c)) has_digit = 1;
-        else if (!isspace(c)) has_symbol = 1;
+    if (n > MAX_PASSWORD_LENGTH) {
+        size_t states_size = (size_t)SAM_MAX_STATES(n) * sizeof(SamState);
+        heap = malloc(states_size + (size_t)SAM_MAX_EDGES(n) * sizeof(SamEdge));
+        if (!heap) return -1;
+        sam.states = heap;
+        sam.edges = (SamEdge *)((char *)heap + states_size);
     }
 
-    int categories = has_lower + has_upper + has_digit + has_symbol;
-    return (double)categories / 4.0;
+    sam_new_state(&sam, 0, -1);
+    for (int i = 0; i < n; i++) {
+        sam_extend(&sam, (unsigned char)str[i]);
+    }
+    *unique_substrings = sam_count_distinct(&sam, max_len);
+    free(heap);
+
+    /* Substrings of length s number n - s + 1 */
+    *total_substrings = 0;
+    for (int slen = 2; slen <= max_len; slen++) {
+        *total_substrings += (uint64_t)(n - slen + 1);
+    }
+    return 0;
 }
 
-void analyze_complexity(const char *password, ComplexityResult *result) {
-    if (!password || !result) return;
+double calculate_pattern_complexity_max(const char *str, int max_substring) {
+    if (!str || *str == '\0') return 0.0;
+
+    uint64_t unique_substrings, total_substrings;
+    if (pattern_counts(str, strlen(str), max_substring, &unique_substrings, &total_substrings) != 0) {
+        return 0.0;
+    }
+    return (double)unique_substrings / (double)total_substrings;
+}
+
+/**
+ * Fraction of the four character classes present
+ */
+static double diversity_from_flags(unsigned flags) {
+    int categories = (int)((flags & CHAR_CLASS_LOWER) != 0) + (int)((flags & CHAR_CLASS_UPPER) != 0) +
+                     (int)((flags & CHAR_CLASS_DIGIT) != 0) + (int)((flags & CHAR_CLASS_SYMBOL) != 0);
+    return (double)categories / 4.0;
+}
 
-    result->length = (int)strlen(password);
-    result->entropy = calculate_shannon_entropy(password);
-    result->compression_ratio = calculate_compression_ratio(password);
-    result->pattern_complexity = calculate_pattern_complexity(password);
-    result->character_diversity = calculate_character_diversity(password);
+double calculate_character_diversity(const char *str) {
+    if (!str || *str == '\0') return 0.0;
+    return diversity_from_flags(classify_characters(str, strlen(str)));
+}
 
-    /* Weighted complexity score (same formula as Swift version) */
+/**
+ * Weighted complexity score (same formula as Swift version)
+ */
+static void combine_score(ComplexityResult *result) {
     double score = (result->entropy * 0.3) +
                    (result->compression_ratio * 0.25) +
                    (result->pattern_complexity * 0.2) +
@@ -166,3 +337,349 @@ void analyze_complexity(const char *password, ComplexityResult *result) {
 
     result->score = fmin(score, 10.0);
 }
+
+/**
+ * Compression, pattern and diversity terms of len bytes
+ */
+static double compression_ratio_len(const char *str, size_t len) {
+    if (len == 0) return 0.0;
+    return 1.0 - ((double)compression_units(str, len) / (double)len);
+}
+
+static double pattern_complexity_len(const char *str, size_t len) {
+    uint64_t unique_substrings, total_substrings;
+    if (pattern_counts(str, len, PATTERN_MAX_SUBSTRING, &unique_substrings, &total_substrings) != 0) {
+        return 0.0;
+    }
+    return (double)unique_substrings / (double)total_substrings;
+}
+
+void analyze_complexity(const char *password, ComplexityResult *result) {
+    if (!password || !result) return;
+    analyze_complexity_len(password, strlen(password), result);
+}
+
+void analyze_complexity_len(const char *password, size_t len, ComplexityResult *result) {
+    if (!password || !result) return;
+
+    result->length = (int)len;
+    result->entropy = shannon_entropy_len(password, len);
+    result->compression_ratio = compression_ratio_len(password, len);
+    result->pattern_complexity = pattern_complexity_len(password, len);
+    result->character_diversity = diversity_from_flags(classify_characters(password, len));
+    result->guesses_log2 = estimate_guesses_log2(password, len);
+    combine_score(result);
+}
+
+bool complexity_score_above(const char *password, size_t len, double must_beat, double *score) {
+    if (!password || !score) return false;
+
+    /* Cheap terms first: length, classes, run-length units, distinct bytes */
+    ComplexityResult partial;
+    uint32_t char_counts[HASH_SIZE] = {0};
+    byte_histogram(password, len, char_counts);
+    int distinct = 0;
+    for (int i = 0; i < HASH_SIZE; i++) {
+        distinct += (char_counts[i] > 0);
+    }
+    partial.length = (int)len;
+    partial.compression_ratio = compression_ratio_len(password, len);
+    partial.character_diversity = diversity_from_flags(classify_characters(password, len));
+
+    /* Bound 1: entropy <= log2(distinct) (margin covers rounding), all
+     * substrings unique. Rounding is monotonic, so a bound at or below the
+     * must_beat proves the real score is too. */
+    partial.entropy = (distinct > 1) ? log2((double)distinct) + 1e-9 : 0.0;
+    partial.pattern_complexity = 1.0;
+    combine_score(&partial);
+    if (partial.score <= must_beat) return false;
+
+    /* Bound 2: exact entropy */
+    partial.entropy = (len == 0) ? 0.0 : entropy_from_histogram(char_counts, len);
+    combine_score(&partial);
+    if (partial.score <= must_beat) return false;
+
+    /* The substring count is the expensive term; only survivors pay it */
+    partial.pattern_complexity = pattern_complexity_len(password, len);
+    combine_score(&partial);
+    *score = partial.score;
+    return partial.score > must_beat;
+}
+
+void analyze_complexity_batch(const char *const *passwords, const size_t *lengths,
+                              size_t count, const ComplexityBatch *out) {
+    double entropy[COMPLEXITY_BATCH_BLOCK];
+    double compression[COMPLEXITY_BATCH_BLOCK];
+    double pattern[COMPLEXITY_BATCH_BLOCK];
+    double diversity[COMPLEXITY_BATCH_BLOCK];
+    double length[COMPLEXITY_BATCH_BLOCK];
+
+    /* Only compute the terms someone reads */
+    bool need_score = out->score != NULL;
+    bool need_entropy = need_score || out->entropy;
+    bool need_compression = need_score || out->compression_ratio;
+    bool need_pattern = need_score || out->pattern_complexity;
+    bool need_diversity = need_score || out->character_diversity;
+
+    for (size_t base = 0; base < count; base += COMPLEXITY_BATCH_BLOCK) {
+        size_t block = count - base;
+        if (block > COMPLEXITY_BATCH_BLOCK) block = COMPLEXITY_BATCH_BLOCK;
+
+        /* Per-password statistics into column arrays */
+        for (size_t i = 0; i < block; i++) {
+            const char *pw = passwords[base + i];
+            size_t len = pw ? (lengths ? lengths[base + i] : strlen(pw)) : 0;
+            if (!pw) pw = "";
+            length[i] = (double)len;
+            entropy[i] = need_entropy ? shannon_entropy_len(pw, len) : 0.0;
+            compression[i] = need_compression ? compression_ratio_len(pw, len) : 0.0;
+            pattern[i] = need_pattern ? pattern_complexity_len(pw, len) : 0.0;
+            diversity[i] = need_diversity ?
+                diversity_from_flags(classify_characters(pw, len)) : 0.0;
+            if (out->length) out->length[base + i] = (int)len;
+            if (out->guesses_log2) out->guesses_log2[base + i] = estimate_guesses_log2(pw, len);
+        }
+
+        /* Same expression as combine_score, one column at a time */
+        if (need_score) {
+            double *score = &out->score[base];
+            for (size_t i = 0; i < block; i++) {
+                double s = (entropy[i] * 0.3) +
+                           (compression[i] * 0.25) +
+                           (pattern[i] * 0.2) +
+                           (diversity[i] * 0.15) +
+                           (fmin(length[i] / 25.0, 1.0) * 0.1);
+                score[i] = fmin(s, 10.0);
+            }
+        }
+        if (out->entropy) memcpy(&out->entropy[base], entropy, block * sizeof(double));
+        if (out->compression_ratio) {
+            memcpy(&out->compression_ratio[base], compression, block * sizeof(double));
+        }
+        if (out->pattern_complexity) {
+            memcpy(&out->pattern_complexity[base], pattern, block * sizeof(double));
+        }
+        if (out->character_diversity) {
+            memcpy(&out->character_diversity[base], diversity, block * sizeof(double));
+        }
+    }
+}
+
+void complexity_init(ComplexityAccumulator *acc) {
+    memset(acc, 0, sizeof(*acc));
+    acc->run_length = 1;
+}
+
+void complexity_reset(ComplexityAccumulator *acc) {
+    for (int i = 0; i < acc->length; i++) {
+        acc->counts[acc->chars[i]] = 0;
+    }
+    for (int i = 0; i < acc->used_count; i++) {
+        acc->ngrams[acc->used_slots[i]] = 0;
+    }
+    acc->length = 0;
+    acc->compressed = 0;
+    acc->run_length = 1;
+    acc->previous = '\0';
+    acc->class_flags = 0;
+    acc->total_substrings = 0;
+    acc->unique_substrings = 0;
+    acc->used_count = 0;
+}
+
+/**
+ * Insert an n-gram key, returning 1 if it was not seen before
+ */
+static int ngram_insert(ComplexityAccumulator *acc, uint64_t key) {
+    uint64_t h = key * 0x9E3779B97F4A7C15ull;
+    size_t slot = (size_t)(h >> 54) & (COMPLEXITY_NGRAM_SLOTS - 1);
+
+    while (acc->ngrams[slot] != 0) {
+        if (acc->ngrams[slot] == key) return 0;
+        slot = (slot + 1) & (COMPLEXITY_NGRAM_SLOTS - 1);
+    }
+    acc->ngrams[slot] = key;
+    acc->used_slots[acc->used_count++] = (uint16_t)slot;
+    return 1;
+}
+
+void complexity_push(ComplexityAccumulator *acc, unsigned char c) {
+    if (acc->length >= MAX_PASSWORD_LENGTH - 1) return;
+
+    int pos = acc->length;
+    acc->chars[pos] = c;
+    acc->length++;
+
+    /* Histogram for entropy */
+    acc->counts[c]++;
+
+    /* Run-length units, as calculate_compression_ratio counts them */
+    if (c == acc->previous) {
+        acc->run_length++;
+    } else {
+        acc->compressed += (acc->run_length > 1) ? 2 : 1;
+        acc->run_length = 1;
+        acc->previous = c;
+    }
+
+    /* Character classes, as calculate_character_diversity sees them */
+    acc->class_flags |= classify_character(c);
+
+    /* Every substring of length 2..PATTERN_MAX_SUBSTRING ending here */
+    uint64_t bytes = c;
+    for (int slen = 2; slen <= PATTERN_MAX_SUBSTRING && slen <= pos + 1; slen++) {
+        bytes = (bytes << 8) | acc->chars[pos - slen + 1];
+        acc->total_substrings++;
+        acc->unique_substrings += ngram_insert(acc, ((uint64_t)slen << 32) | bytes);
+    }
+}
+
+/**
+ * Compressed size units of the pushed string. RLE is tracked as characters
+ * arrive; LZ parses the stored characters at the end.
+ */
+static size_t accumulated_units(const ComplexityAccumulator *acc) {
+    if (compression_method == COMPRESSION_LZ) {
+        return lz_units((const char *)acc->chars, (size_t)acc->length);
+    }
+    return (size_t)acc->compressed + ((acc->run_length > 1) ? 2 : 1);
+}
+
+void complexity_finish(const ComplexityAccumulator *acc, ComplexityResult *result) {
+    result->length = acc->length;
+    if (acc->length == 0) {
+        result->entropy = 0.0;
+        result->compression_ratio = 0.0;
+        result->pattern_complexity = 0.0;
+        result->character_diversity = 0.0;
+        result->guesses_log2 = 0.0;
+        combine_score(result);
+        return;
+    }
+
+    /* Same summation order as calculate_shannon_entropy */
+    double entropy = 0.0;
+    double dlen = (double)acc->length;
+    for (int i = 0; i < HASH_SIZE; i++) {
+        if (acc->counts[i] > 0) {
+            double probability = (double)acc->counts[i] / dlen;
+            entropy -= probability * log2(probability);
+        }
+    }
+    result->entropy = entropy;
+
+    result->compression_ratio = 1.0 - ((double)accumulated_units(acc) / dlen);
+
+    result->pattern_complexity = (acc->total_substrings == 0) ? 0.0 :
+        (double)acc->unique_substrings / (double)acc->total_substrings;
+
+    result->character_diversity = diversity_from_flags(acc->class_flags);
+    result->guesses_log2 = estimate_guesses_log2((const char *)acc->chars, (size_t)acc->length);
+
+    combine_score(result);
+}
+
+/*
+ * Fixed-point scoring. Every term is an exact integer ratio except the
+ * entropy, whose logarithms come from an integer squaring algorithm, so
+ * the result does not depend on the libm in use. With
+ * H = log2(n) - (1/n) * sum(c * log2(c)) and the weights over a common
+ * denominator, score = (6H + 5C + 4P + 3D + 2L) / 20, capped at 10.
+ */
+
+/* c * log2(c) in Q16 for every count a password buffer can hold */
+static uint64_t clog2c_table[MAX_PASSWORD_LENGTH + 1];
+static pthread_once_t clog2c_once = PTHREAD_ONCE_INIT;
+
+/**
+ * log2(x) in Q16 for x >= 1: square the mantissa (Q30) once per
+ * fractional bit, taking a 1 whenever it reaches 2
+ */
+static uint32_t log2_fixed(uint32_t x) {
+    int msb = 0;
+    while ((x >> msb) > 1) msb++;
+
+    uint64_t y = ((uint64_t)x << 30) >> msb;
+    uint32_t frac = 0;
+    for (int bit = COMPLEXITY_FIXED_SHIFT + LOG2_EXTRA_BITS - 1; bit >= 0; bit--) {
+        y = (y * y) >> 30;
+        if (y >= ((uint64_t)2 << 30)) {
+            y >>= 1;
+            frac |= 1u << bit;
+        }
+    }
+    frac = (frac + (1u << (LOG2_EXTRA_BITS - 1))) >> LOG2_EXTRA_BITS;
+    return ((uint32_t)msb << COMPLEXITY_FIXED_SHIFT) + frac;
+}
+
+static void build_clog2c_table(void) {
+    for (uint32_t c = 1; c <= MAX_PASSWORD_LENGTH; c++) {
+        clog2c_table[c] = (uint64_t)c * log2_fixed(c);
+    }
+}
+
+static uint64_t clog2c_fixed(uint32_t c) {
+    if (c <= MAX_PASSWORD_LENGTH) return clog2c_table[c];
+    return (uint64_t)c * log2_fixed(c);
+}
+
+/**
+ * Combine integer statistics into a Q16 score
+ */
+static int32_t combine_score_fixed(size_t len, uint64_t clog2c_sum, size_t units,
+                                   uint64_t unique_substrings, uint64_t total_substrings,
+                                   unsigned class_flags) {
+    if (len == 0 || len > UINT32_MAX) return 0;
+
+    int64_t n = (int64_t)len;
+    int64_t entropy = (int64_t)log2_fixed((uint32_t)len) -
+                      (int64_t)((clog2c_sum + (uint64_t)len / 2) / (uint64_t)len);
+    int64_t compression = (((n - (int64_t)units) * COMPLEXITY_FIXED_ONE)) / n;
+    int64_t pattern = (total_substrings == 0) ? 0 :
+        (int64_t)((unique_substrings * COMPLEXITY_FIXED_ONE) / total_substrings);
+    int64_t categories = (int64_t)((class_flags & CHAR_CLASS_LOWER) != 0) +
+                         (int64_t)((class_flags & CHAR_CLASS_UPPER) != 0) +
+                         (int64_t)((class_flags & CHAR_CLASS_DIGIT) != 0) +
+                         (int64_t)((class_flags & CHAR_CLASS_SYMBOL) != 0);
+    int64_t diversity = categories * COMPLEXITY_FIXED_ONE / 4;
+    int64_t length = ((n < 25) ? n : 25) * COMPLEXITY_FIXED_ONE / 25;
+
+    int64_t numerator = 6 * entropy + 5 * compression + 4 * pattern + 3 * diversity + 2 * length;
+    int64_t score = (numerator >= 0) ? (numerator + 10) / 20 : (numerator - 10) / 20;
+    if (score > 10 * (int64_t)COMPLEXITY_FIXED_ONE) score = 10 * (int64_t)COMPLEXITY_FIXED_ONE;
+    return (int32_t)score;
+}
+
+int32_t complexity_score_fixed(const char *password) {
+    if (!password) return 0;
+    pthread_once(&clog2c_once, build_clog2c_table);
+
+    size_t len = strlen(password);
+    if (len == 0) return 0;
+
+    uint32_t counts[HASH_SIZE] = {0};
+    byte_histogram(password, len, counts);
+    uint64_t clog2c_sum = 0;
+    for (int i = 0; i < HASH_SIZE; i++) {
+        if (counts[i] > 1) clog2c_sum += clog2c_fixed(counts[i]);
+    }
+
+    uint64_t unique_substrings = 0, total_substrings = 0;
+    pattern_counts(password, len, PATTERN_MAX_SUBSTRING, &unique_substrings, &total_substrings);
+
+    return combine_score_fixed(len, clog2c_sum, compression_units(password, len),
+                               unique_substrings, total_substrings,
+                               classify_characters(password, len));
+}
+
+int32_t complexity_finish_fixed(const ComplexityAccumulator *acc) {
+    pthread_once(&clog2c_once, build_clog2c_table);
+
+    uint64_t clog2c_sum = 0;
+    for (int i = 0; i < HASH_SIZE; i++) {
+        if (acc->counts[i] > 1) clog2c_sum += clog2c_table[acc->counts[i]];
+    }
+    return combine_score_fixed((size_t)acc->length, clog2c_sum, accumulated_units(acc),
+                               (uint64_t)acc->unique_substrings, (uint64_t)acc->total_substrings,
+                               acc->class_flags);
+}
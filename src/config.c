@@ -18,7 +18,7 @@ int clamp_int(int value, int min, int max) {
 
 void config_init(PasswordConfig *config, int argc, char *argv[]) {
     /* Set defaults */
-    config->num_numbers = (rand() % 4) + 1;  /* Random 1-4 as per Swift spec */
+    config->num_numbers = (int)rng_uniform(rng_default(), DEFAULT_RANDOM_NUMBERS) + 1;  /* Random 1-4 as per Swift spec */
     config->num_symbols = DEFAULT_NUM_SYMBOLS;
     config->max_length = DEFAULT_MAX_LENGTH;
     config->show_tests = false;
@@ -26,6 +26,23 @@ void config_init(PasswordConfig *config, int argc, char *argv[]) {
     config->psssst = false;
     config->show_help = false;
     config->check_update = false;
+    config->run_bench = false;
+    config->count = 0;
+    config->threads = MIN_THREADS;
+    config->unordered = false;
+    config->candidates = NUM_CANDIDATES;
+    config->target_score = 0.0;
+    config->top = 0;
+    config->compression = COMPRESSION_RLE;
+    config->invalid_compression = NULL;
+    config->audit_file = NULL;
+    config->audit_below = 0.0;
+    config->summary = false;
+    config->cache_entries = 0;
+    config->wordlist_file = NULL;
+    config->dict_file = NULL;
+    config->mix_spec = NULL;
+    config->length_bias = 0.0;
 
     /* Parse command line arguments */
     for (int i = 1; i < argc; i++) {
@@ -47,8 +64,93 @@ void config_init(PasswordConfig *config, int argc, char *argv[]) {
                 config->max_length = clamp_int(val, MIN_LENGTH, MAX_LENGTH);
                 i++;
             }
+        } else if (strcmp(argv[i], "--count") == 0) {
+            if (i + 1 < argc) {
+                long val = atol(argv[i + 1]);
+                config->count = (val > 0) ? val : 0;
+                i++;
+            }
+        } else if (strcmp(argv[i], "--threads") == 0) {
+            if (i + 1 < argc) {
+                int val = atoi(argv[i + 1]);
+                config->threads = clamp_int(val, MIN_THREADS, MAX_THREADS);
+                i++;
+            }
+        } else if (strcmp(argv[i], "--candidates") == 0) {
+            if (i + 1 < argc) {
+                int val = atoi(argv[i + 1]);
+                config->candidates = clamp_int(val, MIN_CANDIDATES, MAX_CANDIDATES);
+                i++;
+            }
+        } else if (strcmp(argv[i], "--target") == 0) {
+            if (i + 1 < argc) {
+                double val = atof(argv[i + 1]);
+                config->target_score = (val > 0.0) ? val : 0.0;
+                i++;
+            }
+        } else if (strcmp(argv[i], "--top") == 0) {
+            if (i + 1 < argc) {
+                int val = atoi(argv[i + 1]);
+                config->top = clamp_int(val, 1, MAX_TOP_CANDIDATES);
+                i++;
+            }
+        } else if (strcmp(argv[i], "--compression") == 0) {
+            if (i + 1 < argc) {
+                if (strcmp(argv[i + 1], "lz") == 0) {
+                    config->compression = COMPRESSION_LZ;
+                } else if (strcmp(argv[i + 1], "rle") == 0) {
+                    config->compression = COMPRESSION_RLE;
+                } else {
+                    config->invalid_compression = argv[i + 1];
+                }
+                i++;
+            }
+        } else if (strcmp(argv[i], "--audit") == 0) {
+            if (i + 1 < argc) {
+                config->audit_file = argv[i + 1];
+                i++;
+            }
+        } else if (strcmp(argv[i], "--below") == 0) {
+            if (i + 1 < argc) {
+                double val = atof(argv[i + 1]);
+                config->audit_below = (val > 0.0) ? val : 0.0;
+                i++;
+            }
+        } else if (strcmp(argv[i], "--cache") == 0) {
+            if (i + 1 < argc) {
+                long val = atol(argv[i + 1]);
+                if (val < 0) val = 0;
+                config->cache_entries = (val > MAX_CACHE_ENTRIES) ? MAX_CACHE_ENTRIES : val;
+                i++;
+            }
+        } else if (strcmp(argv[i], "--wordlist") == 0) {
+            if (i + 1 < argc) {
+                config->wordlist_file = argv[i + 1];
+                i++;
+            }
+        } else if (strcmp(argv[i], "--dict") == 0) {
+            if (i + 1 < argc) {
+                config->dict_file = argv[i + 1];
+                i++;
+            }
+        } else if (strcmp(argv[i], "--mix") == 0) {
+            if (i + 1 < argc) {
+                config->mix_spec = argv[i + 1];
+                i++;
+            }
+        } else if (strcmp(argv[i], "--length-bias") == 0) {
+            if (i + 1 < argc) {
+                config->length_bias = atof(argv[i + 1]);
+                i++;
+            }
+        } else if (strcmp(argv[i], "--summary") == 0) {
+            config->summary = true;
+        } else if (strcmp(argv[i], "--unordered") == 0) {
+            config->unordered = true;
         } else if (strcmp(argv[i], "--test") == 0) {
             config->show_tests = true;
+        } else if (strcmp(argv[i], "--bench") == 0) {
+            config->run_bench = true;
         } else if (strcmp(argv[i], "--copy") == 0) {
             config->copy_to_clipboard = true;
         } else if (strcmp(argv[i], "--psssst") == 0 || strcmp(argv[i], "-p") == 0) {
@@ -0,0 +1,306 @@
+/*
+ * dictionary.c - Memory-Mapped Word Dictionaries
+ * MeowPassword - Cat Name Based Secure Password Generator
+ *
+ * A .meowdict file holds the same tables the build generates for the
+ * embedded cat names: a normalized word blob, a uint32 offset table and a
+ * length index. Opening one maps it read-only and shared and checks only
+ * the header and section bounds, so a multi-million word file opens in
+ * constant time, costs no heap, and its pages are shared by every process
+ * using it. Per-word offsets are checked as words are read.
+ *
+ * Blobs are usually front-coded: sorted or frequency-ranked wordlists
+ * share long prefixes with their neighbours, so storing only the new
+ * suffix of each word plus one offset per block of DICT_FRONT_BLOCK words
+ * roughly halves the tables. Reading a word decodes at most one block.
+ *
+ * Copyright (c) 2025 Jeffrey Kunzelman
+ * MIT License
+ */
+
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "meowpass.h"
+
+/* Longest block a file may declare; bounds the decode walk */
+#define FRONT_BLOCK_MAX 64
+
+/* Selected with dictionary_select, fixed by the first dictionary_active */
+static Dictionary selected;
+static bool has_selected = false;
+static bool active_fixed = false;
+static const Dictionary *active = NULL;
+static pthread_mutex_t active_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t active_once = PTHREAD_ONCE_INIT;
+
+/**
+ * Number of entries in the offset table
+ */
+static size_t offset_entries(size_t count, uint32_t front_block) {
+    if (front_block == 0) return count + 1;
+    return (count + front_block - 1) / front_block + 1;
+}
+
+/**
+ * Check that [offset, offset + size) lies in the file and is 4-byte aligned
+ */
+static bool section_ok(const MeowDictHeader *h, uint64_t offset, uint64_t size) {
+    return offset % sizeof(uint32_t) == 0 && offset >= h->header_size &&
+           offset <= h->file_size && size <= h->file_size - offset;
+}
+
+int dictionary_open(Dictionary *dict, const char *path) {
+    memset(dict, 0, sizeof(*dict));
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return -1;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(MeowDictHeader)) {
+        close(fd);
+        return -1;
+    }
+    size_t size = (size_t)st.st_size;
+
+    void *map = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) return -1;
+
+    const MeowDictHeader *h = map;
+    const char *base = map;
+    uint64_t count = h->count;
+    uint32_t front_block = h->front_block;
+    bool ok = memcmp(h->magic, MEOWDICT_MAGIC, sizeof(h->magic)) == 0 &&
+              h->version >= 1 && h->version <= MEOWDICT_VERSION &&
+              (h->version >= 2 || front_block == 0) && front_block <= FRONT_BLOCK_MAX &&
+              h->header_size == sizeof(MeowDictHeader) &&
+              h->file_size == (uint64_t)size &&
+              h->length_buckets == DICT_LENGTH_BUCKETS &&
+              count < UINT32_MAX && h->blob_size <= UINT32_MAX &&
+              section_ok(h, h->blob_offset, h->blob_size) &&
+              section_ok(h, h->offsets_offset, offset_entries(count, front_block) * sizeof(uint32_t)) &&
+              section_ok(h, h->length_start_offset, (DICT_LENGTH_BUCKETS + 1) * sizeof(uint32_t)) &&
+              section_ok(h, h->by_length_offset, count * sizeof(uint32_t));
+
+    if (ok) {
+        dict->blob = base + h->blob_offset;
+        dict->blob_size = (size_t)h->blob_size;
+        dict->offsets = (const uint32_t *)(const void *)(base + h->offsets_offset);
+        dict->length_start = (const uint32_t *)(const void *)(base + h->length_start_offset);
+        dict->by_length = (const uint32_t *)(const void *)(base + h->by_length_offset);
+        dict->count = (size_t)count;
+        dict->front_block = front_block;
+
+        /* Endpoints only; the tables in between are checked on use */
+        size_t last = offset_entries(dict->count, front_block) - 1;
+        size_t pad = (front_block != 0) ? DICT_FRONT_PAD : 0;
+        ok = dict->offsets[0] == 0 && dict->offsets[last] + pad == h->blob_size &&
+             dict->length_start[0] == 0 && dict->length_start[DICT_LENGTH_BUCKETS] == count;
+        for (int b = 0; ok && b < DICT_LENGTH_BUCKETS; b++) {
+            if (dict->length_start[b] > dict->length_start[b + 1]) ok = false;
+        }
+    }
+    if (!ok) {
+        munmap(map, size);
+        memset(dict, 0, sizeof(*dict));
+        return -1;
+    }
+
+    dict->map = map;
+    dict->map_size = size;
+    return 0;
+}
+
+void dictionary_close(Dictionary *dict) {
+    if (dict->map) munmap(dict->map, dict->map_size);
+    free(dict->heap);
+    memset(dict, 0, sizeof(*dict));
+}
+
+int dictionary_front_code(const Dictionary *src, Dictionary *dst) {
+    memset(dst, 0, sizeof(*dst));
+    if (src->front_block != 0) return -1;
+
+    /* Worst case: nothing shared, two length bytes per word */
+    size_t blocks = offset_entries(src->count, DICT_FRONT_BLOCK) - 1;
+    size_t restarts_size = (blocks + 1) * sizeof(uint32_t);
+    size_t max_blob = src->blob_size + 2 * (size_t)DICT_FRONT_BLOCK * blocks + DICT_FRONT_PAD;
+    if (max_blob > UINT32_MAX) return -1;
+    char *heap = malloc(restarts_size + max_blob);
+    if (!heap) return -1;
+    uint32_t *restarts = (uint32_t *)(void *)heap;
+    unsigned char *out = (unsigned char *)heap + restarts_size;
+
+    /* Per block: DICT_FRONT_BLOCK shared-prefix bytes, as many suffix
+     * lengths (zero past the last word), then the suffixes */
+    size_t pos = 0;
+    NameView prev = {"", 0};
+    unsigned char *header = out;
+    for (size_t i = 0; i < src->count; i++) {
+        NameView word = dictionary_word(src, i, NULL);
+        if (word.len > DICT_WORD_MAX) {
+            free(heap);
+            return -1;
+        }
+        size_t slot = i % DICT_FRONT_BLOCK;
+        size_t shared = 0;
+        if (slot == 0) {
+            restarts[i / DICT_FRONT_BLOCK] = (uint32_t)pos;
+            header = &out[pos];
+            memset(header, 0, 2 * DICT_FRONT_BLOCK);
+            pos += 2 * DICT_FRONT_BLOCK;
+        } else {
+            size_t limit = (word.len < prev.len) ? word.len : prev.len;
+            while (shared < limit && word.str[shared] == prev.str[shared]) shared++;
+        }
+        header[slot] = (unsigned char)shared;
+        header[DICT_FRONT_BLOCK + slot] = (unsigned char)(word.len - shared);
+        memcpy(&out[pos], &word.str[shared], word.len - shared);
+        pos += word.len - shared;
+        prev = word;
+    }
+    restarts[blocks] = (uint32_t)pos;
+    memset(&out[pos], 0, DICT_FRONT_PAD);
+    pos += DICT_FRONT_PAD;
+
+    dst->blob = (const char *)out;
+    dst->blob_size = pos;
+    dst->offsets = restarts;
+    dst->length_start = src->length_start;
+    dst->by_length = src->by_length;
+    dst->count = src->count;
+    dst->front_block = DICT_FRONT_BLOCK;
+    dst->heap = heap;
+    return 0;
+}
+
+/**
+ * Decode a front-coded word, walking its block from the start. Suffixes
+ * are copied in DICT_FRONT_PAD-byte pieces whatever their length, which
+ * keeps the walk free of unpredictable branches; the blob padding and
+ * DICT_WORD_BUF absorb the overrun.
+ */
+static NameView decode_word(const Dictionary *dict, size_t index, char *buf) {
+    NameView view = {"", 0};
+    size_t block_size = dict->front_block;
+    size_t block = index / block_size;
+    size_t pos = dict->offsets[block];
+    size_t end = dict->offsets[block + 1];
+    if (pos > end || end - pos < 2 * block_size || end + DICT_FRONT_PAD > dict->blob_size) return view;
+
+    const unsigned char *p = (const unsigned char *)dict->blob;
+    const unsigned char *shared = &p[pos];
+    const unsigned char *suffix = &p[pos + block_size];
+    size_t target = index % block_size;
+    size_t at = pos + 2 * block_size;
+    size_t len = 0;
+    for (size_t k = 0; k <= target; k++) {
+        size_t s = suffix[k];
+        if (shared[k] > len || s > end - at || shared[k] + s > DICT_WORD_MAX) return view;
+        for (size_t j = 0; j < s; j += DICT_FRONT_PAD) {
+            memcpy(&buf[shared[k] + j], &p[at + j], DICT_FRONT_PAD);
+        }
+        len = shared[k] + s;
+        at += s;
+    }
+    view.str = buf;
+    view.len = len;
+    return view;
+}
+
+NameView dictionary_word(const Dictionary *dict, size_t index, char buf[DICT_WORD_BUF]) {
+    NameView view = {"", 0};
+    if (index >= dict->count) return view;
+    if (dict->front_block != 0) return decode_word(dict, index, buf);
+
+    uint32_t start = dict->offsets[index];
+    uint32_t end = dict->offsets[index + 1];
+    if (start > end || end > dict->blob_size) return view;
+    view.str = &dict->blob[start];
+    view.len = end - start;
+    return view;
+}
+
+/**
+ * Write len bytes, then zero padding up to the next MEOWDICT_ALIGN boundary
+ */
+static int write_section(FILE *out, const void *data, size_t len, uint64_t *pos) {
+    static const char zeros[MEOWDICT_ALIGN] = {0};
+    if (len > 0 && fwrite(data, 1, len, out) != len) return -1;
+    *pos += len;
+    size_t pad = (size_t)((MEOWDICT_ALIGN - *pos % MEOWDICT_ALIGN) % MEOWDICT_ALIGN);
+    if (pad > 0 && fwrite(zeros, 1, pad, out) != pad) return -1;
+    *pos += pad;
+    return 0;
+}
+
+static uint64_t align_up(uint64_t value) {
+    return (value + MEOWDICT_ALIGN - 1) / MEOWDICT_ALIGN * MEOWDICT_ALIGN;
+}
+
+int dictionary_save(const Dictionary *dict, const char *path) {
+    MeowDictHeader h;
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, MEOWDICT_MAGIC, sizeof(h.magic));
+    h.version = MEOWDICT_VERSION;
+    h.header_size = sizeof(MeowDictHeader);
+    h.count = dict->count;
+    h.length_buckets = DICT_LENGTH_BUCKETS;
+    h.front_block = dict->front_block;
+    size_t offsets_size = offset_entries(dict->count, dict->front_block) * sizeof(uint32_t);
+    h.blob_size = dict->blob_size;
+    h.blob_offset = align_up(sizeof(MeowDictHeader));
+    h.offsets_offset = align_up(h.blob_offset + h.blob_size);
+    h.length_start_offset = align_up(h.offsets_offset + offsets_size);
+    h.by_length_offset = align_up(h.length_start_offset + (DICT_LENGTH_BUCKETS + 1) * sizeof(uint32_t));
+    h.file_size = align_up(h.by_length_offset + dict->count * sizeof(uint32_t));
+
+    FILE *out = fopen(path, "wb");
+    if (!out) return -1;
+    uint64_t pos = 0;
+    int rc = 0;
+    if (write_section(out, &h, sizeof(h), &pos) != 0 ||
+        write_section(out, dict->blob, dict->blob_size, &pos) != 0 ||
+        write_section(out, dict->offsets, offsets_size, &pos) != 0 ||
+        write_section(out, dict->length_start, (DICT_LENGTH_BUCKETS + 1) * sizeof(uint32_t), &pos) != 0 ||
+        write_section(out, dict->by_length, dict->count * sizeof(uint32_t), &pos) != 0) {
+        rc = -1;
+    }
+    if (fclose(out) != 0) rc = -1;
+    if (rc == 0 && pos != h.file_size) rc = -1;
+    return rc;
+}
+
+int dictionary_select(const char *path) {
+    pthread_mutex_lock(&active_lock);
+    int rc = -1;
+    if (!active_fixed) {
+        Dictionary dict;
+        if (dictionary_open(&dict, path) == 0) {
+            if (has_selected) dictionary_close(&selected);
+            selected = dict;
+            has_selected = true;
+            rc = 0;
+        }
+    }
+    pthread_mutex_unlock(&active_lock);
+    return rc;
+}
+
+static void fix_active(void) {
+    pthread_mutex_lock(&active_lock);
+    active_fixed = true;
+    active = has_selected ? &selected : get_cat_dictionary();
+    pthread_mutex_unlock(&active_lock);
+}
+
+const Dictionary *dictionary_active(void) {
+    pthread_once(&active_once, fix_active);
+    return active;
+}
@@ -43,7 +43,24 @@ void display_help(void) {
     printf("  --numbers N      Number of random numbers to insert (1-10, default: 1-4)\n");
     printf("  --symbols N      Number of symbols to insert (1-10, default: 2)\n");
     printf("  --max-length N   Maximum password length (15-50, default: 25)\n");
+    printf("  --candidates N   Candidates to generate and rank (default: 5)\n");
+    printf("  --target SCORE   Stop early once a candidate scores at least SCORE\n");
+    printf("  --top K          Show only the K best candidates, ranked\n");
+    printf("  --compression M  Compressibility estimator: rle (default) or lz\n");
+    printf("  --count N        Stream N passwords, one per line (bulk mode)\n");
+    printf("  --threads N      Worker threads for bulk mode (1-256, default: 1)\n");
+    printf("  --unordered      Bulk mode: write chunks as workers finish them\n");
+    printf("  --audit FILE     Score every line of regular FILE (uses --threads)\n");
+    printf("  --below SCORE    Audit mode: only print lines scoring below SCORE\n");
+    printf("  --dict PATH      Draw names from a .meowdict file instead of the cat names\n");
+    printf("  --mix SPEC       Weighted name sources, e.g. cats=70,corp.meowdict=30\n");
+    printf("  --length-bias X  Weight names by length^X (e.g. 1 favors longer names)\n");
+    printf("  --wordlist FILE  Extra words (most common first) for guess estimates\n");
+    printf("  --cache N        Audit mode: memoize scores of up to N distinct lines\n");
+    printf("  --summary        Audit/bulk mode: print score distribution, percentiles,\n");
+    printf("                   class coverage and weakest entries\n");
     printf("  --test           Run tests\n");
+    printf("  --bench          Run performance benchmarks\n");
     printf("  --copy           Copy password to clipboard (Linux xclip required)\n");
     printf("  --psssst, -p     Copy password to clipboard without displaying it\n");
     printf("                   (more secure - password won't be shown in clear text)\n");
@@ -53,6 +70,12 @@ void display_help(void) {
     printf("Examples:\n");
     printf("  meowpass\n");
     printf("  meowpass --numbers 4 --symbols 3 --max-length 30\n");
+    printf("  meowpass --candidates 1000 --top 3\n");
+    printf("  meowpass --candidates 100 --target 1.9\n");
+    printf("  meowpass --count 100000 > passwords.txt\n");
+    printf("  meowpass --count 1000000 --threads 8 --unordered > passwords.txt\n");
+    printf("  meowpass --audit passwords.txt --threads 8 --below 1.2\n");
+    printf("  meowpass --audit passwords.txt --threads 8 --summary\n");
     printf("  meowpass --test\n");
 }
 
@@ -64,6 +87,7 @@ void display_analysis(const ComplexityResult *result, const char *password) {
     printf("    - Mashing Resistance: %.1f%%\n", result->compression_ratio * 100.0);
     printf("    - Shiny Foil Ball Uniqueness: %.1f%%\n", result->pattern_complexity * 100.0);
     printf("    - Percent of Organic NonGMO Catnip: %.1f%%\n", result->character_diversity * 100.0);
+    printf("    - Guesses Before The Cat Gets In: 2^%.1f\n", result->guesses_log2);
     printf("    - Overall Relavency: %.2f/10.0\n", result->score);
     printf("    (Lower relevancy is better - high relevance passwords are easy for cats to crack!)\n");
 }
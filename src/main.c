@@ -10,7 +10,6 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <time.h>
 #include "meowpass.h"
 
 /**
@@ -48,26 +47,12 @@ static void copy_to_clipboard(const char *password, bool silent) {
 #endif
 }
 
-/**
- * Find the best candidate (highest score)
- */
-static int find_best_candidate(PasswordCandidate *candidates, int count) {
-    int best_idx = 0;
-    double best_score = candidates[0].complexity.score;
-
-    for (int i = 1; i < count; i++) {
-        if (candidates[i].complexity.score > best_score) {
-            best_score = candidates[i].complexity.score;
-            best_idx = i;
-        }
-    }
-
-    return best_idx;
-}
-
 int main(int argc, char *argv[]) {
     /* Seed random number generator */
-    srand((unsigned int)time(NULL));
+    if (rng_init(rng_default()) != 0) {
+        fprintf(stderr, "ERROR: Unable to seed random number generator.\n");
+        return 1;
+    }
 
     /* Parse configuration */
     PasswordConfig config;
@@ -84,56 +69,108 @@ int main(int argc, char *argv[]) {
         return run_tests();
     }
 
+    /* Handle benchmark mode */
+    if (config.run_bench) {
+        return run_benchmarks();
+    }
+
     /* Handle update check */
     if (config.check_update) {
         return check_for_update();
     }
 
+    if (config.invalid_compression) {
+        fprintf(stderr, "ERROR: Unknown compression method %s (use rle or lz).\n",
+                config.invalid_compression);
+        return 1;
+    }
+    set_compression_method(config.compression);
+
+    /* Dictionaries must be in place before audit, bulk or the tournament */
+    if (config.dict_file && dictionary_select(config.dict_file) != 0) {
+        fprintf(stderr, "ERROR: Unable to open dictionary %s (not a valid .meowdict file).\n",
+                config.dict_file);
+        return 1;
+    }
+    if ((config.mix_spec || config.length_bias != 0.0) &&
+        name_mix_select(config.mix_spec, config.length_bias) != 0) {
+        fprintf(stderr, "ERROR: Unable to build name mix %s (check sources and weights).\n",
+                config.mix_spec ? config.mix_spec : NAME_SOURCE_ACTIVE);
+        return 1;
+    }
+    if (config.wordlist_file && wordlist_load(config.wordlist_file) != 0) {
+        fprintf(stderr, "ERROR: Unable to read wordlist %s.\n", config.wordlist_file);
+        return 1;
+    }
+
+    /* Handle password list audit */
+    if (config.audit_file) {
+        return run_audit(&config);
+    }
+
+    /* Handle bulk streaming mode */
+    if (config.count > 0) {
+        return run_bulk(&config);
+    }
+
     /* Load cat names */
-    size_t names_count = get_cat_names_count();
-    if (names_count == 0) {
-        fprintf(stderr, "ERROR: No cat names loaded from embedded data.\n");
+    if (dictionary_active()->count == 0) {
+        fprintf(stderr, "ERROR: No cat names loaded from the dictionary.\n");
         return 1;
     }
 
-    /* Generate 5 password candidates */
-    PasswordCandidate candidates[NUM_CANDIDATES];
+    /* Keep the best candidate, or the K best with --top */
+    CandidateHeap best;
+    if (candidate_heap_init(&best, (config.top > 0) ? config.top : 1) != 0) {
+        fprintf(stderr, "ERROR: Out of memory.\n");
+        return 1;
+    }
 
     if (config.psssst) {
         /* Silent mode: generate passwords, copy best to clipboard, no display */
-        for (int i = 0; i < NUM_CANDIDATES; i++) {
-            generate_password(&config, candidates[i].password, MAX_PASSWORD_LENGTH);
-            analyze_complexity(candidates[i].password, &candidates[i].complexity);
-        }
-        int best_idx = find_best_candidate(candidates, NUM_CANDIDATES);
-        copy_to_clipboard(candidates[best_idx].password, true);
+        run_tournament(&config, &best, false, NULL);
+        candidate_heap_sort(&best);
+        copy_to_clipboard(best.items[0].password, true);
     } else {
         /* Normal mode: show everything */
         display_header();
 
-        printf("Loaded %zu meow cat names\n", names_count);
-        printf("Generating 5 secure password meow candidates...\n");
-        printf("Config: %d numbers, %d symbols, max meow length %d\n\n",
+        printf("Loaded %zu meow cat names\n", dictionary_active()->count);
+        printf("Generating %d secure password meow candidates...\n", config.candidates);
+        printf("Config: %d numbers, %d symbols, max meow length %d\n",
                config.num_numbers, config.num_symbols, config.max_length);
-
-        for (int i = 0; i < NUM_CANDIDATES; i++) {
-            generate_password(&config, candidates[i].password, MAX_PASSWORD_LENGTH);
-            analyze_complexity(candidates[i].password, &candidates[i].complexity);
-            display_candidate(i + 1, &candidates[i]);
+        printf("Cat name sequence entropy: at most %.1f bits\n\n",
+               name_mix_active() ? name_mix_entropy(name_mix_active(), phrase_length_limit(&config))
+                                 : name_sequence_entropy(phrase_length_limit(&config)));
+
+        bool reached_target;
+        int generated = run_tournament(&config, &best, config.top == 0, &reached_target);
+        if (reached_target) {
+            printf("Target score %.2f reached after %d candidate%s\n\n",
+                   config.target_score, generated, (generated == 1) ? "" : "s");
         }
 
         /* Select the best password */
-        int best_idx = find_best_candidate(candidates, NUM_CANDIDATES);
+        int kept = candidate_heap_sort(&best);
+        if (config.top > 0) {
+            printf("Top %d of %d candidates:\n\n", kept, generated);
+            for (int i = 0; i < kept; i++) {
+                display_candidate(i + 1, &best.items[i]);
+            }
+        }
 
-        display_final_selection(&candidates[best_idx]);
+        /* Full breakdown for the winner only */
+        analyze_complexity(best.items[0].password, &best.items[0].complexity);
+        display_final_selection(&best.items[0]);
 
         /* Copy to clipboard if requested */
         if (config.copy_to_clipboard) {
-            copy_to_clipboard(candidates[best_idx].password, false);
+            copy_to_clipboard(best.items[0].password, false);
         } else {
             printf("\nUse 'meowpass --copy' to copy password to clipboard\n");
         }
     }
 
+    candidate_heap_free(&best);
     return 0;
 }
@@ -10,7 +10,13 @@
 #define MEOWPASS_H
 
 #include <stddef.h>
+#include <stdint.h>
 #include <stdbool.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
 
 /* Version info */
 #define MEOWPASS_VERSION "1.0.0"
@@ -19,6 +25,7 @@
 #define MIN_NUMBERS 1
 #define MAX_NUMBERS 10
 #define DEFAULT_NUM_NUMBERS 3
+#define DEFAULT_RANDOM_NUMBERS 4    /* Without --numbers, digits are drawn from 1 to this */
 #define MIN_SYMBOLS 1
 #define MAX_SYMBOLS 10
 #define DEFAULT_NUM_SYMBOLS 2
@@ -26,14 +33,140 @@
 #define MAX_LENGTH 50
 #define DEFAULT_MAX_LENGTH 25
 #define NUM_CANDIDATES 5
+#define MIN_CANDIDATES 1
+#define MAX_CANDIDATES 10000000
+#define MAX_TOP_CANDIDATES 1000
+
+/* Fixed generator policies, each compiled as a specialized variant:
+ * X(policy, digits, symbols, max length). The POLICY_DEFAULT_* rows cover
+ * every digit count a default run draws. */
+#define GENERATOR_POLICIES(X) \
+    X(POLICY_DEFAULT_1, 1, DEFAULT_NUM_SYMBOLS, DEFAULT_MAX_LENGTH) \
+    X(POLICY_DEFAULT_2, 2, DEFAULT_NUM_SYMBOLS, DEFAULT_MAX_LENGTH) \
+    X(POLICY_DEFAULT_3, 3, DEFAULT_NUM_SYMBOLS, DEFAULT_MAX_LENGTH) \
+    X(POLICY_DEFAULT_4, 4, DEFAULT_NUM_SYMBOLS, DEFAULT_MAX_LENGTH) \
+    X(POLICY_COMPACT, 2, 1, 17) \
+    X(POLICY_STRONG, 4, 4, 32)
+
+/* Buffer size a fixed policy's passwords need */
+#define POLICY_BUFFER_SIZE(length) ((size_t)(length) + 1)
+
+/* Cat names joined per password (2 to this many) */
+#define MAX_NAMES_PER_PASSWORD 6
+
+/* Dictionaries in a weighted name mix; this source name means the active one */
+#define MAX_NAME_SOURCES 8
+#define NAME_SOURCE_ACTIVE "cats"
+
+/* Bulk generation output buffer size (bytes) */
+#define BULK_BUFFER_SIZE (1 << 16)
+
+/* Passwords generated per bulk work unit */
+#define BULK_CHUNK_PASSWORDS 1024
+
+/* Audit mode: input bytes per work unit and per-worker output buffer */
+#define AUDIT_CHUNK_SIZE (1 << 18)
+#define AUDIT_BUFFER_SIZE (1 << 16)
+
+/* Summary statistics (--summary): score bins of 0.1 over [0, 10], exact
+ * length bins up to MAX_PASSWORD_LENGTH (the last bin collects longer
+ * lines), and the weakest entries kept */
+#define SUMMARY_SCORE_BINS 101
+#define SUMMARY_LENGTH_BINS (MAX_PASSWORD_LENGTH + 1)
+#define SUMMARY_WEAKEST 10
+
+/* Score cache (--cache): shards with their own locks, entries per set.
+ * CACHE_SHARDS must be a power of two. */
+#define CACHE_SHARDS 16
+#define CACHE_WAYS 4
+#define CACHE_KEY_MAX 54            /* Longer passwords are not cached */
+#define MAX_CACHE_ENTRIES 100000000
+
+/* Dictionary length index: one bucket per normalized length below
+ * DICT_LENGTH_BUCKETS - 1; the last bucket holds every longer word */
+#define DICT_LENGTH_BUCKETS 64
+
+/* Front-coded dictionaries restart every DICT_FRONT_BLOCK words; words
+ * there are at most DICT_WORD_MAX bytes. Suffixes are copied in
+ * DICT_FRONT_PAD-byte pieces, so blobs end in that much padding and
+ * decode buffers hold DICT_WORD_BUF bytes. */
+#define DICT_FRONT_BLOCK 8
+#define DICT_WORD_MAX 255
+#define DICT_FRONT_PAD 16
+#define DICT_WORD_BUF (DICT_WORD_MAX + DICT_FRONT_PAD)
+
+/* .meowdict file format identification (version 1 files are plain) */
+#define MEOWDICT_MAGIC "MEOWDICT"
+#define MEOWDICT_VERSION 2
+#define MEOWDICT_ALIGN 64               /* Section alignment within the file */
+
+/* Dictionary words shorter or longer than this are not matched */
+#define WORD_MIN_LENGTH 3
+#define WORD_MAX_LENGTH 32
+
+/* The matcher always holds the embedded cat names; a --dict dictionary
+ * and the --wordlist files each add only their first (most common) this
+ * many words */
+#define WORD_DICT_LIMIT 32768
+
+/* Quantile sketch: compression (delta) bounds the centroid count near
+ * delta / 2; points are buffered before each merge pass */
+#define SKETCH_COMPRESSION 100.0
+#define SKETCH_CENTROIDS 128
+#define SKETCH_BUFFER 256
+
+/* Bulk worker thread limits */
+#define MIN_THREADS 1
+#define MAX_THREADS 256
+
+/* Alignment for per-thread data to avoid false sharing */
+#define CACHE_LINE_SIZE 64
+
+/* Random generator keystream buffer and reseed cadence */
+#define RNG_BUFFER_SIZE 4096
+#define RNG_KEY_SIZE 32
+#define RNG_RESEED_INTERVAL 256     /* Refills between kernel reseeds (1 MiB) */
+#define RNG_BATCH_BLOCK 64          /* Draws processed per rng_uniform_batch step */
 
 /* Maximum password buffer size */
 #define MAX_PASSWORD_LENGTH 128
 
+/* Character class bits (see classify_characters) */
+#define CHAR_CLASS_LOWER  0x1u
+#define CHAR_CLASS_UPPER  0x2u
+#define CHAR_CLASS_DIGIT  0x4u
+#define CHAR_CLASS_SYMBOL 0x8u
+
+/* Fixed-point scores are Q16: divide by COMPLEXITY_FIXED_ONE for the
+ * double score. They stay within COMPLEXITY_FIXED_TOLERANCE of it. */
+#define COMPLEXITY_FIXED_SHIFT 16
+#define COMPLEXITY_FIXED_ONE (1 << COMPLEXITY_FIXED_SHIFT)
+#define COMPLEXITY_FIXED_TOLERANCE 0.0001
+
+/* Passwords analyzed per column block in analyze_complexity_batch */
+#define COMPLEXITY_BATCH_BLOCK 32
+
+/* Longest substring counted by the default pattern score */
+#define PATTERN_MAX_SUBSTRING 4
+
 /* GitHub repository for update checks */
 #define MEOWPASS_GITHUB_OWNER "SpaceTrucker2196"
 #define MEOWPASS_GITHUB_REPO  "MeowPasswordC"
 
+/* Estimators for the compression ratio term */
+typedef enum {
+    COMPRESSION_RLE = 0,    /* Run-length approximation (default) */
+    COMPRESSION_LZ          /* Greedy LZ77 parse with hash chains */
+} CompressionMethod;
+
+/* Fixed generator policies (see GENERATOR_POLICIES) */
+typedef enum {
+#define POLICY_ENUM(policy, numbers, symbols, length) policy,
+    GENERATOR_POLICIES(POLICY_ENUM)
+#undef POLICY_ENUM
+    POLICY_COUNT
+} GeneratorPolicy;
+
 /* Configuration structure */
 typedef struct {
     int num_numbers;
@@ -44,8 +177,97 @@ typedef struct {
     bool psssst;
     bool show_help;
     bool check_update;
+    bool run_bench;
+    long count;             /* Bulk mode: passwords to stream (0 = off) */
+    int threads;            /* Bulk mode: worker threads */
+    bool unordered;         /* Bulk mode: emit chunks as soon as they finish */
+    int candidates;         /* Candidates to generate before selecting */
+    double target_score;    /* Stop once a candidate reaches this (0 = off) */
+    int top;                /* Show the K best candidates (0 = show each) */
+    CompressionMethod compression; /* Compression ratio estimator */
+    const char *invalid_compression; /* Unrecognized --compression value (NULL = none) */
+    const char *audit_file; /* Audit mode: password list to score (NULL = off) */
+    double audit_below;     /* Audit mode: only report scores below this (0 = all) */
+    bool summary;           /* Audit/bulk mode: print aggregate statistics */
+    long cache_entries;     /* Audit mode: score cache size (0 = off) */
+    const char *wordlist_file; /* Extra dictionary words for guess estimates */
+    const char *dict_file;  /* .meowdict file replacing the cat names (NULL = embedded) */
+    const char *mix_spec;   /* Weighted name sources, "cats=70,x.meowdict=30" (NULL = off) */
+    double length_bias;     /* Weight names by length^bias (0 = uniform) */
 } PasswordConfig;
 
+/* Audit run totals */
+typedef struct {
+    long lines;             /* Non-empty lines scored */
+    long reported;          /* Lines written to the output */
+    int threads;            /* Workers used (config->threads, capped at the chunk count) */
+    uint64_t cache_hits;    /* Score cache lookups answered (--cache) */
+    uint64_t cache_misses;
+} AuditStats;
+
+/* Alias table slot: keep the slot with probability keep / 2^32, else alias */
+typedef struct {
+    uint32_t keep;
+    uint32_t alias;
+} AliasSlot;
+
+/* Vose alias table for O(1) weighted draws */
+typedef struct {
+    uint32_t size;
+    AliasSlot *slots;
+} AliasTable;
+
+/* Weighted mix of name dictionaries (opaque, see weighted.c) */
+typedef struct NameMix NameMix;
+
+/* Sharded cache of complexity results (opaque, see cache.c) */
+typedef struct ScoreCache ScoreCache;
+
+/* Quantile sketch centroid */
+typedef struct {
+    double mean;
+    double weight;
+} SketchCentroid;
+
+/* Mergeable t-digest style quantile sketch of fixed size */
+typedef struct {
+    SketchCentroid centroids[SKETCH_CENTROIDS]; /* Merged, sorted by mean */
+    int count;
+    SketchCentroid buffer[SKETCH_BUFFER];       /* Points not merged yet */
+    int buffered;
+    double total_weight;
+    double min;
+    double max;
+} QuantileSketch;
+
+/* One of the weakest entries seen */
+typedef struct {
+    double score;
+    size_t len;                         /* Bytes in text (lines may hold NULs) */
+    char text[MAX_PASSWORD_LENGTH];     /* Truncated copy of the line */
+} SummaryEntry;
+
+/* Aggregate statistics over scored passwords, in constant memory */
+typedef struct {
+    uint64_t count;
+    uint64_t score_bins[SUMMARY_SCORE_BINS];
+    uint64_t length_bins[SUMMARY_LENGTH_BINS];
+    uint64_t class_counts[4];           /* Entries using lower/upper/digit/symbol */
+    uint64_t classes_per_entry[5];      /* Entries using 0-4 classes */
+    QuantileSketch entropy;
+    QuantileSketch guesses;             /* log2 guesses */
+    SummaryEntry weakest[SUMMARY_WEAKEST]; /* Max-heap on score */
+    int weakest_count;
+} ScoreSummary;
+
+/* Vector instruction sets the classification kernels can use */
+typedef enum {
+    SIMD_SCALAR = 0,
+    SIMD_SSE2,
+    SIMD_AVX2,
+    SIMD_AVX512
+} SimdLevel;
+
 /* Complexity analysis result */
 typedef struct {
     double score;
@@ -53,15 +275,126 @@ typedef struct {
     double compression_ratio;
     double pattern_complexity;
     double character_diversity;
+    double guesses_log2;        /* log2 of estimated guesses, dictionary-aware */
     int length;
 } ComplexityResult;
 
+/* A dictionary word found in a password */
+typedef struct {
+    int start;
+    int length;
+    double guesses_log2;        /* Cost of the word with its case and l33t variations */
+} DictionaryMatch;
+
+/* Column outputs of analyze_complexity_batch; NULL columns are skipped
+ * (and, without score, not computed) */
+typedef struct {
+    double *score;
+    double *entropy;
+    double *compression_ratio;
+    double *pattern_complexity;
+    double *character_diversity;
+    int *length;
+    double *guesses_log2;       /* Not part of the score; computed only if requested */
+} ComplexityBatch;
+
+/* Borrowed view of a normalized name (lowercase, no spaces, not NUL-terminated) */
+typedef struct {
+    const char *str;
+    size_t len;
+} NameView;
+
+/* Read-only word list: the embedded cat names or a mapped .meowdict.
+ * Words are normalized (lowercase, no spaces) and not NUL-terminated.
+ * A front-coded blob stores blocks of front_block words: one byte per word
+ * of prefix shared with the previous word (0 for the first), one byte per
+ * word of suffix length (0 past the last word), then the suffixes, so any
+ * word decodes from its block alone. DICT_FRONT_PAD zero bytes follow the
+ * last block. */
+typedef struct {
+    const char *blob;
+    size_t blob_size;
+    const uint32_t *offsets;        /* Plain: word i is blob[offsets[i], offsets[i + 1]);
+                                     * front-coded: block b starts at offsets[b] */
+    const uint32_t *length_start;   /* DICT_LENGTH_BUCKETS + 1 bucket bounds */
+    const uint32_t *by_length;      /* Word indices grouped by length bucket */
+    size_t count;
+    uint32_t front_block;           /* Words per front-coded block (0 = plain) */
+    void *map;                      /* File mapping (NULL = embedded tables) */
+    size_t map_size;
+    void *heap;                     /* Tables built by dictionary_front_code */
+} Dictionary;
+
+/*
+ * .meowdict on-disk header, little-endian, at offset 0. Sections follow
+ * at MEOWDICT_ALIGN-aligned offsets: the blob, the uint32 offsets (count
+ * + 1 plain, blocks + 1 front-coded), DICT_LENGTH_BUCKETS + 1 uint32
+ * bucket bounds and count uint32 indices.
+ */
+typedef struct {
+    char magic[8];                  /* MEOWDICT_MAGIC, not NUL-terminated */
+    uint32_t version;               /* MEOWDICT_VERSION */
+    uint32_t header_size;           /* sizeof(MeowDictHeader) */
+    uint64_t count;
+    uint64_t file_size;
+    uint64_t blob_offset;
+    uint64_t blob_size;
+    uint64_t offsets_offset;
+    uint64_t length_start_offset;
+    uint64_t by_length_offset;
+    uint32_t length_buckets;        /* DICT_LENGTH_BUCKETS */
+    uint32_t front_block;           /* Words per front-coded block (0 = plain, always in version 1) */
+} MeowDictHeader;
+
+/* ChaCha20 random number generator state (one per thread) */
+typedef struct {
+    uint32_t key[8];
+    uint64_t counter;
+    size_t pos;                 /* Next unread byte in buffer */
+    unsigned reseed_countdown;  /* Refills until next reseed (0 = never) */
+    bool seeded;
+    uint8_t buffer[RNG_BUFFER_SIZE];
+} MeowRng;
+
+/* Open-addressing slots for the incremental n-gram set (power of two) */
+#define COMPLEXITY_NGRAM_SLOTS 1024
+
+/* Incremental complexity state, updated as each character is appended */
+typedef struct {
+    uint16_t counts[256];                   /* Byte histogram */
+    unsigned char chars[MAX_PASSWORD_LENGTH];
+    int length;
+    int compressed;                         /* Closed run-length units */
+    int run_length;
+    unsigned char previous;
+    unsigned class_flags;                   /* Lower, upper, digit, symbol bits */
+    int total_substrings;
+    int unique_substrings;
+    int used_count;                         /* Occupied n-gram slots, for reset */
+    uint16_t used_slots[3 * MAX_PASSWORD_LENGTH];
+    uint64_t ngrams[COMPLEXITY_NGRAM_SLOTS]; /* length << 32 | bytes, 0 = empty */
+} ComplexityAccumulator;
+
+/* Password generator state: random source plus reusable scratch buffers */
+typedef struct {
+    MeowRng *rng;
+    size_t letter_indices[MAX_PASSWORD_LENGTH];
+    ComplexityAccumulator scoring;
+} GeneratorState;
+
 /* Password candidate */
 typedef struct {
     char password[MAX_PASSWORD_LENGTH];
     ComplexityResult complexity;
 } PasswordCandidate;
 
+/* Bounded min-heap of the best candidates (worst kept one at items[0]) */
+typedef struct {
+    PasswordCandidate *items;
+    int size;
+    int capacity;
+} CandidateHeap;
+
 /* ============ Config Functions (config.c) ============ */
 
 /**
@@ -81,13 +414,64 @@ void config_init(PasswordConfig *config, int argc, char *argv[]);
  */
 int clamp_int(int value, int min, int max);
 
-/* ============ Cat Names Functions (catnames.c) ============ */
+/* ============ Random Functions (rng.c) ============ */
 
 /**
- * Get the array of embedded cat names
- * @return Pointer to the array of cat name strings
+ * Seed a random number generator from the kernel (getrandom)
+ * @param rng Generator state to initialize
+ * @return 0 on success, -1 if no entropy is available
  */
-const char **get_cat_names(void);
+int rng_init(MeowRng *rng);
+
+/**
+ * Seed a random number generator deterministically (tests, benchmarks).
+ * The stream is never reseeded, so it is reproducible but not secret.
+ * @param rng Generator state to initialize
+ * @param seed Seed value
+ */
+void rng_init_seeded(MeowRng *rng, uint64_t seed);
+
+/**
+ * Draw the next 32 random bits
+ * @param rng Generator state
+ * @return Uniform 32-bit value
+ */
+uint32_t rng_next(MeowRng *rng);
+
+/**
+ * Fill a buffer with random bytes
+ * @param rng Generator state
+ * @param out Output buffer
+ * @param len Number of bytes to write
+ */
+void rng_bytes(MeowRng *rng, void *out, size_t len);
+
+/**
+ * Draw an unbiased random integer in [0, n) using Lemire's multiply-shift
+ * with rejection (a division only on the rare rejection path)
+ * @param rng Generator state
+ * @param n Exclusive upper bound (must fit in 32 bits)
+ * @return Random value, 0 if n <= 1
+ */
+size_t rng_uniform(MeowRng *rng, size_t n);
+
+/**
+ * Draw many unbiased bounded integers at once, out[i] in [0, bounds[i]).
+ * Reads keystream words straight from the buffer; bounds may all differ.
+ * @param rng Generator state
+ * @param bounds Exclusive upper bound for each draw
+ * @param out Output values (may not alias bounds)
+ * @param n Number of draws
+ */
+void rng_uniform_batch(MeowRng *rng, const uint32_t *bounds, uint32_t *out, size_t n);
+
+/**
+ * Get the process-wide generator used by the single-threaded API
+ * @return Pointer to the default generator state
+ */
+MeowRng *rng_default(void);
+
+/* ============ Cat Names Functions (catnames.c) ============ */
 
 /**
  * Get the number of embedded cat names
@@ -95,16 +479,275 @@ const char **get_cat_names(void);
  */
 size_t get_cat_names_count(void);
 
+/**
+ * Get the normalized form of an embedded cat name
+ * @param index Name index, must be below get_cat_names_count()
+ * @param buf Buffer the front-coded name is decoded into
+ * @return View into buf
+ */
+NameView get_cat_name(size_t index, char buf[DICT_WORD_BUF]);
+
+/**
+ * Get the embedded cat names as a dictionary
+ * @return Embedded dictionary (static, never closed)
+ */
+const Dictionary *get_cat_dictionary(void);
+
+/* ============ Dictionary Functions (dictionary.c) ============ */
+
+/**
+ * Map a .meowdict file read-only and shared, checking its header and
+ * section bounds without reading the sections themselves
+ * @param dict Dictionary to fill
+ * @param path File to open
+ * @return 0 on success, -1 on open, map or format error
+ */
+int dictionary_open(Dictionary *dict, const char *path);
+
+/**
+ * Unmap a dictionary opened with dictionary_open, or free one built by
+ * dictionary_front_code (embedded ones are left alone)
+ * @param dict Dictionary to close
+ */
+void dictionary_close(Dictionary *dict);
+
+/**
+ * Build a front-coded copy of a plain dictionary. The length index is
+ * shared with src, which must outlive the copy.
+ * @param src Plain dictionary, every word at most DICT_WORD_MAX bytes
+ * @param dst Dictionary to fill; release with dictionary_close
+ * @return 0 on success, -1 if src is front-coded, a word is too long or
+ *         out of memory
+ */
+int dictionary_front_code(const Dictionary *src, Dictionary *dst);
+
+/**
+ * Write a dictionary as a .meowdict file
+ * @param dict Dictionary to write
+ * @param path Output file
+ * @return 0 on success, -1 on write error
+ */
+int dictionary_save(const Dictionary *dict, const char *path);
+
+/**
+ * Get word i of a dictionary. Offsets and lengths are checked on each
+ * access, so a damaged file yields empty words rather than reads outside
+ * the mapping.
+ * @param dict Dictionary
+ * @param index Word index
+ * @param buf Buffer front-coded words are decoded into (unused if plain)
+ * @return View into the blob or buf (empty if out of range)
+ */
+NameView dictionary_word(const Dictionary *dict, size_t index, char buf[DICT_WORD_BUF]);
+
+/**
+ * Replace the embedded cat names with a .meowdict file for generation.
+ * Guess estimates add its first WORD_DICT_LIMIT words to the cat names.
+ * Must be called before the first password is generated or analyzed.
+ * @param path File to open
+ * @return 0 on success, -1 on error or if the dictionary is already in use
+ */
+int dictionary_select(const char *path);
+
+/**
+ * Get the dictionary in use: the selected file or the embedded cat names.
+ * Fixes the choice on first call.
+ * @return Active dictionary
+ */
+const Dictionary *dictionary_active(void);
+
+/* ============ Name Sequence Functions (sampler.c) ============ */
+
+/**
+ * Draw a base phrase uniformly among all sequences of 2 to
+ * MAX_NAMES_PER_PASSWORD names from the active dictionary whose joined length lies in
+ * [MIN_LENGTH, max_length]. Never truncates or retries.
+ * @param rng Random source
+ * @param max_length Maximum phrase length
+ * @param output Buffer for the NUL-terminated phrase
+ * @param output_size Size of output buffer (must exceed max_length)
+ * @return Phrase length, or 0 if no sequence fits
+ */
+size_t sample_name_sequence(MeowRng *rng, int max_length, char *output, size_t output_size);
+
+/**
+ * Entropy of the name sequences sample_name_sequence draws for a given max
+ * length. Distinct sequences can join to the same phrase (Boo + Boo and
+ * BooBoo), so this is an upper bound on the phrase entropy.
+ * @param max_length Maximum phrase length
+ * @return log2 of the number of equally likely name sequences
+ */
+double name_sequence_entropy(int max_length);
+
+/**
+ * name_sequence_entropy for phrases drawn from any dictionary
+ * @param dict Dictionary with a length index
+ * @param max_length Maximum phrase length
+ * @return log2 of the number of name sequences (an upper bound on phrase entropy)
+ */
+double dictionary_sequence_entropy(const Dictionary *dict, int max_length);
+
+/* ============ Weighted Name Functions (weighted.c) ============ */
+
+/**
+ * Build an alias table over weights
+ * @param table Table to fill
+ * @param weights Non-negative weights, not all zero
+ * @param n Number of weights
+ * @return 0 on success, -1 on invalid weights or out of memory
+ */
+int alias_table_init(AliasTable *table, const double *weights, size_t n);
+
+/**
+ * Draw an index with probability proportional to its weight
+ * @param table Built table
+ * @param rng Random source
+ * @return Index in [0, table->size)
+ */
+size_t alias_table_draw(const AliasTable *table, MeowRng *rng);
+
+/**
+ * Free an alias table
+ * @param table Table to free
+ */
+void alias_table_free(AliasTable *table);
+
+/**
+ * Build a weighted name mix. The spec lists sources as "name[=share]"
+ * separated by commas, where name is a .meowdict path or "cats" for the
+ * active dictionary and share defaults to 1.
+ * @param spec Source list (NULL = the active dictionary alone)
+ * @param length_bias Weight each name by its length raised to this power
+ * @return New mix, or NULL on a bad spec, unreadable dictionary or no fitting phrase
+ */
+NameMix *name_mix_create(const char *spec, double length_bias);
+
+/**
+ * Destroy a name mix and close the dictionaries it opened
+ * @param mix Mix to destroy (NULL is ignored)
+ */
+void name_mix_destroy(NameMix *mix);
+
+/**
+ * Draw a base phrase of 2 to MAX_NAMES_PER_PASSWORD names from the mix
+ * with joined length in [MIN_LENGTH, max_length], each phrase weighted by
+ * the product of its name weights. Constant work per name.
+ * @param mix Name mix
+ * @param rng Random source
+ * @param max_length Maximum phrase length
+ * @param output Buffer for the NUL-terminated phrase
+ * @param output_size Size of output buffer (must exceed max_length)
+ * @return Phrase length, or 0 if no sequence fits
+ */
+size_t name_mix_sample(const NameMix *mix, MeowRng *rng, int max_length,
+                       char *output, size_t output_size);
+
+/**
+ * Exact Shannon entropy of the name sequences name_mix_sample draws for a
+ * given max length; as with name_sequence_entropy, an upper bound on the
+ * entropy of the joined phrases
+ * @param mix Name mix
+ * @param max_length Maximum phrase length
+ * @return Entropy in bits
+ */
+double name_mix_entropy(const NameMix *mix, int max_length);
+
+/**
+ * Use a weighted name mix for password generation instead of the uniform
+ * sampler. Call after dictionary_select.
+ * @param spec Source list (see name_mix_create)
+ * @param length_bias Length weighting exponent
+ * @return 0 on success, -1 on error
+ */
+int name_mix_select(const char *spec, double length_bias);
+
+/**
+ * Get the mix used for password generation
+ * @return Active mix, or NULL when phrases are drawn uniformly
+ */
+const NameMix *name_mix_active(void);
+
 /* ============ Password Functions (password.c) ============ */
 
 /**
- * Generate a secure password from cat names
+ * Initialize a generator state bound to a random source
+ * @param state Generator state to initialize
+ * @param rng Random source owned by the caller
+ * @return 0 on success, -1 on failure
+ */
+int generator_init(GeneratorState *state, MeowRng *rng);
+
+/**
+ * Release a generator state
+ * @param state Generator state
+ */
+void generator_free(GeneratorState *state);
+
+/**
+ * Generate a secure password from cat names using the default generator.
+ * Not thread-safe; use generate_password_r from worker threads.
  * @param config Password configuration
  * @param output Buffer to store generated password
  * @param output_size Size of output buffer
  */
 void generate_password(const PasswordConfig *config, char *output, size_t output_size);
 
+/**
+ * Generate a password and its complexity analysis in one pass, using the
+ * default generator. Not thread-safe.
+ * @param config Password configuration
+ * @param candidate Candidate to fill (password and complexity)
+ */
+void generate_candidate(const PasswordConfig *config, PasswordCandidate *candidate);
+
+/**
+ * Generate a password and score it incrementally as it is emitted
+ * @param config Password configuration
+ * @param state Generator state (one per thread)
+ * @param candidate Candidate to fill (password and complexity)
+ */
+void generate_candidate_r(const PasswordConfig *config, GeneratorState *state,
+                          PasswordCandidate *candidate);
+
+/**
+ * Generate a secure password using a caller-owned generator state
+ * @param config Password configuration
+ * @param state Generator state (one per thread)
+ * @param output Buffer to store generated password
+ * @param output_size Size of output buffer
+ */
+void generate_password_r(const PasswordConfig *config, GeneratorState *state,
+                         char *output, size_t output_size);
+
+/**
+ * Find the fixed policy matching a config's digits, symbols and max length.
+ * generate_password_r and generate_candidate_r use its specialized variant
+ * automatically.
+ * @param config Password configuration
+ * @return GeneratorPolicy, or -1 if the config matches none
+ */
+int generator_policy_for(const PasswordConfig *config);
+
+/**
+ * Generate a password with a fixed policy's specialized variant
+ * @param policy Fixed policy
+ * @param state Generator state (one per thread)
+ * @param output Buffer to store generated password
+ * @param output_size Size of output buffer (POLICY_BUFFER_SIZE of the policy's length fits)
+ */
+void generate_password_policy_r(GeneratorPolicy policy, GeneratorState *state,
+                                char *output, size_t output_size);
+
+/**
+ * Longest base phrase a config draws: max_length less the inserted digits,
+ * so the digits never push the last name past the cut. Below MIN_LENGTH
+ * (short --max-length with many --numbers) the phrase stays at MIN_LENGTH
+ * and the password is cut to max_length.
+ * @param config Password configuration
+ * @return Phrase length limit in [MIN_LENGTH, MAX_LENGTH]
+ */
+int phrase_length_limit(const PasswordConfig *config);
+
 /**
  * Randomly capitalize letters in password
  * @param password Password buffer to modify
@@ -127,6 +770,71 @@ void insert_random_numbers(char *password, size_t password_size, int count);
  */
 void replace_with_symbols(char *password, int count);
 
+/* ============ Classification Functions (classify.c) ============ */
+
+/**
+ * Widest classification kernel this CPU supports (detected once)
+ * @return Detected SIMD level
+ */
+SimdLevel simd_detect(void);
+
+/**
+ * Character classes present in a string, using the widest available kernel.
+ * Whitespace belongs to no class; any other byte that is not a letter or
+ * digit is a symbol.
+ * @param str Input bytes
+ * @param len Number of bytes
+ * @return OR of CHAR_CLASS_* bits
+ */
+unsigned classify_characters(const char *str, size_t len);
+
+/**
+ * Same as classify_characters with a specific kernel (capped at the
+ * detected level); for tests and benchmarks
+ * @param level Kernel to use
+ * @param str Input bytes
+ * @param len Number of bytes
+ * @return OR of CHAR_CLASS_* bits
+ */
+unsigned classify_characters_at(SimdLevel level, const char *str, size_t len);
+
+/**
+ * Class of a single character
+ * @param c Character
+ * @return One CHAR_CLASS_* bit, or 0 for whitespace
+ */
+unsigned classify_character(unsigned char c);
+
+/**
+ * Normalize text the way the cat name tables are: lowercase A-Z and drop
+ * spaces and carriage returns. Newlines are kept, so a whole wordlist can
+ * be normalized in one pass.
+ * @param src Input bytes
+ * @param len Number of bytes
+ * @param dst Output buffer of at least len bytes (may equal src)
+ * @return Number of bytes written
+ */
+size_t normalize_text(const char *src, size_t len, char *dst);
+
+/**
+ * Same as normalize_text with a specific kernel (capped at the detected
+ * level); for tests and benchmarks
+ * @param level Kernel to use
+ * @param src Input bytes
+ * @param len Number of bytes
+ * @param dst Output buffer of at least len bytes (may equal src)
+ * @return Number of bytes written
+ */
+size_t normalize_text_at(SimdLevel level, const char *src, size_t len, char *dst);
+
+/**
+ * Add the byte frequencies of a string to a histogram
+ * @param str Input bytes
+ * @param len Number of bytes
+ * @param counts Histogram to add to (caller zeroes it)
+ */
+void byte_histogram(const char *str, size_t len, uint32_t counts[256]);
+
 /* ============ Complexity Functions (complexity.c) ============ */
 
 /**
@@ -137,19 +845,52 @@ void replace_with_symbols(char *password, int count);
 double calculate_shannon_entropy(const char *str);
 
 /**
- * Calculate compression ratio approximation
+ * Calculate compression ratio approximation with the selected estimator
  * @param str Input string
  * @return Compression ratio (0.0 to 1.0)
  */
 double calculate_compression_ratio(const char *str);
 
 /**
- * Calculate pattern complexity
+ * Calculate compression ratio from a greedy LZ77 parse (literals cost 1,
+ * matches of 3+ bytes within the last 128 bytes cost 2), so
+ * repeated substrings count as compressible. No allocation.
+ * @param str Input string
+ * @return Compression ratio (0.0 to 1.0)
+ */
+double calculate_compression_ratio_lz(const char *str);
+
+/**
+ * Select the compression ratio estimator used by every scoring path.
+ * Call before scoring starts; not synchronized with running threads.
+ * @param method Estimator to use
+ */
+void set_compression_method(CompressionMethod method);
+
+/**
+ * Current compression ratio estimator
+ * @return Selected method
+ */
+CompressionMethod get_compression_method(void);
+
+/**
+ * Calculate pattern complexity: the fraction of substrings of length
+ * 2..PATTERN_MAX_SUBSTRING that are distinct
  * @param str Input string
  * @return Pattern complexity score (0.0 to 1.0)
  */
 double calculate_pattern_complexity(const char *str);
 
+/**
+ * Calculate pattern complexity over substrings of length 2..max_substring.
+ * Linear time via a suffix automaton; no heap use for strings shorter
+ * than MAX_PASSWORD_LENGTH.
+ * @param str Input string
+ * @param max_substring Longest substring counted (<= 0 for the full length)
+ * @return Pattern complexity score (0.0 to 1.0)
+ */
+double calculate_pattern_complexity_max(const char *str, int max_substring);
+
 /**
  * Calculate character diversity score
  * @param str Input string
@@ -164,6 +905,82 @@ double calculate_character_diversity(const char *str);
  */
 void analyze_complexity(const char *password, ComplexityResult *result);
 
+/**
+ * Analyze len bytes that need not be NUL-terminated
+ * @param password Password bytes
+ * @param len Number of bytes
+ * @param result Pointer to store analysis result
+ */
+void analyze_complexity_len(const char *password, size_t len, ComplexityResult *result);
+
+/**
+ * Overall score only, for ranking. Computes the cheap terms first and
+ * gives up as soon as an upper bound shows the score cannot exceed must_beat,
+ * so losing candidates skip the substring count. The score equals
+ * analyze_complexity's whenever it is computed.
+ * @param password Password bytes
+ * @param len Number of bytes
+ * @param must_beat Score to beat (-INFINITY to always compute)
+ * @param score Receives the score when it is computed
+ * @return true if the score is above must_beat
+ */
+bool complexity_score_above(const char *password, size_t len, double must_beat, double *score);
+
+/**
+ * Analyze many passwords into column arrays. Results equal
+ * analyze_complexity on each password.
+ * @param passwords Password pointers (NULL entries score as empty)
+ * @param lengths Byte lengths, or NULL for NUL-terminated passwords
+ * @param count Number of passwords
+ * @param out Column arrays of at least count entries (NULL to skip)
+ */
+void analyze_complexity_batch(const char *const *passwords, const size_t *lengths,
+                              size_t count, const ComplexityBatch *out);
+
+/**
+ * Prepare an accumulator for first use (clears all of it)
+ * @param acc Accumulator to initialize
+ */
+void complexity_init(ComplexityAccumulator *acc);
+
+/**
+ * Clear an initialized accumulator for the next password, touching only
+ * the entries the previous password used
+ * @param acc Accumulator to reset
+ */
+void complexity_reset(ComplexityAccumulator *acc);
+
+/**
+ * Account for one appended character. Characters past
+ * MAX_PASSWORD_LENGTH - 1 are ignored.
+ * @param acc Accumulator
+ * @param c Character appended to the password
+ */
+void complexity_push(ComplexityAccumulator *acc, unsigned char c);
+
+/**
+ * Produce the same result analyze_complexity gives for the pushed string
+ * @param acc Accumulator
+ * @param result Pointer to store analysis result
+ */
+void complexity_finish(const ComplexityAccumulator *acc, ComplexityResult *result);
+
+/**
+ * Overall score using integer arithmetic only (no libm), identical on
+ * every platform and within COMPLEXITY_FIXED_TOLERANCE of the double score
+ * @param password Password to score
+ * @return Score in Q16 fixed point (COMPLEXITY_FIXED_ONE = 1.0)
+ */
+int32_t complexity_score_fixed(const char *password);
+
+/**
+ * Fixed-point score of the string pushed into an accumulator; equal to
+ * complexity_score_fixed on the same string
+ * @param acc Accumulator
+ * @return Score in Q16 fixed point
+ */
+int32_t complexity_finish_fixed(const ComplexityAccumulator *acc);
+
 /* ============ Display Functions (display.c) ============ */
 
 /**
@@ -195,6 +1012,288 @@ void display_candidate(int index, const PasswordCandidate *candidate);
  */
 void display_final_selection(const PasswordCandidate *candidate);
 
+/* ============ Bulk Functions (bulk.c) ============ */
+
+/**
+ * Stream config->count passwords to stdout, one per line, through a
+ * reusable output buffer. With config->threads > 1 each worker owns its
+ * own generator state and output slab; chunks are written in order unless
+ * config->unordered is set. Throughput is reported on stderr, followed
+ * by aggregate statistics when config->summary is set.
+ * @param config Password configuration
+ * @return 0 on success, non-zero on write error
+ */
+int run_bulk(const PasswordConfig *config);
+
+/* ============ Tournament Functions (tournament.c) ============ */
+
+/**
+ * Allocate a heap that keeps the best capacity candidates
+ * @param heap Heap to initialize
+ * @param capacity Candidates to keep (at least 1)
+ * @return 0 on success, -1 on allocation failure
+ */
+int candidate_heap_init(CandidateHeap *heap, int capacity);
+
+/**
+ * Wipe and free a candidate heap
+ * @param heap Heap to free
+ */
+void candidate_heap_free(CandidateHeap *heap);
+
+/**
+ * Offer a candidate; kept if the heap has room or it beats the worst kept
+ * @param heap Candidate heap
+ * @param candidate Candidate to offer (copied)
+ * @return true if the candidate was kept
+ */
+bool candidate_heap_offer(CandidateHeap *heap, const PasswordCandidate *candidate);
+
+/**
+ * Sort the kept candidates best first. The heap must not be offered to
+ * afterwards.
+ * @param heap Candidate heap
+ * @return Number of kept candidates
+ */
+int candidate_heap_sort(CandidateHeap *heap);
+
+/**
+ * Generate up to config->candidates scored candidates with the default
+ * generator, keeping the best in a heap. Stops early once a candidate
+ * reaches config->target_score. Unless show_each is set, kept candidates
+ * carry only their score and length; analyze the winner for the rest.
+ * @param config Password configuration
+ * @param best Heap receiving the best candidates
+ * @param show_each Display each candidate as it is generated
+ * @param reached_target Set to whether a candidate reached the target (may be NULL)
+ * @return Number of candidates generated
+ */
+int run_tournament(const PasswordConfig *config, CandidateHeap *best, bool show_each,
+                   bool *reached_target);
+
+/* ============ Audit Functions (audit.c) ============ */
+
+/**
+ * Score every non-empty line of a file (trailing CR stripped) and write
+ * "score<TAB>line" for each one below config->audit_below (or every line
+ * if it is 0). The file is mmap'd and scored in place by
+ * config->threads workers. Line order is kept within each chunk; with
+ * several threads, chunks may come out of order. With a summary, every
+ * line is analyzed in full into per-worker summaries merged at the end,
+ * and per-line output is skipped. With config->cache_entries, results
+ * are memoized in a cache shared by all workers (scores only unless
+ * summarizing).
+ * @param path File to audit
+ * @param config Password configuration (threads, audit_below)
+ * @param out Output stream
+ * @param stats Receives line counts
+ * @param summary Receives aggregate statistics (NULL = per-line output)
+ * @return 0 on success, -1 on open, map or write error or if path is not
+ *         a regular file (pipes and devices cannot be mapped)
+ */
+int audit_file(const char *path, const PasswordConfig *config, FILE *out, AuditStats *stats,
+               ScoreSummary *summary);
+
+/**
+ * Audit config->audit_file to stdout and report throughput on stderr.
+ * With config->summary, prints aggregate statistics instead of lines.
+ * @param config Password configuration
+ * @return 0 on success, non-zero on error
+ */
+int run_audit(const PasswordConfig *config);
+
+/* ============ Word Match Functions (wordmatch.c) ============ */
+
+/**
+ * Add a wordlist (one word per line, most common first) to the dictionary.
+ * Words are reduced to their lowercase letters; those outside
+ * WORD_MIN_LENGTH..WORD_MAX_LENGTH are skipped. Reading stops once all
+ * wordlists together hold WORD_DICT_LIMIT words. Must be called before the
+ * first dictionary lookup or complexity analysis.
+ * @param path Wordlist file
+ * @return 0 on success, -1 on read error or if the dictionary is already built
+ */
+int wordlist_load(const char *path);
+
+/**
+ * Number of distinct dictionary words (builds the dictionary on first use)
+ * @return Word count, 0 if the dictionary could not be built
+ */
+size_t dictionary_word_count(void);
+
+/**
+ * Find every dictionary word in a password, overlapping ones included,
+ * in order of end position. Case and common l33t substitutions are undone.
+ * @param str Password bytes
+ * @param len Number of bytes (only the first MAX_PASSWORD_LENGTH are searched)
+ * @param matches Receives up to max matches
+ * @param max Capacity of matches
+ * @return Total matches found (may exceed max)
+ */
+int find_dictionary_matches(const char *str, size_t len, DictionaryMatch *matches, int max);
+
+/**
+ * Estimate log2 of the guesses an attacker with the dictionary needs:
+ * the cheapest split into dictionary words and brute-forced characters.
+ * Linear in len apart from overlapping matches.
+ * @param str Password bytes
+ * @param len Number of bytes (only the first MAX_PASSWORD_LENGTH count)
+ * @return log2 of the estimated guess count
+ */
+double estimate_guesses_log2(const char *str, size_t len);
+
+/* ============ Cache Functions (cache.c) ============ */
+
+/**
+ * Create an empty score cache, safe to share between threads
+ * @param entries Approximate capacity (rounded down to whole sets, at
+ *                least one set per shard)
+ * @return New cache, or NULL on allocation failure
+ */
+ScoreCache *score_cache_create(size_t entries);
+
+/**
+ * Wipe every cached password and free the cache
+ * @param cache Cache to destroy (NULL is ignored)
+ */
+void score_cache_destroy(ScoreCache *cache);
+
+/**
+ * Look up a password's cached analysis; counts a hit or a miss
+ * @param cache Score cache
+ * @param str Password bytes
+ * @param len Number of bytes (longer than CACHE_KEY_MAX never hits)
+ * @param result Receives the cached result on a hit
+ * @return true on a hit
+ */
+bool score_cache_lookup(ScoreCache *cache, const char *str, size_t len, ComplexityResult *result);
+
+/**
+ * Cache a password's analysis, evicting (and wiping) the least recently
+ * used entry of its set if full
+ * @param cache Score cache
+ * @param str Password bytes
+ * @param len Number of bytes (longer than CACHE_KEY_MAX is not cached)
+ * @param result Analysis to store
+ */
+void score_cache_store(ScoreCache *cache, const char *str, size_t len, const ComplexityResult *result);
+
+/**
+ * Total hits and misses over all shards
+ * @param cache Score cache
+ * @param hits Receives lookups answered from the cache (may be NULL)
+ * @param misses Receives lookups that were not (may be NULL)
+ */
+void score_cache_counters(ScoreCache *cache, uint64_t *hits, uint64_t *misses);
+
+/**
+ * analyze_complexity_len through a cache. Results equal the uncached
+ * analysis as long as the compression method is not changed while the
+ * cache is in use.
+ * @param cache Score cache (NULL = no caching)
+ * @param str Password bytes
+ * @param len Number of bytes
+ * @param result Receives the analysis
+ */
+void analyze_complexity_cached(ScoreCache *cache, const char *str, size_t len, ComplexityResult *result);
+
+/**
+ * Score only (complexity_score_above with no bound) through a cache.
+ * Misses skip the guess estimate and store just the score.
+ * @param cache Score cache (NULL = no caching)
+ * @param str Password bytes
+ * @param len Number of bytes
+ * @return Complexity score
+ */
+double complexity_score_cached(ScoreCache *cache, const char *str, size_t len);
+
+/**
+ * analyze_complexity_batch through a cache; repeated passwords are
+ * analyzed once. When only score and length are requested, only scores
+ * are computed and cached.
+ * @param cache Score cache (NULL = analyze_complexity_batch)
+ * @param passwords Password pointers (NULL entries score as empty)
+ * @param lengths Byte lengths, or NULL for NUL-terminated passwords
+ * @param count Number of passwords
+ * @param out Column arrays of at least count entries (NULL to skip)
+ */
+void analyze_complexity_batch_cached(ScoreCache *cache, const char *const *passwords,
+                                     const size_t *lengths, size_t count,
+                                     const ComplexityBatch *out);
+
+/* ============ Statistics Functions (stats.c) ============ */
+
+/**
+ * Initialize an empty quantile sketch
+ * @param sketch Sketch to initialize
+ */
+void sketch_init(QuantileSketch *sketch);
+
+/**
+ * Add a weighted point to a sketch
+ * @param sketch Quantile sketch
+ * @param value Point value
+ * @param weight Point weight (1 for a single observation)
+ */
+void sketch_add(QuantileSketch *sketch, double value, double weight);
+
+/**
+ * Fold one sketch into another
+ * @param dst Sketch receiving the points
+ * @param src Sketch to merge in (unchanged)
+ */
+void sketch_merge(QuantileSketch *dst, const QuantileSketch *src);
+
+/**
+ * Estimate a quantile (merges buffered points first)
+ * @param sketch Quantile sketch
+ * @param q Quantile in [0, 1]
+ * @return Estimated value (0 for an empty sketch)
+ */
+double sketch_quantile(QuantileSketch *sketch, double q);
+
+/**
+ * Initialize an empty summary
+ * @param summary Summary to initialize
+ */
+void summary_init(ScoreSummary *summary);
+
+/**
+ * Account one analyzed password
+ * @param summary Summary to update
+ * @param text Password (need not be NUL-terminated)
+ * @param len Length of text
+ * @param result Full complexity analysis of text
+ * @param class_flags Character classes of text (see classify_characters)
+ */
+void summary_add(ScoreSummary *summary, const char *text, size_t len,
+                 const ComplexityResult *result, unsigned class_flags);
+
+/**
+ * Fold one summary into another; the result does not depend on how the
+ * entries were split between them, up to sketch error and score ties
+ * among the weakest entries
+ * @param dst Summary receiving the counts
+ * @param src Summary to merge in (unchanged)
+ */
+void summary_merge(ScoreSummary *dst, const ScoreSummary *src);
+
+/**
+ * Nearest-rank length percentile (exact up to MAX_PASSWORD_LENGTH)
+ * @param summary Summary
+ * @param q Quantile in [0, 1]
+ * @return Length at that rank
+ */
+size_t summary_length_percentile(const ScoreSummary *summary, double q);
+
+/**
+ * Print the score distribution, entropy, guess and length percentiles, class
+ * coverage and weakest entries
+ * @param summary Summary (its weakest entries are sorted in place)
+ * @param out Output stream
+ */
+void summary_print(ScoreSummary *summary, FILE *out);
+
 /* ============ Update Functions (update.c) ============ */
 
 /**
@@ -220,4 +1319,16 @@ int check_for_update(void);
  */
 int run_tests(void);
 
+/* ============ Benchmark Functions (for --bench mode) ============ */
+
+/**
+ * Run all benchmarks and print throughput figures
+ * @return 0 on success, non-zero on failure
+ */
+int run_benchmarks(void);
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif /* MEOWPASS_H */
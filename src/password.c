@@ -9,187 +9,506 @@
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
-#include <time.h>
 #include "meowpass.h"
 
 /* Symbols for replacement */
 static const char SYMBOLS[] = "!@#$%^&*()-_=+[]{;:.<>?";
 static const char NUMBERS[] = "0123456789";
 
+/* Letters capitalized per password */
+#define CAPITALIZE_COUNT 3
+
+/* Per-character actions in a transformation plan */
+#define PLAN_KEEP 0
+#define PLAN_UPPER 1
+#define PLAN_SYMBOL 2
+
+/* Force inlining where the compiler supports it, so every fixed policy
+ * gets its own copy of the generator body with its limits as constants */
+#if defined(__GNUC__) || defined(__clang__)
+#define MEOW_INLINE inline __attribute__((always_inline))
+#else
+#define MEOW_INLINE inline
+#endif
+
+/* Generator used by the single-threaded API */
+static GeneratorState default_state;
+static bool default_state_ready = false;
+
+static GeneratorState *get_default_state(void) {
+    if (!default_state_ready) {
+        if (generator_init(&default_state, rng_default()) != 0) {
+            return NULL;
+        }
+        default_state_ready = true;
+    }
+    return &default_state;
+}
+
+int generator_init(GeneratorState *state, MeowRng *rng) {
+    state->rng = rng;
+    complexity_init(&state->scoring);
+    return 0;
+}
+
+void generator_free(GeneratorState *state) {
+    state->rng = NULL;
+}
+
 /**
  * Shuffle an array of indices (Fisher-Yates)
  */
-static void shuffle_indices(size_t *arr, size_t n) {
-    for (size_t i = n - 1; i > 0; i--) {
-        size_t j = rand() % (i + 1);
-        size_t tmp = arr[i];
-        arr[i] = arr[j];
-        arr[j] = tmp;
+static void shuffle_indices(MeowRng *rng, size_t *arr, size_t n) {
+    uint32_t bounds[RNG_BATCH_BLOCK];
+    uint32_t swaps[RNG_BATCH_BLOCK];
+
+    /* Draw the swap targets a block at a time */
+    size_t i = (n > 0) ? n - 1 : 0;
+    while (i > 0) {
+        size_t block = (i < RNG_BATCH_BLOCK) ? i : RNG_BATCH_BLOCK;
+        for (size_t k = 0; k < block; k++) {
+            bounds[k] = (uint32_t)(i - k + 1);
+        }
+        rng_uniform_batch(rng, bounds, swaps, block);
+
+        for (size_t k = 0; k < block; k++, i--) {
+            size_t j = swaps[k];
+            size_t tmp = arr[i];
+            arr[i] = arr[j];
+            arr[j] = tmp;
+        }
+    }
+}
+
+/**
+ * Draw k distinct indices from [0, n) uniformly, in O(k) expected time.
+ * Rejection against the handful already drawn is cheap because k is tiny
+ * compared to the name table.
+ */
+static void sample_distinct(MeowRng *rng, size_t n, size_t *out, int k) {
+    for (int i = 0; i < k; i++) {
+        size_t pick;
+        int duplicate;
+        do {
+            pick = rng_uniform(rng, n);
+            duplicate = 0;
+            for (int j = 0; j < i; j++) {
+                if (out[j] == pick) {
+                    duplicate = 1;
+                    break;
+                }
+            }
+        } while (duplicate);
+        out[i] = pick;
+    }
+}
+
+/**
+ * Append normalized names to output, stopping at limit
+ */
+static size_t append_names(const Dictionary *dict, const size_t *picks, int count,
+                           char *output, size_t out_len, size_t limit) {
+    char buf[DICT_WORD_BUF];
+    for (int i = 0; i < count && out_len < limit; i++) {
+        NameView name = dictionary_word(dict, picks[i], buf);
+        size_t take = (name.len < limit - out_len) ? name.len : limit - out_len;
+        memcpy(&output[out_len], name.str, take);
+        out_len += take;
     }
+    return out_len;
 }
 
 /**
  * Select random cat names and join them
  */
-static void select_and_join_names(int count, char *output, size_t output_size, int max_length) {
+static void select_and_join_names(GeneratorState *state, int count, char *output,
+                                  size_t output_size, int max_length) {
     (void)output_size; /* Reserved for future bounds checking */
-    const char **names = get_cat_names();
-    size_t names_count = get_cat_names_count();
+    const Dictionary *dict = dictionary_active();
+    size_t names_count = dict->count;
+    size_t picks[MAX_NAMES_PER_PASSWORD];
 
     if (names_count == 0 || count <= 0) {
         output[0] = '\0';
         return;
     }
 
-    /* Create indices for random selection */
-    size_t *indices = malloc(names_count * sizeof(size_t));
-    if (!indices) {
-        output[0] = '\0';
-        return;
-    }
-
-    for (size_t i = 0; i < names_count; i++) {
-        indices[i] = i;
-    }
-    shuffle_indices(indices, names_count);
+    /* Join selected names (pre-normalized: lowercase, no spaces) */
+    int actual_count = (count > MAX_NAMES_PER_PASSWORD) ? MAX_NAMES_PER_PASSWORD : count;
+    if ((size_t)actual_count > names_count) actual_count = (int)names_count;
 
-    /* Join selected names (lowercase, no spaces) */
-    output[0] = '\0';
-    size_t out_len = 0;
-    int actual_count = (count > (int)names_count) ? (int)names_count : count;
-
-    for (int i = 0; i < actual_count && out_len < (size_t)(max_length - 1); i++) {
-        const char *name = names[indices[i]];
-        for (const char *p = name; *p && out_len < (size_t)(max_length - 1); p++) {
-            if (*p != ' ') {
-                output[out_len++] = (char)tolower((unsigned char)*p);
-            }
-        }
-    }
-    output[out_len] = '\0';
+    sample_distinct(state->rng, names_count, picks, actual_count);
+    size_t out_len = append_names(dict, picks, actual_count, output, 0, (size_t)(max_length - 1));
 
     /* If too short, add more names */
     if (out_len < MIN_LENGTH) {
-        shuffle_indices(indices, names_count);
-        for (int i = 0; i < 5 && out_len < (size_t)max_length; i++) {
-            const char *name = names[indices[i]];
-            for (const char *p = name; *p && out_len < (size_t)(max_length - 1); p++) {
-                if (*p != ' ') {
-                    output[out_len++] = (char)tolower((unsigned char)*p);
-                }
-            }
-        }
-        output[out_len] = '\0';
-    }
-
-    free(indices);
-
-    /* Truncate to max length */
-    if (strlen(output) > (size_t)max_length) {
-        output[max_length] = '\0';
+        int extra = (names_count < 5) ? (int)names_count : 5;
+        sample_distinct(state->rng, names_count, picks, extra);
+        out_len = append_names(dict, picks, extra, output, out_len, (size_t)(max_length - 1));
     }
+    output[out_len] = '\0';
 }
 
-void randomly_capitalize(char *password, int count) {
+static void capitalize_with(GeneratorState *state, char *password, int count) {
     size_t len = strlen(password);
     if (len == 0 || count <= 0) return;
 
     /* Find letter indices */
-    size_t *letter_indices = malloc(len * sizeof(size_t));
-    if (!letter_indices) return;
-
+    size_t *letter_indices = state->letter_indices;
     size_t letter_count = 0;
-    for (size_t i = 0; i < len; i++) {
+    for (size_t i = 0; i < len && i < MAX_PASSWORD_LENGTH; i++) {
         if (isalpha((unsigned char)password[i])) {
             letter_indices[letter_count++] = i;
         }
     }
 
-    if (letter_count == 0) {
-        free(letter_indices);
-        return;
-    }
+    if (letter_count == 0) return;
 
     /* Shuffle and capitalize */
-    shuffle_indices(letter_indices, letter_count);
+    shuffle_indices(state->rng, letter_indices, letter_count);
     int to_cap = (count > (int)letter_count) ? (int)letter_count : count;
 
     for (int i = 0; i < to_cap; i++) {
         size_t idx = letter_indices[i];
         password[idx] = (char)toupper((unsigned char)password[idx]);
     }
-
-    free(letter_indices);
 }
 
-void insert_random_numbers(char *password, size_t password_size, int count) {
+static void insert_numbers_with(GeneratorState *state, char *password,
+                                size_t password_size, int count) {
     size_t len = strlen(password);
     size_t num_chars = strlen(NUMBERS);
+    uint32_t bounds[RNG_BATCH_BLOCK];
+    uint32_t draws[RNG_BATCH_BLOCK];
+
+    if (count <= 0 || len >= password_size - 1) return;
+    size_t remaining = password_size - 1 - len;
+    if ((size_t)count < remaining) remaining = (size_t)count;
+
+    while (remaining > 0) {
+        /* Draw (number character, insert position) pairs in one batch */
+        size_t block = (remaining < RNG_BATCH_BLOCK / 2) ? remaining : RNG_BATCH_BLOCK / 2;
+        for (size_t k = 0; k < block; k++) {
+            bounds[2 * k] = (uint32_t)num_chars;
+            bounds[2 * k + 1] = (uint32_t)(len + k + 1);
+        }
+        rng_uniform_batch(state->rng, bounds, draws, 2 * block);
 
-    for (int i = 0; i < count; i++) {
-        if (len >= password_size - 1) break;
-
-        /* Pick random number character */
-        char num = NUMBERS[rand() % num_chars];
-
-        /* Pick random insert position */
-        size_t pos = rand() % (len + 1);
+        for (size_t k = 0; k < block; k++) {
+            char num = NUMBERS[draws[2 * k]];
+            size_t pos = draws[2 * k + 1];
 
-        /* Shift characters right */
-        memmove(&password[pos + 1], &password[pos], len - pos + 1);
-        password[pos] = num;
-        len++;
+            /* Shift characters right */
+            memmove(&password[pos + 1], &password[pos], len - pos + 1);
+            password[pos] = num;
+            len++;
+        }
+        remaining -= block;
     }
 }
 
-void replace_with_symbols(char *password, int count) {
+static void replace_symbols_with(GeneratorState *state, char *password, int count) {
     size_t len = strlen(password);
     if (len == 0 || count <= 0) return;
 
     size_t sym_chars = strlen(SYMBOLS);
 
     /* Find letter indices */
-    size_t *letter_indices = malloc(len * sizeof(size_t));
-    if (!letter_indices) return;
-
+    size_t *letter_indices = state->letter_indices;
     size_t letter_count = 0;
-    for (size_t i = 0; i < len; i++) {
+    for (size_t i = 0; i < len && i < MAX_PASSWORD_LENGTH; i++) {
         if (isalpha((unsigned char)password[i])) {
             letter_indices[letter_count++] = i;
         }
     }
 
-    if (letter_count == 0) {
-        free(letter_indices);
-        return;
-    }
+    if (letter_count == 0) return;
 
     /* Shuffle and replace */
-    shuffle_indices(letter_indices, letter_count);
+    shuffle_indices(state->rng, letter_indices, letter_count);
     int to_replace = (count > (int)letter_count) ? (int)letter_count : count;
 
+    uint32_t bounds[RNG_BATCH_BLOCK];
+    uint32_t picks[RNG_BATCH_BLOCK];
+    for (int i = 0; i < to_replace; i += RNG_BATCH_BLOCK) {
+        size_t block = (size_t)(to_replace - i);
+        if (block > RNG_BATCH_BLOCK) block = RNG_BATCH_BLOCK;
+        for (size_t k = 0; k < block; k++) bounds[k] = (uint32_t)sym_chars;
+        rng_uniform_batch(state->rng, bounds, picks, block);
+
+        for (size_t k = 0; k < block; k++) {
+            size_t idx = letter_indices[(size_t)i + k];
+            password[idx] = SYMBOLS[picks[k]];
+        }
+    }
+}
+
+void randomly_capitalize(char *password, int count) {
+    GeneratorState *state = get_default_state();
+    if (state) capitalize_with(state, password, count);
+}
+
+void insert_random_numbers(char *password, size_t password_size, int count) {
+    GeneratorState *state = get_default_state();
+    if (state) insert_numbers_with(state, password, password_size, count);
+}
+
+void replace_with_symbols(char *password, int count) {
+    GeneratorState *state = get_default_state();
+    if (state) replace_symbols_with(state, password, count);
+}
+
+/**
+ * Fused transformation pipeline. Decides every capitalization, digit slot
+ * and symbol replacement as a plan first, then writes the password in a
+ * single left-to-right pass: no heap, no memmove, no rescans.
+ *
+ * The plan reproduces the sequential passes exactly in distribution:
+ * inserting d digits one at a time at uniform positions is the same as
+ * choosing d distinct slots uniformly among the final n + d positions.
+ *
+ * When score is non-NULL every emitted character is also fed to it, so
+ * the password is analyzed without a second pass.
+ *
+ * Plan arrays hold cap entries: MAX_PASSWORD_LENGTH on the general path,
+ * max length + 1 for a fixed policy. cap is always a constant once
+ * inlined, so the arrays are fixed-size. Only the prefix of each plan
+ * array that the password can reach is cleared.
+ */
+static MEOW_INLINE void transform_fused(GeneratorState *state, int num_numbers, int num_symbols,
+                                        int max_length, size_t cap,
+                                        const char *base, size_t base_len,
+                                        char *output, size_t output_size,
+                                        ComplexityAccumulator *score) {
+    MeowRng *rng = state->rng;
+    uint8_t action[cap];
+    char symbol_at[cap];
+    bool digit_slot[cap];
+    uint8_t letter_pos[cap];
+    size_t picks[cap];
+
+    if (base_len >= output_size) base_len = output_size - 1;
+    if (base_len >= cap) base_len = cap - 1;
+    memset(action, PLAN_KEEP, base_len);
+
+    /* Letter positions in the base phrase */
+    size_t letters = 0;
+    for (size_t i = 0; i < base_len; i++) {
+        if (isalpha((unsigned char)base[i])) letter_pos[letters++] = (uint8_t)i;
+    }
+
+    /* Capitalize distinct letters */
+    int to_cap = (letters < CAPITALIZE_COUNT) ? (int)letters : CAPITALIZE_COUNT;
+    sample_distinct(rng, letters, picks, to_cap);
+    for (int i = 0; i < to_cap; i++) {
+        action[letter_pos[picks[i]]] = PLAN_UPPER;
+    }
+
+    /* Digit slots among the final positions, limited by the buffer */
+    size_t room = output_size - 1;
+    if (room > cap - 1) room = cap - 1;
+    int digits = (num_numbers > 0) ? num_numbers : 0;
+    if ((size_t)digits > room - base_len) digits = (int)(room - base_len);
+    size_t full_len = base_len + (size_t)digits;
+    memset(digit_slot, false, full_len);
+    sample_distinct(rng, full_len, picks, digits);
+    for (int i = 0; i < digits; i++) {
+        digit_slot[picks[i]] = true;
+    }
+
+    /* Truncation point, and how much of the base survives it */
+    size_t out_len = full_len;
+    if (out_len > (size_t)max_length) out_len = (size_t)max_length;
+    size_t kept_base = out_len;
+    for (size_t i = 0; i < out_len; i++) {
+        if (digit_slot[i]) kept_base--;
+    }
+
+    /* Replace distinct surviving letters (capitalized or not) with symbols */
+    size_t kept_letters = 0;
+    while (kept_letters < letters && letter_pos[kept_letters] < kept_base) kept_letters++;
+    int to_replace = (num_symbols > 0) ? num_symbols : 0;
+    if ((size_t)to_replace > kept_letters) to_replace = (int)kept_letters;
+    sample_distinct(rng, kept_letters, picks, to_replace);
+
+    /* Draw every surviving digit and every symbol in one batch */
+    size_t kept_digits = out_len - kept_base;
+    uint32_t bounds[cap];
+    uint32_t chars[cap];
+    for (size_t i = 0; i < kept_digits; i++) {
+        bounds[i] = sizeof(NUMBERS) - 1;
+    }
     for (int i = 0; i < to_replace; i++) {
-        size_t idx = letter_indices[i];
-        password[idx] = SYMBOLS[rand() % sym_chars];
+        bounds[kept_digits + (size_t)i] = sizeof(SYMBOLS) - 1;
     }
+    rng_uniform_batch(rng, bounds, chars, kept_digits + (size_t)to_replace);
 
-    free(letter_indices);
+    for (int i = 0; i < to_replace; i++) {
+        size_t pos = letter_pos[picks[i]];
+        action[pos] = PLAN_SYMBOL;
+        symbol_at[pos] = SYMBOLS[chars[kept_digits + (size_t)i]];
+    }
+
+    /* Emit */
+    size_t src = 0;
+    size_t next_digit = 0;
+    for (size_t i = 0; i < out_len; i++) {
+        char c;
+        if (digit_slot[i]) {
+            c = NUMBERS[chars[next_digit++]];
+        } else {
+            c = base[src];
+            if (action[src] == PLAN_SYMBOL) c = symbol_at[src];
+            else if (action[src] == PLAN_UPPER) c = (char)toupper((unsigned char)c);
+            src++;
+        }
+        output[i] = c;
+        if (score) complexity_push(score, (unsigned char)c);
+    }
+    output[out_len] = '\0';
 }
 
-void generate_password(const PasswordConfig *config, char *output, size_t output_size) {
-    /* Step 1: Select 2-6 random cat names */
-    int name_count = (rand() % 5) + 2;  /* 2 to 6 names */
+/**
+ * Longest base phrase leaving room for the digits
+ */
+static MEOW_INLINE int phrase_limit_for(int num_numbers, int max_length) {
+    int digits = (num_numbers > 0) ? num_numbers : 0;
+    return clamp_int(max_length - digits, MIN_LENGTH, MAX_LENGTH);
+}
+
+int phrase_length_limit(const PasswordConfig *config) {
+    return phrase_limit_for(config->num_numbers, config->max_length);
+}
+
+/**
+ * Draw a base phrase, then transform it (optionally scoring as it goes).
+ * The base phrase and plan arrays hold cap bytes.
+ */
+static MEOW_INLINE void generate_fixed(GeneratorState *state, int num_numbers, int num_symbols,
+                                       int max_length, size_t cap,
+                                       char *output, size_t output_size,
+                                       ComplexityAccumulator *score) {
+    char base[cap];
+
+    /* Step 1-2: Draw a base phrase of 2-6 cat names that leaves room for the digits */
+    int limit = phrase_limit_for(num_numbers, max_length);
+    const NameMix *mix = name_mix_active();
+    size_t base_len = mix
+        ? name_mix_sample(mix, state->rng, limit, base, cap)
+        : sample_name_sequence(state->rng, limit, base, cap);
+    if (base_len == 0) {
+        /* No exact fit available: join random names and truncate */
+        int name_count = (int)rng_uniform(state->rng, MAX_NAMES_PER_PASSWORD - 1) + 2;
+        select_and_join_names(state, name_count, base, cap, limit);
+        base_len = strlen(base);
+    }
+
+    /* Step 3: Capitalize, insert digits, truncate and add symbols in one pass */
+    transform_fused(state, num_numbers, num_symbols, max_length, cap,
+                    base, base_len, output, output_size, score);
+}
 
-    /* Step 2: Create base phrase */
-    select_and_join_names(name_count, output, output_size, config->max_length);
+/* One specialized generator per fixed policy, limits checked at compile
+ * time and every buffer sized to the policy's max length */
+#define DEFINE_POLICY_GENERATOR(policy, numbers, symbols, length)                  \
+    _Static_assert((numbers) >= MIN_NUMBERS && (numbers) <= MAX_NUMBERS,         \
+                   #policy " digits out of range");                              \
+    _Static_assert((symbols) >= MIN_SYMBOLS && (symbols) <= MAX_SYMBOLS,         \
+                   #policy " symbols out of range");                             \
+    _Static_assert((length) >= MIN_LENGTH && (length) <= MAX_LENGTH,             \
+                   #policy " max length out of range");                          \
+    _Static_assert((length) - (numbers) >= MIN_LENGTH,                           \
+                   #policy " leaves no room for a whole phrase and its digits"); \
+    static void generate_##policy(GeneratorState *state, char *output,           \
+                                  size_t output_size, ComplexityAccumulator *score) { \
+        generate_fixed(state, numbers, symbols, length, POLICY_BUFFER_SIZE(length), \
+                       output, output_size, score);                              \
+    }
+GENERATOR_POLICIES(DEFINE_POLICY_GENERATOR)
+#undef DEFINE_POLICY_GENERATOR
+
+_Static_assert(DEFAULT_RANDOM_NUMBERS == 4 && DEFAULT_NUM_NUMBERS <= DEFAULT_RANDOM_NUMBERS,
+               "one POLICY_DEFAULT_* variant per default digit count");
+
+typedef void (*PolicyGenerator)(GeneratorState *state, char *output, size_t output_size,
+                                ComplexityAccumulator *score);
+
+static const struct {
+    int num_numbers;
+    int num_symbols;
+    int max_length;
+    PolicyGenerator generate;
+} POLICY_TABLE[POLICY_COUNT] = {
+#define POLICY_ENTRY(policy, numbers, symbols, length) \
+    [policy] = {numbers, symbols, length, generate_##policy},
+    GENERATOR_POLICIES(POLICY_ENTRY)
+#undef POLICY_ENTRY
+};
+
+int generator_policy_for(const PasswordConfig *config) {
+    for (int p = 0; p < POLICY_COUNT; p++) {
+        if (POLICY_TABLE[p].num_numbers == config->num_numbers &&
+            POLICY_TABLE[p].num_symbols == config->num_symbols &&
+            POLICY_TABLE[p].max_length == config->max_length) {
+            return p;
+        }
+    }
+    return -1;
+}
 
-    /* Step 3: Apply security transformations */
-    randomly_capitalize(output, 3);
-    insert_random_numbers(output, output_size, config->num_numbers);
+/**
+ * Generate through the policy's specialized variant when the config
+ * matches one, otherwise through the general path
+ */
+static void generate_with(const PasswordConfig *config, GeneratorState *state,
+                          char *output, size_t output_size,
+                          ComplexityAccumulator *score) {
+    int policy = generator_policy_for(config);
+    if (policy >= 0) {
+        POLICY_TABLE[policy].generate(state, output, output_size, score);
+    } else {
+        generate_fixed(state, config->num_numbers, config->num_symbols, config->max_length,
+                       MAX_PASSWORD_LENGTH, output, output_size, score);
+    }
+}
 
-    /* Truncate before symbol replacement so symbols aren't placed past max_length */
-    if (strlen(output) > (size_t)config->max_length) {
-        output[config->max_length] = '\0';
+void generate_password_policy_r(GeneratorPolicy policy, GeneratorState *state,
+                                char *output, size_t output_size) {
+    if ((int)policy < 0 || policy >= POLICY_COUNT) {
+        output[0] = '\0';
+        return;
+    }
+    POLICY_TABLE[policy].generate(state, output, output_size, NULL);
+}
+
+void generate_password_r(const PasswordConfig *config, GeneratorState *state,
+                         char *output, size_t output_size) {
+    generate_with(config, state, output, output_size, NULL);
+}
+
+void generate_candidate_r(const PasswordConfig *config, GeneratorState *state,
+                          PasswordCandidate *candidate) {
+    complexity_reset(&state->scoring);
+    generate_with(config, state, candidate->password, sizeof(candidate->password),
+                  &state->scoring);
+    complexity_finish(&state->scoring, &candidate->complexity);
+}
+
+void generate_password(const PasswordConfig *config, char *output, size_t output_size) {
+    GeneratorState *state = get_default_state();
+    if (!state) {
+        output[0] = '\0';
+        return;
+    }
+    generate_password_r(config, state, output, output_size);
+}
+
+void generate_candidate(const PasswordConfig *config, PasswordCandidate *candidate) {
+    GeneratorState *state = get_default_state();
+    if (!state) {
+        candidate->password[0] = '\0';
+        analyze_complexity(candidate->password, &candidate->complexity);
+        return;
     }
-    replace_with_symbols(output, config->num_symbols);
+    generate_candidate_r(config, state, candidate);
 }
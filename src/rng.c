@@ -0,0 +1,223 @@
+/*
+ * rng.c - ChaCha20 Random Number Generator
+ * MeowPassword - Cat Name Based Secure Password Generator
+ *
+ * Copyright (c) 2025 Jeffrey Kunzelman
+ * MIT License
+ */
+
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <sys/random.h>
+#include "meowpass.h"
+
+/* Process-wide state used by the single-threaded API */
+static MeowRng default_rng;
+
+#define ROTL32(v, n) (((v) << (n)) | ((v) >> (32 - (n))))
+
+#define QUARTER_ROUND(a, b, c, d) \
+    a += b; d ^= a; d = ROTL32(d, 16); \
+    c += d; b ^= c; b = ROTL32(b, 12); \
+    a += b; d ^= a; d = ROTL32(d, 8);  \
+    c += d; b ^= c; b = ROTL32(b, 7)
+
+/**
+ * Produce one 64-byte ChaCha20 keystream block
+ */
+static void chacha20_block(const uint32_t key[8], uint64_t counter, uint8_t out[64]) {
+    uint32_t in[16] = {
+        0x61707865, 0x3320646e, 0x79622d32, 0x6b206574, /* "expand 32-byte k" */
+        key[0], key[1], key[2], key[3], key[4], key[5], key[6], key[7],
+        (uint32_t)counter, (uint32_t)(counter >> 32), 0, 0
+    };
+    uint32_t x[16];
+    memcpy(x, in, sizeof(x));
+
+    for (int i = 0; i < 10; i++) {
+        QUARTER_ROUND(x[0], x[4], x[8],  x[12]);
+        QUARTER_ROUND(x[1], x[5], x[9],  x[13]);
+        QUARTER_ROUND(x[2], x[6], x[10], x[14]);
+        QUARTER_ROUND(x[3], x[7], x[11], x[15]);
+        QUARTER_ROUND(x[0], x[5], x[10], x[15]);
+        QUARTER_ROUND(x[1], x[6], x[11], x[12]);
+        QUARTER_ROUND(x[2], x[7], x[8],  x[13]);
+        QUARTER_ROUND(x[3], x[4], x[9],  x[14]);
+    }
+
+    for (int i = 0; i < 16; i++) {
+        uint32_t v = x[i] + in[i];
+        out[4 * i + 0] = (uint8_t)v;
+        out[4 * i + 1] = (uint8_t)(v >> 8);
+        out[4 * i + 2] = (uint8_t)(v >> 16);
+        out[4 * i + 3] = (uint8_t)(v >> 24);
+    }
+}
+
+/**
+ * Fill a buffer from the kernel entropy pool
+ */
+static int read_entropy(void *buf, size_t len) {
+    uint8_t *p = buf;
+    while (len > 0) {
+        ssize_t got = getrandom(p, len, 0);
+        if (got < 0) {
+            if (errno == EINTR) continue;
+            return -1;
+        }
+        p += got;
+        len -= (size_t)got;
+    }
+    return 0;
+}
+
+/**
+ * Regenerate the keystream buffer. The first RNG_KEY_SIZE bytes of every
+ * refill become the next key and are wiped, so earlier output cannot be
+ * recovered from a later copy of the state.
+ */
+static void rng_refill(MeowRng *rng) {
+    if (!rng->seeded && rng_init(rng) != 0) {
+        fprintf(stderr, "ERROR: Unable to seed random number generator.\n");
+        abort();
+    }
+
+    /* Periodically stir in fresh kernel entropy (at most one syscall) */
+    if (rng->reseed_countdown > 0 && --rng->reseed_countdown == 0) {
+        uint32_t fresh[8];
+        if (read_entropy(fresh, sizeof(fresh)) == 0) {
+            for (int i = 0; i < 8; i++) rng->key[i] ^= fresh[i];
+        }
+        memset(fresh, 0, sizeof(fresh));
+        rng->reseed_countdown = RNG_RESEED_INTERVAL;
+    }
+
+    for (size_t off = 0; off < RNG_BUFFER_SIZE; off += 64) {
+        chacha20_block(rng->key, rng->counter++, &rng->buffer[off]);
+    }
+
+    memcpy(rng->key, rng->buffer, RNG_KEY_SIZE);
+    memset(rng->buffer, 0, RNG_KEY_SIZE);
+    rng->counter = 0;
+    rng->pos = RNG_KEY_SIZE;
+}
+
+int rng_init(MeowRng *rng) {
+    if (read_entropy(rng->key, sizeof(rng->key)) != 0) return -1;
+    rng->counter = 0;
+    rng->pos = RNG_BUFFER_SIZE;
+    rng->reseed_countdown = RNG_RESEED_INTERVAL;
+    rng->seeded = true;
+    return 0;
+}
+
+void rng_init_seeded(MeowRng *rng, uint64_t seed) {
+    memset(rng->key, 0, sizeof(rng->key));
+    rng->key[0] = (uint32_t)seed;
+    rng->key[1] = (uint32_t)(seed >> 32);
+    rng->counter = 0;
+    rng->pos = RNG_BUFFER_SIZE;
+    rng->reseed_countdown = 0;  /* Never reseed: keep the stream reproducible */
+    rng->seeded = true;
+}
+
+uint32_t rng_next(MeowRng *rng) {
+    if (rng->pos + sizeof(uint32_t) > RNG_BUFFER_SIZE) {
+        rng_refill(rng);
+    }
+    uint32_t v;
+    memcpy(&v, &rng->buffer[rng->pos], sizeof(v));
+    memset(&rng->buffer[rng->pos], 0, sizeof(v));
+    rng->pos += sizeof(v);
+    return v;
+}
+
+void rng_bytes(MeowRng *rng, void *out, size_t len) {
+    uint8_t *p = out;
+    while (len > 0) {
+        if (rng->pos >= RNG_BUFFER_SIZE) {
+            rng_refill(rng);
+        }
+        size_t avail = RNG_BUFFER_SIZE - rng->pos;
+        size_t take = (len < avail) ? len : avail;
+        memcpy(p, &rng->buffer[rng->pos], take);
+        memset(&rng->buffer[rng->pos], 0, take);
+        rng->pos += take;
+        p += take;
+        len -= take;
+    }
+}
+
+/**
+ * Lemire's nearly divisionless bounded draw: the high half of r * bound is
+ * uniform once the few low products below 2^32 mod bound are rejected, so
+ * the modulo is only computed on the rare path.
+ */
+static uint32_t bounded_draw(MeowRng *rng, uint32_t bound) {
+    uint64_t m = (uint64_t)rng_next(rng) * bound;
+    uint32_t low = (uint32_t)m;
+    if (low < bound) {
+        uint32_t threshold = (uint32_t)(-bound) % bound;
+        while (low < threshold) {
+            m = (uint64_t)rng_next(rng) * bound;
+            low = (uint32_t)m;
+        }
+    }
+    return (uint32_t)(m >> 32);
+}
+
+size_t rng_uniform(MeowRng *rng, size_t n) {
+    if (n <= 1) return 0;
+    return bounded_draw(rng, (uint32_t)n);
+}
+
+void rng_uniform_batch(MeowRng *rng, const uint32_t *bounds, uint32_t *out, size_t n) {
+    uint32_t redo[RNG_BATCH_BLOCK];
+    uint32_t redo_low[RNG_BATCH_BLOCK];
+
+    while (n > 0) {
+        if (rng->pos + sizeof(uint32_t) > RNG_BUFFER_SIZE) {
+            rng_refill(rng);
+        }
+        size_t take = (RNG_BUFFER_SIZE - rng->pos) / sizeof(uint32_t);
+        if (take > n) take = n;
+        if (take > RNG_BATCH_BLOCK) take = RNG_BATCH_BLOCK;
+
+        /* Straight multiply-shift over buffered words; note rare rejects */
+        const uint8_t *src = &rng->buffer[rng->pos];
+        size_t redo_count = 0;
+        for (size_t i = 0; i < take; i++) {
+            uint32_t r;
+            memcpy(&r, &src[i * sizeof(uint32_t)], sizeof(r));
+            uint64_t m = (uint64_t)r * bounds[i];
+            out[i] = (uint32_t)(m >> 32);
+            if ((uint32_t)m < bounds[i]) {
+                redo[redo_count] = (uint32_t)i;
+                redo_low[redo_count++] = (uint32_t)m;
+            }
+        }
+        memset(&rng->buffer[rng->pos], 0, take * sizeof(uint32_t));
+        rng->pos += take * sizeof(uint32_t);
+
+        /* Settle the candidates that might be biased on the slow path */
+        for (size_t k = 0; k < redo_count; k++) {
+            uint32_t i = redo[k];
+            uint32_t bound = bounds[i];
+            if (bound <= 1) {
+                out[i] = 0;
+            } else if (redo_low[k] < (uint32_t)(-bound) % bound) {
+                out[i] = bounded_draw(rng, bound);
+            }
+        }
+        bounds += take;
+        out += take;
+        n -= take;
+    }
+}
+
+MeowRng *rng_default(void) {
+    return &default_rng;
+}
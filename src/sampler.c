@@ -0,0 +1,226 @@
+/*
+ * sampler.c - Exact Uniform Name Sequence Sampling
+ * MeowPassword - Cat Name Based Secure Password Generator
+ *
+ * Draws a sequence of 2..MAX_NAMES_PER_PASSWORD normalized names from the
+ * active dictionary, uniformly among all sequences whose joined length
+ * lies in [MIN_LENGTH, max_length]. The dictionary's length index groups
+ * names into buckets by length and ways[k][t] counts the ordered k-name
+ * sequences of total length t, so one random number in [0, total) maps to
+ * exactly one sequence: no retries and no truncation. Sequences are
+ * counted with repetition, so a name may (rarely) appear twice. Different
+ * sequences can join to the same phrase (Boo + Boo and BooBoo), so the
+ * sequence count only bounds the phrase entropy from above. Very large
+ * dictionaries drop the longest sequence counts that would not fit in 128
+ * bits.
+ *
+ * Copyright (c) 2025 Jeffrey Kunzelman
+ * MIT License
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+#include "meowpass.h"
+
+/* Sequence counts reach ~16913^6, beyond 64 bits */
+__extension__ typedef unsigned __int128 u128;
+
+_Static_assert(MAX_LENGTH < DICT_LENGTH_BUCKETS - 1, "names up to MAX_LENGTH need exact length buckets");
+
+/* Sequence counts over the dictionary's length buckets */
+typedef struct {
+    const Dictionary *dict;
+    const uint32_t *bucket_names;              /* Name indices grouped by length */
+    const uint32_t *bucket_start;              /* Bucket L is [start[L], start[L+1]) */
+    int max_names;                             /* Longest sequence whose counts fit */
+    u128 ways[MAX_NAMES_PER_PASSWORD + 1][MAX_LENGTH + 1];
+    bool ready;
+} SequenceTable;
+
+static SequenceTable table;
+static pthread_once_t table_once = PTHREAD_ONCE_INIT;
+
+/**
+ * Fill ways[k] from ways[k - 1]
+ * @return false if a count overflowed 128 bits
+ */
+static bool count_sequences(SequenceTable *seq, int k, const uint32_t *counts) {
+    for (int t = 1; t <= MAX_LENGTH; t++) {
+        u128 sum = 0;
+        for (int len = 1; len <= t; len++) {
+            u128 term;
+            if (__builtin_mul_overflow((u128)counts[len], seq->ways[k - 1][t - len], &term) ||
+                __builtin_add_overflow(sum, term, &sum)) {
+                return false;
+            }
+        }
+        seq->ways[k][t] = sum;
+    }
+    return true;
+}
+
+/**
+ * Count the sequences over a dictionary's length buckets
+ */
+static void fill_table(SequenceTable *seq, const Dictionary *dict) {
+    uint32_t counts[MAX_LENGTH + 1] = {0};
+
+    /* Names longer than MAX_LENGTH can never fit and are left out */
+    for (int len = 1; len <= MAX_LENGTH; len++) {
+        counts[len] = dict->length_start[len + 1] - dict->length_start[len];
+    }
+    seq->dict = dict;
+    seq->bucket_names = dict->by_length;
+    seq->bucket_start = dict->length_start;
+
+    /* ways[k][t] = sum over L of counts[L] * ways[k-1][t-L] */
+    memset(seq->ways, 0, sizeof(seq->ways));
+    seq->ways[0][0] = 1;
+    seq->max_names = 1;
+    for (int k = 1; k <= MAX_NAMES_PER_PASSWORD; k++) {
+        if (!count_sequences(seq, k, counts)) break;
+        seq->max_names = k;
+    }
+
+    /* The grand total must fit too; drop the longest sequences until it does */
+    for (; seq->max_names >= 2; seq->max_names--) {
+        u128 total = 0;
+        bool fits = true;
+        for (int k = 2; k <= seq->max_names && fits; k++) {
+            for (int len = MIN_LENGTH; len <= MAX_LENGTH && fits; len++) {
+                fits = !__builtin_add_overflow(total, seq->ways[k][len], &total);
+            }
+        }
+        if (fits) break;
+    }
+
+    seq->ready = seq->max_names >= 2;
+}
+
+static void build_table(void) {
+    fill_table(&table, dictionary_active());
+}
+
+static const SequenceTable *get_table(void) {
+    pthread_once(&table_once, build_table);
+    return table.ready ? &table : NULL;
+}
+
+/**
+ * Number of sequences the sampler chooses from for a given max length
+ */
+static u128 total_sequences(const SequenceTable *t, int max_length) {
+    u128 total = 0;
+    for (int k = 2; k <= t->max_names; k++) {
+        for (int len = MIN_LENGTH; len <= max_length; len++) {
+            total += t->ways[k][len];
+        }
+    }
+    return total;
+}
+
+/**
+ * Uniform random value in [0, bound) by masked rejection (< 2 draws expected)
+ */
+static u128 random_below(MeowRng *rng, u128 bound) {
+    u128 mask = bound - 1;
+    for (int shift = 1; shift < 128; shift <<= 1) {
+        mask |= mask >> shift;
+    }
+    for (;;) {
+        u128 r = 0;
+        for (int i = 0; i < 4; i++) {
+            r = (r << 32) | rng_next(rng);
+        }
+        r &= mask;
+        if (r < bound) return r;
+    }
+}
+
+/**
+ * Map r to a (name count, total length) cell, leaving r as the index
+ * within that cell
+ */
+static bool pick_count_and_length(const SequenceTable *t, int max_length,
+                                  u128 *r, int *k, int *length) {
+    for (int count = 2; count <= t->max_names; count++) {
+        for (int len = MIN_LENGTH; len <= max_length; len++) {
+            if (*r < t->ways[count][len]) {
+                *k = count;
+                *length = len;
+                return true;
+            }
+            *r -= t->ways[count][len];
+        }
+    }
+    return false;
+}
+
+size_t sample_name_sequence(MeowRng *rng, int max_length, char *output, size_t output_size) {
+    const SequenceTable *t = get_table();
+    max_length = clamp_int(max_length, MIN_LENGTH, MAX_LENGTH);
+    if (!t || (size_t)max_length >= output_size) return 0;
+
+    u128 total = total_sequences(t, max_length);
+    if (total == 0) return 0;
+
+    u128 r = random_below(rng, total);
+    int k, length;
+    if (!pick_count_and_length(t, max_length, &r, &k, &length)) return 0;
+
+    /* Decode r as a mixed-radix index over (name length, name) choices */
+    size_t out_len = 0;
+    char buf[DICT_WORD_BUF];
+    for (int remaining = k; remaining > 0; remaining--) {
+        for (int len = 1; len <= length; len++) {
+            uint32_t bucket_size = t->bucket_start[len + 1] - t->bucket_start[len];
+            u128 rest = t->ways[remaining - 1][length - len];
+            u128 weight = (u128)bucket_size * rest;
+            if (r >= weight) {
+                r -= weight;
+                continue;
+            }
+
+            size_t slot = (size_t)(r / rest);
+            r %= rest;
+            NameView name = dictionary_word(t->dict, t->bucket_names[t->bucket_start[len] + slot], buf);
+            if (name.len != (size_t)len) return 0;  /* Damaged length index */
+            memcpy(&output[out_len], name.str, name.len);
+            out_len += name.len;
+            length -= len;
+            break;
+        }
+    }
+
+    output[out_len] = '\0';
+    return out_len;
+}
+
+/**
+ * log2 of the sequences a table chooses from for a given max length
+ */
+static double sequence_bits(const SequenceTable *t, int max_length) {
+    u128 total = total_sequences(t, clamp_int(max_length, MIN_LENGTH, MAX_LENGTH));
+    if (total == 0) return 0.0;
+
+    /* log2 of a 128-bit count, split to keep double precision */
+    double high = (double)(uint64_t)(total >> 64);
+    double low = (double)(uint64_t)total;
+    return log2(high * 18446744073709551616.0 + low);
+}
+
+double name_sequence_entropy(int max_length) {
+    const SequenceTable *t = get_table();
+    return t ? sequence_bits(t, max_length) : 0.0;
+}
+
+double dictionary_sequence_entropy(const Dictionary *dict, int max_length) {
+    SequenceTable *t = malloc(sizeof(SequenceTable));
+    if (!t) return 0.0;
+    fill_table(t, dict);
+    double bits = t->ready ? sequence_bits(t, max_length) : 0.0;
+    free(t);
+    return bits;
+}
@@ -0,0 +1,325 @@
+/*
+ * stats.c - Mergeable Summary Statistics
+ * MeowPassword - Cat Name Based Secure Password Generator
+ *
+ * Constant-memory accumulators for audit and bulk runs. Each worker fills
+ * its own ScoreSummary; summaries merge by adding histograms, re-feeding
+ * sketch centroids and offering heap entries, so the result does not
+ * depend on how the input was split.
+ *
+ * The entropy quantiles use a merging t-digest: points are buffered, then
+ * sorted together with the existing centroids and greedily merged under
+ * the arcsine scale k(q) = delta / (2 pi) * asin(2q - 1), which keeps
+ * centroids small near the tails where precision matters most.
+ *
+ * Copyright (c) 2025 Jeffrey Kunzelman
+ * MIT License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "meowpass.h"
+
+#define SKETCH_PI 3.14159265358979323846
+
+/* Percentiles printed in the summary */
+static const double SUMMARY_PERCENTILES[] = {0.01, 0.05, 0.25, 0.50, 0.75, 0.95, 0.99};
+#define SUMMARY_PERCENTILE_COUNT (sizeof(SUMMARY_PERCENTILES) / sizeof(SUMMARY_PERCENTILES[0]))
+
+/* Score histogram rows printed per 0.5 points */
+#define SUMMARY_BINS_PER_ROW 5
+
+/* ============ Quantile sketch ============ */
+
+void sketch_init(QuantileSketch *sketch) {
+    sketch->count = 0;
+    sketch->buffered = 0;
+    sketch->total_weight = 0.0;
+    sketch->min = INFINITY;
+    sketch->max = -INFINITY;
+}
+
+static int compare_centroids(const void *a, const void *b) {
+    double ma = ((const SketchCentroid *)a)->mean;
+    double mb = ((const SketchCentroid *)b)->mean;
+    return (ma > mb) - (ma < mb);
+}
+
+static double sketch_k(double q) {
+    return SKETCH_COMPRESSION / (2.0 * SKETCH_PI) * asin(2.0 * q - 1.0);
+}
+
+static double sketch_q(double k) {
+    double angle = k * 2.0 * SKETCH_PI / SKETCH_COMPRESSION;
+    if (angle >= SKETCH_PI / 2.0) return 1.0;
+    return (sin(angle) + 1.0) / 2.0;
+}
+
+/**
+ * Fold the buffer into the centroid list
+ */
+static void sketch_compress(QuantileSketch *sketch) {
+    if (sketch->buffered == 0) return;
+
+    SketchCentroid all[SKETCH_CENTROIDS + SKETCH_BUFFER];
+    int n = sketch->count;
+    memcpy(all, sketch->centroids, (size_t)n * sizeof(SketchCentroid));
+    memcpy(&all[n], sketch->buffer, (size_t)sketch->buffered * sizeof(SketchCentroid));
+    n += sketch->buffered;
+    qsort(all, (size_t)n, sizeof(SketchCentroid), compare_centroids);
+
+    double total = sketch->total_weight;
+    double so_far = 0.0;
+    double q_limit = sketch_q(sketch_k(0.0) + 1.0) * total;
+    SketchCentroid cur = all[0];
+    int out = 0;
+
+    for (int i = 1; i < n; i++) {
+        double proposed = so_far + cur.weight + all[i].weight;
+        /* The last slot absorbs everything rather than overflow */
+        if (proposed <= q_limit || out == SKETCH_CENTROIDS - 1) {
+            double weight = cur.weight + all[i].weight;
+            cur.mean += (all[i].mean - cur.mean) * all[i].weight / weight;
+            cur.weight = weight;
+        } else {
+            sketch->centroids[out++] = cur;
+            so_far += cur.weight;
+            q_limit = sketch_q(sketch_k(so_far / total) + 1.0) * total;
+            cur = all[i];
+        }
+    }
+    sketch->centroids[out++] = cur;
+    sketch->count = out;
+    sketch->buffered = 0;
+}
+
+void sketch_add(QuantileSketch *sketch, double value, double weight) {
+    if (sketch->buffered == SKETCH_BUFFER) sketch_compress(sketch);
+
+    sketch->buffer[sketch->buffered].mean = value;
+    sketch->buffer[sketch->buffered].weight = weight;
+    sketch->buffered++;
+    sketch->total_weight += weight;
+    if (value < sketch->min) sketch->min = value;
+    if (value > sketch->max) sketch->max = value;
+}
+
+void sketch_merge(QuantileSketch *dst, const QuantileSketch *src) {
+    for (int i = 0; i < src->count; i++) {
+        sketch_add(dst, src->centroids[i].mean, src->centroids[i].weight);
+    }
+    for (int i = 0; i < src->buffered; i++) {
+        sketch_add(dst, src->buffer[i].mean, src->buffer[i].weight);
+    }
+    /* Centroid means lie inside the source range; keep its true extremes */
+    if (src->min < dst->min) dst->min = src->min;
+    if (src->max > dst->max) dst->max = src->max;
+}
+
+double sketch_quantile(QuantileSketch *sketch, double q) {
+    sketch_compress(sketch);
+    if (sketch->count == 0) return 0.0;
+    if (q <= 0.0) return sketch->min;
+    if (q >= 1.0) return sketch->max;
+
+    const SketchCentroid *c = sketch->centroids;
+    double target = q * sketch->total_weight;
+
+    /* Interpolate between centroid centers, and out to min/max at the ends */
+    double center = c[0].weight / 2.0;
+    if (target < center) {
+        return sketch->min + (c[0].mean - sketch->min) * target / center;
+    }
+    double cumulative = 0.0;
+    for (int i = 0; i + 1 < sketch->count; i++) {
+        double left = cumulative + c[i].weight / 2.0;
+        double right = cumulative + c[i].weight + c[i + 1].weight / 2.0;
+        if (target < right) {
+            return c[i].mean + (c[i + 1].mean - c[i].mean) * (target - left) / (right - left);
+        }
+        cumulative += c[i].weight;
+    }
+    double last_center = sketch->total_weight - c[sketch->count - 1].weight / 2.0;
+    double span = sketch->total_weight - last_center;
+    double mean = c[sketch->count - 1].mean;
+    return mean + (sketch->max - mean) * ((span > 0.0) ? (target - last_center) / span : 0.0);
+}
+
+/* ============ Weakest entries (bounded max-heap) ============ */
+
+static void swap_entries(SummaryEntry *a, SummaryEntry *b) {
+    SummaryEntry tmp = *a;
+    *a = *b;
+    *b = tmp;
+}
+
+static void weakest_sift_down(SummaryEntry *items, int n, int i) {
+    for (;;) {
+        int largest = i;
+        int left = 2 * i + 1;
+        int right = left + 1;
+        if (left < n && items[left].score > items[largest].score) largest = left;
+        if (right < n && items[right].score > items[largest].score) largest = right;
+        if (largest == i) return;
+        swap_entries(&items[i], &items[largest]);
+        i = largest;
+    }
+}
+
+/**
+ * Keep the entry if it is among the SUMMARY_WEAKEST lowest scores
+ */
+static void weakest_offer(ScoreSummary *summary, double score, const char *text, size_t len) {
+    SummaryEntry *items = summary->weakest;
+    SummaryEntry *slot;
+
+    if (summary->weakest_count < SUMMARY_WEAKEST) {
+        int i = summary->weakest_count++;
+        slot = &items[i];
+        slot->score = score;
+        if (len >= sizeof(slot->text)) len = sizeof(slot->text) - 1;
+        memcpy(slot->text, text, len);
+        slot->text[len] = '\0';
+        slot->len = len;
+        while (i > 0 && items[(i - 1) / 2].score < items[i].score) {
+            swap_entries(&items[(i - 1) / 2], &items[i]);
+            i = (i - 1) / 2;
+        }
+        return;
+    }
+
+    if (score >= items[0].score) return;
+    slot = &items[0];
+    slot->score = score;
+    if (len >= sizeof(slot->text)) len = sizeof(slot->text) - 1;
+    memcpy(slot->text, text, len);
+    slot->text[len] = '\0';
+    slot->len = len;
+    weakest_sift_down(items, summary->weakest_count, 0);
+}
+
+/* ============ Summary ============ */
+
+void summary_init(ScoreSummary *summary) {
+    memset(summary, 0, sizeof(*summary));
+    sketch_init(&summary->entropy);
+    sketch_init(&summary->guesses);
+}
+
+void summary_add(ScoreSummary *summary, const char *text, size_t len,
+                 const ComplexityResult *result, unsigned class_flags) {
+    summary->count++;
+
+    int bin = (int)(result->score * (SUMMARY_SCORE_BINS - 1) / 10.0);
+    summary->score_bins[clamp_int(bin, 0, SUMMARY_SCORE_BINS - 1)]++;
+    summary->length_bins[(len < SUMMARY_LENGTH_BINS) ? len : SUMMARY_LENGTH_BINS - 1]++;
+    sketch_add(&summary->entropy, result->entropy, 1.0);
+    sketch_add(&summary->guesses, result->guesses_log2, 1.0);
+
+    int classes = 0;
+    for (int c = 0; c < 4; c++) {
+        if (class_flags & (1u << c)) {
+            summary->class_counts[c]++;
+            classes++;
+        }
+    }
+    summary->classes_per_entry[classes]++;
+
+    weakest_offer(summary, result->score, text, len);
+}
+
+void summary_merge(ScoreSummary *dst, const ScoreSummary *src) {
+    dst->count += src->count;
+    for (int i = 0; i < SUMMARY_SCORE_BINS; i++) dst->score_bins[i] += src->score_bins[i];
+    for (int i = 0; i < SUMMARY_LENGTH_BINS; i++) dst->length_bins[i] += src->length_bins[i];
+    for (int i = 0; i < 4; i++) dst->class_counts[i] += src->class_counts[i];
+    for (int i = 0; i <= 4; i++) dst->classes_per_entry[i] += src->classes_per_entry[i];
+    sketch_merge(&dst->entropy, &src->entropy);
+    sketch_merge(&dst->guesses, &src->guesses);
+    for (int i = 0; i < src->weakest_count; i++) {
+        const SummaryEntry *e = &src->weakest[i];
+        weakest_offer(dst, e->score, e->text, e->len);
+    }
+}
+
+size_t summary_length_percentile(const ScoreSummary *summary, double q) {
+    if (summary->count == 0) return 0;
+
+    /* Nearest rank: smallest length covering q of the entries */
+    double rank = ceil(q * (double)summary->count);
+    if (rank < 1.0) rank = 1.0;
+    uint64_t cumulative = 0;
+    for (size_t len = 0; len < SUMMARY_LENGTH_BINS; len++) {
+        cumulative += summary->length_bins[len];
+        if ((double)cumulative >= rank) return len;
+    }
+    return SUMMARY_LENGTH_BINS - 1;
+}
+
+static int compare_entries(const void *a, const void *b) {
+    double sa = ((const SummaryEntry *)a)->score;
+    double sb = ((const SummaryEntry *)b)->score;
+    return (sa > sb) - (sa < sb);
+}
+
+void summary_print(ScoreSummary *summary, FILE *out) {
+    double n = (summary->count > 0) ? (double)summary->count : 1.0;
+
+    fprintf(out, "Summary of %llu entries\n", (unsigned long long)summary->count);
+    if (summary->count == 0) return;
+
+    fprintf(out, "\nScore distribution:\n");
+    for (int row = 0; row < SUMMARY_SCORE_BINS; row += SUMMARY_BINS_PER_ROW) {
+        uint64_t rows = 0;
+        for (int i = row; i < row + SUMMARY_BINS_PER_ROW && i < SUMMARY_SCORE_BINS; i++) {
+            rows += summary->score_bins[i];
+        }
+        if (rows == 0) continue;
+        double low = row * 10.0 / (SUMMARY_SCORE_BINS - 1);
+        fprintf(out, "  %5.1f - %-5.1f %12llu  %5.1f%%\n", low, low + 0.5,
+                (unsigned long long)rows, 100.0 * (double)rows / n);
+    }
+
+    fprintf(out, "\nPercentile       ");
+    for (size_t i = 0; i < SUMMARY_PERCENTILE_COUNT; i++) {
+        char label[16];
+        snprintf(label, sizeof(label), "p%g", SUMMARY_PERCENTILES[i] * 100.0);
+        fprintf(out, " %8s", label);
+    }
+    fprintf(out, "\n  Entropy (bits) ");
+    for (size_t i = 0; i < SUMMARY_PERCENTILE_COUNT; i++) {
+        fprintf(out, " %8.3f", sketch_quantile(&summary->entropy, SUMMARY_PERCENTILES[i]));
+    }
+    fprintf(out, "\n  Guesses (log2) ");
+    for (size_t i = 0; i < SUMMARY_PERCENTILE_COUNT; i++) {
+        fprintf(out, " %8.1f", sketch_quantile(&summary->guesses, SUMMARY_PERCENTILES[i]));
+    }
+    fprintf(out, "\n  Length         ");
+    for (size_t i = 0; i < SUMMARY_PERCENTILE_COUNT; i++) {
+        fprintf(out, " %8zu", summary_length_percentile(summary, SUMMARY_PERCENTILES[i]));
+    }
+    fprintf(out, "\n");
+
+    static const char *class_names[] = {"lowercase", "uppercase", "digits", "symbols"};
+    fprintf(out, "\nCharacter classes:\n");
+    for (int c = 0; c < 4; c++) {
+        fprintf(out, "  %-10s %12llu  %5.1f%%\n", class_names[c],
+                (unsigned long long)summary->class_counts[c],
+                100.0 * (double)summary->class_counts[c] / n);
+    }
+    fprintf(out, "  Classes per entry:");
+    for (int k = 0; k <= 4; k++) {
+        fprintf(out, "  %d: %.1f%%", k, 100.0 * (double)summary->classes_per_entry[k] / n);
+    }
+    fprintf(out, "\n");
+
+    qsort(summary->weakest, (size_t)summary->weakest_count, sizeof(SummaryEntry), compare_entries);
+    fprintf(out, "\nWeakest %d:\n", summary->weakest_count);
+    for (int i = 0; i < summary->weakest_count; i++) {
+        fprintf(out, "  %5.2f  ", summary->weakest[i].score);
+        fwrite(summary->weakest[i].text, 1, summary->weakest[i].len, out);
+        fputc('\n', out);
+    }
+}
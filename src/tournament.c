@@ -0,0 +1,132 @@
+/*
+ * tournament.c - Candidate Tournament
+ * MeowPassword - Cat Name Based Secure Password Generator
+ *
+ * Generates up to N scored candidates and keeps the K best in a bounded
+ * min-heap (worst kept candidate at the root), so memory stays O(K) no
+ * matter how many candidates are drawn. Unless every candidate is shown,
+ * candidates are ranked by score alone and only the caller's winners get
+ * the full breakdown.
+ *
+ * Copyright (c) 2025 Jeffrey Kunzelman
+ * MIT License
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "meowpass.h"
+
+int candidate_heap_init(CandidateHeap *heap, int capacity) {
+    heap->size = 0;
+    heap->capacity = (capacity > 0) ? capacity : 1;
+    heap->items = malloc((size_t)heap->capacity * sizeof(PasswordCandidate));
+    return heap->items ? 0 : -1;
+}
+
+void candidate_heap_free(CandidateHeap *heap) {
+    if (heap->items) {
+        memset(heap->items, 0, (size_t)heap->capacity * sizeof(PasswordCandidate));
+        free(heap->items);
+    }
+    heap->items = NULL;
+    heap->size = 0;
+    heap->capacity = 0;
+}
+
+static void swap_candidates(PasswordCandidate *a, PasswordCandidate *b) {
+    PasswordCandidate tmp = *a;
+    *a = *b;
+    *b = tmp;
+}
+
+/**
+ * Restore the heap property below index i within the first n items
+ */
+static void sift_down(PasswordCandidate *items, int n, int i) {
+    for (;;) {
+        int smallest = i;
+        int left = 2 * i + 1;
+        int right = left + 1;
+        if (left < n && items[left].complexity.score < items[smallest].complexity.score) {
+            smallest = left;
+        }
+        if (right < n && items[right].complexity.score < items[smallest].complexity.score) {
+            smallest = right;
+        }
+        if (smallest == i) return;
+        swap_candidates(&items[i], &items[smallest]);
+        i = smallest;
+    }
+}
+
+bool candidate_heap_offer(CandidateHeap *heap, const PasswordCandidate *candidate) {
+    PasswordCandidate *items = heap->items;
+
+    if (heap->size < heap->capacity) {
+        int i = heap->size++;
+        items[i] = *candidate;
+        while (i > 0) {
+            int parent = (i - 1) / 2;
+            if (items[parent].complexity.score <= items[i].complexity.score) break;
+            swap_candidates(&items[parent], &items[i]);
+            i = parent;
+        }
+        return true;
+    }
+
+    /* Full: only a strictly better candidate displaces the worst kept one,
+     * so ties keep the earlier candidate */
+    if (candidate->complexity.score <= items[0].complexity.score) return false;
+    items[0] = *candidate;
+    sift_down(items, heap->size, 0);
+    return true;
+}
+
+int candidate_heap_sort(CandidateHeap *heap) {
+    /* Heapsort on a min-heap leaves the items in descending score order */
+    for (int end = heap->size - 1; end > 0; end--) {
+        swap_candidates(&heap->items[0], &heap->items[end]);
+        sift_down(heap->items, end, 0);
+    }
+    return heap->size;
+}
+
+int run_tournament(const PasswordConfig *config, CandidateHeap *best, bool show_each,
+                   bool *reached_target) {
+    PasswordCandidate candidate;
+    int generated = 0;
+    if (reached_target) *reached_target = false;
+
+    while (generated < config->candidates) {
+        generated++;
+
+        if (show_each) {
+            /* Every candidate is displayed, so every one is scored in full */
+            generate_candidate(config, &candidate);
+            display_candidate(generated, &candidate);
+        } else {
+            /* Ranking only: a candidate that cannot displace the worst kept
+             * one is dropped without its substring count. Its breakdown is
+             * left for the caller to compute for the winner. */
+            double must_beat = (best->size < best->capacity) ? -INFINITY :
+                           best->items[0].complexity.score;
+            generate_password(config, candidate.password, sizeof(candidate.password));
+            size_t len = strlen(candidate.password);
+            double score;
+            if (!complexity_score_above(candidate.password, len, must_beat, &score)) continue;
+            memset(&candidate.complexity, 0, sizeof(candidate.complexity));
+            candidate.complexity.score = score;
+            candidate.complexity.length = (int)len;
+        }
+        candidate_heap_offer(best, &candidate);
+
+        if (config->target_score > 0.0 && candidate.complexity.score >= config->target_score) {
+            if (reached_target) *reached_target = true;
+            break;
+        }
+    }
+
+    memset(&candidate, 0, sizeof(candidate));
+    return generated;
+}
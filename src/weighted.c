@@ -0,0 +1,365 @@
+/*
+ * weighted.c - Weighted Multi-Dictionary Name Sampling
+ * MeowPassword - Cat Name Based Secure Password Generator
+ *
+ * Draws base phrases from a mix of dictionaries ("cats=70,words.meowdict=30"),
+ * optionally weighting each name by its length raised to a bias. A source's
+ * share is the chance that a single unconstrained draw comes from it; each
+ * name within a source carries weight length^bias.
+ *
+ * As in sampler.c, a phrase is 2..MAX_NAMES_PER_PASSWORD names whose
+ * joined length lies in [MIN_LENGTH, max_length], here drawn with
+ * probability proportional to the product of its name weights. W[L] is the
+ * total weight of names of length L and ways[k][t] the total weight of
+ * k-name sequences of length t, with name weights scaled so a mix of one
+ * list counts sequences exactly. Every choice is then one Vose alias table
+ * draw, all built once per mix: the (name count, length) cell, each
+ * name's length given the names and length left, the source given that
+ * length, and finally a uniform name from that source's length bucket.
+ * Cost per name is constant however many sources or however skewed the
+ * weights. With one source and bias 0 this is exactly the uniform sampler.
+ *
+ * Copyright (c) 2025 Jeffrey Kunzelman
+ * MIT License
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "meowpass.h"
+
+/* Name count and total length cells, k in [2, MAX_NAMES_PER_PASSWORD] */
+#define SHAPE_CELLS ((MAX_NAMES_PER_PASSWORD - 1) * (MAX_LENGTH + 1))
+
+typedef struct {
+    Dictionary dict;
+    bool owned;                 /* Opened here, closed with the mix */
+    double share;
+} NameSource;
+
+struct NameMix {
+    NameSource sources[MAX_NAME_SOURCES];
+    int count;
+    double ways[MAX_NAMES_PER_PASSWORD + 1][MAX_LENGTH + 1];
+    double name_bits[MAX_LENGTH + 1];           /* Entropy of a name given its length */
+    double path_bits[MAX_NAMES_PER_PASSWORD + 1][MAX_LENGTH + 1];
+    AliasTable source_by_length[MAX_LENGTH + 1];
+    AliasTable next_length[MAX_NAMES_PER_PASSWORD + 1][MAX_LENGTH + 1];
+    AliasTable shape[MAX_LENGTH + 1];           /* Per max length: (count, length) cell */
+};
+
+/* Mix used by password generation (NULL = uniform sampler) */
+static NameMix *active_mix = NULL;
+
+int alias_table_init(AliasTable *table, const double *weights, size_t n) {
+    memset(table, 0, sizeof(*table));
+    double total = 0.0;
+    for (size_t i = 0; i < n; i++) {
+        if (!(weights[i] >= 0.0) || isinf(weights[i])) return -1;
+        total += weights[i];
+    }
+    if (n == 0 || n > UINT32_MAX || !(total > 0.0)) return -1;
+
+    AliasSlot *slots = malloc(n * sizeof(AliasSlot));
+    double *scaled = malloc(n * sizeof(double));
+    uint32_t *small = malloc(n * sizeof(uint32_t));
+    uint32_t *large = malloc(n * sizeof(uint32_t));
+    if (!slots || !scaled || !small || !large) {
+        free(slots);
+        free(scaled);
+        free(small);
+        free(large);
+        return -1;
+    }
+
+    /* Vose: pair each under-full slot with an over-full one */
+    size_t n_small = 0, n_large = 0;
+    for (size_t i = 0; i < n; i++) {
+        scaled[i] = weights[i] * (double)n / total;
+        if (scaled[i] < 1.0) small[n_small++] = (uint32_t)i;
+        else large[n_large++] = (uint32_t)i;
+    }
+    while (n_small > 0 && n_large > 0) {
+        uint32_t s = small[--n_small];
+        uint32_t l = large[--n_large];
+        slots[s].keep = (uint32_t)(scaled[s] * 4294967296.0);
+        slots[s].alias = l;
+        scaled[l] = (scaled[l] + scaled[s]) - 1.0;
+        if (scaled[l] < 1.0) small[n_small++] = l;
+        else large[n_large++] = l;
+    }
+    /* Leftovers are full up to rounding */
+    while (n_large > 0) {
+        uint32_t l = large[--n_large];
+        slots[l].keep = UINT32_MAX;
+        slots[l].alias = l;
+    }
+    while (n_small > 0) {
+        uint32_t s = small[--n_small];
+        slots[s].keep = UINT32_MAX;
+        slots[s].alias = s;
+    }
+
+    free(scaled);
+    free(small);
+    free(large);
+    table->slots = slots;
+    table->size = (uint32_t)n;
+    return 0;
+}
+
+size_t alias_table_draw(const AliasTable *table, MeowRng *rng) {
+    size_t i = rng_uniform(rng, table->size);
+    return (rng_next(rng) < table->slots[i].keep) ? i : table->slots[i].alias;
+}
+
+void alias_table_free(AliasTable *table) {
+    free(table->slots);
+    memset(table, 0, sizeof(*table));
+}
+
+static size_t bucket_count(const Dictionary *dict, int len) {
+    return dict->length_start[len + 1] - dict->length_start[len];
+}
+
+/**
+ * Parse "source[=share],..." into mix->sources
+ * @return 0 on success, -1 on a malformed spec or unreadable dictionary
+ */
+static int parse_sources(NameMix *mix, const char *spec) {
+    size_t spec_len = strlen(spec);
+    char *copy = malloc(spec_len + 1);
+    if (!copy) return -1;
+    memcpy(copy, spec, spec_len + 1);
+
+    int rc = 0;
+    char *item = copy;
+    while (rc == 0) {
+        char *comma = strchr(item, ',');
+        if (comma) *comma = '\0';
+
+        /* The last '=' splits off the share, so paths may contain '=' */
+        char *eq = strrchr(item, '=');
+        double share = 1.0;
+        if (eq) {
+            char *end;
+            *eq = '\0';
+            share = strtod(eq + 1, &end);
+            if (end == eq + 1 || *end != '\0') rc = -1;
+        }
+        if (rc != 0 || item[0] == '\0' || !(share > 0.0) || isinf(share) ||
+            mix->count == MAX_NAME_SOURCES) {
+            rc = -1;
+            break;
+        }
+
+        NameSource *src = &mix->sources[mix->count];
+        if (strcmp(item, NAME_SOURCE_ACTIVE) == 0) {
+            src->dict = *dictionary_active();
+            src->owned = false;
+        } else if (dictionary_open(&src->dict, item) == 0) {
+            src->owned = true;
+        } else {
+            rc = -1;
+            break;
+        }
+        src->share = share;
+        mix->count++;
+
+        if (!comma) break;
+        item = comma + 1;
+    }
+    free(copy);
+    return rc;
+}
+
+/**
+ * Build every alias table and the entropy tables from the sources
+ * @return 0 on success, -1 if no phrase fits or out of memory
+ */
+static int build_tables(NameMix *mix, double length_bias) {
+    double share_total = 0.0;
+    for (int s = 0; s < mix->count; s++) share_total += mix->sources[s].share;
+
+    /* Weight of each source's names by length, scaled to its share */
+    double mass[MAX_NAME_SOURCES][MAX_LENGTH + 1];
+    double length_weight[MAX_LENGTH + 1] = {0};
+    for (int s = 0; s < mix->count; s++) {
+        const Dictionary *dict = &mix->sources[s].dict;
+        double z = 0.0;
+        for (int len = 1; len <= MAX_LENGTH; len++) {
+            mass[s][len] = (double)bucket_count(dict, len) * pow((double)len, length_bias);
+            z += mass[s][len];
+        }
+        if (!(z > 0.0)) return -1;
+        for (int len = 1; len <= MAX_LENGTH; len++) {
+            mass[s][len] *= mix->sources[s].share / share_total / z;
+        }
+    }
+
+    /* Scale single-draw probabilities by the effective vocabulary size
+     * (2^entropy of one draw) so phrases of different name counts compare
+     * as they would over a uniform list of that many names */
+    double draw_bits = 0.0;
+    for (int s = 0; s < mix->count; s++) {
+        for (int len = 1; len <= MAX_LENGTH; len++) {
+            double m = mass[s][len];
+            if (m > 0.0) {
+                draw_bits += m * (log2((double)bucket_count(&mix->sources[s].dict, len)) - log2(m));
+            }
+        }
+    }
+    double vocabulary = exp2(draw_bits);
+    for (int s = 0; s < mix->count; s++) {
+        for (int len = 1; len <= MAX_LENGTH; len++) {
+            mass[s][len] *= vocabulary;
+            length_weight[len] += mass[s][len];
+        }
+    }
+
+    /* Source given length, and the entropy of a name of that length */
+    for (int len = 1; len <= MAX_LENGTH; len++) {
+        mix->name_bits[len] = 0.0;
+        if (!(length_weight[len] > 0.0)) continue;
+        double weights[MAX_NAME_SOURCES];
+        for (int s = 0; s < mix->count; s++) {
+            weights[s] = mass[s][len];
+            double p = mass[s][len] / length_weight[len];
+            if (p > 0.0) {
+                mix->name_bits[len] += p * (log2((double)bucket_count(&mix->sources[s].dict, len)) - log2(p));
+            }
+        }
+        if (alias_table_init(&mix->source_by_length[len], weights, (size_t)mix->count) != 0) return -1;
+    }
+
+    /* ways[k][t] = sum over L of W[L] * ways[k-1][t-L] */
+    memset(mix->ways, 0, sizeof(mix->ways));
+    mix->ways[0][0] = 1.0;
+    for (int k = 1; k <= MAX_NAMES_PER_PASSWORD; k++) {
+        for (int t = 1; t <= MAX_LENGTH; t++) {
+            double sum = 0.0;
+            for (int len = 1; len <= t; len++) {
+                sum += length_weight[len] * mix->ways[k - 1][t - len];
+            }
+            mix->ways[k][t] = sum;
+        }
+    }
+
+    /* Length of the next name given the names and length left, and the
+     * expected bits spent drawing the rest of the phrase from there */
+    memset(mix->path_bits, 0, sizeof(mix->path_bits));
+    double weights[MAX_LENGTH];
+    for (int k = 1; k <= MAX_NAMES_PER_PASSWORD; k++) {
+        for (int t = 1; t <= MAX_LENGTH; t++) {
+            if (!(mix->ways[k][t] > 0.0)) continue;
+            double bits = 0.0;
+            for (int len = 1; len <= t; len++) {
+                weights[len - 1] = length_weight[len] * mix->ways[k - 1][t - len];
+                double q = weights[len - 1] / mix->ways[k][t];
+                if (q > 0.0) {
+                    bits += q * (mix->name_bits[len] + mix->path_bits[k - 1][t - len] - log2(q));
+                }
+            }
+            mix->path_bits[k][t] = bits;
+            if (alias_table_init(&mix->next_length[k][t], weights, (size_t)t) != 0) return -1;
+        }
+    }
+
+    /* (name count, total length) cell per max length */
+    double cells[SHAPE_CELLS];
+    bool any = false;
+    for (int max_length = MIN_LENGTH; max_length <= MAX_LENGTH; max_length++) {
+        for (int k = 2; k <= MAX_NAMES_PER_PASSWORD; k++) {
+            for (int t = 0; t <= MAX_LENGTH; t++) {
+                bool fits = t >= MIN_LENGTH && t <= max_length;
+                cells[(k - 2) * (MAX_LENGTH + 1) + t] = fits ? mix->ways[k][t] : 0.0;
+            }
+        }
+        if (alias_table_init(&mix->shape[max_length], cells, SHAPE_CELLS) == 0) any = true;
+    }
+    return any ? 0 : -1;
+}
+
+NameMix *name_mix_create(const char *spec, double length_bias) {
+    if (!isfinite(length_bias)) return NULL;
+    NameMix *mix = calloc(1, sizeof(NameMix));
+    if (!mix) return NULL;
+    if (parse_sources(mix, spec ? spec : NAME_SOURCE_ACTIVE) != 0 ||
+        build_tables(mix, length_bias) != 0) {
+        name_mix_destroy(mix);
+        return NULL;
+    }
+    return mix;
+}
+
+void name_mix_destroy(NameMix *mix) {
+    if (!mix) return;
+    for (int s = 0; s < mix->count; s++) {
+        if (mix->sources[s].owned) dictionary_close(&mix->sources[s].dict);
+    }
+    for (int len = 0; len <= MAX_LENGTH; len++) {
+        alias_table_free(&mix->source_by_length[len]);
+        alias_table_free(&mix->shape[len]);
+        for (int k = 0; k <= MAX_NAMES_PER_PASSWORD; k++) {
+            alias_table_free(&mix->next_length[k][len]);
+        }
+    }
+    free(mix);
+}
+
+size_t name_mix_sample(const NameMix *mix, MeowRng *rng, int max_length,
+                       char *output, size_t output_size) {
+    max_length = clamp_int(max_length, MIN_LENGTH, MAX_LENGTH);
+    const AliasTable *shape = &mix->shape[max_length];
+    if (shape->size == 0 || (size_t)max_length >= output_size) return 0;
+
+    size_t cell = alias_table_draw(shape, rng);
+    int k = (int)(cell / (MAX_LENGTH + 1)) + 2;
+    int left = (int)(cell % (MAX_LENGTH + 1));
+
+    size_t out_len = 0;
+    char buf[DICT_WORD_BUF];
+    for (int remaining = k; remaining > 0; remaining--) {
+        int len = (int)alias_table_draw(&mix->next_length[remaining][left], rng) + 1;
+        const Dictionary *dict = &mix->sources[alias_table_draw(&mix->source_by_length[len], rng)].dict;
+        size_t slot = rng_uniform(rng, bucket_count(dict, len));
+        NameView name = dictionary_word(dict, dict->by_length[dict->length_start[len] + slot], buf);
+        if (name.len != (size_t)len) return 0;  /* Damaged length index */
+        memcpy(&output[out_len], name.str, name.len);
+        out_len += name.len;
+        left -= len;
+    }
+
+    output[out_len] = '\0';
+    return out_len;
+}
+
+double name_mix_entropy(const NameMix *mix, int max_length) {
+    max_length = clamp_int(max_length, MIN_LENGTH, MAX_LENGTH);
+    double total = 0.0;
+    for (int k = 2; k <= MAX_NAMES_PER_PASSWORD; k++) {
+        for (int t = MIN_LENGTH; t <= max_length; t++) total += mix->ways[k][t];
+    }
+    if (!(total > 0.0)) return 0.0;
+
+    double bits = 0.0;
+    for (int k = 2; k <= MAX_NAMES_PER_PASSWORD; k++) {
+        for (int t = MIN_LENGTH; t <= max_length; t++) {
+            double p = mix->ways[k][t] / total;
+            if (p > 0.0) bits += p * (mix->path_bits[k][t] - log2(p));
+        }
+    }
+    return bits;
+}
+
+int name_mix_select(const char *spec, double length_bias) {
+    NameMix *mix = name_mix_create(spec, length_bias);
+    if (!mix) return -1;
+    name_mix_destroy(active_mix);
+    active_mix = mix;
+    return 0;
+}
+
+const NameMix *name_mix_active(void) {
+    return active_mix;
+}
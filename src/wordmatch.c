@@ -0,0 +1,456 @@
+/*
+ * wordmatch.c - Dictionary Word Detection and Guess Estimation
+ * MeowPassword - Cat Name Based Secure Password Generator
+ *
+ * An Aho-Corasick automaton over the cat names (letters only, lowercased),
+ * the first WORD_DICT_LIMIT words of a --dict dictionary and of the loaded
+ * wordlists finds every dictionary word in a password in
+ * one left-to-right pass. The automaton is a dense DFA: failure links are
+ * folded into the transition table when it is built on first use, so each
+ * byte costs one table lookup. Common l33t substitutions (4 -> a, 3 -> e,
+ * ...) are undone before lookup.
+ *
+ * The guess estimate follows zxcvbn: a dynamic program picks the cheapest
+ * split of the password into dictionary words and brute-force characters,
+ * where a word costs its rank times its uppercase and l33t variations and
+ * a brute-force character costs ten guesses. The number
+ * of pieces k adds log2(k!) for the attacker having to try orderings.
+ *
+ * Copyright (c) 2025 Jeffrey Kunzelman
+ * MIT License
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+#include "meowpass.h"
+
+/* Automaton alphabet: the 26 letters */
+#define WORD_ALPHABET 26
+
+/* Transition rows also hold the first word state on the state's
+ * dictionary chain, so steps that end no word touch one row only */
+#define ROW_STRIDE (WORD_ALPHABET + 1)
+#define ROW_OUTPUT WORD_ALPHABET
+
+/* Guesses per brute-forced character, as in zxcvbn */
+#define BRUTEFORCE_BITS 3.321928094887362  /* log2(10) */
+
+/* Automaton state; transitions live in a separate dense table */
+typedef struct {
+    int32_t fail;
+    int32_t dict_link;          /* Nearest proper suffix state that ends a word, -1 if none */
+    uint8_t word_len;           /* Length of the word ending here, 0 if none */
+    float word_bits;            /* log2 rank of that word */
+} WordState;
+
+typedef struct {
+    int32_t *next;              /* states * ROW_STRIDE, -1 = none during build */
+    WordState *states;
+    int32_t count;
+    int32_t capacity;
+    size_t words;
+} WordAutomaton;
+
+/* Words loaded with wordlist_load, added when the automaton is built */
+typedef struct {
+    char *text;                 /* NUL-separated normalized words */
+    size_t len;
+    size_t cap;
+    size_t count;
+} PendingWords;
+
+static WordAutomaton automaton;
+static bool automaton_ready = false;
+static PendingWords pending;
+static pthread_once_t automaton_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t pending_lock = PTHREAD_MUTEX_INITIALIZER;
+static bool automaton_started = false;
+
+/* Byte -> letter index (after l33t undo), -1 for bytes that end a word */
+static int8_t letter_of[256];
+/* Non-zero for bytes that only map to a letter through l33t */
+static uint8_t is_l33t[256];
+/* log2(k!) for the ordering of k pieces */
+static double log2_factorial[MAX_PASSWORD_LENGTH + 1];
+/* log2 of the ways to capitalize up to min(U, L) of U + L letters */
+static double mixed_case_bits[WORD_MAX_LENGTH + 1][WORD_MAX_LENGTH + 1];
+
+static void init_letter_table(void) {
+    static const char l33t[][2] = {
+        {'4', 'a'}, {'@', 'a'}, {'8', 'b'}, {'(', 'c'}, {'3', 'e'}, {'9', 'g'},
+        {'1', 'i'}, {'!', 'i'}, {'|', 'l'}, {'0', 'o'}, {'5', 's'}, {'$', 's'},
+        {'7', 't'}, {'+', 't'}, {'2', 'z'}
+    };
+    memset(letter_of, -1, sizeof(letter_of));
+    memset(is_l33t, 0, sizeof(is_l33t));
+    for (int c = 'a'; c <= 'z'; c++) {
+        letter_of[c] = (int8_t)(c - 'a');
+        letter_of[c - 'a' + 'A'] = (int8_t)(c - 'a');
+    }
+    for (size_t i = 0; i < sizeof(l33t) / sizeof(l33t[0]); i++) {
+        unsigned char c = (unsigned char)l33t[i][0];
+        letter_of[c] = (int8_t)(l33t[i][1] - 'a');
+        is_l33t[c] = 1;
+    }
+    log2_factorial[0] = 0.0;
+    for (int k = 1; k <= MAX_PASSWORD_LENGTH; k++) {
+        log2_factorial[k] = log2_factorial[k - 1] + log2((double)k);
+    }
+    for (int upper = 1; upper <= WORD_MAX_LENGTH; upper++) {
+        for (int lower = 1; upper + lower <= WORD_MAX_LENGTH; lower++) {
+            int n = upper + lower;
+            int k_max = (upper < lower) ? upper : lower;
+            double variations = 0.0, binomial = 1.0;
+            for (int k = 1; k <= k_max; k++) {
+                binomial = binomial * (double)(n - k + 1) / (double)k;
+                variations += binomial;
+            }
+            mixed_case_bits[upper][lower] = log2(variations);
+        }
+    }
+}
+
+/**
+ * Lowercase the letters of a word, dropping everything else
+ * @return Normalized length
+ */
+static size_t normalize_word(const char *word, size_t len, char *out, size_t out_size) {
+    size_t n = 0;
+    for (size_t i = 0; i < len && n + 1 < out_size; i++) {
+        unsigned char c = (unsigned char)word[i];
+        if (c >= 'A' && c <= 'Z') c = (unsigned char)(c - 'A' + 'a');
+        if (c >= 'a' && c <= 'z') out[n++] = (char)c;
+    }
+    out[n] = '\0';
+    return n;
+}
+
+static int32_t new_state(WordAutomaton *ac) {
+    if (ac->count == ac->capacity) {
+        int32_t capacity = (ac->capacity == 0) ? 4096 : ac->capacity * 2;
+        int32_t *next = realloc(ac->next, (size_t)capacity * ROW_STRIDE * sizeof(int32_t));
+        if (!next) return -1;
+        ac->next = next;
+        WordState *states = realloc(ac->states, (size_t)capacity * sizeof(WordState));
+        if (!states) return -1;
+        ac->states = states;
+        ac->capacity = capacity;
+    }
+    int32_t s = ac->count++;
+    for (int c = 0; c < ROW_STRIDE; c++) ac->next[(size_t)s * ROW_STRIDE + (size_t)c] = -1;
+    ac->states[s].fail = 0;
+    ac->states[s].dict_link = -1;
+    ac->states[s].word_len = 0;
+    ac->states[s].word_bits = 0.0f;
+    return s;
+}
+
+/**
+ * Insert a normalized word; a word already present keeps its lower rank
+ */
+static int insert_word(WordAutomaton *ac, const char *word, size_t len, double bits) {
+    if (len < WORD_MIN_LENGTH || len > WORD_MAX_LENGTH) return 0;
+
+    int32_t s = 0;
+    for (size_t i = 0; i < len; i++) {
+        size_t slot = (size_t)s * ROW_STRIDE + (size_t)(word[i] - 'a');
+        int32_t t = ac->next[slot];
+        if (t < 0) {
+            t = new_state(ac);
+            if (t < 0) return -1;
+            ac->next[slot] = t;
+        }
+        s = t;
+    }
+    WordState *state = &ac->states[s];
+    if (state->word_len == 0) {
+        ac->words++;
+        state->word_len = (uint8_t)len;
+        state->word_bits = (float)bits;
+    } else if (bits < state->word_bits) {
+        state->word_bits = (float)bits;
+    }
+    return 0;
+}
+
+/**
+ * Fill failure and dictionary links breadth-first, folding failures into
+ * the transition table so matching never backtracks
+ */
+static int link_states(WordAutomaton *ac) {
+    int32_t *queue = malloc((size_t)ac->count * sizeof(int32_t));
+    if (!queue) return -1;
+    int32_t head = 0, tail = 0;
+
+    for (int c = 0; c < WORD_ALPHABET; c++) {
+        int32_t t = ac->next[c];
+        if (t < 0) {
+            ac->next[c] = 0;
+        } else {
+            ac->states[t].fail = 0;
+            queue[tail++] = t;
+        }
+    }
+    while (head < tail) {
+        int32_t s = queue[head++];
+        int32_t f = ac->states[s].fail;
+        ac->states[s].dict_link = (ac->states[f].word_len > 0) ? f : ac->states[f].dict_link;
+        ac->next[(size_t)s * ROW_STRIDE + ROW_OUTPUT] =
+            (ac->states[s].word_len > 0) ? s : ac->states[s].dict_link;
+        for (int c = 0; c < WORD_ALPHABET; c++) {
+            size_t slot = (size_t)s * ROW_STRIDE + (size_t)c;
+            int32_t t = ac->next[slot];
+            int32_t via_fail = ac->next[(size_t)f * ROW_STRIDE + (size_t)c];
+            if (t < 0) {
+                ac->next[slot] = via_fail;
+            } else {
+                ac->states[t].fail = via_fail;
+                queue[tail++] = t;
+            }
+        }
+    }
+    free(queue);
+    return 0;
+}
+
+/**
+ * Insert up to limit names of a dictionary. Names are not ranked by
+ * popularity: each costs the full table size, as the sampler draws them.
+ */
+static int insert_dictionary(WordAutomaton *ac, const Dictionary *dict, size_t limit) {
+    double name_bits = log2((double)dict->count);
+    char word[WORD_MAX_LENGTH + 2];
+    char buf[DICT_WORD_BUF];
+    if (limit > dict->count) limit = dict->count;
+    for (size_t i = 0; i < limit; i++) {
+        NameView name = dictionary_word(dict, i, buf);
+        size_t len = normalize_word(name.str, name.len, word, sizeof(word));
+        if (insert_word(ac, word, len, name_bits) != 0) return -1;
+    }
+    return 0;
+}
+
+/**
+ * Insert the cat names, the head of a --dict dictionary and the pending
+ * wordlists, and link the result. The dense table costs ROW_STRIDE
+ * transitions per state, so a multi-million word dictionary or wordlist
+ * is capped at WORD_DICT_LIMIT words rather than inserted whole.
+ * @return 0 on success, -1 on allocation failure
+ */
+static int fill_automaton(WordAutomaton *ac) {
+    if (new_state(ac) < 0) return -1;
+
+    const Dictionary *cats = get_cat_dictionary();
+    if (insert_dictionary(ac, cats, cats->count) != 0) return -1;
+    const Dictionary *dict = dictionary_active();
+    if (dict != cats && insert_dictionary(ac, dict, WORD_DICT_LIMIT) != 0) return -1;
+
+    /* Wordlists are ranked: line n costs n guesses */
+    const char *p = pending.text;
+    for (size_t rank = 1; rank <= pending.count; rank++) {
+        size_t len = strlen(p);
+        if (insert_word(ac, p, len, log2((double)rank)) != 0) return -1;
+        p += len + 1;
+    }
+
+    return link_states(ac);
+}
+
+static void build_automaton(void) {
+    init_letter_table();
+
+    pthread_mutex_lock(&pending_lock);
+    automaton_started = true;
+    pthread_mutex_unlock(&pending_lock);
+
+    /* On failure matching is skipped and every character is brute force */
+    WordAutomaton ac = {0};
+    if (fill_automaton(&ac) != 0) {
+        free(ac.next);
+        free(ac.states);
+        fprintf(stderr, "WARNING: Out of memory for the dictionary matcher; "
+                "guess estimates ignore dictionary words.\n");
+        return;
+    }
+    automaton = ac;
+    automaton_ready = true;
+}
+
+int wordlist_load(const char *path) {
+    FILE *in = fopen(path, "r");
+    if (!in) return -1;
+
+    pthread_mutex_lock(&pending_lock);
+    if (automaton_started) {
+        pthread_mutex_unlock(&pending_lock);
+        fclose(in);
+        return -1;
+    }
+
+    /* Ranked lists put their most common words first: keep the head */
+    char *line = NULL;
+    size_t line_cap = 0;
+    ssize_t line_len;
+    char word[WORD_MAX_LENGTH + 2];
+    int rc = 0;
+    while (rc == 0 && pending.count < WORD_DICT_LIMIT &&
+           (line_len = getline(&line, &line_cap, in)) >= 0) {
+        size_t len = normalize_word(line, (size_t)line_len, word, sizeof(word));
+        if (len < WORD_MIN_LENGTH || len > WORD_MAX_LENGTH) continue;
+        if (pending.len + len + 1 > pending.cap) {
+            size_t cap = (pending.cap == 0) ? 4096 : pending.cap * 2;
+            while (cap < pending.len + len + 1) cap *= 2;
+            char *text = realloc(pending.text, cap);
+            if (!text) {
+                rc = -1;
+                break;
+            }
+            pending.text = text;
+            pending.cap = cap;
+        }
+        memcpy(&pending.text[pending.len], word, len + 1);
+        pending.len += len + 1;
+        pending.count++;
+    }
+    if (ferror(in)) rc = -1;
+    pthread_mutex_unlock(&pending_lock);
+    free(line);
+    fclose(in);
+    return rc;
+}
+
+size_t dictionary_word_count(void) {
+    pthread_once(&automaton_once, build_automaton);
+    return automaton_ready ? automaton.words : 0;
+}
+
+/* Running counts over a password, so each match is costed in O(1) */
+typedef struct {
+    uint8_t upper[MAX_PASSWORD_LENGTH + 1];   /* Uppercase letters before i */
+    uint8_t lower[MAX_PASSWORD_LENGTH + 1];
+    uint8_t l33t[MAX_PASSWORD_LENGTH + 1];    /* l33t substitutes before i */
+} PrefixCounts;
+
+static void count_prefixes(const char *str, size_t len, PrefixCounts *counts) {
+    counts->upper[0] = counts->lower[0] = counts->l33t[0] = 0;
+    for (size_t i = 0; i < len; i++) {
+        unsigned char c = (unsigned char)str[i];
+        counts->upper[i + 1] = (uint8_t)(counts->upper[i] + (c >= 'A' && c <= 'Z'));
+        counts->lower[i + 1] = (uint8_t)(counts->lower[i] + (c >= 'a' && c <= 'z'));
+        counts->l33t[i + 1] = (uint8_t)(counts->l33t[i] + is_l33t[c]);
+    }
+}
+
+/**
+ * log2 of the case variations an attacker tries for a word (zxcvbn)
+ */
+static double uppercase_bits(const char *str, const PrefixCounts *counts, size_t start, size_t len) {
+    int upper = counts->upper[start + len] - counts->upper[start];
+    int lower = counts->lower[start + len] - counts->lower[start];
+    if (upper == 0) return 0.0;
+    /* All caps, or a single capital at either end: one extra guess */
+    bool first = str[start] >= 'A' && str[start] <= 'Z';
+    bool last = str[start + len - 1] >= 'A' && str[start + len - 1] <= 'Z';
+    if (lower == 0 || (upper == 1 && (first || last))) return 1.0;
+
+    /* Otherwise every way to capitalize up to min(U, L) letters; matches
+     * are at most WORD_MAX_LENGTH long */
+    return mixed_case_bits[upper][lower];
+}
+
+/**
+ * Cost of one dictionary word at [start, start + len): rank, case and
+ * one bit per l33t substitution
+ */
+static double match_bits(const char *str, const PrefixCounts *counts, size_t start, size_t len,
+                         float word_bits) {
+    int subs = counts->l33t[start + len] - counts->l33t[start];
+    return (double)word_bits + uppercase_bits(str, counts, start, len) + (double)subs;
+}
+
+/**
+ * Advance the automaton by one byte; bytes outside the alphabet reset it
+ */
+static inline int32_t advance(int32_t state, unsigned char c) {
+    int8_t letter = letter_of[c];
+    if (letter < 0) return 0;
+    return automaton.next[(size_t)state * ROW_STRIDE + (size_t)letter];
+}
+
+/**
+ * First state on the dictionary chain of state (itself if it ends a word)
+ */
+static inline int32_t first_word(int32_t state) {
+    return automaton.next[(size_t)state * ROW_STRIDE + ROW_OUTPUT];
+}
+
+int find_dictionary_matches(const char *str, size_t len, DictionaryMatch *matches, int max) {
+    pthread_once(&automaton_once, build_automaton);
+    if (!automaton_ready) return 0;
+
+    if (len > MAX_PASSWORD_LENGTH) len = MAX_PASSWORD_LENGTH;
+    PrefixCounts counts;
+    count_prefixes(str, len, &counts);
+
+    int count = 0;
+    int32_t state = 0;
+    for (size_t end = 0; end < len; end++) {
+        state = advance(state, (unsigned char)str[end]);
+        for (int32_t hit = first_word(state); hit >= 0; hit = automaton.states[hit].dict_link) {
+            if (count < max) {
+                size_t word_len = automaton.states[hit].word_len;
+                size_t start = end + 1 - word_len;
+                matches[count].start = (int)start;
+                matches[count].length = (int)word_len;
+                matches[count].guesses_log2 =
+                    match_bits(str, &counts, start, word_len, automaton.states[hit].word_bits);
+            }
+            count++;
+        }
+    }
+    return count;
+}
+
+double estimate_guesses_log2(const char *str, size_t len) {
+    pthread_once(&automaton_once, build_automaton);
+
+    /* bits[i]: cheapest cost of str[0, i); pieces[i]: pieces on that path,
+     * counting a run of brute-force characters as one piece */
+    double bits[MAX_PASSWORD_LENGTH + 1];
+    int pieces[MAX_PASSWORD_LENGTH + 1];
+    bool brute[MAX_PASSWORD_LENGTH + 1];
+    if (len > MAX_PASSWORD_LENGTH) len = MAX_PASSWORD_LENGTH;
+
+    PrefixCounts counts;
+    if (automaton_ready) count_prefixes(str, len, &counts);
+
+    bits[0] = 0.0;
+    pieces[0] = 0;
+    brute[0] = false;
+    int32_t state = 0;
+    for (size_t end = 0; end < len; end++) {
+        /* Every way to reach end + 1 starts at a position already final */
+        bits[end + 1] = bits[end] + BRUTEFORCE_BITS;
+        pieces[end + 1] = pieces[end] + (brute[end] ? 0 : 1);
+        brute[end + 1] = true;
+        if (!automaton_ready) continue;
+
+        state = advance(state, (unsigned char)str[end]);
+        for (int32_t hit = first_word(state); hit >= 0; hit = automaton.states[hit].dict_link) {
+            size_t start = end + 1 - automaton.states[hit].word_len;
+            double cost = bits[start] + match_bits(str, &counts, start, automaton.states[hit].word_len,
+                                                   automaton.states[hit].word_bits);
+            if (cost < bits[end + 1]) {
+                bits[end + 1] = cost;
+                pieces[end + 1] = pieces[start] + 1;
+                brute[end + 1] = false;
+            }
+        }
+    }
+
+    return bits[len] + log2_factorial[pieces[len]];
+}
@@ -0,0 +1,350 @@
+/*
+ * bench_meowpass.c - MeowPassword Benchmarks
+ * Cat Name Based Secure Password Generator
+ *
+ * Copyright (c) 2025 Jeffrey Kunzelman
+ * MIT License
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../src/meowpass.h"
+
+/* Keeps results alive so the compiler cannot drop the measured loops */
+static volatile uint64_t bench_sink;
+
+/**
+ * Monotonic clock in seconds
+ */
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+/**
+ * Print one result line
+ */
+static void report(const char *name, double amount, double seconds, const char *unit) {
+    double rate = (seconds > 0.0) ? amount / seconds : 0.0;
+    printf("  %-40s %12.2f %s\n", name, rate, unit);
+}
+
+/**
+ * Benchmark the ChaCha20 generator against the libc rand() path
+ */
+static void bench_rng(void) {
+    printf("\nRandom Number Generation\n");
+
+    const size_t chunk = 1 << 16;
+    const size_t total_bytes = (size_t)64 << 20;
+    const long draws = 10000000;
+    const size_t bound = get_cat_names_count();
+    unsigned char *buf = malloc(chunk);
+    if (!buf) return;
+
+    MeowRng *rng = malloc(sizeof(MeowRng));
+    if (!rng) {
+        free(buf);
+        return;
+    }
+    rng_init_seeded(rng, 1);
+    srand(1);
+
+    /* Raw bytes: ChaCha20 keystream */
+    double t0 = now_seconds();
+    for (size_t done = 0; done < total_bytes; done += chunk) {
+        rng_bytes(rng, buf, chunk);
+        bench_sink += buf[0];
+    }
+    report("bytes, chacha20 rng_bytes", (double)total_bytes / 1e6, now_seconds() - t0, "MB/s");
+
+    /* Raw bytes: rand(), three usable bytes per call */
+    t0 = now_seconds();
+    for (size_t done = 0; done < total_bytes; done += chunk) {
+        for (size_t i = 0; i + 3 <= chunk; i += 3) {
+            int r = rand();
+            buf[i] = (unsigned char)r;
+            buf[i + 1] = (unsigned char)(r >> 8);
+            buf[i + 2] = (unsigned char)(r >> 16);
+        }
+        bench_sink += buf[0];
+    }
+    report("bytes, libc rand()", (double)total_bytes / 1e6, now_seconds() - t0, "MB/s");
+
+    /* Bounded draws over the cat name table */
+    uint64_t acc = 0;
+    t0 = now_seconds();
+    for (long i = 0; i < draws; i++) {
+        acc += rng_uniform(rng, bound);
+    }
+    report("draws [0,names), chacha20 rng_uniform", (double)draws / 1e6, now_seconds() - t0, "M draws/s");
+
+    /* Batched draws, a different bound per slot as in a shuffle */
+    uint32_t bounds[RNG_BATCH_BLOCK];
+    uint32_t out[RNG_BATCH_BLOCK];
+    for (int i = 0; i < RNG_BATCH_BLOCK; i++) {
+        bounds[i] = (uint32_t)(bound - (size_t)i);
+    }
+    t0 = now_seconds();
+    for (long i = 0; i < draws; i += RNG_BATCH_BLOCK) {
+        rng_uniform_batch(rng, bounds, out, RNG_BATCH_BLOCK);
+        acc += out[0];
+    }
+    report("draws [0,names), rng_uniform_batch", (double)draws / 1e6, now_seconds() - t0, "M draws/s");
+
+    t0 = now_seconds();
+    for (long i = 0; i < draws; i++) {
+        acc += (uint64_t)(rand() % (int)bound);
+    }
+    report("draws [0,names), rand() % n", (double)draws / 1e6, now_seconds() - t0, "M draws/s");
+    bench_sink += acc;
+
+    free(rng);
+    free(buf);
+}
+
+/**
+ * Benchmark end-to-end password generation
+ */
+static void bench_generation(void) {
+    printf("\nPassword Generation\n");
+
+    const long passwords = 200000;
+    char *argv[] = {"meowpass", "--numbers", "3"};
+    PasswordConfig config;
+    config_init(&config, 3, argv);
+
+    MeowRng *rng = malloc(sizeof(MeowRng));
+    if (!rng) return;
+    rng_init_seeded(rng, 2);
+    GeneratorState state;
+    generator_init(&state, rng);
+
+    char password[MAX_PASSWORD_LENGTH];
+    double t0 = now_seconds();
+    for (long i = 0; i < passwords; i++) {
+        sample_name_sequence(rng, config.max_length, password, sizeof(password));
+        bench_sink += (unsigned char)password[0];
+    }
+    report("sample_name_sequence", (double)passwords / 1e3, now_seconds() - t0, "K phrases/s");
+
+    /* Random access decodes part of one front-coded block */
+    const Dictionary *cats = get_cat_dictionary();
+    const long lookups = 5000000;
+    char word[DICT_WORD_BUF];
+    t0 = now_seconds();
+    for (long i = 0; i < lookups; i++) {
+        NameView name = dictionary_word(cats, rng_uniform(rng, cats->count), word);
+        bench_sink += name.len;
+    }
+    report("dictionary_word (front-coded, random)", (double)lookups / 1e6, now_seconds() - t0, "M words/s");
+
+    /* Two weighted sources with a length bias: alias draws per name */
+    NameMix *mix = name_mix_create(NAME_SOURCE_ACTIVE "=70," NAME_SOURCE_ACTIVE "=30", 1.0);
+    if (mix) {
+        t0 = now_seconds();
+        for (long i = 0; i < passwords; i++) {
+            name_mix_sample(mix, rng, config.max_length, password, sizeof(password));
+            bench_sink += (unsigned char)password[0];
+        }
+        report("name_mix_sample (2 sources, bias 1)", (double)passwords / 1e3, now_seconds() - t0, "K phrases/s");
+        name_mix_destroy(mix);
+    }
+
+    t0 = now_seconds();
+    for (long i = 0; i < passwords; i++) {
+        generate_password_r(&config, &state, password, sizeof(password));
+        bench_sink += (unsigned char)password[0];
+    }
+    report("generate_password_r (fixed policy)", (double)passwords / 1e3, now_seconds() - t0, "K passwords/s");
+
+    /* Same work through the general path: one more character is no policy */
+    PasswordConfig general = config;
+    general.max_length = DEFAULT_MAX_LENGTH + 1;
+    t0 = now_seconds();
+    for (long i = 0; i < passwords; i++) {
+        generate_password_r(&general, &state, password, sizeof(password));
+        bench_sink += (unsigned char)password[0];
+    }
+    report("generate_password_r (general path)", (double)passwords / 1e3, now_seconds() - t0, "K passwords/s");
+
+    /* Scoring: separate analysis pass versus incremental accounting */
+    ComplexityResult result;
+    t0 = now_seconds();
+    for (long i = 0; i < passwords; i++) {
+        generate_password_r(&config, &state, password, sizeof(password));
+        analyze_complexity(password, &result);
+        bench_sink += (uint64_t)result.length;
+    }
+    report("generate + analyze_complexity", (double)passwords / 1e3, now_seconds() - t0, "K candidates/s");
+
+    PasswordCandidate candidate;
+    t0 = now_seconds();
+    for (long i = 0; i < passwords; i++) {
+        generate_candidate_r(&config, &state, &candidate);
+        bench_sink += (uint64_t)candidate.complexity.length;
+    }
+    report("generate_candidate_r (incremental)", (double)passwords / 1e3, now_seconds() - t0, "K candidates/s");
+
+    generator_free(&state);
+    free(rng);
+}
+
+/**
+ * Benchmark complexity analysis on generated passwords
+ */
+static void bench_complexity(void) {
+    printf("\nComplexity Analysis\n");
+
+    const long rounds = 500000;
+    const int samples = 256;
+    char *argv[] = {"meowpass", "--numbers", "3"};
+    PasswordConfig config;
+    config_init(&config, 3, argv);
+
+    MeowRng *rng = malloc(sizeof(MeowRng));
+    char (*passwords)[MAX_PASSWORD_LENGTH] = malloc((size_t)samples * MAX_PASSWORD_LENGTH);
+    if (!rng || !passwords) {
+        free(rng);
+        free(passwords);
+        return;
+    }
+    rng_init_seeded(rng, 3);
+    GeneratorState state;
+    generator_init(&state, rng);
+    for (int i = 0; i < samples; i++) {
+        generate_password_r(&config, &state, passwords[i], MAX_PASSWORD_LENGTH);
+    }
+
+    double acc = 0.0;
+    double t0 = now_seconds();
+    for (long i = 0; i < rounds; i++) {
+        acc += calculate_pattern_complexity(passwords[i % samples]);
+    }
+    report("calculate_pattern_complexity", (double)rounds / 1e3, now_seconds() - t0, "K calls/s");
+
+    t0 = now_seconds();
+    for (long i = 0; i < rounds; i++) {
+        acc += calculate_pattern_complexity_max(passwords[i % samples], 0);
+    }
+    report("calculate_pattern_complexity_max (all)", (double)rounds / 1e3, now_seconds() - t0, "K calls/s");
+
+    /* Compression estimators: LZ must stay within a small factor of RLE */
+    t0 = now_seconds();
+    for (long i = 0; i < rounds; i++) {
+        acc += calculate_compression_ratio(passwords[i % samples]);
+    }
+    double rle_time = now_seconds() - t0;
+    report("calculate_compression_ratio (rle)", (double)rounds / 1e3, rle_time, "K calls/s");
+
+    t0 = now_seconds();
+    for (long i = 0; i < rounds; i++) {
+        acc += calculate_compression_ratio_lz(passwords[i % samples]);
+    }
+    double lz_time = now_seconds() - t0;
+    report("calculate_compression_ratio_lz", (double)rounds / 1e3, lz_time, "K calls/s");
+    printf("  %-40s %12.2f x\n", "lz cost relative to rle", (rle_time > 0.0) ? lz_time / rle_time : 0.0);
+
+    static const char *level_names[] = {"scalar", "sse2", "avx2", "avx512"};
+    static char text[1 << 16];
+    for (size_t i = 0; i < sizeof(text); i++) {
+        text[i] = (char)('a' + i % 26);
+    }
+    for (int level = SIMD_SCALAR; level <= (int)simd_detect(); level++) {
+        char name[64];
+        unsigned flags = 0;
+        t0 = now_seconds();
+        for (int i = 0; i < 2000; i++) {
+            flags |= classify_characters_at((SimdLevel)level, text, sizeof(text));
+        }
+        snprintf(name, sizeof(name), "classify_characters, %s", level_names[level]);
+        report(name, 2000.0 * sizeof(text) / 1e6, now_seconds() - t0, "MB/s");
+        bench_sink += flags;
+    }
+
+    t0 = now_seconds();
+    for (long i = 0; i < rounds; i++) {
+        const char *pw = passwords[i % samples];
+        acc += estimate_guesses_log2(pw, strlen(pw));
+    }
+    report("estimate_guesses_log2", (double)rounds / 1e3, now_seconds() - t0, "K calls/s");
+
+    ComplexityResult result;
+    t0 = now_seconds();
+    for (long i = 0; i < rounds; i++) {
+        analyze_complexity(passwords[i % samples], &result);
+        acc += result.score;
+    }
+    report("analyze_complexity", (double)rounds / 1e3, now_seconds() - t0, "K calls/s");
+
+    /* Duplicate-heavy input: every password repeats rounds / samples times */
+    ScoreCache *cache = score_cache_create(4096);
+    if (cache) {
+        t0 = now_seconds();
+        for (long i = 0; i < rounds; i++) {
+            const char *pw = passwords[i % samples];
+            analyze_complexity_cached(cache, pw, strlen(pw), &result);
+            acc += result.score;
+        }
+        report("analyze_complexity_cached (256 distinct)", (double)rounds / 1e3, now_seconds() - t0, "K calls/s");
+        score_cache_destroy(cache);
+    }
+
+    const char *batch[COMPLEXITY_BATCH_BLOCK * 8];
+    double scores[COMPLEXITY_BATCH_BLOCK * 8];
+    const size_t batch_size = sizeof(batch) / sizeof(batch[0]);
+    ComplexityBatch columns = {scores, NULL, NULL, NULL, NULL, NULL, NULL};
+    for (size_t i = 0; i < batch_size; i++) {
+        batch[i] = passwords[i % (size_t)samples];
+    }
+    t0 = now_seconds();
+    for (long i = 0; i < rounds; i += (long)batch_size) {
+        analyze_complexity_batch(batch, NULL, batch_size, &columns);
+        acc += scores[0];
+    }
+    report("analyze_complexity_batch (score only)", (double)rounds / 1e3, now_seconds() - t0, "K calls/s");
+    bench_sink += (uint64_t)acc;
+
+    /* Ranking against a strong current best: most candidates are pruned */
+    long kept = 0;
+    t0 = now_seconds();
+    for (long i = 0; i < rounds; i++) {
+        const char *pw = passwords[i % samples];
+        double score;
+        kept += complexity_score_above(pw, strlen(pw), 1.75, &score);
+    }
+    report("complexity_score_above (best 1.75)", (double)rounds / 1e3, now_seconds() - t0, "K calls/s");
+    bench_sink += (uint64_t)kept;
+
+    int64_t fixed = 0;
+    t0 = now_seconds();
+    for (long i = 0; i < rounds; i++) {
+        fixed += complexity_score_fixed(passwords[i % samples]);
+    }
+    report("complexity_score_fixed", (double)rounds / 1e3, now_seconds() - t0, "K calls/s");
+    bench_sink += (uint64_t)fixed;
+    bench_sink += (uint64_t)acc;
+
+    generator_free(&state);
+    free(passwords);
+    free(rng);
+}
+
+/**
+ * Run all benchmarks (exported function)
+ */
+int run_benchmarks(void) {
+    printf("Running MeowPassword Benchmarks\n");
+    printf("===============================\n");
+
+    bench_rng();
+    bench_generation();
+    bench_complexity();
+
+    printf("\nMeow Benchmarks Complete!\n");
+    return 0;
+}
@@ -12,6 +12,12 @@
 #include <string.h>
 #include <ctype.h>
 #include <time.h>
+#include <math.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
 #include "../src/meowpass.h"
 
 static int tests_passed = 0;
@@ -43,31 +49,55 @@ static void assert_equal_int(int actual, int expected, const char *message) {
     }
 }
 
+/**
+ * Field-by-field equality of two analysis results
+ */
+static int same_complexity(const ComplexityResult *a, const ComplexityResult *b) {
+    return a->score == b->score && a->entropy == b->entropy &&
+           a->compression_ratio == b->compression_ratio &&
+           a->pattern_complexity == b->pattern_complexity &&
+           a->character_diversity == b->character_diversity &&
+           a->guesses_log2 == b->guesses_log2 && a->length == b->length;
+}
+
 /**
  * Test cat name loading
  */
 static void test_load_cat_names(void) {
     printf("\nTesting Cat Name Loading...\n");
 
-    const char **names = get_cat_names();
+    const Dictionary *cats = get_cat_dictionary();
     size_t count = get_cat_names_count();
 
-    assert_true(names != NULL, "Should Meow load cat names from embedded data");
+    assert_true(cats->count == count, "Should Meow load cat names from embedded data");
     assert_true(count > 100, "Should load a substantial Meow number of cat names");
 
-    /* Check that names are non-empty */
+    /* Names are stored normalized: non-empty, lowercase, no spaces */
     int non_empty = 1;
-    for (size_t i = 0; i < count && non_empty; i++) {
-        if (names[i] == NULL || names[i][0] == '\0') {
-            non_empty = 0;
+    int normalized = 1;
+    int views_match = 1;
+    char buf[DICT_WORD_BUF], buf_dict[DICT_WORD_BUF];
+    for (size_t i = 0; i < count; i++) {
+        NameView view = get_cat_name(i, buf);
+        if (view.len == 0) non_empty = 0;
+        for (size_t k = 0; k < view.len; k++) {
+            if (view.str[k] == ' ' || isupper((unsigned char)view.str[k])) normalized = 0;
         }
+        NameView entry = dictionary_word(cats, i, buf_dict);
+        if (entry.len != view.len || memcmp(entry.str, view.str, view.len) != 0) views_match = 0;
     }
     assert_true(non_empty, "All Meow Meow loaded names should be non-empty");
+    assert_true(normalized, "Meow names should be lowercase without spaces");
+    assert_true(views_match, "Meow name views should match the embedded dictionary");
 
     printf("Cat names loaded meow: %zu\n", count);
     if (count >= 5) {
-        printf("First few names: %s, %s, %s, %s, %s\n",
-               names[0], names[1], names[2], names[3], names[4]);
+        printf("First few names:");
+        for (size_t i = 0; i < 5; i++) {
+            NameView view = get_cat_name(i, buf);
+            printf("%s %.*s", (i == 0) ? "" : ",", (int)view.len, view.str);
+        }
+        printf("\n");
     }
 }
 
@@ -156,6 +186,186 @@ static void test_character_diversity(void) {
     printf("Diversity tests passed!\n");
 }
 
+/**
+ * Test LZ77 compressibility estimator and method selection
+ */
+static void test_lz_compression(void) {
+    printf("\nTesting LZ Meow Compression...\n");
+
+    /* a, b, c literals then one overlapping match of 6 */
+    assert_true(calculate_compression_ratio_lz("abcabcabc") == 1.0 - 5.0 / 9.0,
+                "abcabcabc should compress under LZ");
+    assert_true(calculate_compression_ratio("abcabcabc") <= 0.0,
+                "abcabcabc should be incompressible under RLE");
+    assert_true(calculate_compression_ratio_lz("abcdefgh") == 0.0,
+                "No repeats should be incompressible under LZ");
+    assert_true(calculate_compression_ratio_lz("") == 0.0, "Empty string should be 0");
+
+    /* Long input: matches stay within the window, no allocation */
+    static char text[4096];
+    for (size_t i = 0; i + 1 < sizeof(text); i++) {
+        text[i] = "meowpurr"[i % 8];
+    }
+    assert_true(calculate_compression_ratio_lz(text) > 0.9, "Long periodic text should compress");
+
+    char *argv[] = {"meowpass", "--compression", "lz"};
+    PasswordConfig config;
+    config_init(&config, 3, argv);
+    assert_equal_int(config.compression, COMPRESSION_LZ, "--compression lz should select LZ");
+    assert_true(config.invalid_compression == NULL, "--compression lz should be accepted");
+    char *typo_argv[] = {"meowpass", "--compression", "LZ"};
+    config_init(&config, 3, typo_argv);
+    assert_true(config.invalid_compression == typo_argv[2] && config.compression == COMPRESSION_RLE,
+                "Unknown --compression values should be flagged, not silently mapped to RLE");
+
+    /* Every scoring path follows the selected method */
+    set_compression_method(COMPRESSION_LZ);
+    static ComplexityAccumulator acc;
+    complexity_init(&acc);
+    const char *pw = "MeowMeowMeow42!";
+    for (const char *p = pw; *p; p++) {
+        complexity_push(&acc, (unsigned char)*p);
+    }
+    ComplexityResult full, incremental;
+    analyze_complexity(pw, &full);
+    complexity_finish(&acc, &incremental);
+    assert_true(full.compression_ratio == calculate_compression_ratio_lz(pw),
+                "analyze_complexity should use the selected method");
+    assert_true(same_complexity(&full, &incremental), "Accumulator should use the selected method");
+    assert_true(complexity_finish_fixed(&acc) == complexity_score_fixed(pw),
+                "Fixed-point paths should agree under LZ");
+    set_compression_method(COMPRESSION_RLE);
+
+    printf("LZ compression tests passed!\n");
+}
+
+/**
+ * Test SIMD classification kernels and the byte histogram
+ */
+static void test_classification_kernels(void) {
+    printf("\nTesting Meow Classification Kernels...\n");
+
+    static MeowRng rng;
+    rng_init_seeded(&rng, 12);
+
+    int kernels_ok = 1;
+    for (int trial = 0; trial < 2000; trial++) {
+        char str[300];
+        size_t len = rng_uniform(&rng, sizeof(str));
+        /* Mostly one class so a single stray byte decides the result */
+        const char *pool = (trial % 3 == 0) ? "abcxyz" : (trial % 3 == 1) ? "QRZ09 " : "";
+        size_t pool_len = strlen(pool);
+        for (size_t i = 0; i < len; i++) {
+            str[i] = pool_len ? pool[rng_uniform(&rng, pool_len)] : (char)rng_uniform(&rng, 256);
+        }
+        if (len > 0 && trial % 5 == 0) str[rng_uniform(&rng, len)] = (char)rng_uniform(&rng, 256);
+
+        unsigned expected = 0;
+        for (size_t i = 0; i < len; i++) {
+            unsigned char c = (unsigned char)str[i];
+            if (islower(c)) expected |= CHAR_CLASS_LOWER;
+            else if (isupper(c)) expected |= CHAR_CLASS_UPPER;
+            else if (isdigit(c)) expected |= CHAR_CLASS_DIGIT;
+            else if (!isspace(c)) expected |= CHAR_CLASS_SYMBOL;
+        }
+        for (int level = SIMD_SCALAR; level <= (int)simd_detect(); level++) {
+            if (classify_characters_at((SimdLevel)level, str, len) != expected) kernels_ok = 0;
+        }
+    }
+    assert_true(kernels_ok, "Every available kernel should match ctype classification");
+
+    /* Normalization: lowercase, no spaces or CRs, newlines kept, in place too */
+    int normalize_ok = 1;
+    for (int trial = 0; trial < 500; trial++) {
+        char str[300], expected[300], out[300];
+        size_t len = rng_uniform(&rng, sizeof(str));
+        const char *pool = (trial % 2 == 0) ? "ZZ Top\r\nzz top\n" : "";
+        size_t pool_len = strlen(pool);
+        size_t expected_len = 0;
+        for (size_t i = 0; i < len; i++) {
+            str[i] = pool_len ? pool[rng_uniform(&rng, pool_len)] : (char)rng_uniform(&rng, 256);
+            unsigned char c = (unsigned char)str[i];
+            if (c != ' ' && c != '\r') expected[expected_len++] = (char)tolower(c);
+        }
+        for (int level = SIMD_SCALAR; level <= (int)simd_detect(); level++) {
+            size_t out_len = normalize_text_at((SimdLevel)level, str, len, out);
+            if (out_len != expected_len || memcmp(out, expected, out_len) != 0) normalize_ok = 0;
+        }
+        if (normalize_text(str, len, str) != expected_len || memcmp(str, expected, expected_len) != 0) {
+            normalize_ok = 0;
+        }
+    }
+    assert_true(normalize_ok, "Every available kernel should normalize like tolower without spaces");
+
+    static char text[5003];
+    uint32_t counts[256] = {0};
+    uint32_t expected_counts[256] = {0};
+    for (size_t i = 0; i < sizeof(text); i++) {
+        text[i] = (char)((i % 7 == 0) ? 'a' : rng_uniform(&rng, 256));
+        expected_counts[(unsigned char)text[i]]++;
+    }
+    byte_histogram(text, sizeof(text), counts);
+    assert_true(memcmp(counts, expected_counts, sizeof(counts)) == 0,
+                "Byte histogram should match a simple count");
+
+    printf("Classification kernel tests passed!\n");
+}
+
+/**
+ * Reference pattern complexity: compare every substring with every other
+ */
+static double brute_pattern_complexity(const char *str, int max_len) {
+    int n = (int)strlen(str);
+    if (max_len <= 0 || max_len > n) max_len = n;
+    int total = 0;
+    int unique = 0;
+    for (int slen = 2; slen <= max_len; slen++) {
+        for (int start = 0; start + slen <= n; start++) {
+            int seen = 0;
+            for (int prev = 0; prev < start && !seen; prev++) {
+                seen = (strncmp(&str[prev], &str[start], (size_t)slen) == 0);
+            }
+            total++;
+            unique += !seen;
+        }
+    }
+    return (total == 0) ? 0.0 : (double)unique / (double)total;
+}
+
+/**
+ * Test suffix automaton pattern complexity
+ */
+static void test_pattern_complexity(void) {
+    printf("\nTesting Pattern Complexity...\n");
+
+    /* abab: ab ba ab | aba bab | abab -> 5 of 6 distinct */
+    assert_true(calculate_pattern_complexity("abab") == 5.0 / 6.0, "abab should be 5/6");
+    assert_true(calculate_pattern_complexity_max("aaaa", 0) == 0.5, "aaaa over all lengths should be 0.5");
+    assert_true(calculate_pattern_complexity_max("abcd", 1) == 0.0, "Max length 1 counts nothing");
+    assert_true(calculate_pattern_complexity("a") == 0.0, "Single character should be 0");
+
+    /* Small alphabets force repeats and clones; 200 chars takes the heap path */
+    static MeowRng rng;
+    rng_init_seeded(&rng, 11);
+    int matches = 1;
+    for (int trial = 0; trial < 200; trial++) {
+        char str[201];
+        int n = (trial == 0) ? 200 : 2 + (int)rng_uniform(&rng, 40);
+        int alphabet = 1 + (int)rng_uniform(&rng, 4);
+        for (int i = 0; i < n; i++) {
+            str[i] = (char)('a' + rng_uniform(&rng, (size_t)alphabet));
+        }
+        str[n] = '\0';
+        int max_len = (int)rng_uniform(&rng, (size_t)n + 2) - 1;
+        if (calculate_pattern_complexity_max(str, max_len) != brute_pattern_complexity(str, max_len)) {
+            matches = 0;
+        }
+    }
+    assert_true(matches, "Suffix automaton should match brute force counting");
+
+    printf("Pattern complexity tests passed!\n");
+}
+
 /**
  * Test configuration parsing
  */
@@ -194,6 +404,14 @@ static void test_config_parsing(void) {
     assert_true(config4.psssst, "Psssst should be enabled with -p");
     assert_true(config4.copy_to_clipboard, "Copy to clipboard should be enabled with -p");
 
+    /* Test --count flag */
+    char *argv5[] = {"meowpass", "--count", "1000"};
+    PasswordConfig config5;
+    config_init(&config5, 3, argv5);
+
+    assert_true(config5.count == 1000, "Count should be 1000 with --count 1000");
+    assert_true(config1.count == 0, "Count should default to 0 (bulk mode off)");
+
     printf("Config parsing tests passed!\n");
 }
 
@@ -235,6 +453,1228 @@ static void test_relevancy_score_explanation(void) {
     printf("Relevancy explanation tests passed!\n");
 }
 
+/**
+ * Test bulk streaming generation
+ */
+static void test_bulk_generation(void) {
+    printf("\nTesting Bulk Meow Generation...\n");
+
+    PasswordConfig config;
+    char *argv[] = {"meowpass", "--count", "50"};
+    config_init(&config, 3, argv);
+
+    /* Capture run_bulk output by redirecting stdout */
+    char buffer[8192];
+    FILE *memstream = fmemopen(buffer, sizeof(buffer), "w");
+    assert_true(memstream != NULL, "Should open memory stream for bulk output capture");
+
+    FILE *old_stdout = stdout;
+    stdout = memstream;
+    int rc = run_bulk(&config);
+    fflush(stdout);
+    stdout = old_stdout;
+    fclose(memstream);
+
+    assert_equal_int(rc, 0, "Bulk run should succeed");
+
+    /* One password per line, each within the length limit */
+    int lines = 0;
+    int lengths_ok = 1;
+    for (char *line = buffer, *nl; (nl = strchr(line, '\n')) != NULL; line = nl + 1) {
+        size_t len = (size_t)(nl - line);
+        if (len == 0 || len > (size_t)config.max_length) lengths_ok = 0;
+        lines++;
+    }
+    assert_equal_int(lines, 50, "Bulk mode should emit one line per password");
+    assert_true(lengths_ok, "Bulk passwords should be non-empty and within max length");
+
+    printf("Bulk generation tests passed!\n");
+}
+
+/**
+ * Test ChaCha20 random number generator
+ */
+static void test_rng(void) {
+    printf("\nTesting ChaCha20 Meow Random Generator...\n");
+
+    /* Zero key, zero counter: bytes 32..63 of the first keystream block
+     * (the first 32 bytes are consumed as the next key) */
+    static const unsigned char expected[8] = {
+        0xda, 0x41, 0x59, 0x7c, 0x51, 0x57, 0x48, 0x8d
+    };
+    static MeowRng rng;
+    unsigned char out[8];
+    rng_init_seeded(&rng, 0);
+    rng_bytes(&rng, out, sizeof(out));
+    assert_true(memcmp(out, expected, sizeof(out)) == 0,
+                "Keystream should match the ChaCha20 reference block");
+
+    /* Bounded draws stay in range and hit every value */
+    int seen[7] = {0};
+    int in_range = 1;
+    for (int i = 0; i < 7000; i++) {
+        size_t v = rng_uniform(&rng, 7);
+        if (v >= 7) in_range = 0;
+        else seen[v]++;
+    }
+    int all_seen = 1;
+    for (int i = 0; i < 7; i++) {
+        if (seen[i] == 0) all_seen = 0;
+    }
+    assert_true(in_range, "Bounded draws should stay below the bound");
+    assert_true(all_seen, "Bounded draws should cover the whole range");
+
+    /* Batched draws with a different bound per slot */
+    uint32_t bounds[300];
+    uint32_t draws[300];
+    int hits[300] = {0};
+    for (int i = 0; i < 300; i++) bounds[i] = (uint32_t)(i % 5) + 1;
+    int batch_ok = 1;
+    for (int round = 0; round < 50; round++) {
+        rng_uniform_batch(&rng, bounds, draws, 300);
+        for (int i = 0; i < 300; i++) {
+            if (draws[i] >= bounds[i]) batch_ok = 0;
+            if (draws[i] == bounds[i] - 1) hits[i]++;
+        }
+    }
+    int batch_covers = 1;
+    for (int i = 0; i < 300; i++) {
+        if (hits[i] == 0) batch_covers = 0;
+    }
+    assert_true(batch_ok, "Batched draws should stay below their own bounds");
+    assert_true(batch_covers, "Batched draws should reach the top of each range");
+
+    /* Kernel-seeded generators must not repeat each other */
+    static MeowRng a, b;
+    assert_equal_int(rng_init(&a), 0, "Generator should seed from the kernel");
+    assert_equal_int(rng_init(&b), 0, "Second generator should seed from the kernel");
+    unsigned char out_a[16], out_b[16];
+    rng_bytes(&a, out_a, sizeof(out_a));
+    rng_bytes(&b, out_b, sizeof(out_b));
+    assert_true(memcmp(out_a, out_b, sizeof(out_a)) != 0,
+                "Independently seeded generators should differ");
+
+    printf("Random generator tests passed!\n");
+}
+
+/**
+ * Test exact length-constrained name sequence sampling
+ */
+static void test_name_sequence_sampler(void) {
+    printf("\nTesting Meow Name Sequence Sampler...\n");
+
+    static MeowRng rng;
+    rng_init_seeded(&rng, 7);
+
+    char phrase[MAX_PASSWORD_LENGTH];
+    int in_range = 1;
+    int exact_fit = 1;
+    for (int i = 0; i < 500; i++) {
+        size_t len = sample_name_sequence(&rng, 20, phrase, sizeof(phrase));
+        if (len < MIN_LENGTH || len > 20 || len != strlen(phrase)) in_range = 0;
+
+        len = sample_name_sequence(&rng, MIN_LENGTH, phrase, sizeof(phrase));
+        if (len != MIN_LENGTH) exact_fit = 0;
+    }
+    assert_true(in_range, "Sampled phrases should land in [MIN_LENGTH, max_length]");
+    assert_true(exact_fit, "Sampled phrases should fill max_length exactly when it equals MIN_LENGTH");
+
+    double h15 = name_sequence_entropy(MIN_LENGTH);
+    double h25 = name_sequence_entropy(25);
+    assert_true(h15 > 40.0, "Name sequence entropy should be substantial");
+    assert_true(h25 > h15, "Name sequence entropy should grow with max length");
+
+    printf("Name sequence entropy: %.2f bits (15), %.2f bits (25)\n", h15, h25);
+
+    /* boo and booboo collide: every 15-letter sequence from them joins to
+     * the same phrase, so the 8 sequences carry 3 bits of bound but none
+     * of entropy */
+    static const char collide_blob[] = "boobooboowhiskers";
+    static const uint32_t collide_offsets[] = {0, 3, 9, 17};
+    static const uint32_t collide_order[] = {0, 1, 2};
+    uint32_t collide_start[DICT_LENGTH_BUCKETS + 1];
+    for (int len = 0; len <= DICT_LENGTH_BUCKETS; len++) {
+        collide_start[len] = (uint32_t)((len > 3) + (len > 6) + (len > 8));
+    }
+    Dictionary collide = {collide_blob, 17, collide_offsets, collide_start, collide_order,
+                          3, 0, NULL, 0, NULL};
+    assert_true(fabs(dictionary_sequence_entropy(&collide, MIN_LENGTH) - 3.0) < 1e-9,
+                "Sequence entropy should count all 8 colliding sequences");
+    assert_true(fabs(dictionary_sequence_entropy(dictionary_active(), 25) - h25) < 1e-9,
+                "Dictionary sequence entropy should match the active sampler");
+
+    /* Drawing from it really does give one phrase only */
+    char path[] = "/tmp/meowpass_collide_XXXXXX";
+    int fd = mkstemp(path);
+    if (fd >= 0) {
+        close(fd);
+        NameMix *mix = NULL;
+        if (dictionary_save(&collide, path) == 0) mix = name_mix_create(path, 0.0);
+        assert_true(mix != NULL, "Colliding dictionary should load");
+        int one_phrase = mix != NULL;
+        for (int i = 0; i < 100 && mix; i++) {
+            name_mix_sample(mix, &rng, MIN_LENGTH, phrase, sizeof(phrase));
+            if (strcmp(phrase, "boobooboobooboo") != 0) one_phrase = 0;
+        }
+        assert_true(one_phrase, "Colliding sequences should all join to the same phrase");
+        name_mix_destroy(mix);
+        remove(path);
+    }
+}
+
+/**
+ * Test fused single-pass transformation plan
+ */
+static void test_fused_transformations(void) {
+    printf("\nTesting Fused Meow Transformations...\n");
+
+    PasswordConfig config;
+    char *argv[] = {"meowpass", "--numbers", "10", "--symbols", "4", "--max-length", "15"};
+    config_init(&config, 7, argv);
+
+    static MeowRng rng;
+    GeneratorState state;
+    rng_init_seeded(&rng, 99);
+    generator_init(&state, &rng);
+
+    int length_ok = 1;
+    int upper_ok = 1;
+    int digits_ok = 1;
+    for (int i = 0; i < 1000; i++) {
+        char password[MAX_PASSWORD_LENGTH];
+        generate_password_r(&config, &state, password, sizeof(password));
+
+        int upper = 0;
+        int digits = 0;
+        for (const char *p = password; *p; p++) {
+            if (isupper((unsigned char)*p)) upper++;
+            if (isdigit((unsigned char)*p)) digits++;
+        }
+        /* Digit slots past the truncation point are dropped, never shifted in */
+        if (strlen(password) != (size_t)config.max_length) length_ok = 0;
+        if (upper > 3) upper_ok = 0;
+        if (digits == 0) digits_ok = 0;
+    }
+    assert_true(length_ok, "Fused passwords should be truncated to exactly max length");
+    assert_true(upper_ok, "Fused passwords should capitalize at most 3 letters");
+    assert_true(digits_ok, "Fused passwords should keep inserted digits");
+
+    /* With room for the digits the phrase is drawn short enough: no cut */
+    char *fit_argv[] = {"meowpass", "--numbers", "3", "--symbols", "2", "--max-length", "25"};
+    config_init(&config, 7, fit_argv);
+    assert_equal_int(phrase_length_limit(&config), 22, "Phrase limit should leave room for the digits");
+    int fit_ok = 1;
+    for (int i = 0; i < 1000; i++) {
+        char password[MAX_PASSWORD_LENGTH];
+        generate_password_r(&config, &state, password, sizeof(password));
+        int digits = 0;
+        for (const char *p = password; *p; p++) {
+            if (isdigit((unsigned char)*p)) digits++;
+        }
+        size_t len = strlen(password);
+        if (digits < 3 || len < MIN_LENGTH + 3 || len > 25) fit_ok = 0;
+    }
+    assert_true(fit_ok, "Passwords should keep every digit and the whole phrase");
+
+    generator_free(&state);
+    printf("Fused transformation tests passed!\n");
+}
+
+/**
+ * Test fixed-policy specialized generators and their dispatch
+ */
+static void test_generator_policies(void) {
+    printf("\nTesting Fixed Meow Generator Policies...\n");
+
+    PasswordConfig config;
+    char *argv[] = {"meowpass", "--numbers", "4", "--symbols", "4", "--max-length", "32"};
+    config_init(&config, 7, argv);
+    assert_equal_int(generator_policy_for(&config), POLICY_STRONG, "Strong config should map to its policy");
+    config.max_length = 33;
+    assert_equal_int(generator_policy_for(&config), -1, "Other configs should use the general path");
+
+    /* Every default run, whatever digit count it draws, is specialized */
+    int defaults_ok = 1;
+    for (int i = 0; i < 200; i++) {
+        char *plain_argv[] = {"meowpass"};
+        config_init(&config, 1, plain_argv);
+        int policy = generator_policy_for(&config);
+        if (policy < POLICY_DEFAULT_1 || policy > POLICY_DEFAULT_4) defaults_ok = 0;
+    }
+    assert_true(defaults_ok, "Default configs should always map to a default policy");
+
+    /* The specialized variant is the dispatched path, draw for draw */
+    config.num_numbers = 3;
+    config.num_symbols = DEFAULT_NUM_SYMBOLS;
+    config.max_length = DEFAULT_MAX_LENGTH;
+    assert_equal_int(generator_policy_for(&config), POLICY_DEFAULT_3, "Three digits should map to its default policy");
+    static MeowRng rng_a, rng_b;
+    GeneratorState state_a, state_b;
+    rng_init_seeded(&rng_a, 31337);
+    rng_init_seeded(&rng_b, 31337);
+    assert_equal_int(generator_init(&state_a, &rng_a), 0, "Generator state A should initialize");
+    assert_equal_int(generator_init(&state_b, &rng_b), 0, "Generator state B should initialize");
+    int same = 1;
+    for (int i = 0; i < 100; i++) {
+        char pw_a[MAX_PASSWORD_LENGTH], pw_b[POLICY_BUFFER_SIZE(DEFAULT_MAX_LENGTH)];
+        generate_password_r(&config, &state_a, pw_a, sizeof(pw_a));
+        generate_password_policy_r(POLICY_DEFAULT_3, &state_b, pw_b, sizeof(pw_b));
+        if (strcmp(pw_a, pw_b) != 0) same = 0;
+    }
+    assert_true(same, "Policy variant should match generate_password_r for the same config");
+
+    /* Compact phrases are exactly MIN_LENGTH, so passwords are 17 with both digits */
+    int compact_ok = 1;
+    for (int i = 0; i < 500; i++) {
+        char pw[POLICY_BUFFER_SIZE(17)];
+        generate_password_policy_r(POLICY_COMPACT, &state_a, pw, sizeof(pw));
+        if (strlen(pw) != 17) compact_ok = 0;
+    }
+    assert_true(compact_ok, "Compact policy should emit whole 17-character passwords");
+
+    char pw[MAX_PASSWORD_LENGTH];
+    generate_password_policy_r(POLICY_COUNT, &state_a, pw, sizeof(pw));
+    assert_true(pw[0] == '\0', "Unknown policy should produce an empty password");
+
+    generator_free(&state_a);
+    generator_free(&state_b);
+    printf("Generator policy tests passed!\n");
+}
+
+/**
+ * Test per-thread generator state
+ */
+static void test_generator_state(void) {
+    printf("\nTesting Per-Thread Meow Generator State...\n");
+
+    PasswordConfig config;
+    char *argv[] = {"meowpass", "--numbers", "3"};
+    config_init(&config, 3, argv);
+
+    /* Two states with the same seed must produce the same stream */
+    MeowRng rng_a, rng_b;
+    GeneratorState state_a, state_b;
+    rng_init_seeded(&rng_a, 4242);
+    rng_init_seeded(&rng_b, 4242);
+    assert_equal_int(generator_init(&state_a, &rng_a), 0, "Generator state A should initialize");
+    assert_equal_int(generator_init(&state_b, &rng_b), 0, "Generator state B should initialize");
+
+    int same = 1;
+    for (int i = 0; i < 20; i++) {
+        char pw_a[MAX_PASSWORD_LENGTH];
+        char pw_b[MAX_PASSWORD_LENGTH];
+        generate_password_r(&config, &state_a, pw_a, sizeof(pw_a));
+        generate_password_r(&config, &state_b, pw_b, sizeof(pw_b));
+        if (strcmp(pw_a, pw_b) != 0) same = 0;
+    }
+    assert_true(same, "Identically seeded generator states should not interfere");
+
+    generator_free(&state_a);
+    generator_free(&state_b);
+
+    /* Threaded config parsing */
+    char *argv2[] = {"meowpass", "--count", "10", "--threads", "999", "--unordered"};
+    PasswordConfig config2;
+    config_init(&config2, 6, argv2);
+    assert_equal_int(config2.threads, MAX_THREADS, "Threads should be clamped to max");
+    assert_true(config2.unordered, "Unordered should be enabled with --unordered");
+    assert_equal_int(config.threads, 1, "Threads should default to 1");
+
+    printf("Generator state tests passed!\n");
+}
+
+/**
+ * Test incremental complexity accounting against the full analysis
+ */
+static void test_incremental_complexity(void) {
+    printf("\nTesting Incremental Meow Complexity...\n");
+
+    static ComplexityAccumulator acc;
+    complexity_init(&acc);
+
+    const char *samples[] = {"", "a", "aa", "aaabbb", "Whiskers4Tom!", "abcabcabcabc", "  x y  "};
+    int fixed_ok = 1;
+    for (size_t i = 0; i < sizeof(samples) / sizeof(samples[0]); i++) {
+        ComplexityResult full, incremental;
+        analyze_complexity(samples[i], &full);
+        complexity_reset(&acc);
+        for (const char *p = samples[i]; *p; p++) {
+            complexity_push(&acc, (unsigned char)*p);
+        }
+        complexity_finish(&acc, &incremental);
+        if (!same_complexity(&full, &incremental)) fixed_ok = 0;
+    }
+    assert_true(fixed_ok, "Incremental analysis should match analyze_complexity exactly");
+
+    /* Generated candidates carry the same scores a second pass would give */
+    PasswordConfig config;
+    char *argv[] = {"meowpass", "--numbers", "4", "--symbols", "2"};
+    config_init(&config, 5, argv);
+
+    static MeowRng rng;
+    static GeneratorState state;
+    rng_init_seeded(&rng, 7);
+    generator_init(&state, &rng);
+
+    int generated_ok = 1;
+    for (int i = 0; i < 500; i++) {
+        PasswordCandidate candidate;
+        ComplexityResult full;
+        generate_candidate_r(&config, &state, &candidate);
+        analyze_complexity(candidate.password, &full);
+        if (!same_complexity(&full, &candidate.complexity)) generated_ok = 0;
+    }
+    assert_true(generated_ok, "Candidate scores should match a full re-analysis");
+
+    generator_free(&state);
+    printf("Incremental complexity tests passed!\n");
+}
+
+/**
+ * Test batch analysis into column arrays
+ */
+static void test_complexity_batch(void) {
+    printf("\nTesting Batch Meow Complexity...\n");
+
+    enum { BATCH = 75 };
+    static char storage[BATCH][MAX_PASSWORD_LENGTH];
+    const char *passwords[BATCH];
+    size_t lengths[BATCH];
+
+    PasswordConfig config;
+    char *argv[] = {"meowpass", "--numbers", "2"};
+    config_init(&config, 3, argv);
+    static MeowRng rng;
+    static GeneratorState state;
+    rng_init_seeded(&rng, 14);
+    generator_init(&state, &rng);
+    for (int i = 0; i < BATCH; i++) {
+        generate_password_r(&config, &state, storage[i], MAX_PASSWORD_LENGTH);
+        passwords[i] = storage[i];
+        lengths[i] = strlen(storage[i]);
+    }
+    strcpy(storage[3], "");
+    lengths[3] = 0;
+    passwords[4] = NULL;
+
+    double score[BATCH], entropy[BATCH], compression[BATCH], pattern[BATCH], diversity[BATCH];
+    double guesses[BATCH];
+    int length[BATCH];
+    ComplexityBatch out = {score, entropy, compression, pattern, diversity, length, guesses};
+    analyze_complexity_batch(passwords, lengths, BATCH, &out);
+
+    int batch_ok = 1;
+    for (int i = 0; i < BATCH; i++) {
+        ComplexityResult single;
+        analyze_complexity(passwords[i] ? passwords[i] : "", &single);
+        ComplexityResult column = {score[i], entropy[i], compression[i], pattern[i],
+                                   diversity[i], guesses[i], length[i]};
+        if (!same_complexity(&single, &column)) batch_ok = 0;
+    }
+    assert_true(batch_ok, "Batch columns should equal single analysis");
+
+    /* Score-only callers get the same scores; lengths may come from strlen */
+    double score_only[BATCH];
+    ComplexityBatch score_out = {score_only, NULL, NULL, NULL, NULL, NULL, NULL};
+    analyze_complexity_batch(passwords, NULL, BATCH, &score_out);
+    assert_true(memcmp(score, score_only, sizeof(score)) == 0,
+                "Score-only batch should match the full batch");
+
+    /* Explicit lengths need not stop at a NUL */
+    ComplexityResult prefix, whole;
+    analyze_complexity_len("Whiskers4Tom!", 8, &prefix);
+    analyze_complexity("Whiskers", &whole);
+    assert_true(same_complexity(&prefix, &whole), "Length-based analysis should stop at len");
+
+    generator_free(&state);
+    printf("Batch complexity tests passed!\n");
+}
+
+/**
+ * Test score-only ranking with pruning
+ */
+static void test_score_only_ranking(void) {
+    printf("\nTesting Score-Only Meow Ranking...\n");
+
+    PasswordConfig config;
+    char *argv[] = {"meowpass", "--numbers", "3"};
+    config_init(&config, 3, argv);
+    static MeowRng rng;
+    static GeneratorState state;
+    rng_init_seeded(&rng, 15);
+    generator_init(&state, &rng);
+
+    int exact_ok = 1;
+    int sound_ok = 1;
+    int pruned = 0;
+    for (int i = 0; i < 2000; i++) {
+        char password[MAX_PASSWORD_LENGTH];
+        generate_password_r(&config, &state, password, sizeof(password));
+        size_t len = strlen(password);
+        ComplexityResult full;
+        analyze_complexity(password, &full);
+
+        double score = -1.0;
+        if (!complexity_score_above(password, len, -INFINITY, &score) || score != full.score) {
+            exact_ok = 0;
+        }
+
+        /* Floors around typical scores: a rejection must never be wrong */
+        double must_beat = 1.5 + (double)(i % 40) / 100.0;
+        if (complexity_score_above(password, len, must_beat, &score)) {
+            if (score != full.score || full.score <= must_beat) sound_ok = 0;
+        } else {
+            pruned++;
+            if (full.score > must_beat) sound_ok = 0;
+        }
+    }
+    assert_true(exact_ok, "Unbounded score-only path should equal analyze_complexity");
+    assert_true(sound_ok, "Pruning should only reject candidates that cannot win");
+    assert_true(pruned > 0, "Pruning should reject some candidates");
+
+    generator_free(&state);
+    printf("Score-only ranking tests passed!\n");
+}
+
+/**
+ * Test libm-free fixed-point scoring against the double score
+ */
+static void test_fixed_point_score(void) {
+    printf("\nTesting Fixed-Point Meow Score...\n");
+
+    assert_equal_int(complexity_score_fixed(""), 0, "Empty password should score 0");
+
+    static MeowRng rng;
+    static ComplexityAccumulator acc;
+    rng_init_seeded(&rng, 13);
+    complexity_init(&acc);
+
+    double max_error = 0.0;
+    int accumulator_ok = 1;
+    for (int trial = 0; trial < 3000; trial++) {
+        char str[MAX_PASSWORD_LENGTH];
+        size_t len = 1 + rng_uniform(&rng, sizeof(str) - 1);
+        size_t alphabet = 1 + rng_uniform(&rng, 94);
+        for (size_t i = 0; i < len; i++) {
+            str[i] = (char)('!' + rng_uniform(&rng, alphabet));
+        }
+        str[len] = '\0';
+
+        ComplexityResult result;
+        analyze_complexity(str, &result);
+        int32_t fixed = complexity_score_fixed(str);
+        double error = fabs((double)fixed / COMPLEXITY_FIXED_ONE - result.score);
+        if (error > max_error) max_error = error;
+
+        complexity_reset(&acc);
+        for (size_t i = 0; i < len; i++) {
+            complexity_push(&acc, (unsigned char)str[i]);
+        }
+        if (complexity_finish_fixed(&acc) != fixed) accumulator_ok = 0;
+    }
+    assert_true(max_error <= COMPLEXITY_FIXED_TOLERANCE,
+                "Fixed-point score should stay within the documented tolerance");
+    assert_true(accumulator_ok, "Accumulator fixed-point score should match the string path");
+
+    printf("Fixed-point score tests passed!\n");
+}
+
+/**
+ * Test bounded top-K heap and tournament early stop
+ */
+static void test_candidate_tournament(void) {
+    printf("\nTesting Meow Candidate Tournament...\n");
+
+    CandidateHeap heap;
+    assert_equal_int(candidate_heap_init(&heap, 3), 0, "Heap should allocate");
+
+    const double scores[] = {1.5, 0.2, 3.1, 2.7, 0.9, 3.1, 1.1, 2.0};
+    for (size_t i = 0; i < sizeof(scores) / sizeof(scores[0]); i++) {
+        PasswordCandidate candidate = {0};
+        snprintf(candidate.password, sizeof(candidate.password), "pw%zu", i);
+        candidate.complexity.score = scores[i];
+        candidate_heap_offer(&heap, &candidate);
+    }
+    assert_equal_int(candidate_heap_sort(&heap), 3, "Heap should keep exactly K candidates");
+    assert_true(heap.items[0].complexity.score == 3.1 && heap.items[1].complexity.score == 3.1 &&
+                heap.items[2].complexity.score == 2.7,
+                "Heap should keep the K best, best first");
+    candidate_heap_free(&heap);
+
+    /* A single-slot heap keeps the first of equal scores, like the old linear max */
+    candidate_heap_init(&heap, 1);
+    PasswordCandidate first = {0}, second = {0};
+    strcpy(first.password, "first");
+    strcpy(second.password, "second");
+    first.complexity.score = second.complexity.score = 1.0;
+    candidate_heap_offer(&heap, &first);
+    assert_true(!candidate_heap_offer(&heap, &second), "Ties should not displace the kept candidate");
+    assert_true(strcmp(heap.items[0].password, "first") == 0, "Earlier candidate should win a tie");
+    candidate_heap_free(&heap);
+
+    /* Any candidate reaches a target of 0.01, so the run stops after one */
+    char *argv[] = {"meowpass", "--candidates", "50", "--target", "0.01", "--top", "4"};
+    PasswordConfig config;
+    config_init(&config, 7, argv);
+    assert_equal_int(config.candidates, 50, "Candidates should be set by --candidates");
+    assert_equal_int(config.top, 4, "Top should be set by --top");
+
+    bool reached_target;
+    candidate_heap_init(&heap, config.top);
+    assert_equal_int(run_tournament(&config, &heap, false, &reached_target), 1,
+                     "Tournament should stop at the first candidate over target");
+    assert_true(reached_target, "Tournament should report the target as reached");
+    candidate_heap_free(&heap);
+
+    /* Reaching the target on the last candidate is still an early stop */
+    config.candidates = 1;
+    candidate_heap_init(&heap, config.top);
+    run_tournament(&config, &heap, false, &reached_target);
+    assert_true(reached_target, "Target reached on the last candidate should be reported");
+    candidate_heap_free(&heap);
+
+    config.candidates = 50;
+    config.target_score = 0.0;
+    candidate_heap_init(&heap, config.top);
+    assert_equal_int(run_tournament(&config, &heap, false, &reached_target), 50,
+                     "Tournament without a target should run every candidate");
+    assert_true(!reached_target, "Tournament without a target should not report reaching it");
+    assert_equal_int(candidate_heap_sort(&heap), 4, "Tournament should keep top K");
+    assert_true(heap.items[0].complexity.score >= heap.items[3].complexity.score,
+                "Top candidates should be ranked best first");
+    candidate_heap_free(&heap);
+
+    printf("Candidate tournament tests passed!\n");
+}
+
+/**
+ * Test memory-mapped parallel audit of a password list
+ */
+static void test_audit_file(void) {
+    printf("\nTesting Meow Password List Audit...\n");
+
+    char path[] = "/tmp/meowpass_audit_XXXXXX";
+    int fd = mkstemp(path);
+    assert_true(fd >= 0, "Temporary audit file should be created");
+    if (fd < 0) return;
+    FILE *list = fdopen(fd, "w");
+
+    /* Enough lines for several chunks; CRLF and blank lines mixed in */
+    const long lines = 120000;
+    long expected_below = 0;
+    for (long i = 0; i < lines; i++) {
+        char line[64];
+        if (i % 3 == 0) {
+            snprintf(line, sizeof(line), "password%ld", i % 100);
+        } else {
+            snprintf(line, sizeof(line), "Wh1sk3rs!%ldTom#%ld", i, i * 7919);
+        }
+        ComplexityResult result;
+        analyze_complexity(line, &result);
+        if (result.score < 1.0) expected_below++;
+        fprintf(list, (i % 5 == 0) ? "%s\r\n" : "%s\n", line);
+        if (i % 1000 == 0) fputs("\n", list);
+    }
+    fclose(list);
+
+    char *argv[] = {"meowpass", "--audit", path, "--threads", "4", "--below", "1.0"};
+    PasswordConfig config;
+    config_init(&config, 7, argv);
+    assert_true(config.audit_file == argv[2], "Audit file should be set by --audit");
+
+    FILE *out = tmpfile();
+    AuditStats stats;
+    assert_equal_int(audit_file(path, &config, out, &stats, NULL), 0, "Audit should succeed");
+    assert_true(stats.lines == lines, "Audit should score every non-empty line once");
+    assert_true(stats.reported == expected_below, "Audit should report exactly the lines below threshold");
+    assert_equal_int(stats.threads, 4, "Audit should use every requested worker when there are enough chunks");
+
+    /* Each reported line is "score<TAB>line" with the CR stripped */
+    rewind(out);
+    char row[128];
+    long rows = 0;
+    int format_ok = 1;
+    while (fgets(row, sizeof(row), out)) {
+        rows++;
+        if (!strchr(row, '\t') || strchr(row, '\r')) format_ok = 0;
+    }
+    fclose(out);
+    assert_true(rows == expected_below, "Audit output should have one row per reported line");
+    assert_true(format_ok, "Audit rows should be score, tab, line");
+
+    /* Summary mode: no per-line output, one merged summary over all lines */
+    ScoreSummary *summary = malloc(sizeof(ScoreSummary));
+    summary_init(summary);
+    out = tmpfile();
+    assert_equal_int(audit_file(path, &config, out, &stats, summary), 0, "Summary audit should succeed");
+    assert_true(ftell(out) == 0, "Summary audit should not write per-line rows");
+    fclose(out);
+    assert_true(summary->count == (uint64_t)lines, "Summary should count every non-empty line");
+    assert_true(stats.reported == expected_below, "Summary audit should still count lines below threshold");
+    assert_true(summary->weakest_count == SUMMARY_WEAKEST &&
+                strncmp(summary->weakest[0].text, "password", 8) == 0,
+                "Weakest entries should be the dictionary-style lines");
+    free(summary);
+
+    /* A score cache changes nothing but the work done */
+    char *cache_argv[] = {"meowpass", "--audit", path, "--threads", "4", "--below", "1.0",
+                          "--cache", "4096"};
+    PasswordConfig cached_config;
+    config_init(&cached_config, 9, cache_argv);
+    assert_true(cached_config.cache_entries == 4096, "Cache size should be set by --cache");
+    out = tmpfile();
+    assert_equal_int(audit_file(path, &cached_config, out, &stats, NULL), 0, "Cached audit should succeed");
+    fclose(out);
+    assert_true(stats.lines == lines && stats.reported == expected_below,
+                "Cached audit should report the same lines");
+    assert_true(stats.cache_hits + stats.cache_misses == (uint64_t)lines && stats.cache_hits > 0,
+                "Repeated lines should hit the cache");
+
+    assert_true(audit_file("/nonexistent/meowpass", &config, stdout, &stats, NULL) != 0,
+                "Missing audit file should fail");
+
+    /* An empty list is a clean audit; pipes and devices are refused */
+    FILE *empty = fopen(path, "w");
+    if (empty) fclose(empty);
+    assert_equal_int(audit_file(path, &config, stdout, &stats, NULL), 0, "Empty audit file should succeed");
+    assert_true(stats.lines == 0 && stats.reported == 0, "Empty audit file should score nothing");
+    assert_true(audit_file("/dev/null", &config, stdout, &stats, NULL) != 0,
+                "Device audit input should fail");
+    char fifo[] = "/tmp/meowpass_fifo_XXXXXX";
+    int fifo_fd = mkstemp(fifo);
+    if (fifo_fd >= 0) {
+        close(fifo_fd);
+        remove(fifo);
+        if (mkfifo(fifo, 0600) == 0) {
+            assert_true(audit_file(fifo, &config, stdout, &stats, NULL) != 0,
+                        "FIFO audit input should fail");
+            remove(fifo);
+        }
+    }
+    remove(path);
+    printf("Audit tests passed!\n");
+}
+
+/**
+ * Test dictionary word detection and guess estimation
+ */
+static void test_dictionary_matching(void) {
+    printf("\nTesting Meow Dictionary Matching...\n");
+
+    const double brute_bits = log2(10.0);
+    assert_true(dictionary_word_count() > 10000, "Dictionary should hold the cat names");
+
+    DictionaryMatch matches[32];
+    int n = find_dictionary_matches("fluffytiger", 11, matches, 32);
+    int found_fluffy = 0, found_tiger = 0, ordered = 1;
+    for (int i = 0; i < n && i < 32; i++) {
+        if (matches[i].start == 0 && matches[i].length == 6) found_fluffy = 1;
+        if (matches[i].start == 6 && matches[i].length == 5) found_tiger = 1;
+        if (i > 0 && matches[i].start + matches[i].length <
+                     matches[i - 1].start + matches[i - 1].length) ordered = 0;
+    }
+    assert_true(found_fluffy && found_tiger, "Both cat names in fluffytiger should be found");
+    assert_true(ordered, "Matches should come out in order of end position");
+
+    /* Two words cost far less than eleven random characters */
+    double words = estimate_guesses_log2("fluffytiger", 11);
+    assert_true(words < 11 * brute_bits - 6.0, "Dictionary words should cut the guess estimate");
+    assert_true(words > 2 * log2((double)get_cat_names_count()) - 2.0,
+                "Each word should still cost about the dictionary size");
+
+    /* Case and l33t variations cost a little more than the plain words */
+    double capitalized = estimate_guesses_log2("FluffyTiger", 11);
+    double l33t = estimate_guesses_log2("flUffyt1g3r", 11);
+    assert_true(fabs(capitalized - (words + 2.0)) < 1e-6, "Leading capitals should add one bit per word");
+    assert_true(l33t > words && l33t < 11 * brute_bits, "L33t words should still be found");
+
+    /* Nothing to match: pure brute force, one piece */
+    assert_true(fabs(estimate_guesses_log2("qzx%&*", 6) - 6 * brute_bits) < 1e-9,
+                "Unmatched characters should be brute-forced");
+    assert_true(estimate_guesses_log2("", 0) == 0.0, "Empty password needs no guesses");
+
+    ComplexityResult result;
+    analyze_complexity("fluffytiger", &result);
+    assert_true(result.guesses_log2 == words, "Analysis should carry the guess estimate");
+
+    /* The dictionary is fixed once built */
+    assert_true(wordlist_load("/dev/null") != 0, "Wordlists should be rejected after first use");
+
+    printf("Dictionary matching tests passed!\n");
+}
+
+/**
+ * Test .meowdict save, memory-mapped open and validation
+ */
+static void test_dictionary_file(void) {
+    printf("\nTesting Meow Dictionary Files...\n");
+
+    const Dictionary *cats = get_cat_dictionary();
+    assert_true(cats->count == get_cat_names_count(), "Embedded dictionary should hold every cat name");
+    assert_true(dictionary_active() == cats, "Embedded cat names should be active by default");
+
+    char path[] = "/tmp/meowpass_dict_XXXXXX";
+    int fd = mkstemp(path);
+    assert_true(fd >= 0, "Temporary dictionary file should be created");
+    if (fd < 0) return;
+    close(fd);
+
+    assert_equal_int(dictionary_save(cats, path), 0, "Dictionary should save");
+    Dictionary dict;
+    assert_equal_int(dictionary_open(&dict, path), 0, "Saved dictionary should open");
+    assert_true(dict.count == cats->count && dict.blob_size == cats->blob_size,
+                "Mapped dictionary should match the embedded one");
+    int words_ok = 1;
+    char buf_a[DICT_WORD_BUF], buf_b[DICT_WORD_BUF];
+    for (size_t i = 0; i < dict.count; i++) {
+        NameView a = dictionary_word(&dict, i, buf_a);
+        NameView b = dictionary_word(cats, i, buf_b);
+        if (a.len != b.len || memcmp(a.str, b.str, a.len) != 0) words_ok = 0;
+    }
+    assert_true(words_ok, "Mapped words should match the embedded words");
+
+    /* Every length bucket holds exactly the words of its length */
+    int index_ok = 1;
+    for (int len = 0; len < DICT_LENGTH_BUCKETS; len++) {
+        for (uint32_t k = dict.length_start[len]; k < dict.length_start[len + 1]; k++) {
+            size_t word_len = dictionary_word(&dict, dict.by_length[k], buf_a).len;
+            bool last = (len == DICT_LENGTH_BUCKETS - 1);
+            if (last ? word_len < (size_t)len : word_len != (size_t)len) index_ok = 0;
+        }
+    }
+    assert_true(index_ok, "Length index should group words by length");
+    assert_true(dictionary_word(&dict, dict.count, buf_a).len == 0, "Out of range words should be empty");
+    dictionary_close(&dict);
+    assert_true(dict.map == NULL && dict.count == 0, "Closed dictionary should be cleared");
+
+    /* Front coding a plain copy reproduces the generated embedded tables */
+    assert_true(cats->front_block == DICT_FRONT_BLOCK, "Embedded names should be front-coded");
+    char *blob = malloc(cats->count * DICT_WORD_MAX);
+    uint32_t *offsets = malloc((cats->count + 1) * sizeof(uint32_t));
+    size_t blob_size = 0;
+    for (size_t i = 0; i < cats->count; i++) {
+        NameView name = dictionary_word(cats, i, buf_a);
+        offsets[i] = (uint32_t)blob_size;
+        memcpy(&blob[blob_size], name.str, name.len);
+        blob_size += name.len;
+    }
+    offsets[cats->count] = (uint32_t)blob_size;
+    Dictionary plain = {blob, blob_size, offsets, cats->length_start, cats->by_length,
+                        cats->count, 0, NULL, 0, NULL};
+    Dictionary coded;
+    assert_equal_int(dictionary_front_code(&plain, &coded), 0, "Plain dictionary should front-code");
+    assert_true(coded.blob_size == cats->blob_size &&
+                memcmp(coded.blob, cats->blob, coded.blob_size) == 0,
+                "Front coding should match the generated tables");
+    assert_true(coded.blob_size < blob_size, "Front-coded names should be smaller than plain ones");
+    assert_true(dictionary_front_code(&coded, &dict) != 0, "Front-coded input should be rejected");
+    dictionary_close(&coded);
+
+    /* Plain files still open and read the same words */
+    assert_equal_int(dictionary_save(&plain, path), 0, "Plain dictionary should save");
+    assert_equal_int(dictionary_open(&dict, path), 0, "Plain dictionary should open");
+    words_ok = dict.front_block == 0 && dict.count == cats->count;
+    for (size_t i = 0; i < dict.count && words_ok; i++) {
+        NameView a = dictionary_word(&dict, i, buf_a);
+        NameView b = dictionary_word(cats, i, buf_b);
+        if (a.len != b.len || memcmp(a.str, b.str, a.len) != 0) words_ok = 0;
+    }
+    assert_true(words_ok, "Plain mapped words should match the front-coded ones");
+    dictionary_close(&dict);
+    free(blob);
+    free(offsets);
+
+    /* The active dictionary is fixed once anything has used it */
+    assert_true(dictionary_select(path) != 0, "Dictionary should not change once in use");
+
+    /* Damaged files are rejected before any word is read */
+    FILE *f = fopen(path, "r+b");
+    fputc('X', f);
+    fclose(f);
+    assert_true(dictionary_open(&dict, path) != 0, "Bad magic should be rejected");
+    assert_equal_int(dictionary_save(cats, path), 0, "Dictionary should save again");
+    f = fopen(path, "rb");
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fclose(f);
+    assert_true(truncate(path, size / 2) == 0, "Dictionary should truncate");
+    assert_true(dictionary_open(&dict, path) != 0, "Truncated dictionary should be rejected");
+    assert_true(dictionary_open(&dict, "/nonexistent/meowpass.meowdict") != 0,
+                "Missing dictionary should fail");
+
+    remove(path);
+    printf("Dictionary file tests passed!\n");
+}
+
+/**
+ * Test that a large --dict dictionary keeps scoring memory bounded
+ */
+static void test_large_dictionary_scoring(void) {
+    printf("\nTesting Large Meow Dictionary Scoring...\n");
+
+    /* 500K pseudo-random 8-letter words, far beyond WORD_DICT_LIMIT */
+    const size_t words = 500000, word_len = 8;
+    char *blob = malloc(words * word_len);
+    uint32_t *offsets = malloc((words + 1) * sizeof(uint32_t));
+    uint32_t *order = malloc(words * sizeof(uint32_t));
+    uint32_t start[DICT_LENGTH_BUCKETS + 1];
+    if (!blob || !offsets || !order) {
+        free(blob);
+        free(offsets);
+        free(order);
+        assert_true(false, "Large dictionary should allocate");
+        return;
+    }
+    uint64_t x = 88172645463325252ULL;
+    for (size_t i = 0; i < words; i++) {
+        offsets[i] = (uint32_t)(i * word_len);
+        order[i] = (uint32_t)i;
+        for (size_t j = 0; j < word_len; j++) {
+            x ^= x << 13;
+            x ^= x >> 7;
+            x ^= x << 17;
+            blob[i * word_len + j] = (char)('a' + x % 26);
+        }
+    }
+    offsets[words] = (uint32_t)(words * word_len);
+    for (int len = 0; len <= DICT_LENGTH_BUCKETS; len++) {
+        start[len] = (len > (int)word_len) ? (uint32_t)words : 0;
+    }
+    Dictionary big = {blob, words * word_len, offsets, start, order, words, 0, NULL, 0, NULL};
+
+    char path[] = "/tmp/meowpass_big_XXXXXX";
+    int fd = mkstemp(path);
+    assert_true(fd >= 0, "Temporary dictionary file should be created");
+    if (fd >= 0) {
+        close(fd);
+        assert_equal_int(dictionary_save(&big, path), 0, "Large dictionary should save");
+    }
+    free(blob);
+    free(offsets);
+    free(order);
+    if (fd < 0) return;
+
+    /* Score candidates against it in a fresh process, as the CLI does */
+    pid_t pid = fork();
+    if (pid == 0) {
+        int null_fd = open("/dev/null", O_WRONLY);
+        if (null_fd >= 0) dup2(null_fd, STDOUT_FILENO);
+        execl("/proc/self/exe", "meowpass", "--dict", path, "--candidates", "5", (char *)NULL);
+        _exit(127);
+    }
+    int status = 0;
+    assert_true(pid > 0 && waitpid(pid, &status, 0) == pid, "Scoring process should run");
+    assert_true(WIFEXITED(status) && WEXITSTATUS(status) == 0, "Scoring process should succeed");
+
+    struct rusage usage;
+    getrusage(RUSAGE_CHILDREN, &usage);
+    assert_true(usage.ru_maxrss < 128 * 1024, "Scoring with a large dictionary should stay under 128 MB");
+    printf("Peak scoring memory with %zu words: %ld KB\n", words, usage.ru_maxrss);
+
+    remove(path);
+    printf("Large dictionary scoring tests passed!\n");
+}
+
+/**
+ * Test alias tables and weighted multi-dictionary name mixes
+ */
+static void test_weighted_names(void) {
+    printf("\nTesting Weighted Meow Name Mixes...\n");
+
+    static MeowRng rng;
+    rng_init_seeded(&rng, 2024);
+
+    /* Alias draws follow the weights; zero weights never come up */
+    const double weights[] = {1.0, 0.0, 2.0, 3.0, 4.0};
+    AliasTable table;
+    assert_equal_int(alias_table_init(&table, weights, 5), 0, "Alias table should build");
+    long hits[5] = {0};
+    const long draws = 200000;
+    for (long i = 0; i < draws; i++) hits[alias_table_draw(&table, &rng)]++;
+    int freq_ok = hits[1] == 0;
+    for (int i = 0; i < 5; i++) {
+        double expected = weights[i] / 10.0 * (double)draws;
+        if (fabs((double)hits[i] - expected) > 0.03 * (double)draws) freq_ok = 0;
+    }
+    assert_true(freq_ok, "Alias draws should match their weights");
+    alias_table_free(&table);
+    const double zeros[] = {0.0, 0.0};
+    assert_true(alias_table_init(&table, zeros, 2) != 0, "All-zero weights should be rejected");
+
+    /* The active dictionary alone with no bias is the uniform sampler */
+    NameMix *mix = name_mix_create(NAME_SOURCE_ACTIVE, 0.0);
+    assert_true(mix != NULL, "Active dictionary mix should build");
+    if (!mix) return;
+    assert_true(fabs(name_mix_entropy(mix, 25) - name_sequence_entropy(25)) < 1e-6,
+                "Unbiased single-source entropy should match the uniform sampler");
+    char phrase[MAX_PASSWORD_LENGTH];
+    int in_range = 1;
+    for (int i = 0; i < 500; i++) {
+        size_t len = name_mix_sample(mix, &rng, 20, phrase, sizeof(phrase));
+        if (len < MIN_LENGTH || len > 20 || len != strlen(phrase)) in_range = 0;
+    }
+    assert_true(in_range, "Mixed phrases should land in [MIN_LENGTH, max_length]");
+    name_mix_destroy(mix);
+
+    /* A two-word corporate list: one short word, one long word */
+    static const char corp_blob[] = "CorpSynergyventures";
+    static const uint32_t corp_offsets[] = {0, 4, 19};
+    static const uint32_t corp_order[] = {0, 1};
+    uint32_t corp_start[DICT_LENGTH_BUCKETS + 1];
+    for (int len = 0; len <= DICT_LENGTH_BUCKETS; len++) corp_start[len] = (len > 4) + (len > 15);
+    Dictionary corp = {corp_blob, 19, corp_offsets, corp_start, corp_order, 2, 0, NULL, 0, NULL};
+
+    char path[] = "/tmp/meowpass_mix_XXXXXX";
+    int fd = mkstemp(path);
+    assert_true(fd >= 0, "Temporary dictionary file should be created");
+    if (fd < 0) return;
+    close(fd);
+    assert_equal_int(dictionary_save(&corp, path), 0, "Corporate dictionary should save");
+
+    /* Only corporate words, and a length bias favors the long one */
+    double long_share[2];
+    const double biases[2] = {0.0, 3.0};
+    int corp_only = 1;
+    for (int b = 0; b < 2; b++) {
+        mix = name_mix_create(path, biases[b]);
+        assert_true(mix != NULL, "Corporate mix should build");
+        if (!mix) break;
+        long with_long = 0;
+        for (int i = 0; i < 2000; i++) {
+            size_t len = name_mix_sample(mix, &rng, 25, phrase, sizeof(phrase));
+            char *p = phrase;
+            while (p < phrase + len) {
+                if (strncmp(p, "Synergyventures", 15) == 0) p += 15;
+                else if (strncmp(p, "Corp", 4) == 0) p += 4;
+                else { corp_only = 0; break; }
+            }
+            if (len == 0) corp_only = 0;
+            if (strstr(phrase, "Synergyventures")) with_long++;
+        }
+        long_share[b] = (double)with_long / 2000.0;
+        name_mix_destroy(mix);
+    }
+    assert_true(corp_only, "Single-source phrases should use only that source's words");
+    assert_true(long_share[1] > long_share[0] + 0.2, "Length bias should favor longer names");
+
+    /* Mixing with the cat names draws from both sources */
+    char spec[128];
+    snprintf(spec, sizeof(spec), "%s=50,%s=50", NAME_SOURCE_ACTIVE, path);
+    mix = name_mix_create(spec, 0.0);
+    assert_true(mix != NULL, "Two-source mix should build");
+    if (mix) {
+        int saw_corp = 0, saw_cats = 0;
+        for (int i = 0; i < 500; i++) {
+            name_mix_sample(mix, &rng, 25, phrase, sizeof(phrase));
+            if (strstr(phrase, "Corp") || strstr(phrase, "Synergyventures")) saw_corp = 1;
+            else saw_cats = 1;
+        }
+        assert_true(saw_corp && saw_cats, "Mixed phrases should come from both sources");
+        assert_true(name_mix_entropy(mix, 25) > 0.0, "Mixed entropy should be positive");
+        name_mix_destroy(mix);
+    }
+
+    /* Bad specs are rejected */
+    assert_true(name_mix_create("cats=0", 0.0) == NULL, "Zero share should be rejected");
+    assert_true(name_mix_create("cats=x", 0.0) == NULL, "Non-numeric share should be rejected");
+    assert_true(name_mix_create("/nonexistent/meowpass.meowdict", 0.0) == NULL,
+                "Missing source should be rejected");
+
+    remove(path);
+    printf("Weighted name tests passed!\n");
+}
+
+/**
+ * Test the sharded score cache
+ */
+static void test_score_cache(void) {
+    printf("\nTesting Meow Score Cache...\n");
+
+    /* Smallest cache: one set of CACHE_WAYS entries per shard */
+    ScoreCache *cache = score_cache_create(1);
+    assert_true(cache != NULL, "Score cache should be created");
+    if (!cache) return;
+
+    ComplexityResult direct, cached;
+    const char *pw = "Whiskers4Tom!";
+    analyze_complexity(pw, &direct);
+    assert_true(!score_cache_lookup(cache, pw, strlen(pw), &cached), "First lookup should miss");
+    analyze_complexity_cached(cache, pw, strlen(pw), &cached);
+    assert_true(same_complexity(&direct, &cached), "Cached analysis should equal direct analysis");
+    assert_true(score_cache_lookup(cache, pw, strlen(pw), &cached) &&
+                same_complexity(&direct, &cached), "Second lookup should hit with the same result");
+    assert_true(!score_cache_lookup(cache, pw, 8, &cached), "A prefix should not hit the full key");
+
+    uint64_t hits, misses;
+    score_cache_counters(cache, &hits, &misses);
+    assert_true(hits == 1 && misses == 3, "Counters should record hits and misses");
+
+    /* Score-only entries answer score lookups but never full ones */
+    const char *ranked = "Mittens7Luna$";
+    analyze_complexity(ranked, &direct);
+    assert_true(complexity_score_cached(cache, ranked, strlen(ranked)) == direct.score,
+                "Cached score should equal the direct score");
+    assert_true(!score_cache_lookup(cache, ranked, strlen(ranked), &cached),
+                "A score-only entry should not answer a full lookup");
+    analyze_complexity_cached(cache, ranked, strlen(ranked), &cached);
+    assert_true(same_complexity(&direct, &cached) &&
+                score_cache_lookup(cache, ranked, strlen(ranked), &cached),
+                "A full analysis should replace the score-only entry");
+    assert_true(complexity_score_cached(cache, ranked, strlen(ranked)) == direct.score,
+                "A full entry should answer score lookups");
+
+    /* Far more keys than entries: evictions must never return a wrong result */
+    int evict_ok = 1;
+    for (int round = 0; round < 2; round++) {
+        for (int i = 0; i < 2000; i++) {
+            char key[32];
+            snprintf(key, sizeof(key), "Tabby%d#%d", i, i % 7);
+            analyze_complexity(key, &direct);
+            analyze_complexity_cached(cache, key, strlen(key), &cached);
+            if (!same_complexity(&direct, &cached)) evict_ok = 0;
+        }
+    }
+    assert_true(evict_ok, "Results should stay correct under eviction");
+
+    /* Passwords too long to store are analyzed but never cached */
+    char long_pw[MAX_PASSWORD_LENGTH + 8];
+    memset(long_pw, 'm', sizeof(long_pw));
+    analyze_complexity_len(long_pw, sizeof(long_pw), &direct);
+    analyze_complexity_cached(cache, long_pw, sizeof(long_pw), &cached);
+    assert_true(same_complexity(&direct, &cached) &&
+                !score_cache_lookup(cache, long_pw, sizeof(long_pw), &cached),
+                "Overlong passwords should bypass the cache");
+    score_cache_destroy(cache);
+
+    /* Batch path through a cache, with heavy duplication */
+    enum { BATCH = 96 };
+    const char *names[] = {"mittens1!", "Luna", "", "Oreo#42Felix", "tigger"};
+    const char *passwords[BATCH];
+    for (int i = 0; i < BATCH; i++) {
+        passwords[i] = (i % 11 == 0) ? NULL : names[i % 5];
+    }
+    double score[BATCH], score_cached[BATCH], entropy[BATCH];
+    int length[BATCH];
+    ComplexityBatch plain = {score, NULL, NULL, NULL, NULL, NULL, NULL};
+    ComplexityBatch with_cache = {score_cached, entropy, NULL, NULL, NULL, length, NULL};
+    cache = score_cache_create(1024);
+    analyze_complexity_batch(passwords, NULL, BATCH, &plain);
+    analyze_complexity_batch_cached(cache, passwords, NULL, BATCH, &with_cache);
+    assert_true(memcmp(score, score_cached, sizeof(score)) == 0,
+                "Cached batch scores should equal the uncached batch");
+    assert_true(length[1] == 4 && length[0] == 0, "Cached batch should fill requested columns");
+    score_cache_counters(cache, &hits, &misses);
+    assert_true(misses == 5 && hits == BATCH - 5, "Each distinct password should be analyzed once");
+    score_cache_destroy(cache);
+
+    /* Score-only batches compute and cache scores alone */
+    double score_only[BATCH];
+    ComplexityBatch scores = {score_only, NULL, NULL, NULL, NULL, NULL, NULL};
+    cache = score_cache_create(1024);
+    analyze_complexity_batch_cached(cache, passwords, NULL, BATCH, &scores);
+    assert_true(memcmp(score, score_only, sizeof(score)) == 0,
+                "Score-only cached batch should equal the uncached batch");
+    score_cache_counters(cache, &hits, &misses);
+    assert_true(misses == 5 && hits == BATCH - 5, "Each distinct password should be scored once");
+    score_cache_destroy(cache);
+
+    printf("Score cache tests passed!\n");
+}
+
+/**
+ * Test mergeable summary statistics
+ */
+static void test_summary_statistics(void) {
+    printf("\nTesting Meow Summary Statistics...\n");
+
+    /* Sketch quantiles of a shuffled uniform sequence, whole and merged */
+    const int n = 100000;
+    QuantileSketch *whole = malloc(sizeof(QuantileSketch));
+    QuantileSketch *parts = malloc(2 * sizeof(QuantileSketch));
+    sketch_init(whole);
+    sketch_init(&parts[0]);
+    sketch_init(&parts[1]);
+    for (int i = 0; i < n; i++) {
+        double value = (double)((long)i * 7919 % n);
+        sketch_add(whole, value, 1.0);
+        sketch_add(&parts[i % 2], value, 1.0);
+    }
+    sketch_merge(&parts[0], &parts[1]);
+    static const double qs[] = {0.001, 0.01, 0.25, 0.5, 0.75, 0.99, 0.999};
+    int sketch_ok = 1;
+    for (size_t i = 0; i < sizeof(qs) / sizeof(qs[0]); i++) {
+        double exact = qs[i] * (n - 1);
+        if (fabs(sketch_quantile(whole, qs[i]) - exact) > 0.005 * n) sketch_ok = 0;
+        if (fabs(sketch_quantile(&parts[0], qs[i]) - exact) > 0.005 * n) sketch_ok = 0;
+    }
+    assert_true(sketch_ok, "Sketch quantiles should be within 0.5% of rank, whole or merged");
+    assert_true(whole->count <= SKETCH_CENTROIDS, "Sketch should stay within its centroid budget");
+    assert_true(sketch_quantile(whole, 0.0) == 0.0 && sketch_quantile(whole, 1.0) == n - 1,
+                "Sketch extremes should be exact");
+    free(parts);
+    free(whole);
+
+    /* A summary split three ways and merged matches one built in a single pass */
+    ScoreSummary *single = malloc(sizeof(ScoreSummary));
+    ScoreSummary *split = malloc(3 * sizeof(ScoreSummary));
+    summary_init(single);
+    for (int k = 0; k < 3; k++) summary_init(&split[k]);
+    for (int i = 0; i < 3000; i++) {
+        char pw[64];
+        snprintf(pw, sizeof(pw), (i % 4) ? "Mittens%d!Luna" : "kitty%d", i * 31);
+        size_t len = strlen(pw);
+        ComplexityResult result;
+        analyze_complexity_len(pw, len, &result);
+        unsigned flags = classify_characters(pw, len);
+        summary_add(single, pw, len, &result, flags);
+        summary_add(&split[i % 3], pw, len, &result, flags);
+    }
+    summary_merge(&split[0], &split[1]);
+    summary_merge(&split[0], &split[2]);
+    ScoreSummary *merged = &split[0];
+    assert_true(merged->count == 3000 && single->count == 3000, "Merged summary should count every entry");
+    assert_true(memcmp(merged->score_bins, single->score_bins, sizeof(single->score_bins)) == 0 &&
+                memcmp(merged->length_bins, single->length_bins, sizeof(single->length_bins)) == 0,
+                "Merged histograms should equal single-pass histograms");
+    assert_true(memcmp(merged->class_counts, single->class_counts, sizeof(single->class_counts)) == 0 &&
+                memcmp(merged->classes_per_entry, single->classes_per_entry,
+                       sizeof(single->classes_per_entry)) == 0,
+                "Merged class coverage should equal single-pass coverage");
+    assert_true(merged->class_counts[3] == 2250 && merged->classes_per_entry[2] == 750,
+                "Class coverage should count symbol and two-class entries");
+    assert_true(summary_length_percentile(single, 0.0) == strlen("kitty0") &&
+                summary_length_percentile(single, 1.0) == strlen("Mittens92969!Luna"),
+                "Length percentiles should span the shortest to longest entry");
+
+    FILE *sink = tmpfile();
+    summary_print(single, sink);
+    summary_print(merged, sink);
+    fclose(sink);
+    int weakest_ok = single->weakest_count == SUMMARY_WEAKEST &&
+                     merged->weakest_count == SUMMARY_WEAKEST;
+    for (int i = 0; i < SUMMARY_WEAKEST && weakest_ok; i++) {
+        if (merged->weakest[i].score != single->weakest[i].score) weakest_ok = 0;
+        if (i > 0 && single->weakest[i].score < single->weakest[i - 1].score) weakest_ok = 0;
+    }
+    assert_true(weakest_ok, "Merged weakest entries should match, sorted weakest first");
+
+    /* Audit lines may hold NUL bytes; merging must keep their full length */
+    static const char nul_line[] = "ab\0cd";
+    ComplexityResult nul_result;
+    analyze_complexity_len(nul_line, 5, &nul_result);
+    summary_init(&split[1]);
+    summary_init(&split[2]);
+    summary_add(&split[2], nul_line, 5, &nul_result, classify_characters(nul_line, 5));
+    summary_merge(&split[1], &split[2]);
+    assert_true(split[1].weakest_count == 1 && split[1].weakest[0].len == 5 &&
+                memcmp(split[1].weakest[0].text, nul_line, 5) == 0,
+                "Merged weakest entries should keep embedded NUL bytes");
+    free(split);
+    free(single);
+
+    printf("Summary statistics tests passed!\n");
+}
+
 /**
  * Test update checker version comparison
  */
@@ -266,15 +1706,39 @@ int run_tests(void) {
     printf("Running Basic MeowPassword Tests\n");
     printf("=================================\n");
 
-    /* Seed random for reproducible-ish tests */
-    srand((unsigned int)time(NULL));
+    /* Seed the default generator from the kernel */
+    if (rng_init(rng_default()) != 0) {
+        printf("FAIL: Unable to seed random number generator\n");
+        return 1;
+    }
 
     test_load_cat_names();
     test_complete_password_generation();
     test_shannon_entropy();
     test_character_diversity();
+    test_pattern_complexity();
+    test_lz_compression();
+    test_classification_kernels();
     test_config_parsing();
     test_relevancy_score_explanation();
+    test_bulk_generation();
+    test_rng();
+    test_name_sequence_sampler();
+    test_fused_transformations();
+    test_generator_policies();
+    test_generator_state();
+    test_incremental_complexity();
+    test_complexity_batch();
+    test_fixed_point_score();
+    test_score_only_ranking();
+    test_candidate_tournament();
+    test_audit_file();
+    test_summary_statistics();
+    test_score_cache();
+    test_dictionary_matching();
+    test_dictionary_file();
+    test_large_dictionary_scoring();
+    test_weighted_names();
     test_update_version_compare();
 
     printf("\nMeow Basic Tests Complete!\n");
@@ -0,0 +1,257 @@
+/*
+ * catnames_gen.c - Build-time Cat Name Table Generator
+ * MeowPassword - Cat Name Based Secure Password Generator
+ *
+ * Reads data/catnames.txt (one name per line) and writes a C header with
+ * the normalized names (lowercase, no spaces) front-coded in blocks of
+ * FRONT_BLOCK plus a uint32_t table of block starts and a length index
+ * (name indices grouped by normalized length). No table contains
+ * pointers, so nothing needs relocating at startup.
+ *
+ * Usage: catnames_gen <catnames.txt> <catnames_data.h>
+ *
+ * Copyright (c) 2025 Jeffrey Kunzelman
+ * MIT License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+/* Longest accepted input line */
+#define LINE_MAX_LEN 1024
+
+/* Length index buckets; must match DICT_LENGTH_BUCKETS in meowpass.h */
+#define LENGTH_BUCKETS 64
+
+/* Names per front-coded block, longest name and padding after the last
+ * block; must match DICT_FRONT_BLOCK, DICT_WORD_MAX and DICT_FRONT_PAD in
+ * meowpass.h */
+#define FRONT_BLOCK 8
+#define NAME_MAX_LEN 255
+#define FRONT_PAD 16
+
+/* Growable byte buffer */
+typedef struct {
+    unsigned char *data;
+    size_t len;
+    size_t cap;
+} ByteBuf;
+
+static int buf_push(ByteBuf *buf, unsigned char c) {
+    if (buf->len == buf->cap) {
+        size_t cap = (buf->cap == 0) ? 4096 : buf->cap * 2;
+        unsigned char *data = realloc(buf->data, cap);
+        if (!data) return -1;
+        buf->data = data;
+        buf->cap = cap;
+    }
+    buf->data[buf->len++] = c;
+    return 0;
+}
+
+/**
+ * Emit a byte array as a C initializer of character constants
+ */
+static void write_bytes(FILE *out, const char *name, const ByteBuf *buf) {
+    fprintf(out, "static const char %s[%zu] = {\n", name, buf->len);
+    for (size_t i = 0; i < buf->len; i++) {
+        unsigned char c = buf->data[i];
+        fputs((i % 16 == 0) ? "    " : " ", out);
+        if (c == '\'' || c == '\\') {
+            fprintf(out, "'\\%c',", c);
+        } else if (isprint(c)) {
+            fprintf(out, "'%c',", c);
+        } else {
+            fprintf(out, "'\\x%02x',", c);
+        }
+        if (i % 16 == 15 || i + 1 == buf->len) fputc('\n', out);
+    }
+    fprintf(out, "};\n\n");
+}
+
+/**
+ * Emit the names front-coded. Each block holds FRONT_BLOCK bytes of prefix
+ * length shared with the previous name (0 for the first), FRONT_BLOCK
+ * suffix lengths (0 past the last name), then the suffixes. Block b starts
+ * at cat_name_restarts[b]; FRONT_PAD zero bytes follow the last block.
+ * @return 0 on success, -1 on allocation failure
+ */
+static int write_front_coded(FILE *out, const ByteBuf *normalized,
+                             const unsigned long *offsets, size_t count) {
+    ByteBuf coded = {0};
+    size_t blocks = (count + FRONT_BLOCK - 1) / FRONT_BLOCK;
+    unsigned long *restarts = malloc((blocks + 1) * sizeof(*restarts));
+    if (!restarts) return -1;
+
+    int rc = 0;
+    for (size_t b = 0; b < blocks && rc == 0; b++) {
+        size_t first = b * FRONT_BLOCK;
+        size_t last = (first + FRONT_BLOCK < count) ? first + FRONT_BLOCK : count;
+        unsigned char shared[FRONT_BLOCK] = {0};
+        unsigned char suffix[FRONT_BLOCK] = {0};
+        for (size_t i = first; i < last; i++) {
+            size_t len = offsets[i + 1] - offsets[i];
+            size_t s = 0;
+            if (i > first) {
+                const unsigned char *word = &normalized->data[offsets[i]];
+                const unsigned char *prev = &normalized->data[offsets[i - 1]];
+                size_t prev_len = offsets[i] - offsets[i - 1];
+                while (s < len && s < prev_len && word[s] == prev[s]) s++;
+            }
+            shared[i - first] = (unsigned char)s;
+            suffix[i - first] = (unsigned char)(len - s);
+        }
+
+        restarts[b] = (unsigned long)coded.len;
+        for (int k = 0; k < FRONT_BLOCK && rc == 0; k++) rc = buf_push(&coded, shared[k]);
+        for (int k = 0; k < FRONT_BLOCK && rc == 0; k++) rc = buf_push(&coded, suffix[k]);
+        for (size_t i = first; i < last && rc == 0; i++) {
+            for (size_t k = offsets[i] + shared[i - first]; k < offsets[i + 1] && rc == 0; k++) {
+                rc = buf_push(&coded, normalized->data[k]);
+            }
+        }
+    }
+    restarts[blocks] = (unsigned long)coded.len;
+    for (int k = 0; k < FRONT_PAD && rc == 0; k++) rc = buf_push(&coded, 0);
+    if (rc != 0) {
+        free(restarts);
+        free(coded.data);
+        return -1;
+    }
+
+    fprintf(out, "#define CAT_NAME_FRONT_BLOCK %d\n\n", FRONT_BLOCK);
+    write_bytes(out, "cat_name_front", &coded);
+    fprintf(out, "static const uint32_t cat_name_restarts[%zu] = {\n", blocks + 1);
+    for (size_t b = 0; b <= blocks; b++) {
+        fprintf(out, "%s%lu,%s", (b % 8 == 0) ? "    " : "", restarts[b],
+                (b % 8 == 7 || b == blocks) ? "\n" : " ");
+    }
+    fprintf(out, "};\n\n");
+    free(restarts);
+    free(coded.data);
+    return 0;
+}
+
+/**
+ * Emit the length index: bucket start positions, then name indices grouped
+ * by normalized length (the last bucket holds every longer name)
+ */
+static void write_length_index(FILE *out, const unsigned long *offsets, size_t count) {
+    unsigned long start[LENGTH_BUCKETS + 1] = {0};
+    for (size_t i = 0; i < count; i++) {
+        unsigned long len = offsets[i + 1] - offsets[i];
+        start[(len < LENGTH_BUCKETS - 1) ? len : LENGTH_BUCKETS - 1]++;
+    }
+    unsigned long total = 0;
+    for (int b = 0; b <= LENGTH_BUCKETS; b++) {
+        unsigned long n = (b < LENGTH_BUCKETS) ? start[b] : 0;
+        start[b] = total;
+        total += n;
+    }
+
+    fprintf(out, "#define CAT_NAME_LENGTH_BUCKETS %d\n\n", LENGTH_BUCKETS);
+    fprintf(out, "static const uint32_t cat_name_length_start[CAT_NAME_LENGTH_BUCKETS + 1] = {\n");
+    for (int b = 0; b <= LENGTH_BUCKETS; b++) {
+        fprintf(out, "%s%lu,%s", (b % 8 == 0) ? "    " : "", start[b],
+                (b % 8 == 7 || b == LENGTH_BUCKETS) ? "\n" : " ");
+    }
+    fprintf(out, "};\n\n");
+
+    /* Stable within each bucket, so names keep their file order */
+    fprintf(out, "static const uint32_t cat_name_by_length[CAT_NAMES_COUNT] = {\n");
+    size_t emitted = 0;
+    for (int b = 0; b < LENGTH_BUCKETS; b++) {
+        for (size_t i = 0; i < count; i++) {
+            unsigned long len = offsets[i + 1] - offsets[i];
+            if ((int)((len < LENGTH_BUCKETS - 1) ? len : LENGTH_BUCKETS - 1) != b) continue;
+            fprintf(out, "%s%zu,%s", (emitted % 8 == 0) ? "    " : "", i,
+                    (emitted % 8 == 7 || emitted + 1 == count) ? "\n" : " ");
+            emitted++;
+        }
+    }
+    fprintf(out, "};\n\n");
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 3) {
+        fprintf(stderr, "Usage: %s <catnames.txt> <catnames_data.h>\n", argv[0]);
+        return 1;
+    }
+
+    FILE *in = fopen(argv[1], "r");
+    if (!in) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    ByteBuf normalized = {0};
+    unsigned long *offsets = NULL;
+    size_t count = 0;
+    size_t offsets_cap = 0;
+    char line[LINE_MAX_LEN];
+    int rc = 0;
+
+    while (fgets(line, sizeof(line), in)) {
+        size_t len = strcspn(line, "\r\n");
+        line[len] = '\0';
+        if (len == 0) continue;
+        if (len > NAME_MAX_LEN) {
+            rc = 1;
+            break;
+        }
+
+        if (count + 1 >= offsets_cap) {
+            offsets_cap = (offsets_cap == 0) ? 1024 : offsets_cap * 2;
+            unsigned long *grown = realloc(offsets, offsets_cap * sizeof(*offsets));
+            if (!grown) {
+                rc = 1;
+                break;
+            }
+            offsets = grown;
+        }
+        offsets[count++] = (unsigned long)normalized.len;
+
+        /* Same normalization select_and_join_names applied at runtime */
+        for (size_t i = 0; i < len && rc == 0; i++) {
+            unsigned char c = (unsigned char)line[i];
+            if (c != ' ' && buf_push(&normalized, (unsigned char)tolower(c)) != 0) rc = 1;
+        }
+        if (rc != 0) break;
+    }
+    fclose(in);
+
+    if (rc != 0 || count == 0 || normalized.len > 0xFFFFFFFFul) {
+        fprintf(stderr, "%s: failed to build name table\n", argv[0]);
+        free(offsets);
+        free(normalized.data);
+        return 1;
+    }
+    offsets[count] = (unsigned long)normalized.len;
+
+    FILE *out = fopen(argv[2], "w");
+    if (!out) {
+        perror(argv[2]);
+        free(offsets);
+        free(normalized.data);
+        return 1;
+    }
+
+    fprintf(out, "/* Generated by tools/catnames_gen.c from %s - do not edit */\n\n", argv[1]);
+    fprintf(out, "#define CAT_NAMES_COUNT %zu\n\n", count);
+    if (write_front_coded(out, &normalized, offsets, count) != 0) {
+        fprintf(stderr, "%s: out of memory\n", argv[0]);
+        rc = 1;
+    }
+    write_length_index(out, offsets, count);
+
+    if (fclose(out) != 0) {
+        perror(argv[2]);
+        rc = 1;
+    }
+
+    free(offsets);
+    free(normalized.data);
+    return rc;
+}
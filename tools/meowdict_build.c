@@ -0,0 +1,441 @@
+/*
+ * meowdict_build.c - Wordlist to .meowdict Dictionary Compiler
+ * MeowPassword - Cat Name Based Secure Password Generator
+ *
+ * Reads one or more text wordlists (one word per line, most common first)
+ * and writes a .meowdict file for --dict. Words are normalized the way the
+ * embedded cat names are (lowercase, no spaces), words that collide after
+ * normalization are kept once at their first position, and the length
+ * index is built alongside.
+ *
+ * Inputs are memory-mapped and cut into chunks at line boundaries. Worker
+ * threads normalize whole chunks with the SIMD kernels from classify.c,
+ * split and hash the words, and scatter them into hash partitions; each
+ * partition is then deduplicated by one thread, and the surviving words
+ * are copied into the output tables in parallel. The result is front-coded
+ * unless --plain is given.
+ *
+ * Usage: meowdict_build [--threads N] [--plain] <output.meowdict> <wordlist.txt>...
+ *
+ * Copyright (c) 2025 Jeffrey Kunzelman
+ * MIT License
+ */
+
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "../src/meowpass.h"
+
+/* Input bytes per chunk, extended to the next newline */
+#define CHUNK_BYTES ((size_t)8 << 20)
+
+/* Longer normalized words are dropped */
+#define WORD_LIMIT DICT_WORD_MAX
+
+/* Dedup partitions, chosen by the top bits of each word's hash */
+#define PARTITION_BITS 8
+#define PARTITIONS (1 << PARTITION_BITS)
+
+/* One normalized word of a chunk */
+typedef struct {
+    uint64_t hash;
+    uint32_t offset;            /* Into the chunk's normalized text */
+    uint32_t len;
+} WordEntry;
+
+/* A line-aligned slice of one input file and everything derived from it */
+typedef struct {
+    const char *src;
+    size_t src_len;
+    char *text;                 /* Normalized copy of src */
+    WordEntry *words;
+    size_t count;
+    uint32_t *by_partition;     /* Word indices grouped by partition */
+    uint32_t part_start[PARTITIONS + 1];
+    unsigned char *keep;        /* 1 = first occurrence of its word */
+    /* Filled after dedup */
+    size_t kept;
+    size_t kept_bytes;
+    uint32_t length_counts[DICT_LENGTH_BUCKETS];
+    size_t first_word;          /* Output index of this chunk's first kept word */
+    size_t first_byte;          /* Blob offset of this chunk's first kept word */
+    uint32_t length_base[DICT_LENGTH_BUCKETS];
+} Chunk;
+
+/* Hash table slot: chunk UINT32_MAX marks an empty slot */
+typedef struct {
+    uint64_t hash;
+    uint32_t chunk;
+    uint32_t word;
+} DedupSlot;
+
+typedef struct {
+    Chunk *chunks;
+    size_t chunk_count;
+    atomic_size_t next;         /* Next chunk or partition to claim */
+    atomic_int failed;
+    /* Output tables */
+    char *blob;
+    uint32_t *offsets;
+    uint32_t length_start[DICT_LENGTH_BUCKETS + 1];
+    uint32_t *by_length;
+} BuildState;
+
+/**
+ * Fast 64-bit hash, eight bytes per step
+ */
+static uint64_t hash_word(const char *str, size_t len) {
+    uint64_t h = 0x9E3779B97F4A7C15ull ^ (uint64_t)len;
+    size_t i = 0;
+    for (; i + 8 <= len; i += 8) {
+        uint64_t w;
+        memcpy(&w, &str[i], 8);
+        h = (h ^ w) * 0xFF51AFD7ED558CCDull;
+        h ^= h >> 32;
+    }
+    uint64_t tail = 0;
+    memcpy(&tail, &str[i], len - i);
+    h = (h ^ tail) * 0xC4CEB9FE1A85EC53ull;
+    h ^= h >> 29;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 32;
+    return h;
+}
+
+static int length_bucket(size_t len) {
+    return (len < DICT_LENGTH_BUCKETS - 1) ? (int)len : DICT_LENGTH_BUCKETS - 1;
+}
+
+/**
+ * Normalize a chunk, split it into words and group them by partition
+ * @return 0 on success, -1 on allocation failure
+ */
+static int scan_chunk(Chunk *c) {
+    c->text = malloc(c->src_len + 1);
+    /* At most one word per two bytes: each needs a newline after it */
+    size_t max_words = c->src_len / 2 + 1;
+    c->words = malloc(max_words * sizeof(WordEntry));
+    if (!c->text || !c->words) return -1;
+
+    size_t len = normalize_text(c->src, c->src_len, c->text);
+    c->text[len] = '\n';
+
+    size_t count = 0;
+    uint32_t part_counts[PARTITIONS] = {0};
+    const char *p = c->text, *end = c->text + len;
+    while (p < end) {
+        const char *nl = memchr(p, '\n', (size_t)(end - p + 1));
+        size_t word_len = (size_t)(nl - p);
+        if (word_len > 0 && word_len <= WORD_LIMIT) {
+            WordEntry *w = &c->words[count++];
+            w->hash = hash_word(p, word_len);
+            w->offset = (uint32_t)(p - c->text);
+            w->len = (uint32_t)word_len;
+            part_counts[w->hash >> (64 - PARTITION_BITS)]++;
+        }
+        p = nl + 1;
+    }
+    c->count = count;
+
+    c->by_partition = malloc((count > 0 ? count : 1) * sizeof(uint32_t));
+    c->keep = calloc(count > 0 ? count : 1, 1);
+    if (!c->by_partition || !c->keep) return -1;
+    uint32_t fill[PARTITIONS];
+    c->part_start[0] = 0;
+    for (int b = 0; b < PARTITIONS; b++) {
+        c->part_start[b + 1] = c->part_start[b] + part_counts[b];
+        fill[b] = c->part_start[b];
+    }
+    for (size_t i = 0; i < count; i++) {
+        c->by_partition[fill[c->words[i].hash >> (64 - PARTITION_BITS)]++] = (uint32_t)i;
+    }
+    return 0;
+}
+
+/**
+ * Mark the first occurrence of every word in one partition, walking the
+ * chunks in input order
+ * @return 0 on success, -1 on allocation failure
+ */
+static int dedup_partition(BuildState *st, int part) {
+    size_t n = 0;
+    for (size_t k = 0; k < st->chunk_count; k++) {
+        n += st->chunks[k].part_start[part + 1] - st->chunks[k].part_start[part];
+    }
+    if (n == 0) return 0;
+
+    size_t cap = 16;
+    while (cap < n * 2) cap *= 2;
+    DedupSlot *table = malloc(cap * sizeof(DedupSlot));
+    if (!table) return -1;
+    for (size_t s = 0; s < cap; s++) table[s].chunk = UINT32_MAX;
+
+    for (size_t k = 0; k < st->chunk_count; k++) {
+        Chunk *c = &st->chunks[k];
+        for (uint32_t j = c->part_start[part]; j < c->part_start[part + 1]; j++) {
+            uint32_t idx = c->by_partition[j];
+            const WordEntry *w = &c->words[idx];
+            const char *text = &c->text[w->offset];
+            size_t s = (size_t)w->hash & (cap - 1);
+            bool seen = false;
+            for (; table[s].chunk != UINT32_MAX; s = (s + 1) & (cap - 1)) {
+                if (table[s].hash != w->hash) continue;
+                const Chunk *oc = &st->chunks[table[s].chunk];
+                const WordEntry *o = &oc->words[table[s].word];
+                if (o->len == w->len && memcmp(&oc->text[o->offset], text, w->len) == 0) {
+                    seen = true;
+                    break;
+                }
+            }
+            if (!seen) {
+                table[s].hash = w->hash;
+                table[s].chunk = (uint32_t)k;
+                table[s].word = idx;
+                c->keep[idx] = 1;
+            }
+        }
+    }
+    free(table);
+    return 0;
+}
+
+/**
+ * Count a chunk's surviving words and bytes per length bucket
+ */
+static void count_chunk(Chunk *c) {
+    c->kept = 0;
+    c->kept_bytes = 0;
+    memset(c->length_counts, 0, sizeof(c->length_counts));
+    for (size_t i = 0; i < c->count; i++) {
+        if (!c->keep[i]) continue;
+        c->kept++;
+        c->kept_bytes += c->words[i].len;
+        c->length_counts[length_bucket(c->words[i].len)]++;
+    }
+}
+
+/**
+ * Copy a chunk's surviving words into the output tables
+ */
+static void emit_chunk(BuildState *st, Chunk *c) {
+    size_t index = c->first_word;
+    size_t byte = c->first_byte;
+    uint32_t fill[DICT_LENGTH_BUCKETS];
+    memcpy(fill, c->length_base, sizeof(fill));
+    for (size_t i = 0; i < c->count; i++) {
+        if (!c->keep[i]) continue;
+        const WordEntry *w = &c->words[i];
+        memcpy(&st->blob[byte], &c->text[w->offset], w->len);
+        st->offsets[index] = (uint32_t)byte;
+        st->by_length[fill[length_bucket(w->len)]++] = (uint32_t)index;
+        byte += w->len;
+        index++;
+    }
+}
+
+typedef enum { PHASE_SCAN, PHASE_DEDUP, PHASE_COUNT, PHASE_EMIT } BuildPhase;
+
+typedef struct {
+    BuildState *st;
+    BuildPhase phase;
+} WorkerArgs;
+
+static void *build_worker(void *arg) {
+    WorkerArgs *a = arg;
+    BuildState *st = a->st;
+    size_t limit = (a->phase == PHASE_DEDUP) ? PARTITIONS : st->chunk_count;
+
+    for (;;) {
+        size_t k = atomic_fetch_add(&st->next, 1);
+        if (k >= limit || atomic_load(&st->failed)) break;
+        int rc = 0;
+        switch (a->phase) {
+        case PHASE_SCAN:  rc = scan_chunk(&st->chunks[k]); break;
+        case PHASE_DEDUP: rc = dedup_partition(st, (int)k); break;
+        case PHASE_COUNT: count_chunk(&st->chunks[k]); break;
+        case PHASE_EMIT:  emit_chunk(st, &st->chunks[k]); break;
+        }
+        if (rc != 0) atomic_store(&st->failed, 1);
+    }
+    return NULL;
+}
+
+/**
+ * Run one phase across the worker threads
+ * @return 0 on success, -1 on failure
+ */
+static int run_phase(BuildState *st, BuildPhase phase, int threads) {
+    pthread_t tids[MAX_THREADS];
+    WorkerArgs args = {st, phase};
+    atomic_store(&st->next, 0);
+
+    int started = 0;
+    for (; started < threads; started++) {
+        if (pthread_create(&tids[started], NULL, build_worker, &args) != 0) break;
+    }
+    if (started == 0) build_worker(&args);
+    for (int t = 0; t < started; t++) {
+        pthread_join(tids[t], NULL);
+    }
+    return atomic_load(&st->failed) ? -1 : 0;
+}
+
+/**
+ * Map an input file and append its line-aligned chunks
+ * @return 0 on success, -1 on failure
+ */
+static int add_input(const char *path, Chunk **chunks, size_t *count, size_t *cap) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return -1;
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return -1;
+    }
+    size_t size = (size_t)st.st_size;
+    if (size == 0) {
+        close(fd);
+        return 0;
+    }
+    const char *data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) return -1;
+    madvise((void *)(uintptr_t)data, size, MADV_SEQUENTIAL);
+
+    /* The mapping stays until exit; chunk text points into it */
+    size_t pos = 0;
+    while (pos < size) {
+        size_t end = (size - pos > CHUNK_BYTES) ? pos + CHUNK_BYTES : size;
+        const char *nl = (end < size) ? memchr(&data[end], '\n', size - end) : NULL;
+        if (end < size) end = nl ? (size_t)(nl - data) + 1 : size;
+        if (end - pos >= UINT32_MAX) return -1;
+
+        if (*count == *cap) {
+            size_t new_cap = (*cap == 0) ? 64 : *cap * 2;
+            Chunk *grown = realloc(*chunks, new_cap * sizeof(Chunk));
+            if (!grown) return -1;
+            *chunks = grown;
+            *cap = new_cap;
+        }
+        Chunk *c = &(*chunks)[(*count)++];
+        memset(c, 0, sizeof(*c));
+        c->src = &data[pos];
+        c->src_len = end - pos;
+        pos = end;
+    }
+    return 0;
+}
+
+static void print_usage(void) {
+    fprintf(stderr, "Usage: meowdict_build [--threads N] [--plain] <output.meowdict> <wordlist.txt>...\n");
+}
+
+int main(int argc, char *argv[]) {
+    int threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    bool front_code = true;
+    int arg = 1;
+    for (; arg < argc; arg++) {
+        if (arg + 1 < argc && strcmp(argv[arg], "--threads") == 0) {
+            threads = atoi(argv[++arg]);
+        } else if (strcmp(argv[arg], "--plain") == 0) {
+            front_code = false;
+        } else {
+            break;
+        }
+    }
+    if (threads < 1) threads = 1;
+    if (threads > MAX_THREADS) threads = MAX_THREADS;
+    if (argc - arg < 2) {
+        print_usage();
+        return 1;
+    }
+    const char *output = argv[arg++];
+
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    BuildState st;
+    memset(&st, 0, sizeof(st));
+    size_t cap = 0;
+    for (; arg < argc; arg++) {
+        if (add_input(argv[arg], &st.chunks, &st.chunk_count, &cap) != 0) {
+            fprintf(stderr, "meowdict_build: cannot read %s\n", argv[arg]);
+            return 1;
+        }
+    }
+
+    if (run_phase(&st, PHASE_SCAN, threads) != 0 ||
+        run_phase(&st, PHASE_DEDUP, threads) != 0 ||
+        run_phase(&st, PHASE_COUNT, threads) != 0) {
+        fprintf(stderr, "meowdict_build: out of memory\n");
+        return 1;
+    }
+
+    /* Place each chunk's words; length buckets keep input order */
+    size_t words = 0, bytes = 0, lines = 0;
+    uint32_t bucket_totals[DICT_LENGTH_BUCKETS] = {0};
+    for (size_t k = 0; k < st.chunk_count; k++) {
+        Chunk *c = &st.chunks[k];
+        c->first_word = words;
+        c->first_byte = bytes;
+        words += c->kept;
+        bytes += c->kept_bytes;
+        lines += c->count;
+        for (int b = 0; b < DICT_LENGTH_BUCKETS; b++) {
+            c->length_base[b] = bucket_totals[b];
+            bucket_totals[b] += c->length_counts[b];
+        }
+    }
+    if (words >= UINT32_MAX || bytes > UINT32_MAX) {
+        fprintf(stderr, "meowdict_build: dictionary too large (%zu words, %zu bytes)\n", words, bytes);
+        return 1;
+    }
+    st.length_start[0] = 0;
+    for (int b = 0; b < DICT_LENGTH_BUCKETS; b++) {
+        st.length_start[b + 1] = st.length_start[b] + bucket_totals[b];
+    }
+    for (size_t k = 0; k < st.chunk_count; k++) {
+        for (int b = 0; b < DICT_LENGTH_BUCKETS; b++) {
+            st.chunks[k].length_base[b] += st.length_start[b];
+        }
+    }
+
+    st.blob = malloc(bytes + 1);
+    st.offsets = malloc((words + 1) * sizeof(uint32_t));
+    st.by_length = malloc((words + 1) * sizeof(uint32_t));
+    if (!st.blob || !st.offsets || !st.by_length) {
+        fprintf(stderr, "meowdict_build: out of memory\n");
+        return 1;
+    }
+    run_phase(&st, PHASE_EMIT, threads);
+    st.offsets[words] = (uint32_t)bytes;
+
+    Dictionary dict = {st.blob, bytes, st.offsets, st.length_start, st.by_length, words, 0, NULL, 0, NULL};
+    Dictionary coded;
+    if (front_code) {
+        if (dictionary_front_code(&dict, &coded) != 0) {
+            fprintf(stderr, "meowdict_build: out of memory\n");
+            return 1;
+        }
+        dict = coded;
+    }
+    if (dictionary_save(&dict, output) != 0) {
+        fprintf(stderr, "meowdict_build: cannot write %s\n", output);
+        return 1;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double elapsed = (double)(end.tv_sec - start.tv_sec) + (double)(end.tv_nsec - start.tv_nsec) / 1e9;
+    fprintf(stderr, "Wrote %zu words (%zu duplicates dropped, %zu name bytes%s) to %s in %.2f s "
+            "(%d thread%s)\n", words, lines - words, dict.blob_size,
+            front_code ? " front-coded" : "", output, elapsed, threads, threads == 1 ? "" : "s");
+    return 0;
+}